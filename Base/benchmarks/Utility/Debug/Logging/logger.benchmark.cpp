@@ -0,0 +1,491 @@
+/*! @file logger.benchmark.cpp
+	@brief Google Benchmark comparison of the compile-time, runtime and binary deferred-formatting paths of the static Logger, the
+   multi-threaded throughput of every Logger mode, and per-call latency by level, argument count and thread count.
+	@details Each benchmark initializes a Logger that writes to `/dev/null`, so the measurement covers argument forwarding, formatting (or
+   encoding) and the sink call without real disk I/O. Mapped mode needs a regular file, so it writes to a scratch file that is deleted
+   afterwards; its records only reach the page cache inside the timed loop. The argument values are fixed so every iteration logs the same record. The
+   throughput benchmarks report messages per second summed over all logging threads, so contention shows up as a curve that flattens or
+   falls as threads are added. The latency benchmarks are timed by Google Benchmark over many calls per run and repeated a few times,
+   so they report the mean per-call time and its spread between runs, not tail percentiles of single calls. Each run sets the Logger up
+   once, outside the timed loop. The repeat benchmark writes a scratch file so it can report the bytes each call adds to it.
+	@date --/--/----
+	@version x.x.x
+	@since x.x.x
+	@author Matthew Moore
+*/
+
+#include <benchmark/benchmark.h>
+
+#include "Utility/Debug/Logging/logger.h"
+#include "Utility/Debug/Logging/loggerOptions.h"
+#include "Utility/Debug/Logging/tscClock.h"
+
+#include <algorithm>
+#include <filesystem>
+#include <memory>
+#include <optional>
+#include <string>
+#include <string_view>
+
+#include <spdlog/spdlog.h>
+
+namespace Logging = Project::Utility::Debug::Logging;
+
+using Logging::Logger;
+
+namespace
+{
+	/*! @brief The sink path used by every Logger benchmark; discards output so disk speed does not skew results. */
+	constexpr std::string_view BENCHMARK_LOG_FILE{"/dev/null"};
+
+	/*! @brief The scratch file used by mapped-mode benchmarks, which cannot map `/dev/null`. */
+	constexpr std::string_view BENCHMARK_MAPPED_LOG_FILE{"benchmark_mapped.log"};
+
+	/*! @brief The scratch file used by durable-logging benchmarks, since syncing `/dev/null` costs nothing. */
+	constexpr std::string_view BENCHMARK_DURABLE_LOG_FILE{"benchmark_durable.log"};
+
+	/*! @brief The scratch file used by the repeat-collapsing benchmark, which measures how many bytes reach the file. */
+	constexpr std::string_view BENCHMARK_REPEAT_LOG_FILE{"benchmark_repeat.log"};
+
+	/*! @brief The registry name used by every Logger benchmark. */
+	constexpr std::string_view BENCHMARK_LOGGER_NAME{"benchmark_logger"};
+
+	/*! @brief Initializes the Logger for a benchmark run, marking the run as skipped if that fails.
+		@param[in,out] state The benchmark state to report failures on.
+		@param[in] options The Logger options to benchmark; synchronous by default.
+		@return true if the Logger is ready.
+	*/
+	bool initializeBenchmarkLogger(benchmark::State &state, // NOLINT(llvm-prefer-static-over-anonymous-namespace)
+								   const Logging::LoggerOptions &options = {})
+	{
+		spdlog::drop_all();
+
+		const std::string_view fileName{options.mode == Logging::LoggerMode::Mapped ? BENCHMARK_MAPPED_LOG_FILE : BENCHMARK_LOG_FILE};
+
+		if (!Logger::initialize(BENCHMARK_LOGGER_NAME, fileName, options))
+		{
+			state.SkipWithError("Logger::initialize failed");
+			return false;
+		}
+
+		return true;
+	}
+
+	/*! @brief How many runs each latency benchmark repeats, so the spread between runs is reported next to the mean per-call time. */
+	constexpr int LATENCY_REPETITIONS{10};
+
+	/*! @brief Registers a latency benchmark as @ref LATENCY_REPETITIONS runs timed by Google Benchmark, reporting only the aggregates:
+	   the mean, median, standard deviation and coefficient of variation of the runs' per-call times.
+		@param[in,out] benchmark The benchmark to configure.
+	*/
+	void latencyRepetitions(benchmark::internal::Benchmark *benchmark) // NOLINT(llvm-prefer-static-over-anonymous-namespace)
+	{
+		benchmark->Repetitions(LATENCY_REPETITIONS)->ReportAggregatesOnly(true);
+	}
+
+	/*! @brief Runs @p call once per iteration for a benchmark registered through @ref latencyRepetitions.
+		@tparam Call A callable whose result is passed to benchmark::DoNotOptimize.
+		@param[in,out] state The benchmark state.
+		@param[in] call The operation to measure.
+	*/
+	template <typename Call>
+	void measureLatency(benchmark::State &state, Call &&call) // NOLINT(llvm-prefer-static-over-anonymous-namespace)
+	{
+		for (auto _ : state)
+		{
+			auto result{call()};
+			benchmark::DoNotOptimize(result);
+		}
+
+		state.SetItemsProcessed(state.iterations());
+	}
+
+	/*! @brief Restores the synchronous Logger at the default level after a benchmark that changed either. */
+	void restoreBenchmarkLogger() // NOLINT(llvm-prefer-static-over-anonymous-namespace)
+	{
+		spdlog::drop_all();
+		static_cast<void>(Logger::initialize(BENCHMARK_LOGGER_NAME, BENCHMARK_LOG_FILE));
+	}
+} // namespace
+
+// NOLINTBEGIN(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
+
+/*! @brief Measures Logger::info with a literal format validated at compile time via fmt::format_string. */
+static void BM_Logger_InfoCompileTimeFormat(benchmark::State &state)
+{
+	if (!initializeBenchmarkLogger(state))
+	{
+		return;
+	}
+
+	const int requestId{42};
+	const std::string_view path{"/api/v1/items"};
+	const double latency{12.5};
+
+	for (auto _ : state)
+	{
+		std::optional<std::string_view> result{Logger::info("request {} path {} took {}ms", requestId, path, latency)};
+		benchmark::DoNotOptimize(result);
+	}
+}
+
+BENCHMARK(BM_Logger_InfoCompileTimeFormat);
+
+/*! @brief Measures Logger::info with the same format passed as a std::string_view, which is validated on every call via fmt::runtime. */
+static void BM_Logger_InfoRuntimeFormat(benchmark::State &state)
+{
+	if (!initializeBenchmarkLogger(state))
+	{
+		return;
+	}
+
+	const std::string_view format{"request {} path {} took {}ms"};
+	const int requestId{42};
+	const std::string_view path{"/api/v1/items"};
+	const double latency{12.5};
+
+	for (auto _ : state)
+	{
+		benchmark::DoNotOptimize(format);
+		std::optional<std::string_view> result{Logger::info(format, requestId, path, latency)};
+		benchmark::DoNotOptimize(result);
+	}
+}
+
+BENCHMARK(BM_Logger_InfoRuntimeFormat);
+
+/*! @brief Measures Logger::info in binary mode, where the call only copies the format id and raw arguments into a per-thread buffer. */
+static void BM_Logger_InfoBinary(benchmark::State &state)
+{
+	if (!initializeBenchmarkLogger(state, Logging::LoggerOptions{.mode = Logging::LoggerMode::Binary}))
+	{
+		return;
+	}
+
+	const int requestId{42};
+	const std::string_view path{"/api/v1/items"};
+	const double latency{12.5};
+
+	for (auto _ : state)
+	{
+		std::optional<std::string_view> result{Logger::info("request {} path {} took {}ms", requestId, path, latency)};
+		benchmark::DoNotOptimize(result);
+	}
+
+	// Tear the sink down outside the timed region so its final drain is not attributed to the next benchmark
+	spdlog::drop_all();
+	static_cast<void>(Logger::initialize(BENCHMARK_LOGGER_NAME, BENCHMARK_LOG_FILE));
+}
+
+BENCHMARK(BM_Logger_InfoBinary);
+
+/*! @brief Measures a structured Logger::info call encoded as JSON Lines, where each field is written straight into a per-thread buffer. */
+static void BM_Logger_InfoStructuredJson(benchmark::State &state)
+{
+	if (!initializeBenchmarkLogger(state, Logging::LoggerOptions{.recordFormat = Logging::RecordFormat::JsonLines}))
+	{
+		return;
+	}
+
+	const int requestId{42};
+	const std::string_view path{"/api/v1/items"};
+	const double latency{12.5};
+
+	for (auto _ : state)
+	{
+		std::optional<std::string_view> result{
+			Logger::info("request done", Logging::kv("request_id", requestId), Logging::kv("path", path), Logging::kv("latency_ms", latency))};
+		benchmark::DoNotOptimize(result);
+	}
+}
+
+BENCHMARK(BM_Logger_InfoStructuredJson);
+
+/*! @brief Measures the same structured call stamped by the TSC clock, where neither the clock read nor the timestamp text calls into libc
+   more than once a second. */
+static void BM_Logger_InfoStructuredJsonTsc(benchmark::State &state)
+{
+	if (!initializeBenchmarkLogger(state, Logging::LoggerOptions{.recordFormat = Logging::RecordFormat::JsonLines,
+																 .clock = Logging::ClockSource::Tsc}))
+	{
+		return;
+	}
+
+	const int requestId{42};
+	const std::string_view path{"/api/v1/items"};
+	const double latency{12.5};
+
+	for (auto _ : state)
+	{
+		std::optional<std::string_view> result{
+			Logger::info("request done", Logging::kv("request_id", requestId), Logging::kv("path", path), Logging::kv("latency_ms", latency))};
+		benchmark::DoNotOptimize(result);
+	}
+}
+
+BENCHMARK(BM_Logger_InfoStructuredJsonTsc);
+
+/*! @brief Measures one timestamp read from @p source, the cost every record pays before it is formatted. */
+static void BM_Logger_ClockNow(benchmark::State &state, const Logging::ClockSource source)
+{
+	if (source == Logging::ClockSource::Tsc && !Logging::TscClock::available())
+	{
+		state.SetLabel("no invariant TSC; system clock fallback");
+	}
+
+	for (auto _ : state)
+	{
+		benchmark::DoNotOptimize(Logging::TscClock::now(source));
+	}
+}
+
+BENCHMARK_CAPTURE(BM_Logger_ClockNow, System, Logging::ClockSource::System);
+BENCHMARK_CAPTURE(BM_Logger_ClockNow, Tsc, Logging::ClockSource::Tsc);
+
+/*! @brief Measures the combined rate at which several threads can log through Logger in @p mode.
+	@details Thread 0 initializes the Logger before the timed loop and restores the synchronous Logger after it; Google Benchmark holds every
+   thread at a barrier on entry to and exit from the loop, so no thread logs through a half-built or torn-down Logger. The blocking
+   overflow policy makes the asynchronous modes report sustained throughput rather than the rate at which their buffers fill.
+	@param[in,out] state The benchmark state.
+	@param[in] mode The Logger mode to measure.
+*/
+static void BM_Logger_InfoThroughput(benchmark::State &state, const Logging::LoggerMode mode)
+{
+	if (state.thread_index() == 0 &&
+		!initializeBenchmarkLogger(state, Logging::LoggerOptions{.mode = mode, .overflowPolicy = Logging::OverflowPolicy::Block}))
+	{
+		return;
+	}
+
+	const int requestId{42};
+	const std::string_view path{"/api/v1/items"};
+	const double latency{12.5};
+
+	for (auto _ : state)
+	{
+		std::optional<std::string_view> result{Logger::info("request {} path {} took {}ms", requestId, path, latency)};
+		benchmark::DoNotOptimize(result);
+	}
+
+	state.SetItemsProcessed(state.iterations());
+
+	if (state.thread_index() == 0)
+	{
+		spdlog::drop_all();
+		static_cast<void>(Logger::initialize(BENCHMARK_LOGGER_NAME, BENCHMARK_LOG_FILE));
+		std::filesystem::remove(BENCHMARK_MAPPED_LOG_FILE);
+	}
+}
+
+BENCHMARK_CAPTURE(BM_Logger_InfoThroughput, Synchronous, Logging::LoggerMode::Synchronous)->ThreadRange(1, 16)->UseRealTime();
+BENCHMARK_CAPTURE(BM_Logger_InfoThroughput, Asynchronous, Logging::LoggerMode::Asynchronous)->ThreadRange(1, 16)->UseRealTime();
+BENCHMARK_CAPTURE(BM_Logger_InfoThroughput, PerThread, Logging::LoggerMode::PerThread)->ThreadRange(1, 16)->UseRealTime();
+BENCHMARK_CAPTURE(BM_Logger_InfoThroughput, Binary, Logging::LoggerMode::Binary)->ThreadRange(1, 16)->UseRealTime();
+BENCHMARK_CAPTURE(BM_Logger_InfoThroughput, Mapped, Logging::LoggerMode::Mapped)->ThreadRange(1, 16)->UseRealTime();
+BENCHMARK_CAPTURE(BM_Logger_InfoThroughput, Uring, Logging::LoggerMode::Uring)->ThreadRange(1, 16)->UseRealTime();
+
+/*! @brief Measures the latency of one enabled call at @p level, with the Logger lowered to trace so every level is written.
+	@param[in,out] state The benchmark state.
+	@param[in] level The level logged at.
+*/
+static void BM_Logger_LevelLatency(benchmark::State &state, const spdlog::level::level_enum level)
+{
+	if (!initializeBenchmarkLogger(state))
+	{
+		return;
+	}
+
+	Logger::setLevel(spdlog::level::trace);
+
+	const int requestId{42};
+	const std::string_view path{"/api/v1/items"};
+	const double latency{12.5};
+
+	measureLatency(state, [level, requestId, path, latency] { return Logger::log(level, "request {} path {} took {}ms", requestId, path, latency); });
+
+	restoreBenchmarkLogger();
+}
+
+BENCHMARK_CAPTURE(BM_Logger_LevelLatency, Trace, spdlog::level::trace)->Apply(latencyRepetitions);
+BENCHMARK_CAPTURE(BM_Logger_LevelLatency, Debug, spdlog::level::debug)->Apply(latencyRepetitions);
+BENCHMARK_CAPTURE(BM_Logger_LevelLatency, Info, spdlog::level::info)->Apply(latencyRepetitions);
+BENCHMARK_CAPTURE(BM_Logger_LevelLatency, Warn, spdlog::level::warn)->Apply(latencyRepetitions);
+BENCHMARK_CAPTURE(BM_Logger_LevelLatency, Error, spdlog::level::err)->Apply(latencyRepetitions);
+BENCHMARK_CAPTURE(BM_Logger_LevelLatency, Critical, spdlog::level::critical)->Apply(latencyRepetitions);
+
+/*! @brief Measures the latency of a call at @p level below the Logger's info level, which must return before formatting anything.
+	@param[in,out] state The benchmark state.
+	@param[in] level The disabled level logged at.
+*/
+static void BM_Logger_DisabledLevelLatency(benchmark::State &state, const spdlog::level::level_enum level)
+{
+	if (!initializeBenchmarkLogger(state))
+	{
+		return;
+	}
+
+	Logger::setLevel(spdlog::level::info);
+
+	const int requestId{42};
+	const std::string_view path{"/api/v1/items"};
+	const double latency{12.5};
+
+	measureLatency(state, [level, requestId, path, latency] { return Logger::log(level, "request {} path {} took {}ms", requestId, path, latency); });
+}
+
+BENCHMARK_CAPTURE(BM_Logger_DisabledLevelLatency, Trace, spdlog::level::trace)->Apply(latencyRepetitions);
+BENCHMARK_CAPTURE(BM_Logger_DisabledLevelLatency, Debug, spdlog::level::debug)->Apply(latencyRepetitions);
+
+/*! @brief Measures the latency of Logger::info with `state.range(0)` integer arguments, showing what each formatted argument adds. */
+static void BM_Logger_ArgumentCountLatency(benchmark::State &state)
+{
+	if (!initializeBenchmarkLogger(state))
+	{
+		return;
+	}
+
+	const int value{42};
+
+	switch (state.range(0))
+	{
+		case 0:
+			// Spelled out because a bare literal with no arguments selects the structured overload
+			measureLatency(state, [] { return Logger::info(fmt::format_string<>{"request done"}); });
+			break;
+		case 1:
+			measureLatency(state, [value] { return Logger::info("request {}", value); });
+			break;
+		case 2:
+			measureLatency(state, [value] { return Logger::info("request {} {}", value, value); });
+			break;
+		case 4:
+			measureLatency(state, [value] { return Logger::info("request {} {} {} {}", value, value, value, value); });
+			break;
+		case 8:
+		default:
+			measureLatency(state, [value] { return Logger::info("request {} {} {} {} {} {} {} {}", value, value, value, value, value, value, value, value); });
+			break;
+	}
+}
+
+BENCHMARK(BM_Logger_ArgumentCountLatency)->Arg(0)->Arg(1)->Arg(2)->Arg(4)->Arg(8)->Apply(latencyRepetitions);
+
+/*! @brief Measures per-call latency of Logger::info in @p mode while several threads log at once.
+	@details Set up and torn down by thread 0 around the timed loop, as in @ref BM_Logger_InfoThroughput. The percentiles show how
+   contention for the synchronous sink's mutex, or for a full asynchronous queue, raises the mean cost of a call. The time is wall time,
+   as in the throughput benchmarks, divided by the calls of every thread: the inverse of the combined call rate. A thread spends the
+   reported time multiplied by the thread count in each of its calls.
+	@param[in,out] state The benchmark state.
+	@param[in] mode The Logger mode to measure.
+*/
+static void BM_Logger_InfoLatency(benchmark::State &state, const Logging::LoggerMode mode)
+{
+	if (state.thread_index() == 0 &&
+		!initializeBenchmarkLogger(state, Logging::LoggerOptions{.mode = mode, .overflowPolicy = Logging::OverflowPolicy::Block}))
+	{
+		return;
+	}
+
+	const int requestId{42};
+	const std::string_view path{"/api/v1/items"};
+	const double latency{12.5};
+
+	measureLatency(state, [requestId, path, latency] { return Logger::info("request {} path {} took {}ms", requestId, path, latency); });
+
+	if (state.thread_index() == 0)
+	{
+		restoreBenchmarkLogger();
+	}
+}
+
+BENCHMARK_CAPTURE(BM_Logger_InfoLatency, Synchronous, Logging::LoggerMode::Synchronous)->ThreadRange(1, 16)->UseRealTime()->Apply(latencyRepetitions);
+BENCHMARK_CAPTURE(BM_Logger_InfoLatency, Asynchronous, Logging::LoggerMode::Asynchronous)->ThreadRange(1, 16)->UseRealTime()->Apply(latencyRepetitions);
+
+/*! @brief Measures the combined rate of durable error records, each synced to a real file before its call returns, as threads are added.
+	@details Thread 0 sets the Logger up and tears it down around the timed loop, as in @ref BM_Logger_InfoThroughput. With a group
+   commit, threads that log while a sync is running share the next one, so the rate should rise with the thread count instead of staying
+   pinned at one record per fdatasync.
+	@param[in,out] state The benchmark state.
+*/
+static void BM_Logger_DurableErrorThroughput(benchmark::State &state)
+{
+	if (state.thread_index() == 0)
+	{
+		spdlog::drop_all();
+
+		if (!Logger::initialize(BENCHMARK_LOGGER_NAME, BENCHMARK_DURABLE_LOG_FILE,
+								Logging::LoggerOptions{.truncateFile = true, .durability = Logging::DurabilityOptions{.level = spdlog::level::err}}))
+		{
+			state.SkipWithError("Logger::initialize failed");
+			return;
+		}
+	}
+
+	const int requestId{42};
+
+	for (auto _ : state)
+	{
+		std::optional<std::string_view> result{Logger::error("request {} failed", requestId)};
+		benchmark::DoNotOptimize(result);
+	}
+
+	state.SetItemsProcessed(state.iterations());
+
+	if (state.thread_index() == 0)
+	{
+		restoreBenchmarkLogger();
+		std::filesystem::remove(BENCHMARK_DURABLE_LOG_FILE);
+	}
+}
+
+BENCHMARK(BM_Logger_DurableErrorThroughput)->ThreadRange(1, 16)->UseRealTime();
+
+/*! @brief Measures Logger::info and the bytes it writes per call with and without repeat collapsing, for a record that repeats every
+   call and for one whose argument changes every call.
+	@details Writes to a scratch file and reports its size divided by the number of calls as the `bytes_per_call` counter. A repeating
+   record with deduplication on should cost one format and one hash per call and write almost nothing; a changing one shows what
+   deduplication adds to records it cannot collapse.
+	@param[in,out] state The benchmark state.
+	@param[in] deduplicate Whether repeats are collapsed.
+	@param[in] repeating Whether every call logs the same record.
+*/
+static void BM_Logger_RepeatedInfo(benchmark::State &state, const bool deduplicate, const bool repeating)
+{
+	spdlog::drop_all();
+
+	if (!Logger::initialize(BENCHMARK_LOGGER_NAME, BENCHMARK_REPEAT_LOG_FILE, Logging::LoggerOptions{.truncateFile = true}))
+	{
+		state.SkipWithError("Logger::initialize failed");
+		return;
+	}
+
+	Logger::setDeduplication(deduplicate);
+	int requestId{42};
+
+	for (auto _ : state)
+	{
+		std::optional<std::string_view> result{Logger::info("request {} done", requestId)};
+		benchmark::DoNotOptimize(result);
+
+		if (!repeating)
+		{
+			++requestId;
+		}
+	}
+
+	Logger::setDeduplication(false);
+	spdlog::apply_all([](const std::shared_ptr<spdlog::logger> &logger) { logger->flush(); });
+	state.SetItemsProcessed(state.iterations());
+	state.counters["bytes_per_call"] = benchmark::Counter(static_cast<double>(std::filesystem::file_size(BENCHMARK_REPEAT_LOG_FILE)) /
+														  static_cast<double>(std::max<benchmark::IterationCount>(state.iterations(), 1)));
+
+	restoreBenchmarkLogger();
+	std::filesystem::remove(BENCHMARK_REPEAT_LOG_FILE);
+}
+
+BENCHMARK_CAPTURE(BM_Logger_RepeatedInfo, RepeatingOff, false, true);
+BENCHMARK_CAPTURE(BM_Logger_RepeatedInfo, RepeatingOn, true, true);
+BENCHMARK_CAPTURE(BM_Logger_RepeatedInfo, ChangingOff, false, false);
+BENCHMARK_CAPTURE(BM_Logger_RepeatedInfo, ChangingOn, true, false);
+
+// NOLINTEND(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
@@ -0,0 +1,154 @@
+/*! @file metrics.benchmark.cpp
+	@brief Google Benchmark comparison of the sharded metrics against a single shared atomic and against counting by logging a line.
+	@details The multi-threaded benchmarks report updates per second summed over all threads, so a curve that flattens as threads are added
+   shows cache-line contention. The logged counter writes to `/dev/null`, so it measures formatting and the sink call without disk I/O.
+	@date --/--/----
+	@version x.x.x
+	@since x.x.x
+	@author Matthew Moore
+*/
+
+#include <benchmark/benchmark.h>
+
+#include "Core/typedefs.h"
+#include "Utility/Debug/Logging/logger.h"
+#include "Utility/Debug/Metrics/counter.h"
+#include "Utility/Debug/Metrics/histogram.h"
+#include "Utility/Debug/Metrics/metricsExporter.h"
+#include "Utility/Debug/Metrics/registry.h"
+
+#include <atomic>
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <string_view>
+
+#include <spdlog/common.h>
+#include <spdlog/spdlog.h>
+
+namespace Logging = Project::Utility::Debug::Logging;
+namespace Metrics = Project::Utility::Debug::Metrics;
+
+namespace
+{
+	/*! @brief The sink path used by the logged counter; discards output so disk speed does not skew results. */
+	constexpr std::string_view BENCHMARK_LOG_FILE{"/dev/null"};
+
+	/*! @brief The registry name used by the logged counter. */
+	constexpr std::string_view BENCHMARK_LOGGER_NAME{"benchmark_metrics_logger"};
+
+	/*! @brief A counter every thread increments, which is what the sharded counter avoids. */
+	std::atomic<Project::Core::ul> sharedCounter{0}; // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
+} // namespace
+
+/*! @brief Measures a sharded counter increment from every thread.
+	@param[in,out] state The benchmark state.
+*/
+static void BM_Metrics_CounterAdd(benchmark::State &state)
+{
+	Metrics::Counter &counter{Metrics::Registry::global().counter("benchmark_counter_total")};
+
+	for (auto _ : state)
+	{
+		counter.add();
+	}
+
+	state.SetItemsProcessed(state.iterations());
+}
+
+BENCHMARK(BM_Metrics_CounterAdd)->ThreadRange(1, 16)->UseRealTime();
+
+/*! @brief Measures a relaxed increment of one atomic shared by every thread, for comparison with the sharded counter.
+	@param[in,out] state The benchmark state.
+*/
+static void BM_Metrics_SharedAtomicAdd(benchmark::State &state)
+{
+	for (auto _ : state)
+	{
+		sharedCounter.fetch_add(1, std::memory_order_relaxed);
+	}
+
+	state.SetItemsProcessed(state.iterations());
+}
+
+BENCHMARK(BM_Metrics_SharedAtomicAdd)->ThreadRange(1, 16)->UseRealTime();
+
+/*! @brief Measures recording a value in a sharded histogram from every thread.
+	@param[in,out] state The benchmark state.
+*/
+static void BM_Metrics_HistogramRecord(benchmark::State &state)
+{
+	Metrics::Histogram &histogram{Metrics::Registry::global().histogram("benchmark_latency_ns")};
+	Project::Core::ul value{0};
+
+	for (auto _ : state)
+	{
+		histogram.record(value);
+		value = (value + 97) & 0xFFFF;
+	}
+
+	state.SetItemsProcessed(state.iterations());
+}
+
+BENCHMARK(BM_Metrics_HistogramRecord)->ThreadRange(1, 16)->UseRealTime();
+
+/*! @brief Measures counting an event by logging a line for it, the approach the metrics replace.
+	@param[in,out] state The benchmark state.
+*/
+static void BM_Metrics_LoggedCounter(benchmark::State &state)
+{
+	spdlog::drop_all();
+
+	if (!Logging::Logger::initialize(BENCHMARK_LOGGER_NAME, BENCHMARK_LOG_FILE))
+	{
+		state.SkipWithError("Logger::initialize failed");
+		return;
+	}
+
+	for (auto _ : state)
+	{
+		std::optional<std::string_view> result{Logging::Logger::info("counter {} incremented by {}", "benchmark_counter_total", 1)};
+		benchmark::DoNotOptimize(result);
+	}
+
+	state.SetItemsProcessed(state.iterations());
+	spdlog::drop_all();
+}
+
+BENCHMARK(BM_Metrics_LoggedCounter);
+
+/*! @brief Measures rendering a Prometheus snapshot of a registry holding a few hundred metrics.
+	@param[in,out] state The benchmark state.
+*/
+static void BM_Metrics_RenderPrometheus(benchmark::State &state)
+{
+	Metrics::Registry registry{};
+
+	for (int i{0}; i < 200; ++i)
+	{
+		registry.counter("counter_" + std::to_string(i) + "_total").add(static_cast<Project::Core::ul>(i));
+	}
+
+	for (int i{0}; i < 20; ++i)
+	{
+		Metrics::Histogram &histogram{registry.histogram("histogram_" + std::to_string(i))};
+
+		for (Project::Core::ul value{1}; value < 1'000'000; value *= 3)
+		{
+			histogram.record(value);
+		}
+	}
+
+	spdlog::memory_buf_t buffer{};
+
+	for (auto _ : state)
+	{
+		buffer.clear();
+		Metrics::MetricsExporter::renderPrometheus(registry.snapshot(), buffer);
+		benchmark::DoNotOptimize(buffer.data());
+	}
+
+	state.SetBytesProcessed(state.iterations() * static_cast<std::int64_t>(buffer.size()));
+}
+
+BENCHMARK(BM_Metrics_RenderPrometheus);
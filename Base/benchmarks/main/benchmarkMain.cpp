@@ -0,0 +1,11 @@
+/*! @file benchmarkMain.cpp
+	@brief C++ file for running all benchmarks.
+	@date --/--/----
+	@version x.x.x
+	@since x.x.x
+	@author Matthew Moore
+*/
+
+#include <benchmark/benchmark.h>
+
+BENCHMARK_MAIN();
@@ -0,0 +1,20 @@
+/*! @file hardware.h
+	@brief Contains constants describing the hardware the project assumes it runs on.
+	@date --/--/----
+	@version x.x.x
+	@since x.x.x
+	@author Matthew Moore
+*/
+
+#ifndef INCLUDE_CORE_HARDWARE_H
+#define INCLUDE_CORE_HARDWARE_H
+
+#include <cstddef>
+
+namespace Project::Core
+{
+	/*! @brief The assumed size of a cache line; data written by different threads is aligned to it so they never false-share a line. */
+	inline constexpr std::size_t CACHE_LINE_SIZE{64};
+} // namespace Project::Core
+
+#endif
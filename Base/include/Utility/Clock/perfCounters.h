@@ -0,0 +1,179 @@
+/*! @file perfCounters.h
+	@brief Contains the declaration of a group of Linux hardware performance counters for the calling thread.
+	@date --/--/----
+	@version x.x.x
+	@since x.x.x
+	@author Matthew Moore
+*/
+
+#ifndef INCLUDE_UTILITY_CLOCK_PERFCOUNTERS_H
+#define INCLUDE_UTILITY_CLOCK_PERFCOUNTERS_H
+
+#include <array>
+#include <cstddef>
+#include <string>
+#include <string_view>
+
+#include "Core/attributeMacros.h"
+#include "Core/typedefs.h"
+
+namespace Project::Utility::Clock
+{
+	using Project::Core::ul;
+
+	/*! @class PerfCounters perfCounters.h "include/Utility/Clock/perfCounters.h"
+		@brief Counts CPU cycles, instructions, cache misses and branch misses for the calling thread through `perf_event_open`
+		@details The counters are opened as one group, so a single `read` returns all of them measured over the same interval, and only
+	   user-space work is counted, which `perf_event_paranoid` allows up to level 2. Opening fails when the kernel forbids it, the machine
+	   (often a virtual one) exposes no PMU, or the binary runs somewhere other than Linux; each event that cannot be opened is left out,
+	   and with none open every read returns zeros and @ref available is false, so callers can use the counters unconditionally. When
+	   the kernel multiplexes the group with other users of the PMU the values are scaled up by the share of time it was counting.
+		@date --/--/----
+		@version x.x.x
+		@since x.x.x
+		@author Matthew Moore
+	*/
+	class PerfCounters
+	{
+		public:
+			/*! @enum Event The hardware events counted; also the index of each in a @ref Reading
+				@date --/--/----
+				@version x.x.x
+				@since x.x.x
+				@author Matthew Moore
+			*/
+			enum class Event : Project::Core::ub
+			{
+				Cycles,
+				Instructions,
+				CacheMisses,
+				BranchMisses
+			};
+
+			static constexpr std::size_t EVENTS{4}; /*!< The number of events in @ref Event */
+
+			/*! @struct Reading perfCounters.h "include/Utility/Clock/perfCounters.h"
+				@brief The value of every counter at one moment, or the difference between two such moments
+				@date --/--/----
+				@version x.x.x
+				@since x.x.x
+				@author Matthew Moore
+			*/
+			struct Reading
+			{
+				std::array<ul, EVENTS> values{}; /*!< Indexed by @ref Event; zero for events that are not counted */
+
+				/*! @brief Gets the count of one event.
+					@param[in] event The event.
+					@retval ul Its count
+				*/
+				ATTR_NODISCARD constexpr ul operator[](const Event event) const noexcept
+				{
+					return values[static_cast<std::size_t>(event)];
+				}
+
+				/*! @brief Gets the counts accumulated since @p earlier.
+					@param[in] earlier A reading taken before this one.
+					@retval Reading The differences
+				*/
+				ATTR_NODISCARD constexpr Reading operator-(const Reading &earlier) const noexcept
+				{
+					Reading difference{};
+
+					for (std::size_t event{0}; event < EVENTS; ++event)
+					{
+						// Scaling a multiplexed count can make it step backwards slightly
+						difference.values[event] = values[event] >= earlier.values[event] ? values[event] - earlier.values[event] : 0;
+					}
+
+					return difference;
+				}
+			};
+
+			// MARK: Constructors & Destructor
+
+			/*! @brief Opens and starts the counters for the calling thread, leaving out any the kernel refuses
+				@post @ref available reports whether anything is being counted
+				@date --/--/----
+				@version x.x.x
+				@since x.x.x
+				@author Matthew Moore
+			*/
+			PerfCounters() noexcept;
+
+			// Do not allow copies or moves; the object owns the counters' file descriptors
+
+			PerfCounters(const PerfCounters &) = delete;
+			PerfCounters(PerfCounters &&) = delete;
+			PerfCounters &operator=(const PerfCounters &) = delete;
+			PerfCounters &operator=(PerfCounters &&) = delete;
+
+			/*! @brief Closes the counters
+				@date --/--/----
+				@version x.x.x
+				@since x.x.x
+				@author Matthew Moore
+			*/
+			~PerfCounters();
+
+			// MARK: Getters
+
+			/*! @brief Tests whether any event is being counted
+				@retval bool true if at least one counter opened
+				@date --/--/----
+				@version x.x.x
+				@since x.x.x
+				@author Matthew Moore
+			*/
+			ATTR_NODISCARD ATTR_PURE bool available() const noexcept;
+
+			/*! @brief Tests whether @p event is being counted
+				@param[in] event The event
+				@retval bool true if its counter opened
+				@date --/--/----
+				@version x.x.x
+				@since x.x.x
+				@author Matthew Moore
+			*/
+			ATTR_NODISCARD ATTR_PURE bool available(const Event event) const noexcept;
+
+			/*! @brief Gets why the first counter that failed to open was refused
+				@retval std::string The system error message, or empty when every counter opened
+				@throws std::bad_alloc If the message cannot be allocated
+				@date --/--/----
+				@version x.x.x
+				@since x.x.x
+				@author Matthew Moore
+			*/
+			ATTR_NODISCARD std::string unavailableReason() const;
+
+			// MARK: Utility
+
+			/*! @brief Reads every counter at once
+				@retval Reading The counts since the counters were opened; all zero if none are available or the read fails
+				@date --/--/----
+				@version x.x.x
+				@since x.x.x
+				@author Matthew Moore
+			*/
+			ATTR_NODISCARD Reading read() const noexcept;
+
+			/*! @brief Gets the display name of @p event
+				@param[in] event The event
+				@retval std::string_view Its name, such as "cache misses"
+				@date --/--/----
+				@version x.x.x
+				@since x.x.x
+				@author Matthew Moore
+			*/
+			ATTR_NODISCARD ATTR_CONST static std::string_view name(const Event event) noexcept;
+
+		private:
+			std::array<int, EVENTS> mFiles{-1, -1, -1, -1};	/*!< Each event's file descriptor; -1 when it is not counted */
+			std::array<ul, EVENTS> mIds{};					/*!< The kernel's id for each open event, which tags its value in a group read */
+			int mLeader{-1};								/*!< The first open descriptor, which reads and controls the whole group */
+			int mError{0};									/*!< The errno of the first refused event */
+	};
+} // namespace Project::Utility::Clock
+
+#endif
@@ -0,0 +1,116 @@
+/*! @file scopedTimer.h
+	@brief Contains the declaration of a timer that measures its own lifetime and hands the result to a caller-supplied sink.
+	@date --/--/----
+	@version x.x.x
+	@since x.x.x
+	@author Matthew Moore
+*/
+
+#ifndef INCLUDE_UTILITY_CLOCK_SCOPEDTIMER_H
+#define INCLUDE_UTILITY_CLOCK_SCOPEDTIMER_H
+
+#include <chrono>
+#include <concepts>
+#include <ratio>
+#include <type_traits>
+#include <utility>
+
+#include "Core/attributeMacros.h"
+#include "Utility/Clock/timer.h"
+
+namespace Project::Utility::Clock
+{
+	/*! @class ScopedTimer scopedTimer.h "include/Utility/Clock/scopedTimer.h"
+		@brief Times the scope it lives in and passes the elapsed time to a sink when it is destroyed
+		@details All state belongs to the instance, so any number of threads can time their own scopes at once. The sink is called on the
+	   destroying thread, so it must be safe to call from every thread that owns a timer sharing it; a lambda capturing a
+	   @ref Project::Utility::Debug::Metrics::Histogram, for example, is. The sink should not throw, since it runs in a destructor.
+		@code
+		{
+			const auto timer{makeScopedTimer<std::nano>([&latency](const double elapsed) { latency.record(static_cast<ul>(elapsed)); })};
+			handleRequest();
+		}
+		@endcode
+		@tparam T A parameter of type std::ratio; the unit the sink receives
+		@tparam Sink A callable taking the elapsed time as a double
+		@date --/--/----
+		@version x.x.x
+		@since x.x.x
+		@author Matthew Moore
+	*/
+	template <Ratio T, typename Sink>
+		requires(std::invocable<Sink &, double>)
+	class ScopedTimer
+	{
+		public:
+			// MARK: Constructors & Destructor
+
+			/*! @brief Starts timing
+				@param[in] sink Receives the elapsed time when the timer is destroyed
+				@date --/--/----
+				@version x.x.x
+				@since x.x.x
+				@author Matthew Moore
+			*/
+			explicit ScopedTimer(Sink sink) noexcept(std::is_nothrow_move_constructible_v<Sink>) : mSink{std::move(sink)}
+			{
+			}
+
+			// The timer is tied to its scope, so it cannot be copied or moved out of it
+
+			ScopedTimer(const ScopedTimer &) = delete;
+			ScopedTimer(ScopedTimer &&) = delete;
+			ScopedTimer &operator=(const ScopedTimer &) = delete;
+			ScopedTimer &operator=(ScopedTimer &&) = delete;
+
+			/*! @brief Passes the time since construction to the sink
+				@date --/--/----
+				@version x.x.x
+				@since x.x.x
+				@author Matthew Moore
+			*/
+			~ScopedTimer()
+			{
+				mSink(elapsed());
+			}
+
+			// MARK: Getters
+
+			/*! @brief Gets the time since the timer was constructed, without stopping it
+				@retval double The elapsed time in the unit of @p T
+				@date --/--/----
+				@version x.x.x
+				@since x.x.x
+				@author Matthew Moore
+			*/
+			ATTR_NODISCARD double elapsed() const noexcept
+			{
+				return std::chrono::duration<double, T>(Clock::now() - mStart).count();
+			}
+
+		private:
+			using Clock = std::chrono::steady_clock;
+
+			Sink mSink;											  /*!< Receives the elapsed time on destruction */
+			const std::chrono::time_point<Clock> mStart{Clock::now()}; /*!< When the timer was constructed */
+	};
+
+	/*! @brief Starts a @ref ScopedTimer, naming only the unit and letting the sink's type be deduced
+		@tparam T A parameter of type std::ratio, defaulted to std::ratio<1L> or per second; the unit the sink receives
+		@tparam Sink A callable taking the elapsed time as a double
+		@param[in] sink Receives the elapsed time when the timer is destroyed
+		@retval ScopedTimer The running timer, to be held in a local variable
+		@date --/--/----
+		@version x.x.x
+		@since x.x.x
+		@author Matthew Moore
+	*/
+	template <Ratio T = std::ratio<1L>, typename Sink>
+		requires(std::invocable<std::decay_t<Sink> &, double>)
+	ATTR_NODISCARD ScopedTimer<T, std::decay_t<Sink>> makeScopedTimer(Sink &&sink)
+	{
+		return ScopedTimer<T, std::decay_t<Sink>>{std::forward<Sink>(sink)};
+	}
+} // namespace Project::Utility::Clock
+
+#endif
@@ -9,17 +9,28 @@
 #ifndef INCLUDE_CLOCK_H
 #define INCLUDE_CLOCK_H
 
+#include <algorithm>
+#include <array>
 #include <chrono>
+#include <cmath>
 #include <format>
+#include <cstddef>
 #include <fstream>
 #include <iostream>
+#include <iterator>
+#include <limits>
 #include <mutex>
+#include <optional>
 #include <ratio>
+#include <span>
+#include <string>
 #include <string_view>
 #include <utility>
+#include <vector>
 
 #include "Core/attributeMacros.h"
 #include "Core/typedefs.h"
+#include "Utility/Clock/perfCounters.h"
 
 /*! @namespace Project::Utility::Clock Holds any useful functionality that doesn't fit anywhere else
 	@date --/--/----
@@ -30,6 +41,7 @@
 namespace Project::Utility::Clock
 {
 	using Project::Core::ub;
+	using Project::Core::ul;
 
 	template <typename T>
 	concept Ratio = std::is_same_v<T, std::ratio<T::num, T::den>>; /*!< A concept to check if a type is a std::ratio */
@@ -48,6 +60,85 @@ namespace Project::Utility::Clock
 		Nanoseconds = 1'000'000'000
 	};
 
+	inline constexpr std::chrono::milliseconds TIMER_MINIMUM_BATCH_TIME{10}; /*!< The default shortest batch when calibrating */
+	inline constexpr ul TIMER_MAXIMUM_BATCH_GROWTH{10};						 /*!< The most a batch grows between two calibration runs */
+
+	/*! @struct TimingOptions timer.h "include/Utility/Clock/timer.h"
+		@brief Settings for @ref Timer::timeFunction
+		@date --/--/----
+		@version x.x.x
+		@since x.x.x
+		@author Matthew Moore
+	*/
+	struct TimingOptions
+	{
+		ul iterations{1};							  /*!< The number of samples to take */
+		std::chrono::nanoseconds minimumBatchTime{0}; /*!< The shortest batch to calibrate to; zero times one call per sample */
+		bool listIterations{true};					  /*!< Whether the report lists every sample before the summary */
+		bool hardwareCounters{false};				  /*!< Whether to read hardware counters around each sample */
+	};
+
+	/*! @struct CounterStatistics timer.h "include/Utility/Clock/timer.h"
+		@brief The hardware counters measured by @ref Timer::timeFunction, averaged per call over every sample
+		@date --/--/----
+		@version x.x.x
+		@since x.x.x
+		@author Matthew Moore
+	*/
+	struct CounterStatistics
+	{
+		std::array<std::optional<double>, PerfCounters::EVENTS> perCall{}; /*!< Indexed by @ref PerfCounters::Event; empty if not counted */
+		std::optional<double> instructionsPerCycle{};					   /*!< Instructions retired per cycle, when both were counted */
+
+		/*! @brief Gets the mean count of one event per call.
+			@param[in] event The event.
+			@retval std::optional<double> The count, or nothing if the event was not counted
+		*/
+		ATTR_NODISCARD constexpr std::optional<double> operator[](const PerfCounters::Event event) const noexcept
+		{
+			return perCall[static_cast<std::size_t>(event)];
+		}
+	};
+
+	/*! @struct TimingStatistics timer.h "include/Utility/Clock/timer.h"
+		@brief A summary of the durations measured by @ref Timer::timeFunction, all in the unit it was timed in.
+		@details Percentiles interpolate linearly between the two nearest samples. Outliers are the samples outside Tukey's fences, 1.5
+	   interquartile ranges below the first quartile or above the third; for latency they are usually preemptions, page faults or cold
+	   caches.
+		@date --/--/----
+		@version x.x.x
+		@since x.x.x
+		@author Matthew Moore
+	*/
+	struct TimingStatistics
+	{
+		ul iterations{0};					 /*!< The number of samples summarized */
+		ul batchSize{1};					 /*!< The calls each sample averages over */
+		std::string_view unit{"unknown"};	 /*!< The unit every duration is in */
+		double min{0.0};					 /*!< The shortest sample */
+		double max{0.0};					 /*!< The longest sample */
+		double mean{0.0};					 /*!< The arithmetic mean */
+		double median{0.0};					 /*!< The 50th percentile */
+		double p90{0.0};					 /*!< The 90th percentile */
+		double p99{0.0};					 /*!< The 99th percentile */
+		double p999{0.0};					 /*!< The 99.9th percentile */
+		double standardDeviation{0.0};		 /*!< The sample standard deviation; 0 for fewer than two samples */
+		double medianAbsoluteDeviation{0.0}; /*!< The median distance of a sample from the median */
+		double lowerFence{0.0};				 /*!< Samples below this are outliers */
+		double upperFence{0.0};				 /*!< Samples above this are outliers */
+		ul outliers{0};						 /*!< The number of samples outside the fences */
+		CounterStatistics counters{};		 /*!< The hardware counters; all empty unless they were asked for and available */
+
+		/*! @brief Tests whether @p sample lies outside the fences.
+			@param[in] sample A duration in @ref unit.
+			@retval bool true if @p sample is an outlier
+		*/
+		ATTR_NODISCARD constexpr bool isOutlier(const double sample) const noexcept
+		{
+			return sample < lowerFence || sample > upperFence;
+		}
+	};
+
 	/*! @class Timer timer.h "include/timer.h"
 		@brief A class to time code execution
 		@date --/--/----
@@ -142,7 +233,9 @@ namespace Project::Utility::Clock
 			}
 
 			/*! @brief Sets #mStart to the current time
-				@post #mStart is set to Clock::now()
+				@details #mStart is per thread, so @ref start and @ref stop pair up within a thread and not across threads. Timing a scope
+			   is simpler with a @ref ScopedTimer.
+				@post #mStart is set to Clock::now() for the calling thread
 				@date --/--/----
 				@version x.x.x
 				@since x.x.x
@@ -170,7 +263,10 @@ namespace Project::Utility::Clock
 				return std::chrono::duration_cast<Duration>(Clock::now() - mStart).count();
 			}
 
-			/*! @brief Times the execution of @p function @p iterations times
+			/*! @brief Times the execution of @p function @p iterations times and reports the distribution of the durations
+				@details The durations are kept in a buffer allocated before the first iteration, so nothing is written or allocated between
+			   iterations. Once all have run, each iteration is printed, outliers flagged, followed for more than one iteration by the
+			   average and the rest of the @ref TimingStatistics.
 				@pre The template parameter @p T must be a std::ratio type and @p Callable must be invocable with @p Args
 				@tparam T A parameter of type std::ratio, defaulted to std::ratio<1L> or per second
 				@tparam Callable A parameter that is invocable
@@ -179,6 +275,7 @@ namespace Project::Utility::Clock
 				@param[in] iterations The number of times to run @p function
 				@param[in] function The function to time
 				@param[in] args The arguments to pass to @p function
+				@retval TimingStatistics The summary of the durations, in the unit of @p T
 				@date --/--/----
 				@version x.x.x
 				@since x.x.x
@@ -186,75 +283,468 @@ namespace Project::Utility::Clock
 			*/
 			template <Ratio T = std::ratio<1L>, typename Callable, typename... Args>
 				requires(std::is_invocable_v<Callable, Args...>)
-			static void timeFunction(std::string_view identifier, const ub iterations, Callable &&function, Args &&...args)
+			static TimingStatistics timeFunction(std::string_view identifier, const ul iterations, Callable &&function, Args &&...args)
 			{
-				std::ofstream &logFile = getLogFile();
+				return timeFunction<T>(identifier, TimingOptions{.iterations = iterations}, std::forward<Callable>(function),
+									   std::forward<Args>(args)...);
+			}
 
-				std::ostream &output = logFile.is_open() ? logFile : std::cout;
+			/*! @brief Times @p function as @p options describe and reports the distribution of the durations
+				@details The samples are kept in a buffer allocated before the first one is taken, and between reading the clock before and
+			   after a sample nothing runs but the calls to @p function. The report is formatted into one string once sampling is done and
+			   written with a single call, so neither formatting nor I/O disturbs the caches between samples and reports from several
+			   threads do not interleave.
+				@pre The template parameter @p T must be a std::ratio type and @p Callable must be invocable with @p Args
+				@tparam T A parameter of type std::ratio, defaulted to std::ratio<1L> or per second
+				@tparam Callable A parameter that is invocable
+				@tparam Args A pack of parameters to be passed to @p Callable
+				@param[in] identifier A unique name to identify the function being timed
+				@param[in] options The number of samples, the batch calibration and whether each sample is listed
+				@param[in] function The function to time
+				@param[in] args The arguments to pass to @p function
+				@retval TimingStatistics The summary of the time per call, in the unit of @p T
+				@date --/--/----
+				@version x.x.x
+				@since x.x.x
+				@author Matthew Moore
+			*/
+			template <Ratio T = std::ratio<1L>, typename Callable, typename... Args>
+				requires(std::is_invocable_v<Callable, Args...>)
+			static TimingStatistics timeFunction(std::string_view identifier, const TimingOptions &options, Callable &&function,
+												 Args &&...args)
+			{
+				const Callable copyFunction(std::forward<Callable>(function));
+				const auto copyArgs = std::make_tuple(std::forward<Args>(args)...);
 
-				// LCOV_EXCL_BR_START — uncovered branches are compiler-generated throw edges from std::format / operator<< (std::bad_alloc)
-				output << std::format("Timing function: {}\n", identifier);
-				// LCOV_EXCL_BR_STOP
+				const ul batchSize{options.minimumBatchTime > std::chrono::nanoseconds::zero()
+									   ? calibrate(options.minimumBatchTime, copyFunction, copyArgs)
+									   : 1};
 
-				double average{0.0};
+				return timeBatches<T>(identifier, options, batchSize, copyFunction, copyArgs);
+			}
 
-				constexpr std::string_view unit = getUnit<T>();
+			/*! @brief Times @p function in batches long enough that reading the clock does not dominate, reporting the time per call
+				@details The batch starts at one call and grows, by at most @ref TIMER_MAXIMUM_BATCH_GROWTH times per run, until one batch
+			   takes at least @p minimumBatchTime. Each of the @p iterations then times a whole batch, and its duration divided by the
+			   batch size is the sample, so functions taking nanoseconds can be timed with a clock whose overhead is tens of nanoseconds.
+				@pre The template parameter @p T must be a std::ratio type and @p Callable must be invocable with @p Args
+				@tparam T A parameter of type std::ratio, defaulted to std::ratio<1L> or per second
+				@tparam Callable A parameter that is invocable
+				@tparam Args A pack of parameters to be passed to @p Callable
+				@param[in] identifier A unique name to identify the function being timed
+				@param[in] iterations The number of batches to time
+				@param[in] minimumBatchTime The shortest a batch may take
+				@param[in] function The function to time
+				@param[in] args The arguments to pass to @p function
+				@retval TimingStatistics The summary of the time per call, in the unit of @p T
+				@date --/--/----
+				@version x.x.x
+				@since x.x.x
+				@author Matthew Moore
+			*/
+			template <Ratio T = std::ratio<1L>, typename Callable, typename... Args>
+				requires(std::is_invocable_v<Callable, Args...>)
+			static TimingStatistics timeFunctionCalibrated(std::string_view identifier, const ul iterations,
+														   const std::chrono::nanoseconds minimumBatchTime, Callable &&function,
+														   Args &&...args)
+			{
+				return timeFunction<T>(identifier, TimingOptions{.iterations = iterations, .minimumBatchTime = minimumBatchTime},
+									   std::forward<Callable>(function), std::forward<Args>(args)...);
+			}
 
-				const Callable copyFunction(std::forward<Callable>(function));
-				const auto copyArgs = std::make_tuple(std::forward<Args>(args)...);
+			/*! @brief Times @p function in batches of at least @ref TIMER_MINIMUM_BATCH_TIME, reporting the time per call
+				@pre The template parameter @p T must be a std::ratio type and @p Callable must be invocable with @p Args
+				@tparam T A parameter of type std::ratio, defaulted to std::ratio<1L> or per second
+				@tparam Callable A parameter that is invocable
+				@tparam Args A pack of parameters to be passed to @p Callable
+				@param[in] identifier A unique name to identify the function being timed
+				@param[in] iterations The number of batches to time
+				@param[in] function The function to time
+				@param[in] args The arguments to pass to @p function
+				@retval TimingStatistics The summary of the time per call, in the unit of @p T
+				@date --/--/----
+				@version x.x.x
+				@since x.x.x
+				@author Matthew Moore
+			*/
+			template <Ratio T = std::ratio<1L>, typename Callable, typename... Args>
+				requires(std::is_invocable_v<Callable, Args...>)
+			static TimingStatistics timeFunctionCalibrated(std::string_view identifier, const ul iterations, Callable &&function,
+														   Args &&...args)
+			{
+				return timeFunctionCalibrated<T>(identifier, iterations, TIMER_MINIMUM_BATCH_TIME, std::forward<Callable>(function),
+												 std::forward<Args>(args)...);
+			}
 
-				for (ub i = 0; i < iterations; ++i)
+			/*! @brief Summarizes a set of durations
+				@post @p samples is sorted in ascending order, unless @p preserveOrder is set
+				@param[in,out] samples The durations; sorted in place to find the order statistics, the values themselves are kept
+				@param[in] unit The unit of the durations
+				@param[in] preserveOrder Whether to work on a copy and leave @p samples untouched
+				@retval TimingStatistics The summary; all zero for no samples
+				@date --/--/----
+				@version x.x.x
+				@since x.x.x
+				@author Matthew Moore
+			*/
+			ATTR_NODISCARD static TimingStatistics summarize(std::span<double> samples, const std::string_view unit,
+															 const bool preserveOrder = false)
+			{
+				if (preserveOrder)
 				{
-					functionStart();
-					std::apply(copyFunction, copyArgs);
-					const double duration = functionStop<T>();
+					std::vector<double> copy(samples.begin(), samples.end());
+					return summarize(copy, unit);
+				}
 
-					average += duration;
+				TimingStatistics statistics{.iterations = samples.size(), .unit = unit};
 
-					// LCOV_EXCL_BR_START — uncovered branches are compiler-generated throw edges from std::format / operator<<
-					// (std::bad_alloc)
-					output << std::format("\tIteration {}: {}{}\n", i + 1, duration, unit);
-					// LCOV_EXCL_BR_STOP
+				if (samples.empty())
+				{
+					return statistics;
 				}
 
-				if (iterations > 1)
+				std::ranges::sort(samples);
+
+				double sum{0.0};
+
+				for (const double sample : samples)
 				{
-					// LCOV_EXCL_BR_START — uncovered branches are compiler-generated throw edges from std::format / operator<<
-					// (std::bad_alloc)
-					output << std::format("\tAverage: {}{}\n", average / static_cast<double>(iterations), unit);
-					// LCOV_EXCL_BR_STOP
+					sum += sample;
 				}
+
+				statistics.min = samples.front();
+				statistics.max = samples.back();
+				statistics.mean = sum / static_cast<double>(samples.size());
+				statistics.median = percentile(samples, 0.5);
+				statistics.p90 = percentile(samples, 0.9);
+				statistics.p99 = percentile(samples, 0.99);
+				statistics.p999 = percentile(samples, 0.999);
+
+				if (samples.size() > 1)
+				{
+					double squares{0.0};
+
+					for (const double sample : samples)
+					{
+						squares += (sample - statistics.mean) * (sample - statistics.mean);
+					}
+
+					statistics.standardDeviation = std::sqrt(squares / static_cast<double>(samples.size() - 1));
+				}
+
+				// Tukey's fences: 1.5 interquartile ranges beyond the quartiles
+				constexpr double FENCE_SCALE{1.5};
+
+				const double firstQuartile{percentile(samples, 0.25)};
+				const double thirdQuartile{percentile(samples, 0.75)};
+				const double interquartileRange{thirdQuartile - firstQuartile};
+
+				statistics.lowerFence = firstQuartile - (FENCE_SCALE * interquartileRange);
+				statistics.upperFence = thirdQuartile + (FENCE_SCALE * interquartileRange);
+				statistics.outliers = static_cast<ul>(std::ranges::count_if(samples, [&statistics](const double sample) {
+					return statistics.isOutlier(sample);
+				}));
+
+				std::vector<double> deviations{};
+				deviations.reserve(samples.size());
+
+				for (const double sample : samples)
+				{
+					deviations.push_back(std::abs(sample - statistics.median));
+				}
+
+				std::ranges::sort(deviations);
+				statistics.medianAbsoluteDeviation = percentile(deviations, 0.5);
+
+				return statistics;
 			}
 
 		private:
 			// MARK: Private Utility
 
-			/*! @brief Sets #mFunctionStart to the current time
-				@post #mFunctionStart is set to Clock::now()
+			/*! @brief Runs @p function @p batchSize times back to back
+				@param[in] batchSize The number of calls
+				@param[in] function The function to run
+				@param[in] args The arguments to pass to @p function
+				@retval std::chrono::nanoseconds How long the whole batch took
 				@date --/--/----
 				@version x.x.x
 				@since x.x.x
 				@author Matthew Moore
 			*/
-			static void functionStart() noexcept
+			template <typename Callable, typename Arguments>
+			static std::chrono::nanoseconds runBatch(const ul batchSize, const Callable &function, const Arguments &args)
 			{
-				mFunctionStart = Clock::now();
+				const auto begin{Clock::now()};
+
+				for (ul call = 0; call < batchSize; ++call)
+				{
+					std::apply(function, args);
+				}
+
+				return std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - begin);
 			}
 
-			/*! @brief Gets the elapsed time since the start of #mFunctionStart
-				@pre The template parameter @p T must be a std::ratio type
-				@tparam T A parameter of type std::ratio, defaulted to std::ratio<1L> or per second
-				@retval double The amount of time passed since the start of #mFunctionStart
+			/*! @brief Finds the smallest batch of calls to @p function, to within one growth step, that takes at least @p minimumBatchTime
+				@param[in] minimumBatchTime The shortest a batch may take
+				@param[in] function The function to run
+				@param[in] args The arguments to pass to @p function
+				@retval ul The batch size
 				@date --/--/----
 				@version x.x.x
 				@since x.x.x
 				@author Matthew Moore
 			*/
-			template <Ratio T = std::ratio<1L>>
-			ATTR_NODISCARD static double functionStop() noexcept
+			template <typename Callable, typename Arguments>
+			static ul calibrate(const std::chrono::nanoseconds minimumBatchTime, const Callable &function, const Arguments &args)
+			{
+				ul batchSize{1};
+
+				for (std::chrono::nanoseconds elapsed{runBatch(batchSize, function, args)}; elapsed < minimumBatchTime;
+					 elapsed = runBatch(batchSize, function, args))
+				{
+					// Aim a little past the target, since the estimate assumes every call costs the same
+					ul growth{TIMER_MAXIMUM_BATCH_GROWTH};
+
+					if (elapsed.count() > 0)
+					{
+						growth = std::clamp<ul>(static_cast<ul>(minimumBatchTime.count() * 6 / 5 / elapsed.count()) + 1, 2,
+												TIMER_MAXIMUM_BATCH_GROWTH);
+					}
+
+					if (batchSize > std::numeric_limits<ul>::max() / growth)
+					{
+						break;
+					}
+
+					batchSize *= growth;
+				}
+
+				return batchSize;
+			}
+
+			/*! @brief Times @p options.iterations batches of @p batchSize calls to @p function and reports the time per call
+				@tparam T A parameter of type std::ratio
+				@param[in] identifier A unique name to identify the function being timed
+				@param[in] options The number of batches and whether each is listed
+				@param[in] batchSize The calls in each batch
+				@param[in] function The function to time
+				@param[in] args The arguments to pass to @p function
+				@retval TimingStatistics The summary of the time per call, in the unit of @p T
+				@date --/--/----
+				@version x.x.x
+				@since x.x.x
+				@author Matthew Moore
+			*/
+			template <Ratio T, typename Callable, typename Arguments>
+			static TimingStatistics timeBatches(std::string_view identifier, const TimingOptions &options, const ul batchSize,
+												const Callable &function, const Arguments &args)
 			{
 				using Duration = std::chrono::duration<double, T>;
-				return std::chrono::duration_cast<Duration>(Clock::now() - mFunctionStart).count();
+
+				constexpr std::string_view unit = getUnit<T>();
+
+				std::vector<double> samples(options.iterations);
+
+				std::optional<PerfCounters> counters{};
+				std::vector<PerfCounters::Reading> deltas{};
+
+				if (options.hardwareCounters)
+				{
+					counters.emplace();
+
+					if (counters->available())
+					{
+						deltas.resize(options.iterations);
+					}
+				}
+
+				if (deltas.empty())
+				{
+					for (double &sample : samples)
+					{
+						const std::chrono::nanoseconds elapsed{runBatch(batchSize, function, args)};
+						sample = std::chrono::duration_cast<Duration>(elapsed).count() / static_cast<double>(batchSize);
+					}
+				}
+				else
+				{
+					// The counters are read outside the clock reads, so they add to the counts but not the time
+					for (std::size_t i = 0; i < samples.size(); ++i)
+					{
+						const PerfCounters::Reading before{counters->read()};
+						const std::chrono::nanoseconds elapsed{runBatch(batchSize, function, args)};
+						deltas[i] = counters->read() - before;
+
+						samples[i] = std::chrono::duration_cast<Duration>(elapsed).count() / static_cast<double>(batchSize);
+					}
+				}
+
+				// Listing needs the samples in the order they were taken, so the summary sorts a copy
+				std::vector<double> ordered{};
+
+				if (options.listIterations)
+				{
+					ordered = samples;
+				}
+
+				TimingStatistics statistics{summarize(samples, unit)};
+				statistics.batchSize = batchSize;
+
+				if (!deltas.empty())
+				{
+					statistics.counters = summarizeCounters(*counters, deltas, batchSize);
+				}
+
+				std::string report{};
+				report.reserve(REPORT_BYTES + (options.listIterations ? ordered.size() * ITERATION_BYTES : 0));
+
+				// LCOV_EXCL_BR_START — uncovered branches are compiler-generated throw edges from std::format_to / operator<<
+				// (std::bad_alloc)
+				auto out = std::back_inserter(report);
+
+				std::format_to(out, "Timing function: {}\n", identifier);
+
+				if (batchSize > 1)
+				{
+					std::format_to(out, "\tBatch size: {} calls per iteration\n", batchSize);
+				}
+
+				for (ul i = 0; i < ordered.size(); ++i)
+				{
+					std::format_to(out, "\tIteration {}: {}{}{}", i + 1, ordered[i], unit,
+								   statistics.isOutlier(ordered[i]) ? " (outlier)" : "");
+
+					if (!deltas.empty() && deltas[i][PerfCounters::Event::Cycles] != 0)
+					{
+						std::format_to(out, " [IPC {:.2f}]",
+									   static_cast<double>(deltas[i][PerfCounters::Event::Instructions]) /
+										   static_cast<double>(deltas[i][PerfCounters::Event::Cycles]));
+					}
+
+					report.push_back('\n');
+				}
+
+				if (options.iterations > 1)
+				{
+					std::format_to(out, "\tAverage: {}{}\n", statistics.mean, unit);
+					std::format_to(out, "\tMin: {0}{2}, Max: {1}{2}\n", statistics.min, statistics.max, unit);
+					std::format_to(out, "\tMedian: {0}{4}, p90: {1}{4}, p99: {2}{4}, p99.9: {3}{4}\n", statistics.median, statistics.p90,
+								   statistics.p99, statistics.p999, unit);
+					std::format_to(out, "\tStandard deviation: {0}{2}, Median absolute deviation: {1}{2}\n", statistics.standardDeviation,
+								   statistics.medianAbsoluteDeviation, unit);
+					std::format_to(out, "\tOutliers: {} outside the Tukey fences [{}{}, {}{}]\n", statistics.outliers,
+								   statistics.lowerFence, unit, statistics.upperFence, unit);
+				}
+
+				if (!deltas.empty())
+				{
+					std::format_to(out, "\tPer call:");
+
+					for (std::size_t event = 0; event < PerfCounters::EVENTS; ++event)
+					{
+						if (const std::optional<double> count{statistics.counters.perCall[event]}; count.has_value())
+						{
+							std::format_to(out, " {:.1f} {},", *count, PerfCounters::name(static_cast<PerfCounters::Event>(event)));
+						}
+					}
+
+					if (statistics.counters.instructionsPerCycle.has_value())
+					{
+						std::format_to(out, " IPC {:.2f}", *statistics.counters.instructionsPerCycle);
+					}
+					else
+					{
+						report.pop_back();
+					}
+
+					report.push_back('\n');
+				}
+				else if (counters.has_value() && counters->available())
+				{
+					// The counter group opened, but no iterations ran to read it around
+					std::format_to(out, "\tHardware counters: no samples\n");
+				}
+				else if (counters.has_value())
+				{
+					std::format_to(out, "\tHardware counters unavailable: {}\n", counters->unavailableReason());
+				}
+
+				{
+					const std::scoped_lock lock(getOutputMutex());
+
+					std::ofstream &logFile = getLogFile();
+					std::ostream &output = logFile.is_open() ? logFile : std::cout;
+
+					output << report;
+				}
+				// LCOV_EXCL_BR_STOP
+
+				return statistics;
+			}
+
+			/*! @brief Averages the counts of every sample over the calls made
+				@pre @p deltas is non-empty
+				@param[in] counters The counters the deltas were read from, to tell which events were counted
+				@param[in] deltas The counts accumulated over each sample
+				@param[in] batchSize The calls in each sample
+				@retval CounterStatistics The mean counts per call
+				@date --/--/----
+				@version x.x.x
+				@since x.x.x
+				@author Matthew Moore
+			*/
+			ATTR_NODISCARD static CounterStatistics summarizeCounters(const PerfCounters &counters,
+																	  std::span<const PerfCounters::Reading> deltas,
+																	  const ul batchSize) noexcept
+			{
+				CounterStatistics statistics{};
+				PerfCounters::Reading total{};
+
+				for (const PerfCounters::Reading &delta : deltas)
+				{
+					for (std::size_t event = 0; event < PerfCounters::EVENTS; ++event)
+					{
+						total.values[event] += delta.values[event];
+					}
+				}
+
+				const double calls{static_cast<double>(deltas.size()) * static_cast<double>(batchSize)};
+
+				for (std::size_t event = 0; event < PerfCounters::EVENTS; ++event)
+				{
+					if (counters.available(static_cast<PerfCounters::Event>(event)))
+					{
+						statistics.perCall[event] = static_cast<double>(total.values[event]) / calls;
+					}
+				}
+
+				if (statistics[PerfCounters::Event::Instructions].has_value() && total[PerfCounters::Event::Cycles] != 0)
+				{
+					statistics.instructionsPerCycle = static_cast<double>(total[PerfCounters::Event::Instructions]) /
+													  static_cast<double>(total[PerfCounters::Event::Cycles]);
+				}
+
+				return statistics;
+			}
+
+			/*! @brief Gets a percentile of sorted durations, interpolating linearly between the two nearest
+				@pre @p sorted is non-empty and sorted in ascending order
+				@param[in] sorted The durations
+				@param[in] quantile The percentile as a fraction, from 0 to 1
+				@retval double The percentile
+				@date --/--/----
+				@version x.x.x
+				@since x.x.x
+				@author Matthew Moore
+			*/
+			ATTR_NODISCARD static double percentile(std::span<const double> sorted, const double quantile) noexcept
+			{
+				const double rank{quantile * static_cast<double>(sorted.size() - 1)};
+				const auto lower{static_cast<std::size_t>(rank)};
+				const std::size_t upper{std::min(lower + 1, sorted.size() - 1)};
+
+				return sorted[lower] + ((rank - static_cast<double>(lower)) * (sorted[upper] - sorted[lower]));
 			}
 
 			/*! @brief Gets a log file to write to
@@ -289,9 +779,21 @@ namespace Project::Utility::Clock
 		private:
 			using Clock = std::chrono::steady_clock;
 
-			static inline std::chrono::time_point<Clock> mStart{Clock::now()}; /*!< The starting time for the classes internal timer */
-			static inline std::chrono::time_point<Clock> mFunctionStart{Clock::now()}; /*!< The starting time for timing a function */
-			static inline std::string_view mUnit{"s"};								   /*!< The unit of time for what is being timed */
+			// Each thread has its own start, so threads timing at once do not overwrite one another
+			static inline thread_local std::chrono::time_point<Clock> mStart{Clock::now()}; /*!< The calling thread's start time */
+			static inline thread_local std::string_view mUnit{"s"};							 /*!< The calling thread's unit */
+
+			static constexpr std::size_t REPORT_BYTES{512};   /*!< Room reserved for a report's header and summary */
+			static constexpr std::size_t ITERATION_BYTES{48}; /*!< Room reserved for each listed sample */
+
+			/*! @brief Provides access to the mutex that keeps reports written from several threads whole.
+				@return A reference to the mutex. The reference remains valid for the lifetime of the program.
+			*/
+			static std::mutex &getOutputMutex() noexcept
+			{
+				static std::mutex outputMutex;
+				return outputMutex;
+			}
 
 			/*! @brief Provides access to the function-local static file name string.
 				@return A reference to the stored file name. The reference remains valid for the lifetime of the program.
@@ -0,0 +1,257 @@
+/*! @file boundedQueue.h
+	@brief Contains the declaration of a fixed-capacity lock-free multi-producer multi-consumer queue.
+	@date --/--/----
+	@version x.x.x
+	@since x.x.x
+	@author Matthew Moore
+*/
+
+#ifndef INCLUDE_UTILITY_CONTAINERS_BOUNDEDQUEUE_BOUNDEDQUEUE_H
+#define INCLUDE_UTILITY_CONTAINERS_BOUNDEDQUEUE_BOUNDEDQUEUE_H
+
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <memory>
+#include <utility>
+
+#include "Core/attributeMacros.h"
+#include "Core/cconcepts.h"
+#include "Core/hardware.h"
+
+/*! @namespace Project::Utility::Containers::BoundedQueue
+	@brief Fixed-capacity concurrent queues used to hand work between threads without locking.
+	@date --/--/----
+	@version x.x.x
+	@since x.x.x
+	@author Matthew Moore
+*/
+namespace Project::Utility::Containers::BoundedQueue
+{
+	using Project::Core::CACHE_LINE_SIZE;
+	using Project::Core::InvocableWithArgs;
+
+	/*! @class BoundedQueue boundedQueue.h "include/Utility/Containers/BoundedQueue/boundedQueue.h"
+		@brief A bounded lock-free multi-producer multi-consumer queue whose elements are filled and drained in place.
+		@details Implements Dmitry Vyukov's bounded MPMC algorithm: every cell carries a sequence number that tells producers and consumers
+	   whether the cell is free, published, or still being written, so each push or pop costs one CAS on a cursor plus one acquire/release
+	   pair on the cell. Elements are constructed once up front and then reused; callers fill or consume them through a callback instead of
+	   moving values in and out, which lets heap-backed element types (e.g. formatting buffers) keep their capacity across uses.
+		@tparam T The element type. Must be default constructible.
+		@note The capacity is rounded up to the next power of two so that cursor-to-index mapping is a single mask.
+		@date --/--/----
+		@version x.x.x
+		@since x.x.x
+		@author Matthew Moore
+	*/
+	template <typename T>
+	class BoundedQueue
+	{
+		public:
+			// MARK: Constructors & Destructor
+
+			/*! @brief Creates a queue that holds at least @p capacity elements.
+				@param[in] capacity The minimum number of elements the queue can hold. Rounded up to a power of two; values below 2 become 2.
+				@throws std::bad_alloc If the cell storage cannot be allocated.
+			*/
+			explicit BoundedQueue(const std::size_t capacity) : mCapacity{std::bit_ceil(capacity < 2 ? std::size_t{2} : capacity)},
+																mMask{mCapacity - 1},
+																mCells{std::make_unique<Cell[]>(mCapacity)}
+			{
+				for (std::size_t i{0}; i < mCapacity; ++i)
+				{
+					mCells[i].sequence.store(i, std::memory_order_relaxed);
+				}
+			}
+
+			// Do not allow copies or moves; producers and consumers hold references into the cell storage
+
+			BoundedQueue(const BoundedQueue &) = delete;
+			BoundedQueue(BoundedQueue &&) = delete;
+			BoundedQueue &operator=(const BoundedQueue &) = delete;
+			BoundedQueue &operator=(BoundedQueue &&) = delete;
+			~BoundedQueue() = default;
+
+			// MARK: Getters
+
+			/*! @brief Gets the number of cells in the queue.
+				@return The rounded-up capacity passed to the constructor.
+			*/
+			ATTR_NODISCARD std::size_t capacity() const noexcept
+			{
+				return mCapacity;
+			}
+
+			/*! @brief Gets the number of pushes that have claimed a cell so far.
+				@details Includes pushes whose fill callback is still running, so this can run ahead of what consumers can observe.
+				@return The monotonically increasing producer cursor.
+			*/
+			ATTR_NODISCARD std::size_t enqueuePosition() const noexcept
+			{
+				return mEnqueuePosition.load(std::memory_order_acquire);
+			}
+
+			/*! @brief Gets the number of pops that have claimed a cell so far.
+				@return The monotonically increasing consumer cursor.
+			*/
+			ATTR_NODISCARD std::size_t dequeuePosition() const noexcept
+			{
+				return mDequeuePosition.load(std::memory_order_acquire);
+			}
+
+			// MARK: Utility
+
+			/*! @brief Claims a free cell and lets @p fill write the new element into it.
+				@details The cell is published to consumers when @p fill returns, or when it throws; in the latter case the element is left in
+			   whatever state @p fill produced and the exception propagates.
+				@tparam Fill A callable invocable with `T &`.
+				@param[in] fill Writes the element in place. The referenced element still holds whatever the previous user left in it.
+				@return true if a cell was claimed, false if the queue was full.
+				@note Lock-free; O(1) apart from CAS retries under contention.
+			*/
+			template <InvocableWithArgs<T &> Fill>
+			ATTR_NODISCARD bool tryPush(Fill &&fill)
+			{
+				std::size_t position{mEnqueuePosition.load(std::memory_order_relaxed)};
+				Cell *cell{nullptr};
+
+				while (true)
+				{
+					cell = &mCells[position & mMask];
+					const std::size_t sequence{cell->sequence.load(std::memory_order_acquire)};
+					const auto difference{static_cast<std::ptrdiff_t>(sequence) - static_cast<std::ptrdiff_t>(position)};
+
+					if (difference == 0)
+					{
+						if (mEnqueuePosition.compare_exchange_weak(position, position + 1, std::memory_order_relaxed))
+						{
+							break;
+						}
+					}
+					else if (difference < 0)
+					{
+						return false;
+					}
+					else
+					{
+						position = mEnqueuePosition.load(std::memory_order_relaxed);
+					}
+				}
+
+				const Publisher publisher{cell->sequence, position + 1};
+				std::forward<Fill>(fill)(cell->value);
+
+				return true;
+			}
+
+			/*! @brief Claims the oldest published element and lets @p consume read it in place.
+				@details The cell is returned to producers when @p consume returns, or when it throws.
+				@tparam Consume A callable invocable with `T &`.
+				@param[in] consume Reads (and may modify) the element in place. The element is reused by a later push, so do not keep references.
+				@return true if an element was consumed, false if no published element was available.
+				@note Lock-free; O(1) apart from CAS retries under contention.
+			*/
+			template <InvocableWithArgs<T &> Consume>
+			ATTR_NODISCARD bool tryPop(Consume &&consume)
+			{
+				std::size_t position{mDequeuePosition.load(std::memory_order_relaxed)};
+				Cell *cell{nullptr};
+
+				while (true)
+				{
+					cell = &mCells[position & mMask];
+					const std::size_t sequence{cell->sequence.load(std::memory_order_acquire)};
+					const auto difference{static_cast<std::ptrdiff_t>(sequence) - static_cast<std::ptrdiff_t>(position + 1)};
+
+					if (difference == 0)
+					{
+						if (mDequeuePosition.compare_exchange_weak(position, position + 1, std::memory_order_relaxed))
+						{
+							break;
+						}
+					}
+					else if (difference < 0)
+					{
+						return false;
+					}
+					else
+					{
+						position = mDequeuePosition.load(std::memory_order_relaxed);
+					}
+				}
+
+				const Publisher publisher{cell->sequence, position + mCapacity};
+				std::forward<Consume>(consume)(cell->value);
+
+				return true;
+			}
+
+			/*! @brief Shows @p visit every published element, oldest first, without claiming any of them.
+				@details Takes no locks and performs no CAS, so it can run where nothing else may, such as a signal handler. It is not
+			   synchronized with consumers: an element being popped concurrently may be skipped or visited while it is read, and one being
+			   pushed concurrently may be visited half-written. Meant for last-resort reads such as crash reports.
+				@tparam Visit A callable invocable with `const T &`.
+				@param[in] visit Reads the element in place.
+			*/
+			template <InvocableWithArgs<const T &> Visit>
+			void forEachPublished(Visit &&visit) const
+			{
+				const std::size_t first{mDequeuePosition.load(std::memory_order_acquire)};
+
+				for (std::size_t position{first}; position - first < mCapacity; ++position)
+				{
+					const Cell &cell{mCells[position & mMask]};
+
+					if (cell.sequence.load(std::memory_order_acquire) != position + 1)
+					{
+						break;
+					}
+
+					visit(cell.value);
+				}
+			}
+
+		private:
+			/*! @struct Cell boundedQueue.h "include/Utility/Containers/BoundedQueue/boundedQueue.h"
+				@brief A single queue slot: the element plus the sequence number that encodes its state.
+			*/
+			struct Cell
+			{
+				std::atomic<std::size_t> sequence{0}; /*!< Equal to the push cursor when free, cursor + 1 when published */
+				T value{};							  /*!< The reused element storage */
+			};
+
+			/*! @struct Publisher boundedQueue.h "include/Utility/Containers/BoundedQueue/boundedQueue.h"
+				@brief Releases a claimed cell on scope exit so a throwing callback cannot wedge the queue.
+			*/
+			struct Publisher
+			{
+				std::atomic<std::size_t> &sequence; /*!< The claimed cell's sequence number */
+				const std::size_t next;				/*!< The value that hands the cell to the other side */
+
+				Publisher(std::atomic<std::size_t> &cellSequence, const std::size_t nextSequence) noexcept : sequence{cellSequence},
+																											 next{nextSequence}
+				{
+				}
+
+				Publisher(const Publisher &) = delete;
+				Publisher(Publisher &&) = delete;
+				Publisher &operator=(const Publisher &) = delete;
+				Publisher &operator=(Publisher &&) = delete;
+
+				~Publisher()
+				{
+					sequence.store(next, std::memory_order_release);
+				}
+			};
+
+			const std::size_t mCapacity;		  /*!< The number of cells; always a power of two */
+			const std::size_t mMask;			  /*!< mCapacity - 1, used to map cursors to cell indices */
+			const std::unique_ptr<Cell[]> mCells; /*!< The cell storage */
+
+			alignas(CACHE_LINE_SIZE) std::atomic<std::size_t> mEnqueuePosition{0}; /*!< The producer cursor */
+			alignas(CACHE_LINE_SIZE) std::atomic<std::size_t> mDequeuePosition{0}; /*!< The consumer cursor */
+	};
+} // namespace Project::Utility::Containers::BoundedQueue
+
+#endif
@@ -0,0 +1,208 @@
+/*! @file byteRing.h
+	@brief Contains the declaration of a fixed-capacity lock-free single-producer single-consumer byte ring.
+	@date --/--/----
+	@version x.x.x
+	@since x.x.x
+	@author Matthew Moore
+*/
+
+#ifndef INCLUDE_UTILITY_CONTAINERS_BYTERING_BYTERING_H
+#define INCLUDE_UTILITY_CONTAINERS_BYTERING_BYTERING_H
+
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <cstring>
+#include <memory>
+#include <span>
+#include <utility>
+
+#include "Core/attributeMacros.h"
+#include "Core/cconcepts.h"
+#include "Core/hardware.h"
+
+/*! @namespace Project::Utility::Containers::ByteRing
+	@brief Fixed-capacity byte buffers used to stream variable-length records from one thread to another without locking.
+	@date --/--/----
+	@version x.x.x
+	@since x.x.x
+	@author Matthew Moore
+*/
+namespace Project::Utility::Containers::ByteRing
+{
+	using Project::Core::CACHE_LINE_SIZE;
+	using Project::Core::InvocableWithArgs;
+
+	/*! @class ByteRing byteRing.h "include/Utility/Containers/ByteRing/byteRing.h"
+		@brief A bounded lock-free single-producer single-consumer ring of bytes.
+		@details The producer appends whole variable-length records and publishes them with a single release store; the consumer reads
+	   everything published so far as at most two contiguous spans (the ring may wrap once) and releases it with a single release store.
+	   Each side caches the other side's cursor, so a push or a drain only touches the shared cache line when the cached value says the
+	   ring looks full or empty.
+		@note The capacity is rounded up to the next power of two so that cursor-to-offset mapping is a single mask.
+		@date --/--/----
+		@version x.x.x
+		@since x.x.x
+		@author Matthew Moore
+	*/
+	class ByteRing
+	{
+		public:
+			/*! @class Writer byteRing.h "include/Utility/Containers/ByteRing/byteRing.h"
+				@brief Appends bytes into the space reserved by @ref ByteRing::tryPush, wrapping at the end of the storage.
+			*/
+			class Writer
+			{
+				public:
+					/*! @brief Copies @p size bytes from @p data into the reservation.
+						@param[in] data The bytes to copy.
+						@param[in] size The number of bytes to copy. The caller must not exceed the size passed to @ref ByteRing::tryPush.
+					*/
+					void put(const void *data, const std::size_t size) noexcept
+					{
+						const std::size_t offset{mPosition & mRing.mMask};
+						const std::size_t first{std::min(size, mRing.mCapacity - offset)};
+
+						std::memcpy(mRing.mStorage.get() + offset, data, first);
+						std::memcpy(mRing.mStorage.get(), static_cast<const std::byte *>(data) + first, size - first);
+
+						mPosition += size;
+					}
+
+				private:
+					friend class ByteRing;
+
+					Writer(ByteRing &ring, const std::size_t position) noexcept : mRing{ring}, mPosition{position}
+					{
+					}
+
+					ByteRing &mRing;		 /*!< The ring being written */
+					std::size_t mPosition; /*!< The producer cursor of the next byte to write */
+			};
+
+			// MARK: Constructors & Destructor
+
+			/*! @brief Creates a ring that holds at least @p capacity bytes.
+				@param[in] capacity The minimum number of bytes the ring can hold. Rounded up to a power of two; values below 64 become 64.
+				@throws std::bad_alloc If the storage cannot be allocated.
+			*/
+			explicit ByteRing(const std::size_t capacity) : mCapacity{std::bit_ceil(std::max(capacity, std::size_t{64}))},
+															mMask{mCapacity - 1},
+															mStorage{std::make_unique<std::byte[]>(mCapacity)}
+			{
+			}
+
+			// Do not allow copies or moves; the producer and consumer hold references into the storage
+
+			ByteRing(const ByteRing &) = delete;
+			ByteRing(ByteRing &&) = delete;
+			ByteRing &operator=(const ByteRing &) = delete;
+			ByteRing &operator=(ByteRing &&) = delete;
+			~ByteRing() = default;
+
+			// MARK: Getters
+
+			/*! @brief Gets the number of bytes the ring can hold.
+				@return The rounded-up capacity passed to the constructor.
+			*/
+			ATTR_NODISCARD std::size_t capacity() const noexcept
+			{
+				return mCapacity;
+			}
+
+			/*! @brief Gets the number of published bytes the consumer has not released yet.
+				@return A snapshot; exact when called from either the producer or the consumer thread.
+			*/
+			ATTR_NODISCARD std::size_t size() const noexcept
+			{
+				return mHead.load(std::memory_order_acquire) - mTail.load(std::memory_order_acquire);
+			}
+
+			/*! @brief Tests whether the consumer has read everything the producer has published.
+				@return true if no published bytes are waiting.
+			*/
+			ATTR_NODISCARD bool empty() const noexcept
+			{
+				return mHead.load(std::memory_order_acquire) == mTail.load(std::memory_order_acquire);
+			}
+
+			// MARK: Utility
+
+			/*! @brief Reserves @p size contiguous ring bytes and lets @p fill write a record into them. Producer thread only.
+				@details The record is published when @p fill returns. If @p fill throws, nothing is published and the exception propagates.
+				@tparam Fill A callable invocable with `Writer &`.
+				@param[in] size The exact number of bytes @p fill will write.
+				@param[in] fill Writes the record through the supplied @ref Writer.
+				@return true if the record was published, false if the ring does not currently have @p size free bytes.
+				@note Wait-free.
+			*/
+			template <InvocableWithArgs<Writer &> Fill>
+			ATTR_NODISCARD bool tryPush(const std::size_t size, Fill &&fill)
+			{
+				const std::size_t head{mHead.load(std::memory_order_relaxed)};
+
+				if (head + size - mCachedTail > mCapacity)
+				{
+					mCachedTail = mTail.load(std::memory_order_acquire);
+
+					if (head + size - mCachedTail > mCapacity)
+					{
+						return false;
+					}
+				}
+
+				Writer writer{*this, head};
+				std::forward<Fill>(fill)(writer);
+
+				mHead.store(head + size, std::memory_order_release);
+
+				return true;
+			}
+
+			/*! @brief Hands every published byte to @p consume and then releases it to the producer. Consumer thread only.
+				@tparam Consume A callable invocable with `std::span<const std::byte>`; called once, or twice when the bytes wrap.
+				@param[in] consume Reads the bytes. The spans are only valid for the duration of the call.
+				@return The number of bytes consumed.
+				@note Wait-free apart from @p consume. Because the producer only publishes whole records, the bytes handed over are always a
+			   sequence of whole records.
+			*/
+			template <InvocableWithArgs<std::span<const std::byte>> Consume>
+			std::size_t drain(Consume &&consume)
+			{
+				const std::size_t tail{mTail.load(std::memory_order_relaxed)};
+				const std::size_t head{mHead.load(std::memory_order_acquire)};
+				const std::size_t size{head - tail};
+
+				if (size == 0)
+				{
+					return 0;
+				}
+
+				const std::size_t offset{tail & mMask};
+				const std::size_t first{std::min(size, mCapacity - offset)};
+
+				consume(std::span<const std::byte>{mStorage.get() + offset, first});
+
+				if (first < size)
+				{
+					consume(std::span<const std::byte>{mStorage.get(), size - first});
+				}
+
+				mTail.store(head, std::memory_order_release);
+
+				return size;
+			}
+
+		private:
+			const std::size_t mCapacity;				/*!< The number of bytes; always a power of two */
+			const std::size_t mMask;					/*!< mCapacity - 1, used to map cursors to offsets */
+			const std::unique_ptr<std::byte[]> mStorage; /*!< The ring storage */
+
+			alignas(CACHE_LINE_SIZE) std::atomic<std::size_t> mHead{0}; /*!< The producer cursor; bytes before it are published */
+			std::size_t mCachedTail{0};									 /*!< The producer's last view of mTail */
+			alignas(CACHE_LINE_SIZE) std::atomic<std::size_t> mTail{0}; /*!< The consumer cursor; bytes before it are free */
+	};
+} // namespace Project::Utility::Containers::ByteRing
+
+#endif
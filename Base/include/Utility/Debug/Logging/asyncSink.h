@@ -0,0 +1,177 @@
+/*! @file asyncSink.h
+	@brief Contains the declaration of an spdlog sink that moves file I/O off the logging thread.
+	@date --/--/----
+	@version x.x.x
+	@since x.x.x
+	@author Matthew Moore
+*/
+
+#ifndef INCLUDE_UTILITY_DEBUG_LOGGING_ASYNCSINK_H
+#define INCLUDE_UTILITY_DEBUG_LOGGING_ASYNCSINK_H
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <variant>
+
+#include "Core/attributeMacros.h"
+#include "Core/typedefs.h"
+#include "Utility/Containers/BoundedQueue/boundedQueue.h"
+#include "Utility/Debug/Logging/loggerOptions.h"
+#include "Utility/Debug/Logging/rotatingFile.h"
+#include "Utility/Debug/Logging/uringFile.h"
+
+#include <spdlog/common.h>
+#include <spdlog/details/log_msg.h>
+#include <spdlog/formatter.h>
+#include <spdlog/sinks/sink.h>
+
+namespace Project::Utility::Debug::Logging
+{
+	using Project::Core::ul;
+
+	/*! @class AsyncSink asyncSink.h "include/Utility/Debug/Logging/asyncSink.h"
+		@brief An spdlog sink that formats records on the calling thread and writes them to a file from a dedicated writer thread.
+		@details Each call formats its record straight into a reusable slot of a lock-free @ref Containers::BoundedQueue::BoundedQueue, so the
+	   hot path performs no locking, no system calls and, once every slot has grown to its working size, no allocation. The writer thread
+	   drains the queue in batches and only flushes the file when the queue runs dry or a caller asks for it, and it sleeps on an atomic wait
+	   while idle; producers only issue a wake-up when the writer has announced that it is sleeping. Formatters are cloned per thread because
+	   spdlog's pattern formatter caches timestamp state and is not safe to share. When rotation is enabled the writer thread also rotates
+	   the file, so a rotation never stalls a logging thread. Constructed with @ref UringOptions, the writer thread writes through a
+	   @ref UringFile instead, keeping several batches of records in flight through io_uring; that file is never rotated. The sink registers
+	   a drain with @ref CrashHandler once its writer thread is running, so when the handler is installed the records still queued at a
+	   crash are written out; @ref crashDrainRegistered reports whether the handler had a slot for it.
+		@note Records that cannot be written because the file write fails are counted as dropped.
+		@date --/--/----
+		@version x.x.x
+		@since x.x.x
+		@author Matthew Moore
+	*/
+	class AsyncSink final : public spdlog::sinks::sink
+	{
+		public:
+			// MARK: Constructors & Destructor
+
+			/*! @brief Opens @p fileName for appending and starts the writer thread.
+				@param[in] fileName The path of the file that receives the formatted records.
+				@param[in] capacity The minimum number of records the queue can hold; rounded up to a power of two.
+				@param[in] policy What @ref log does when the queue is full.
+				@param[in] rotation When the writer thread rotates the file; never by default.
+				@throws spdlog::spdlog_ex If the file cannot be opened.
+				@throws std::system_error If the writer or archiver thread cannot be started.
+			*/
+			AsyncSink(const std::string &fileName, const ul capacity, const OverflowPolicy policy, const RotationOptions &rotation = {});
+
+			/*! @brief Opens @p fileName for appending through io_uring and starts the writer thread.
+				@param[in] fileName The path of the file that receives the formatted records.
+				@param[in] capacity The minimum number of records the queue can hold; rounded up to a power of two.
+				@param[in] policy What @ref log does when the queue is full.
+				@param[in] uring The number and size of the batch buffers the writer thread keeps in flight.
+				@throws spdlog::spdlog_ex If the file cannot be opened.
+				@throws std::system_error If the writer thread cannot be started.
+			*/
+			AsyncSink(const std::string &fileName, const ul capacity, const OverflowPolicy policy, const UringOptions &uring);
+
+			// Do not allow copies or moves; the writer thread holds a pointer to this sink
+
+			AsyncSink(const AsyncSink &) = delete;
+			AsyncSink(AsyncSink &&) = delete;
+			AsyncSink &operator=(const AsyncSink &) = delete;
+			AsyncSink &operator=(AsyncSink &&) = delete;
+
+			/*! @brief Writes every record still in the queue, flushes the file and joins the writer thread. */
+			~AsyncSink() override;
+
+			// MARK: Getters
+
+			/*! @brief Gets the number of records discarded by the overflow policy or lost to a failed write.
+				@return The running total since construction.
+			*/
+			ATTR_NODISCARD ul droppedCount() const noexcept;
+
+			/*! @brief Checks whether the sink's drain found a slot in the crash handler.
+				@return false if every slot was taken, in which case the records still queued at a crash are lost.
+			*/
+			ATTR_NODISCARD ATTR_PURE bool crashDrainRegistered() const noexcept;
+
+			// MARK: spdlog::sinks::sink
+
+			/*! @brief Formats @p msg into a queue slot and hands it to the writer thread.
+				@param[in] msg The record produced by spdlog::logger.
+				@throws std::bad_alloc If a slot or the thread's formatter needs to grow and allocation fails.
+			*/
+			void log(const spdlog::details::log_msg &msg) override;
+
+			/*! @brief Blocks until every record queued before the call has been written and the file has been flushed. */
+			void flush() override;
+
+			/*! @brief Replaces the formatter with a pattern formatter for @p pattern.
+				@param[in] pattern An spdlog pattern string.
+			*/
+			void set_pattern(const std::string &pattern) override;
+
+			/*! @brief Replaces the formatter used by every thread on its next record.
+				@param[in] sinkFormatter The new prototype formatter; each logging thread receives its own clone.
+			*/
+			void set_formatter(std::unique_ptr<spdlog::formatter> sinkFormatter) override;
+
+		private:
+			// MARK: Private Member Functions
+
+			/*! @brief Starts the writer thread, then registers the sink's drain with @ref CrashHandler.
+				@throws std::system_error If the writer thread cannot be started; nothing is registered then.
+			*/
+			void startWriter();
+
+			/*! @brief Gets the calling thread's formatter clone, refreshing it if the prototype changed or belongs to another sink.
+				@return A formatter owned by the calling thread; valid until the thread's next call into any AsyncSink.
+			*/
+			spdlog::formatter &threadFormatter();
+
+			/*! @brief Pushes one record according to the overflow policy.
+				@param[in] msg The record to format into the queue.
+			*/
+			void enqueue(const spdlog::details::log_msg &msg);
+
+			/*! @brief Wakes the writer thread if it has announced that it is about to sleep. */
+			void wakeWriter() noexcept;
+
+			/*! @brief The writer thread body: drains, flushes and sleeps until the sink is destroyed. */
+			void writerLoop();
+
+			/*! @brief Writes every published record to the file.
+				@return The number of records taken off the queue.
+			*/
+			ul drain();
+
+			/*! @brief Flushes the file and publishes how far the queue has been persisted. */
+			void publishFlushed();
+
+			/*! @brief The crash handler's drain: writes the records still in the queue to the crash report file.
+				@param[in] context The AsyncSink.
+				@param[in] file The crash report file; @ref Logger installs the handler on the file the sink writes.
+			*/
+			static void drainPending(const void *context, int file) noexcept;
+
+			using Queue = Containers::BoundedQueue::BoundedQueue<spdlog::memory_buf_t>;
+
+			const ul mId;								 /*!< Distinguishes this sink from earlier ones in per-thread formatter caches */
+			const OverflowPolicy mPolicy;				 /*!< What to do when the queue is full */
+			Queue mQueue;								 /*!< Formatted records waiting for the writer thread */
+			std::variant<RotatingFile, UringFile> mFile; /*!< The output file; only touched by the writer thread after construction */
+			std::mutex mFormatterMutex{};				 /*!< Guards mFormatter against concurrent set_formatter calls */
+			std::unique_ptr<spdlog::formatter> mFormatter; /*!< The prototype cloned into each thread */
+			std::atomic<ul> mFormatterGeneration{0};	 /*!< Bumped whenever mFormatter is replaced */
+			std::atomic<ul> mDropped{0};				 /*!< Records discarded or lost */
+			std::atomic<ul> mWakeups{0};				 /*!< The value the writer waits on; bumped to wake it */
+			std::atomic<bool> mWriterSleeping{false};	 /*!< Set by the writer just before it waits on mWakeups */
+			std::atomic<bool> mStopping{false};		 /*!< Set by the destructor to end the writer loop */
+			std::atomic<ul> mFlushedPosition{0};		 /*!< Dequeue position up to which records are flushed to the file */
+			bool mCrashDrain{false};					 /*!< Whether the crash handler drains the queue; set by startWriter */
+			std::thread mWriter{};						 /*!< The writer thread; started last in the constructor */
+	};
+} // namespace Project::Utility::Debug::Logging
+
+#endif
@@ -0,0 +1,191 @@
+/*! @file backtraceRing.h
+	@brief Contains the declaration of the per-thread ring that keeps recent low-level records in memory until an error asks for them.
+	@date --/--/----
+	@version x.x.x
+	@since x.x.x
+	@author Matthew Moore
+*/
+
+#ifndef INCLUDE_UTILITY_DEBUG_LOGGING_BACKTRACERING_H
+#define INCLUDE_UTILITY_DEBUG_LOGGING_BACKTRACERING_H
+
+#include <cstddef>
+#include <cstring>
+#include <memory>
+#include <string_view>
+#include <utility>
+
+#include "Core/attributeMacros.h"
+#include "Core/cconcepts.h"
+#include "Core/typedefs.h"
+
+#include <spdlog/common.h>
+
+namespace Project::Utility::Debug::Logging
+{
+	using Project::Core::InvocableWithArgs;
+	using Project::Core::ul;
+
+	/*! @class BacktraceRing backtraceRing.h "include/Utility/Debug/Logging/backtraceRing.h"
+		@brief A fixed-size ring of recent log records, each kept as a format string plus its encoded arguments.
+		@details The storage is allocated once by the constructor. Pushing a record evicts the oldest ones until the new record fits within
+	   the record limit and the byte limit, so a push never allocates. A record is stored as a small header followed by a payload of
+	   @ref Binary::encodeArgument bytes, leaving the formatting to whoever drains the ring; records whose text was already produced are
+	   stored as @ref Binary::PREFORMATTED_FORMAT with a single string argument. Records never wrap: one that would cross the end of the
+	   storage starts again at the beginning, so payloads can be handed out in place.
+		@note Not thread-safe; each logging thread owns its own ring.
+		@date --/--/----
+		@version x.x.x
+		@since x.x.x
+		@author Matthew Moore
+	*/
+	class BacktraceRing
+	{
+		public:
+			/*! @class Writer backtraceRing.h "include/Utility/Debug/Logging/backtraceRing.h"
+				@brief Appends payload bytes into the contiguous space reserved by @ref BacktraceRing::push.
+				@details Satisfies @ref Binary::ByteOutput.
+			*/
+			class Writer
+			{
+				public:
+					/*! @brief Copies @p size bytes from @p data into the reservation.
+						@param[in] data The bytes to copy.
+						@param[in] size The number of bytes to copy. The caller must not exceed the size passed to @ref BacktraceRing::push.
+					*/
+					void put(const void *data, const std::size_t size) noexcept
+					{
+						std::memcpy(mPosition, data, size);
+						mPosition += size;
+					}
+
+				private:
+					friend class BacktraceRing;
+
+					explicit Writer(std::byte *position) noexcept : mPosition{position}
+					{
+					}
+
+					std::byte *mPosition; /*!< Where the next byte goes */
+			};
+
+			/*! @struct Record backtraceRing.h "include/Utility/Debug/Logging/backtraceRing.h"
+				@brief One record as handed to the consumer of @ref BacktraceRing::drain.
+			*/
+			struct Record
+			{
+				spdlog::level::level_enum level{};		/*!< The record's level */
+				spdlog::log_clock::time_point time{};	/*!< When the record was logged */
+				std::string_view format{};				/*!< The format string; must have static storage duration */
+				bool complete{false};					/*!< Whether the formatted text is already a finished record for the file */
+				std::string_view payload{};				/*!< The encoded arguments; only valid until the ring is next modified */
+			};
+
+			// MARK: Constructors & Destructor
+
+			/*! @brief Creates a ring that keeps at most @p records records in at most @p bytes bytes.
+				@param[in] records The record limit; at least 1.
+				@param[in] bytes The byte limit, headers included.
+				@throws std::bad_alloc If the storage cannot be allocated.
+			*/
+			BacktraceRing(const ul records, const ul bytes);
+
+			// Do not allow copies or moves; writers hold references into the storage
+
+			BacktraceRing(const BacktraceRing &) = delete;
+			BacktraceRing(BacktraceRing &&) = delete;
+			BacktraceRing &operator=(const BacktraceRing &) = delete;
+			BacktraceRing &operator=(BacktraceRing &&) = delete;
+			~BacktraceRing() = default;
+
+			// MARK: Getters
+
+			/*! @brief Gets the record limit the ring was created with.
+				@return The maximum number of records kept.
+			*/
+			ATTR_NODISCARD ATTR_PURE ul recordLimit() const noexcept;
+
+			/*! @brief Gets the byte limit the ring was created with.
+				@return The size of the storage.
+			*/
+			ATTR_NODISCARD ATTR_PURE ul byteLimit() const noexcept;
+
+			/*! @brief Gets the number of records currently kept.
+				@return The record count.
+			*/
+			ATTR_NODISCARD ATTR_PURE ul size() const noexcept;
+
+			// MARK: Utility
+
+			/*! @brief Stores a record, evicting the oldest records until it fits.
+				@tparam Fill A callable invocable with `Writer &`.
+				@param[in] record The record's level, time, format and completeness; its payload member is ignored.
+				@param[in] payloadSize The exact number of bytes @p fill will write.
+				@param[in] fill Writes the encoded arguments through the supplied @ref Writer.
+				@return false, with the ring unchanged, if the record alone is larger than the byte limit.
+			*/
+			template <InvocableWithArgs<Writer &> Fill>
+			bool push(const Record &record, const std::size_t payloadSize, Fill &&fill)
+			{
+				if (!reserve(record, payloadSize))
+				{
+					return false;
+				}
+
+				Writer writer{mStorage.get() + (mHead % mByteLimit) + sizeof(Header)};
+				std::forward<Fill>(fill)(writer);
+				mHead += sizeof(Header) + payloadSize;
+
+				return true;
+			}
+
+			/*! @brief Hands every kept record to @p consume, oldest first, and empties the ring.
+				@tparam Consume A callable invocable with `const Record &`.
+				@param[in] consume Receives each record.
+			*/
+			template <InvocableWithArgs<const Record &> Consume>
+			void drain(Consume &&consume)
+			{
+				while (mCount != 0)
+				{
+					consume(take());
+				}
+			}
+
+		private:
+			/*! @struct Header backtraceRing.h "include/Utility/Debug/Logging/backtraceRing.h"
+				@brief The fixed-size part of a stored record, written ahead of its payload.
+			*/
+			struct Header
+			{
+				Project::Core::sl nanoseconds{0};	 /*!< The record's time since the log_clock epoch */
+				const char *format{nullptr};		 /*!< The format string's characters; nullptr marks padding up to the end of the storage */
+				Project::Core::ui formatSize{0};	 /*!< The format string's length */
+				Project::Core::ui payloadSize{0};	 /*!< The number of payload bytes that follow */
+				Project::Core::ub level{0};			 /*!< The record's level */
+				bool complete{false};				 /*!< See @ref Record::complete */
+			};
+
+			/*! @brief Evicts records until one of @p payloadSize bytes fits contiguously, then writes its header at @ref mHead.
+				@param[in] record The record's level, time, format and completeness.
+				@param[in] payloadSize The payload size.
+				@return false if the record can never fit.
+			*/
+			bool reserve(const Record &record, const std::size_t payloadSize);
+
+			/*! @brief Removes the oldest record, skipping any padding in front of it.
+				@pre The ring is not empty.
+				@return The record; its payload views @ref mStorage.
+			*/
+			Record take();
+
+			const ul mRecordLimit;						  /*!< The most records kept at once */
+			const ul mByteLimit;						  /*!< The size of mStorage */
+			const std::unique_ptr<std::byte[]> mStorage; /*!< Headers and payloads; a cursor maps to offset cursor % mByteLimit */
+			std::size_t mHead{0};						  /*!< The cursor after the newest record */
+			std::size_t mTail{0};						  /*!< The cursor of the oldest record */
+			ul mCount{0};								  /*!< The number of records kept */
+	};
+} // namespace Project::Utility::Debug::Logging
+
+#endif
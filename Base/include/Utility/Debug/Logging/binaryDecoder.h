@@ -0,0 +1,54 @@
+/*! @file binaryDecoder.h
+	@brief Contains the declaration of the offline decoder that turns binary log files back into text.
+	@date --/--/----
+	@version x.x.x
+	@since x.x.x
+	@author Matthew Moore
+*/
+
+#ifndef INCLUDE_UTILITY_DEBUG_LOGGING_BINARYDECODER_H
+#define INCLUDE_UTILITY_DEBUG_LOGGING_BINARYDECODER_H
+
+#include <istream>
+#include <optional>
+#include <ostream>
+#include <string>
+#include <string_view>
+
+#include "Core/attributeMacros.h"
+
+#include <spdlog/common.h>
+
+namespace Project::Utility::Debug::Logging::Binary
+{
+	/*! @brief Decodes a file written by @ref BinarySink into the text an spdlog file sink would have written.
+		@details Each record's format string is applied to its decoded arguments with fmt, and the result is passed through an spdlog pattern
+	   formatter together with the record's level, timestamp, thread id and the logger name from the file header, so every pattern flag
+	   except the source-location ones reproduces the original output. A file that was appended to by several sinks is decoded session by
+	   session.
+		@param[in,out] input The binary log, opened in binary mode.
+		@param[in,out] output Receives the decoded lines.
+		@param[in] pattern The spdlog pattern to format records with; empty selects spdlog's default pattern.
+		@return std::nullopt once the whole input has been decoded, otherwise one of the BINARY_DECODE_*_FAILURE messages. Every record
+	   before the failing one has already been written to @p output.
+		@date --/--/----
+		@version x.x.x
+		@since x.x.x
+		@author Matthew Moore
+	*/
+	ATTR_NODISCARD std::optional<std::string_view> decode(std::istream &input, std::ostream &output, const std::string &pattern = {});
+
+	/*! @brief Formats one record payload, as written by @ref encodeArgument, with its format string.
+		@param[in] format The record's format string.
+		@param[in] payload The record's encoded arguments.
+		@param[out] output Receives the message; cleared first.
+		@return false if the payload is malformed or does not match @p format.
+		@date --/--/----
+		@version x.x.x
+		@since x.x.x
+		@author Matthew Moore
+	*/
+	ATTR_NODISCARD bool formatPayload(std::string_view format, std::string_view payload, spdlog::memory_buf_t &output);
+} // namespace Project::Utility::Debug::Logging::Binary
+
+#endif
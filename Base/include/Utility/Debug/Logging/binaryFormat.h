@@ -0,0 +1,213 @@
+/*! @file binaryFormat.h
+	@brief Contains the layout of binary log files and the compile-time encoders for log arguments.
+	@date --/--/----
+	@version x.x.x
+	@since x.x.x
+	@author Matthew Moore
+*/
+
+#ifndef INCLUDE_UTILITY_DEBUG_LOGGING_BINARYFORMAT_H
+#define INCLUDE_UTILITY_DEBUG_LOGGING_BINARYFORMAT_H
+
+#include <array>
+#include <concepts>
+#include <cstddef>
+#include <string_view>
+#include <type_traits>
+
+#include "Core/cconcepts.h"
+#include "Core/typedefs.h"
+
+/*! @namespace Project::Utility::Debug::Logging::Binary
+	@brief The on-disk format shared by the binary log writer and the offline decoder.
+	@details A binary log file starts with @ref MAGIC, a `ui` @ref VERSION and the logger name (`ui` length followed by the bytes). It is
+   followed by a stream of entries, each starting with a @ref EntryKind byte:
+	- @ref EntryKind::Definition: `ui` format id, `ui` length, then the format string bytes. Always precedes the first record using the id.
+	- @ref EntryKind::Record: `ub` spdlog level, `ui` format id, `sl` nanoseconds since the system_clock epoch, `ul` thread id, `ui` payload
+	  length, then the payload: one @ref ArgumentTag byte per argument followed by its value.
+
+	Integers are widened to 64 bits, strings are stored as a `ui` length plus bytes, and every value is stored in native byte order, so a file
+	must be decoded on a machine with the same endianness.
+	@date --/--/----
+	@version x.x.x
+	@since x.x.x
+	@author Matthew Moore
+*/
+namespace Project::Utility::Debug::Logging::Binary
+{
+	using Project::Core::FloatingPoint;
+	using Project::Core::Integral;
+	using Project::Core::SignedIntegral;
+	using Project::Core::ub;
+	using Project::Core::ui;
+	using Project::Core::ul;
+	using Project::Core::sl;
+
+	/*! @brief The bytes every binary log file starts with. */
+	inline constexpr std::array<char, 8> MAGIC{'P', 'R', 'J', 'B', 'L', 'O', 'G', '\0'};
+
+	/*! @brief The format version written after @ref MAGIC; bumped whenever the layout changes. */
+	inline constexpr ui VERSION{1};
+
+	/*! @brief The format id reserved for records whose text was formatted on the calling thread; its format string is `{}`. */
+	inline constexpr ui PREFORMATTED_FORMAT_ID{0};
+
+	/*! @brief The format string registered under @ref PREFORMATTED_FORMAT_ID. */
+	inline constexpr std::string_view PREFORMATTED_FORMAT{"{}"};
+
+	/*! @brief The size of a record entry before its payload: kind, level, format id, timestamp, thread id and payload length. */
+	inline constexpr std::size_t RECORD_HEADER_SIZE{sizeof(ub) + sizeof(ub) + sizeof(ui) + sizeof(sl) + sizeof(ul) + sizeof(ui)};
+
+	/*! @enum EntryKind
+		@brief Identifies the entry that follows in a binary log file.
+	*/
+	enum class EntryKind : ub
+	{
+		Definition = 1, /*!< A format string registration */
+		Record = 2		/*!< A log call */
+	};
+
+	/*! @enum ArgumentTag
+		@brief Identifies how one encoded argument is stored and which C++ type it is decoded back into.
+	*/
+	enum class ArgumentTag : ub
+	{
+		Bool = 1,	  /*!< One byte, 0 or 1 */
+		Char = 2,	  /*!< One `char` */
+		Signed = 3,	  /*!< An `sl` */
+		Unsigned = 4, /*!< A `ul` */
+		Float = 5,	  /*!< A `float`; kept narrow because fmt prints floats and doubles differently */
+		Double = 6,	  /*!< A `double` */
+		String = 7,	  /*!< A `ui` length followed by the bytes */
+		Pointer = 8	  /*!< A `ul` address, printed as `0x...` */
+	};
+
+	/*! @concept ByteOutput
+		@brief Tests whether a type can receive raw bytes through `put(const void *, std::size_t)`.
+		@tparam T The type to test, e.g. @ref Containers::ByteRing::ByteRing::Writer.
+	*/
+	template <typename T>
+	concept ByteOutput = requires(T &output, const void *data, std::size_t size) { output.put(data, size); };
+
+	/*! @concept StringArgument
+		@brief Tests whether a log argument is stored as @ref ArgumentTag::String.
+		@tparam T The argument type, cv/ref qualifiers ignored.
+	*/
+	template <typename T>
+	concept StringArgument = std::is_convertible_v<const std::remove_cvref_t<T> &, std::string_view> &&
+							 !std::is_same_v<std::remove_cvref_t<T>, std::nullptr_t>;
+
+	/*! @concept BinaryArgument
+		@brief Tests whether a log argument can be encoded as raw bytes instead of being formatted on the calling thread.
+		@details Satisfied by `bool`, `char`, the other integral and floating-point types (except `long double`), anything convertible to
+	   `std::string_view`, and object pointers. Every other type makes the whole call fall back to formatting on the calling thread.
+		@tparam T The argument type, cv/ref qualifiers ignored.
+	*/
+	template <typename T>
+	concept BinaryArgument = (Integral<std::remove_cvref_t<T>>) ||
+							 (FloatingPoint<std::remove_cvref_t<T>> && !std::is_same_v<std::remove_cvref_t<T>, long double>) ||
+							 StringArgument<T> || std::is_pointer_v<std::remove_cvref_t<T>>;
+
+	/*! @brief Gets the number of payload bytes @p argument encodes to, including its tag.
+		@tparam T The argument type.
+		@param[in] argument The argument to measure.
+		@return The encoded size in bytes.
+	*/
+	template <BinaryArgument T>
+	constexpr std::size_t encodedSize(const T &argument) noexcept
+	{
+		using Type = std::remove_cvref_t<T>;
+
+		if constexpr (std::is_same_v<Type, bool> || std::is_same_v<Type, char>)
+		{
+			return sizeof(ub) + sizeof(ub);
+		}
+		else if constexpr (std::is_same_v<Type, float>)
+		{
+			return sizeof(ub) + sizeof(float);
+		}
+		else if constexpr (FloatingPoint<Type>)
+		{
+			return sizeof(ub) + sizeof(double);
+		}
+		else if constexpr (StringArgument<T>)
+		{
+			return sizeof(ub) + sizeof(ui) + std::string_view{argument}.size();
+		}
+		else
+		{
+			return sizeof(ub) + sizeof(ul);
+		}
+	}
+
+	/*! @brief Writes a fixed-size value in native byte order.
+		@tparam Output A @ref ByteOutput.
+		@tparam T A trivially copyable type.
+		@param[in,out] output Receives the bytes.
+		@param[in] value The value to write.
+	*/
+	template <ByteOutput Output, typename T>
+		requires std::is_trivially_copyable_v<T>
+	void put(Output &output, const T &value) noexcept
+	{
+		output.put(&value, sizeof(T));
+	}
+
+	/*! @brief Writes @p argument's tag and value.
+		@tparam Output A @ref ByteOutput.
+		@tparam T The argument type.
+		@param[in,out] output Receives exactly @ref encodedSize bytes.
+		@param[in] argument The argument to encode.
+	*/
+	template <ByteOutput Output, BinaryArgument T>
+	void encodeArgument(Output &output, const T &argument) noexcept
+	{
+		using Type = std::remove_cvref_t<T>;
+
+		if constexpr (std::is_same_v<Type, bool>)
+		{
+			put(output, ArgumentTag::Bool);
+			put(output, static_cast<ub>(argument ? 1 : 0));
+		}
+		else if constexpr (std::is_same_v<Type, char>)
+		{
+			put(output, ArgumentTag::Char);
+			put(output, argument);
+		}
+		else if constexpr (std::is_same_v<Type, float>)
+		{
+			put(output, ArgumentTag::Float);
+			put(output, argument);
+		}
+		else if constexpr (FloatingPoint<Type>)
+		{
+			put(output, ArgumentTag::Double);
+			put(output, static_cast<double>(argument));
+		}
+		else if constexpr (StringArgument<T>)
+		{
+			const std::string_view text{argument};
+
+			put(output, ArgumentTag::String);
+			put(output, static_cast<ui>(text.size()));
+			output.put(text.data(), text.size());
+		}
+		else if constexpr (std::is_pointer_v<Type>)
+		{
+			put(output, ArgumentTag::Pointer);
+			put(output, reinterpret_cast<ul>(argument)); // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+		}
+		else if constexpr (SignedIntegral<Type>)
+		{
+			put(output, ArgumentTag::Signed);
+			put(output, static_cast<sl>(argument));
+		}
+		else
+		{
+			put(output, ArgumentTag::Unsigned);
+			put(output, static_cast<ul>(argument));
+		}
+	}
+} // namespace Project::Utility::Debug::Logging::Binary
+
+#endif
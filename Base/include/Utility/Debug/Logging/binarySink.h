@@ -0,0 +1,242 @@
+/*! @file binarySink.h
+	@brief Contains the declaration of an spdlog sink that stores raw log arguments and defers all formatting to an offline decoder.
+	@date --/--/----
+	@version x.x.x
+	@since x.x.x
+	@author Matthew Moore
+*/
+
+#ifndef INCLUDE_UTILITY_DEBUG_LOGGING_BINARYSINK_H
+#define INCLUDE_UTILITY_DEBUG_LOGGING_BINARYSINK_H
+
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "Core/attributeMacros.h"
+#include "Core/cconcepts.h"
+#include "Core/typedefs.h"
+#include "Utility/Debug/Logging/binaryFormat.h"
+#include "Utility/Debug/Logging/loggerOptions.h"
+#include "Utility/Debug/Logging/threadBufferWriter.h"
+#include "Utility/Debug/Logging/tscClock.h"
+
+#include <spdlog/common.h>
+#include <spdlog/details/log_msg.h>
+#include <spdlog/details/os.h>
+#include <spdlog/formatter.h>
+#include <spdlog/sinks/sink.h>
+
+namespace Project::Utility::Debug::Logging
+{
+	using Project::Core::InvocableWithArgs;
+	using Project::Core::sl;
+	using Project::Core::ub;
+	using Project::Core::ui;
+	using Project::Core::ul;
+
+	/*! @class BinarySink binarySink.h "include/Utility/Debug/Logging/binarySink.h"
+		@brief An spdlog sink whose file holds format ids and raw argument bytes instead of text.
+		@details @ref Logger calls @ref logDeferred directly, bypassing spdlog's formatting: the call site's format string is registered once
+	   (the id is cached per thread, keyed by the string's address), and each call only copies the id, a timestamp, the thread id and the
+	   encoded arguments into the calling thread's own buffer in a @ref ThreadBufferWriter. Its writer thread merges the buffers by timestamp
+	   and copies the records into the file untouched, preceded by any format strings the file has not seen yet, so the common call makes no
+	   system call and touches no shared state. The offline decoder (see binaryDecoder.h) turns the file back into the text spdlog would have
+	   produced. Records that reach the sink through spdlog itself arrive already formatted and are stored as a single string argument.
+		@note Records are written in timestamp order within each writer pass; see @ref ThreadBufferWriter for the exact guarantee.
+		@date --/--/----
+		@version x.x.x
+		@since x.x.x
+		@author Matthew Moore
+	*/
+	class BinarySink final : public spdlog::sinks::sink
+	{
+		public:
+			// MARK: Constructors & Destructor
+
+			/*! @brief Opens @p fileName for appending, writes the file header and starts the writer thread.
+				@param[in] fileName The path of the binary log file.
+				@param[in] loggerName The logger name stored in the header, reproduced by the decoder's `%n` flag.
+				@param[in] threadBufferBytes The minimum size of each thread's buffer; rounded up to a power of two.
+				@param[in] policy What a call does when its thread's buffer is full.
+				@param[in] clock Where @ref logDeferred and @ref logFormatted read their timestamps.
+				@throws spdlog::spdlog_ex If the file cannot be opened or the header cannot be written.
+				@throws std::system_error If the writer thread cannot be started.
+			*/
+			BinarySink(const std::string &fileName, std::string_view loggerName, const ul threadBufferBytes, const OverflowPolicy policy,
+					   const ClockSource clock = ClockSource::System);
+
+			// Do not allow copies or moves; the writer's callbacks hold pointers to this sink
+
+			BinarySink(const BinarySink &) = delete;
+			BinarySink(BinarySink &&) = delete;
+			BinarySink &operator=(const BinarySink &) = delete;
+			BinarySink &operator=(BinarySink &&) = delete;
+
+			/*! @brief Writes every buffered record, flushes the file and joins the writer thread. */
+			~BinarySink() override;
+
+			// MARK: Getters
+
+			/*! @brief Gets the number of records discarded by the overflow policy or too large for a thread buffer, plus failed file writes.
+				@return The running total since construction. A failed write loses a whole batch but counts once.
+			*/
+			ATTR_NODISCARD ul droppedCount() const noexcept;
+
+			// MARK: Utility
+
+			/*! @brief Records a call without formatting it.
+				@tparam Args The argument types; all must satisfy @ref Binary::BinaryArgument.
+				@param[in] level The record's level.
+				@param[in] format The call site's format string. Must have static storage duration, as every compile-time checked format does.
+				@param[in] args The arguments, encoded by value.
+				@throws std::bad_alloc If the calling thread's buffer or a new format registration cannot be allocated.
+			*/
+			template <Binary::BinaryArgument... Args>
+			void logDeferred(const spdlog::level::level_enum level, const std::string_view format, const Args &...args)
+			{
+				const std::size_t payloadSize{(std::size_t{0} + ... + Binary::encodedSize(args))};
+
+				push(level, formatId(format), TscClock::now(mClock), spdlog::details::os::thread_id(), payloadSize,
+					 [&args...](ThreadBufferWriter::Ring::Writer &writer) { (Binary::encodeArgument(writer, args), ...); });
+			}
+
+			/*! @brief Records a call whose text has already been formatted.
+				@param[in] level The record's level.
+				@param[in] text The formatted message.
+				@throws std::bad_alloc If the calling thread's buffer cannot be allocated.
+			*/
+			void logFormatted(const spdlog::level::level_enum level, const std::string_view text);
+
+			// MARK: spdlog::sinks::sink
+
+			/*! @brief Stores a record produced by spdlog::logger as preformatted text.
+				@param[in] msg The record; its payload has already been formatted by spdlog.
+				@throws std::bad_alloc If the calling thread's buffer cannot be allocated.
+			*/
+			void log(const spdlog::details::log_msg &msg) override;
+
+			/*! @brief Blocks until every record logged before the call has been written and the file has been flushed. */
+			void flush() override;
+
+			/*! @brief Ignored; the pattern is chosen when the file is decoded.
+				@param[in] pattern Unused.
+			*/
+			void set_pattern(const std::string &pattern) override;
+
+			/*! @brief Ignored; the formatter is chosen when the file is decoded.
+				@param[in] sinkFormatter Unused.
+			*/
+			void set_formatter(std::unique_ptr<spdlog::formatter> sinkFormatter) override;
+
+		private:
+			/*! @struct FormatCacheEntry binarySink.h "include/Utility/Debug/Logging/binarySink.h"
+				@brief One slot of the per-thread format id cache.
+			*/
+			struct FormatCacheEntry
+			{
+				const char *data{nullptr}; /*!< The format string's address */
+				std::size_t size{0};	   /*!< The format string's length */
+				ui id{0};				   /*!< The registered id */
+			};
+
+			/*! @brief The number of slots in the per-thread format id cache; a power of two. */
+			static constexpr std::size_t FORMAT_CACHE_SIZE{256};
+
+			/*! @brief The offset of the timestamp in a file record; the buffered body omits it, since the frame already carries it. */
+			static constexpr std::size_t TIMESTAMP_OFFSET{sizeof(Binary::EntryKind) + sizeof(ub) + sizeof(ui)};
+
+			// MARK: Private Member Functions
+
+			/*! @brief Gets the id of @p format, registering it on first use.
+				@details Looks the string's address up in a direct-mapped per-thread cache first, so the shared registry is only consulted once
+			   per call site and thread (or after a cache collision).
+				@param[in] format A format string with static storage duration.
+				@return The process-wide id of @p format.
+			*/
+			static ui formatId(const std::string_view format)
+			{
+				thread_local std::array<FormatCacheEntry, FORMAT_CACHE_SIZE> cache{};
+
+				// Format strings are at least byte aligned and usually far apart, so drop the low bits that rarely differ
+				constexpr unsigned ALIGNMENT_BITS{3};
+				FormatCacheEntry &entry{
+					cache[(reinterpret_cast<std::uintptr_t>(format.data()) >> ALIGNMENT_BITS) & (FORMAT_CACHE_SIZE - 1)]}; // NOLINT
+
+				if (entry.data != format.data() || entry.size != format.size()) ATTR_UNLIKELY
+				{
+					entry = FormatCacheEntry{.data = format.data(), .size = format.size(), .id = registerFormat(format)};
+				}
+
+				return entry.id;
+			}
+
+			/*! @brief Looks @p format up in the process-wide registry, adding it if it is new.
+				@param[in] format A format string with static storage duration.
+				@return The id of @p format.
+			*/
+			static ui registerFormat(const std::string_view format);
+
+			/*! @brief Copies the format strings registered since @p first.
+				@param[in] first The first id to copy.
+				@param[out] formats Receives the strings with ids `first`, `first + 1`, ...
+			*/
+			static void registeredFormats(const ui first, std::vector<std::string_view> &formats);
+
+			/*! @brief Writes one record into the calling thread's buffer.
+				@tparam Fill A callable invocable with `ThreadBufferWriter::Ring::Writer &` that writes exactly @p payloadSize bytes.
+				@param[in] level The record's level.
+				@param[in] id The record's format id.
+				@param[in] time The record's timestamp.
+				@param[in] threadId The logging thread's id.
+				@param[in] payloadSize The number of bytes @p fill writes.
+				@param[in] fill Writes the encoded arguments.
+			*/
+			template <InvocableWithArgs<ThreadBufferWriter::Ring::Writer &> Fill>
+			void push(const spdlog::level::level_enum level, const ui id, const spdlog::log_clock::time_point time, const std::size_t threadId,
+					  const std::size_t payloadSize, Fill &&fill)
+			{
+				const sl timestamp{std::chrono::duration_cast<std::chrono::nanoseconds>(time.time_since_epoch()).count()};
+
+				mWriter.push(timestamp, Binary::RECORD_HEADER_SIZE - sizeof(sl) + payloadSize, [&](ThreadBufferWriter::Ring::Writer &writer) {
+					Binary::put(writer, Binary::EntryKind::Record);
+					Binary::put(writer, static_cast<ub>(level));
+					Binary::put(writer, id);
+					Binary::put(writer, static_cast<ul>(threadId));
+					Binary::put(writer, static_cast<ui>(payloadSize));
+					fill(writer);
+				});
+			}
+
+			/*! @brief Builds the file header written when the sink opens its file.
+				@param[in] loggerName The logger name stored in the header.
+				@return The encoded header.
+			*/
+			static std::string header(std::string_view loggerName);
+
+			/*! @brief Appends a definition for every format registered since the last batch. Writer thread only.
+				@param[in,out] batch The batch about to receive records.
+			*/
+			void defineFormats(spdlog::memory_buf_t &batch);
+
+			/*! @brief Appends one buffered record to @p batch in file form, restoring its timestamp. Writer thread only.
+				@param[in,out] batch The batch to append to.
+				@param[in] timestamp The record's timestamp from its frame.
+				@param[in] body The buffered record without its timestamp.
+			*/
+			static void appendRecord(spdlog::memory_buf_t &batch, sl timestamp, std::span<const std::byte> body);
+
+			ui mDefinedFormats{0};						 /*!< The number of format ids already written to the file */
+			std::vector<std::string_view> mNewFormats{}; /*!< Scratch space for format strings registered since the last batch */
+			const ClockSource mClock;					 /*!< Where calls read their timestamps */
+			ThreadBufferWriter mWriter;					 /*!< The per-thread buffers and writer thread; declared last so it is joined first */
+	};
+} // namespace Project::Utility::Debug::Logging
+
+#endif
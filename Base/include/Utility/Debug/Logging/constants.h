@@ -9,8 +9,11 @@
 #ifndef INCLUDE_UTILITY_DEBUG_LOGGING_CONSTANTS_H
 #define INCLUDE_UTILITY_DEBUG_LOGGING_CONSTANTS_H
 
+#include <chrono>
 #include <string_view>
 
+#include "Core/typedefs.h"
+
 namespace Project::Utility::Debug::Logging
 {
 	/*! @brief The default logger name used for the static Logger wrapper. */
@@ -19,6 +22,69 @@ namespace Project::Utility::Debug::Logging
 	/*! @brief The default log file name used for the static Logger wrapper. */
 	constexpr std::string_view LOGGING_FILE_NAME{"project.log"};
 
+	/*! @brief The default number of records the asynchronous sink can hold before its overflow policy applies. */
+	inline constexpr Project::Core::ul LOGGING_ASYNC_QUEUE_CAPACITY{8'192};
+
+	/*! @brief The default number of bytes each thread's binary or per-thread log buffer can hold before its overflow policy applies. */
+	inline constexpr Project::Core::ul LOGGING_THREAD_BUFFER_BYTES{262'144};
+
+	/*! @brief How long a thread buffer writer sleeps between polls of the per-thread buffers when nobody wakes it. */
+	inline constexpr std::chrono::milliseconds LOGGING_THREAD_BUFFER_WRITER_INTERVAL{10};
+
+	/*! @brief The default number of bytes the memory-mapped sink pre-allocates and maps each time its file runs out of space. */
+	inline constexpr Project::Core::ul LOGGING_MAPPED_EXTENT_BYTES{16'777'216};
+
+	/*! @brief The default largest size of a memory-mapped log file; the sink reserves this much address space up front. */
+	inline constexpr Project::Core::ul LOGGING_MAPPED_LIMIT_BYTES{68'719'476'736};
+
+	/*! @brief The default number of batch buffers the io_uring sink keeps, and so the most writes it has in flight at once. */
+	inline constexpr Project::Core::ul LOGGING_URING_QUEUE_DEPTH{16};
+
+	/*! @brief The default size of each io_uring sink batch buffer; a record larger than this is written on its own. */
+	inline constexpr Project::Core::ul LOGGING_URING_BATCH_BYTES{262'144};
+
+	/*! @brief The default size each of a thread's formatting buffers is reserved at before its first record. */
+	inline constexpr Project::Core::ul LOGGING_FORMAT_BUFFER_BYTES{1'024};
+
+	/*! @brief The default size above which a thread's formatting buffer is given back after the record that grew it. */
+	inline constexpr Project::Core::ul LOGGING_FORMAT_BUFFER_LIMIT_BYTES{65'536};
+
+	/*! @brief The default number of bytes each thread's backtrace ring may use for the records it keeps. */
+	inline constexpr Project::Core::ul LOGGING_BACKTRACE_BYTES{65'536};
+
+	/*! @brief The most modules, the root module included, that can be registered for per-module log levels. */
+	inline constexpr Project::Core::ul LOGGING_MAX_MODULES{256};
+
+	/*! @brief How long the TSC clock measures the time-stamp counter against the steady clock to learn its frequency. */
+	inline constexpr std::chrono::milliseconds LOGGING_TSC_CALIBRATION{10};
+
+	/*! @brief How long a thread converts time-stamp counter readings from one anchor before reading the system clock again. */
+	inline constexpr std::chrono::milliseconds LOGGING_TSC_REANCHOR_INTERVAL{1'000};
+
+	/*! @brief The default number of call sites the Logger's rate limiter can track; later sites are not limited. */
+	inline constexpr Project::Core::ul LOGGING_RATE_LIMIT_SITES{1'024};
+
+	/*! @brief How often a call site whose records keep being held back reports how many it has held back. */
+	inline constexpr std::chrono::milliseconds LOGGING_RATE_LIMIT_SUMMARY_INTERVAL{10'000};
+
+	/*! @brief How often a thread whose records keep repeating reports how many repeats it has collapsed. */
+	inline constexpr std::chrono::milliseconds LOGGING_REPEAT_SUMMARY_INTERVAL{10'000};
+
+	/*! @brief How soon the background retirer checks again for a replaced Logger state that a logging call was still using. */
+	inline constexpr std::chrono::milliseconds LOGGING_RETIRE_INTERVAL{10};
+
+	/*! @brief The most sinks and streams the crash handler can drain; later ones lose their pending records on a crash. */
+	inline constexpr Project::Core::ul LOGGING_CRASH_DRAINS{32};
+
+	/*! @brief The size of the alternate stack the crash handler runs on, so a stack overflow can still be reported. */
+	inline constexpr Project::Core::ul LOGGING_CRASH_STACK_BYTES{65'536};
+
+	/*! @brief How long the crash handler waits for writer threads to finish moving a record before it drains the buffers anyway. */
+	inline constexpr std::chrono::milliseconds LOGGING_CRASH_QUIESCE_TIMEOUT{100};
+
+	/*! @brief The most stack frames the crash handler lists. */
+	inline constexpr Project::Core::ul LOGGING_CRASH_FRAMES{64};
+
     /*! @brief Error message returned when a call to @ref Logger::log fails. */
 	constexpr std::string_view LOG_LOG_FAILURE{
 		"Failed to log the log message. This likely indicates a severe issue with the logging system itself."};
@@ -46,6 +112,26 @@ namespace Project::Utility::Debug::Logging
 	/*! @brief Error message returned when a call to @ref Logger::critical fails. */
 	constexpr std::string_view CRITICAL_LOG_FAILURE{
 		"Failed to log the critical message. This likely indicates a severe issue with the logging system itself."};
+
+	/*! @brief Error message returned when a durable record was written but could not be synced to disk. */
+	inline constexpr std::string_view DURABLE_LOG_FAILURE{
+		"The log message was written but could not be synced to disk; it may be lost if the machine fails."};
+
+	/*! @brief Warning written to a new asynchronous log when the crash handler has no slot left for its queue. */
+	inline constexpr std::string_view LOGGING_CRASH_DRAIN_UNAVAILABLE{
+		"Every crash handler drain slot is taken; records still queued when the process crashes will be lost."};
+
+	/*! @brief Error message returned when a binary log does not start with a valid header. */
+	inline constexpr std::string_view BINARY_DECODE_HEADER_FAILURE{"The input is not a binary log file or was written by an unsupported version."};
+
+	/*! @brief Error message returned when a binary log ends in the middle of an entry. */
+	inline constexpr std::string_view BINARY_DECODE_TRUNCATED_FAILURE{"The binary log ends in the middle of an entry."};
+
+	/*! @brief Error message returned when a binary log contains an entry the decoder does not understand. */
+	inline constexpr std::string_view BINARY_DECODE_CORRUPT_FAILURE{"The binary log contains an unknown entry, argument or format id."};
+
+	/*! @brief Error message returned when a binary log record's arguments do not match its format string. */
+	inline constexpr std::string_view BINARY_DECODE_FORMAT_FAILURE{"A binary log record's arguments do not match its format string."};
 } // namespace Project::Utility::Debug::Logging
 
 #endif
\ No newline at end of file
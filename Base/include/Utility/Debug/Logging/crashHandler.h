@@ -0,0 +1,137 @@
+/*! @file crashHandler.h
+	@brief Contains the declaration of the fatal-signal handler that writes pending log records and a stack trace before the process dies.
+	@date --/--/----
+	@version x.x.x
+	@since x.x.x
+	@author Matthew Moore
+*/
+
+#ifndef INCLUDE_UTILITY_DEBUG_LOGGING_CRASHHANDLER_H
+#define INCLUDE_UTILITY_DEBUG_LOGGING_CRASHHANDLER_H
+
+#include <cstddef>
+#include <cstdio>
+#include <string>
+#include <string_view>
+
+#include <csignal>
+
+#include "Core/attributeMacros.h"
+
+#include <spdlog/common.h>
+
+namespace Project::Utility::Debug::Logging
+{
+	/*! @class CrashHandler crashHandler.h "include/Utility/Debug/Logging/crashHandler.h"
+		@brief Handles SIGSEGV, SIGBUS, SIGFPE, SIGILL and SIGABRT by writing out whatever the logging sinks still hold, followed by a crash
+	   report, then lets the signal take its course.
+		@details The handler only does what is async-signal-safe: it never allocates, locks or calls into stdio. Sinks that buffer records
+	   register a drain, a plain function plus a context pointer kept in a fixed table of @ref LOGGING_CRASH_DRAINS slots, and the handler
+	   calls each drain in turn once every @ref WriteScope has closed. Drains write raw bytes with `write(2)`: @ref AsyncSink writes the records still in its queue, and every
+	   stdio stream opened with @ref streamEvents (spdlog's file sinks and @ref RotatingFile) writes the bytes still sitting in its
+	   buffer. The report names the signal and faulting address and lists the stack with `backtrace_symbols_fd`, which resolves the names
+	   of exported functions (link with `-rdynamic` to see them all). Afterwards the handler restores the disposition that was in place
+	   before @ref install and re-raises the signal, so core dumps and outer handlers still see it. The handler runs on an alternate stack
+	   of @ref LOGGING_CRASH_STACK_BYTES for the thread that called @ref install, so a stack overflow there is reported too.
+		@note The handler reads buffers other threads may still be writing to, so the records nearest the crash can be torn or written
+	   twice. Stdio buffers are only reached on glibc.
+		@date --/--/----
+		@version x.x.x
+		@since x.x.x
+		@author Matthew Moore
+	*/
+	class CrashHandler
+	{
+		public:
+			/*! @brief Writes a sink's pending records to @p file from inside the signal handler; must be async-signal-safe. */
+			using Drain = void (*)(const void *context, int file) noexcept;
+
+			/*! @class WriteScope crashHandler.h "include/Utility/Debug/Logging/crashHandler.h"
+				@brief Marks a writer thread as moving records between buffers that drains read, e.g. from a queue into a stdio stream.
+				@details The handler waits for open scopes to close before it runs the drains, for at most
+			   @ref LOGGING_CRASH_QUIESCE_TIMEOUT in case the crash happened inside one, so a record is never half-way between two buffers
+			   when they are drained. Once a fatal signal has arrived, opening a scope parks the thread for good instead.
+			*/
+			class WriteScope
+			{
+				public:
+					/*! @brief Opens the scope, or parks the calling thread if the handler is running. */
+					WriteScope() noexcept;
+
+					WriteScope(const WriteScope &) = delete;
+					WriteScope(WriteScope &&) = delete;
+					WriteScope &operator=(const WriteScope &) = delete;
+					WriteScope &operator=(WriteScope &&) = delete;
+
+					/*! @brief Closes the scope. */
+					~WriteScope();
+			};
+
+			// Do not allow instantiation; signal dispositions are process-wide
+
+			CrashHandler() = delete;
+			CrashHandler(const CrashHandler &) = delete;
+			CrashHandler(CrashHandler &&) = delete;
+			CrashHandler &operator=(const CrashHandler &) = delete;
+			CrashHandler &operator=(CrashHandler &&) = delete;
+			~CrashHandler() = delete;
+
+			// MARK: Static Member Functions
+
+			/*! @brief Installs the handler, or points an installed handler at a new file.
+				@details Checks that @p fileName can be opened for appending and performs the first stack walk up front, so the handler
+			   never has to load the unwinder. The handler opens the path again when a signal arrives, so the report follows a rotated
+			   log to its live file and lands after the records the sinks have already written.
+				@param[in] fileName The log file the report is appended to; at most PATH_MAX - 1 bytes.
+				@return true if the handler is installed and writing to @p fileName.
+			*/
+			ATTR_NODISCARD static bool install(const std::string &fileName);
+
+			/*! @brief Restores the signal dispositions that were in place before @ref install. */
+			static void uninstall() noexcept;
+
+			/*! @brief Tests whether the handler is installed.
+				@return true between @ref install and @ref uninstall.
+			*/
+			ATTR_NODISCARD static bool installed() noexcept;
+
+			/*! @brief Registers @p drain to run with @p context when a fatal signal arrives.
+				@param[in] drain The function that writes the pending records.
+				@param[in] context Identifies the sink; also the key for @ref removeDrain.
+				@return false if every slot is taken, in which case the sink's records are not written on a crash.
+			*/
+			static bool addDrain(Drain drain, const void *context) noexcept;
+
+			/*! @brief Unregisters the drain added with @p context; must be called before the context is destroyed.
+				@param[in] context The context passed to @ref addDrain.
+			*/
+			static void removeDrain(const void *context) noexcept;
+
+			/*! @brief Builds file event handlers that register every stdio stream a file sink opens, and unregister it before it closes.
+				@return Handlers for spdlog's file sinks and file_helper.
+			*/
+			ATTR_NODISCARD ATTR_CONST static spdlog::file_event_handlers streamEvents();
+
+			/*! @brief Writes @p text to @p file with `write(2)`, retrying partial writes; async-signal-safe.
+				@param[in] file The descriptor to write to.
+				@param[in] text The bytes to write.
+			*/
+			static void writeRaw(const int file, std::string_view text) noexcept;
+
+		private:
+			/*! @brief The signal handler.
+				@param[in] signal The signal number.
+				@param[in] info What raised the signal, including the faulting address.
+				@param[in] context The interrupted thread's context; unused.
+			*/
+			static void handle(int signal, siginfo_t *info, void *context) noexcept;
+
+			/*! @brief Writes the bytes buffered in a stdio stream to the stream's own descriptor.
+				@param[in] context The std::FILE.
+				@param[in] file Unused; the stream's bytes belong to the stream's file.
+			*/
+			static void drainStream(const void *context, int file) noexcept;
+	};
+} // namespace Project::Utility::Debug::Logging
+
+#endif
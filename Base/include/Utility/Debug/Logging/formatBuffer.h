@@ -0,0 +1,101 @@
+/*! @file formatBuffer.h
+	@brief Contains the declaration of the lease on one of the calling thread's pre-sized formatting buffers.
+	@date --/--/----
+	@version x.x.x
+	@since x.x.x
+	@author Matthew Moore
+*/
+
+#ifndef INCLUDE_UTILITY_DEBUG_LOGGING_FORMATBUFFER_H
+#define INCLUDE_UTILITY_DEBUG_LOGGING_FORMATBUFFER_H
+
+#include <array>
+#include <cstddef>
+#include <string_view>
+
+#include "Core/attributeMacros.h"
+#include "Core/typedefs.h"
+#include "Utility/Debug/Logging/loggerOptions.h"
+
+#include <spdlog/common.h>
+
+namespace Project::Utility::Debug::Logging
+{
+	using Project::Core::ub;
+	using Project::Core::ul;
+
+	/*! @class FormatBuffer formatBuffer.h "include/Utility/Debug/Logging/formatBuffer.h"
+		@brief Lends out one of the calling thread's formatting buffers for the lifetime of the lease.
+		@details Every thread owns one buffer per @ref Use, so the stages of a record that format at the same time (a message, the record
+	   wrapped around it, a summary written ahead of it and the line a sink writes) never share one. A lease empties its buffer and reserves
+	   @ref FormatBufferOptions::initialBytes the first time, so short records never reach the allocator; a longer record grows the buffer
+	   once and later ones of that size reuse it. When the lease ends, a buffer that has grown beyond @ref FormatBufferOptions::maxBytes is
+	   given back.
+		@note At most one lease per @ref Use may be held on a thread at a time; the buffer is only valid while the lease is held.
+		@date --/--/----
+		@version x.x.x
+		@since x.x.x
+		@author Matthew Moore
+	*/
+	class FormatBuffer
+	{
+		public:
+			/*! @enum Use
+				@brief Selects which of the calling thread's buffers a lease takes.
+			*/
+			enum class Use : ub
+			{
+				Message,  /*!< A formatted message */
+				Record,	  /*!< A structured or timestamped record built around a message */
+				Summary,  /*!< A rate-limit or repeat summary written ahead of the record that ended it */
+				Repeated, /*!< The message of a run of repeats, formatted again from its arguments for the repeat summary */
+				Sink,	  /*!< The line a synchronous sink writes to its file */
+			};
+
+			// MARK: Constructors & Destructor
+
+			/*! @brief Takes the calling thread's buffer for @p use, empty and with at least @p options initialBytes of capacity.
+				@param[in] use The buffer to take.
+				@param[in] options The buffer's size and high-water mark.
+				@throws std::bad_alloc If the buffer cannot be reserved.
+			*/
+			FormatBuffer(const Use use, const FormatBufferOptions &options);
+
+			FormatBuffer(const FormatBuffer &) = delete;
+			FormatBuffer(FormatBuffer &&) = delete;
+
+			/*! @brief Returns the buffer, giving its memory back if it grew beyond the high-water mark. */
+			~FormatBuffer();
+
+			// MARK: Operators
+
+			FormatBuffer &operator=(const FormatBuffer &) = delete;
+			FormatBuffer &operator=(FormatBuffer &&) = delete;
+
+			// MARK: Getters
+
+			/*! @brief Gets the leased buffer.
+				@return The buffer.
+			*/
+			ATTR_NODISCARD ATTR_PURE spdlog::memory_buf_t &get() noexcept;
+
+			/*! @brief Views the leased buffer's contents.
+				@return The contents; valid until the buffer is next written.
+			*/
+			ATTR_NODISCARD ATTR_PURE std::string_view view() const noexcept;
+
+		private:
+			/*! @brief The number of buffers each thread owns, one per @ref Use. */
+			static constexpr std::size_t USES{5};
+
+			/*! @brief Gets the calling thread's buffers.
+				@return The buffers, indexed by @ref Use.
+			*/
+			ATTR_NODISCARD static std::array<spdlog::memory_buf_t, USES> &buffers() noexcept;
+
+			spdlog::memory_buf_t &mBuffer; /*!< The leased buffer */
+			const ul mMaxBytes;			   /*!< The capacity above which the buffer is given back */
+	};
+} // namespace Project::Utility::Debug::Logging
+
+#endif
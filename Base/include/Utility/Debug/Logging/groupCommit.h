@@ -0,0 +1,108 @@
+/*! @file groupCommit.h
+	@brief Contains the declaration of the group commit that makes records durable with one fdatasync for every thread waiting at once.
+	@date --/--/----
+	@version x.x.x
+	@since x.x.x
+	@author Matthew Moore
+*/
+
+#ifndef INCLUDE_UTILITY_DEBUG_LOGGING_GROUPCOMMIT_H
+#define INCLUDE_UTILITY_DEBUG_LOGGING_GROUPCOMMIT_H
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <string>
+
+#include <sys/types.h>
+
+#include "Core/attributeMacros.h"
+#include "Core/typedefs.h"
+
+#include <spdlog/logger.h>
+
+namespace Project::Utility::Debug::Logging
+{
+	using Project::Core::ul;
+
+	/*! @class GroupCommit groupCommit.h "include/Utility/Debug/Logging/groupCommit.h"
+		@brief Blocks a thread until the records it has written are on disk, sharing each flush and fdatasync among every waiting thread.
+		@details Each call to @ref commit takes a ticket. The first thread to find no sync in progress becomes the leader: it holds the
+	   commit open for up to the configured wait so that more threads can join, notes the newest ticket, flushes the logger and
+	   fdatasyncs the file, then wakes everyone whose ticket that sync covered. Threads arriving while a sync runs wait for the next
+	   one, which the first of them leads. So a burst of N durable records costs about two syncs rather than N, and the file is never
+	   synced by two threads at once. The file is synced through a descriptor of its own, which is reopened when the path starts
+	   naming a different file, e.g. after a rotation; the replaced file is synced once more first. A file that cannot be synced at all,
+	   such as `/dev/null`, counts as durable.
+		@date --/--/----
+		@version x.x.x
+		@since x.x.x
+		@author Matthew Moore
+	*/
+	class GroupCommit
+	{
+		public:
+			// MARK: Constructors & Destructor
+
+			/*! @brief Opens @p fileName for syncing.
+				@param[in] fileName The log file; the sink that writes it must already have created it.
+				@param[in] maxWait How long a leader holds a commit open for other threads before syncing; 0 syncs straight away.
+				@throws spdlog::spdlog_ex If the file cannot be opened.
+			*/
+			GroupCommit(std::string fileName, const std::chrono::microseconds maxWait);
+
+			// Do not allow copies or moves; waiting threads hold a reference to the commit
+
+			GroupCommit(const GroupCommit &) = delete;
+			GroupCommit(GroupCommit &&) = delete;
+			GroupCommit &operator=(const GroupCommit &) = delete;
+			GroupCommit &operator=(GroupCommit &&) = delete;
+
+			/*! @brief Closes the file. No thread may still be inside @ref commit. */
+			~GroupCommit();
+
+			// MARK: Getters
+
+			/*! @brief Gets the number of syncs performed, to compare against the number of commits.
+				@return The running total since construction.
+			*/
+			ATTR_NODISCARD ul syncCount() const noexcept;
+
+			// MARK: Utility
+
+			/*! @brief Blocks until every record the calling thread has handed to @p logger is flushed and synced to disk.
+				@param[in] logger The logger whose sinks write the file; flushed by whichever thread leads the sync.
+				@return true once a sync that started after the call has succeeded; false if the sync this thread led failed.
+			*/
+			ATTR_NODISCARD bool commit(spdlog::logger &logger);
+
+		private:
+			// MARK: Private Member Functions
+
+			/*! @brief Flushes @p logger and fdatasyncs the file, following the path to a new file first if it was replaced.
+				@param[in] logger The logger to flush.
+				@return true if the file is durable; false if the sync failed or the flush threw, e.g. from the logger's error handler.
+			*/
+			ATTR_NODISCARD bool sync(spdlog::logger &logger);
+
+			/*! @brief Opens the file at mFileName and records its identity.
+				@return The descriptor, or -1 with errno set.
+			*/
+			ATTR_NODISCARD int open();
+
+			const std::string mFileName;				/*!< The path of the log file */
+			const std::chrono::microseconds mMaxWait;	/*!< How long a leader waits for followers */
+			int mFile{-1};								/*!< The descriptor synced; only touched by the leader */
+			dev_t mDevice{0};							/*!< The device of the file mFile refers to */
+			ino_t mInode{0};							/*!< The inode of the file mFile refers to */
+			std::mutex mMutex{};						/*!< Guards the ticket counters and mSyncing */
+			std::condition_variable mSynced{};			/*!< Signalled whenever a sync finishes */
+			ul mRequested{0};							/*!< The last ticket handed out */
+			ul mDurable{0};								/*!< Every ticket up to this one is durable */
+			bool mSyncing{false};						/*!< Whether a leader is between taking its batch and finishing its sync */
+			std::atomic<ul> mSyncs{0};					/*!< Syncs performed */
+	};
+} // namespace Project::Utility::Debug::Logging
+
+#endif
@@ -9,16 +9,52 @@
 #ifndef INCLUDE_UTILITY_DEBUG_LOGGING_LOGGER_H
 #define INCLUDE_UTILITY_DEBUG_LOGGING_LOGGER_H
 
+#include <array>
+#include <atomic>
+#include <concepts>
+#include <cstddef>
+#include <iterator>
+#include <limits>
 #include <memory>
+#include <mutex>
+#include <optional>
 #include <string>
 #include <string_view>
+#include <type_traits>
 #include <utility>
 
 #include "Core/attributeMacros.h"
+#include "Core/typedefs.h"
+#include "Utility/Debug/Logging/asyncSink.h"
+#include "Utility/Debug/Logging/backtraceRing.h"
+#include "Utility/Debug/Logging/binaryFormat.h"
+#include "Utility/Debug/Logging/binarySink.h"
 #include "Utility/Debug/Logging/constants.h"
+#include "Utility/Debug/Logging/formatBuffer.h"
+#include "Utility/Debug/Logging/groupCommit.h"
+#include "Utility/Debug/Logging/loggerOptions.h"
+#include "Utility/Debug/Logging/mappedFileSink.h"
+#include "Utility/Debug/Logging/moduleLevels.h"
+#include "Utility/Debug/Logging/perThreadSink.h"
+#include "Utility/Debug/Logging/rateLimiter.h"
+#include "Utility/Debug/Logging/repeatFilter.h"
+#include "Utility/Debug/Logging/structuredFormat.h"
+#include "Utility/Debug/Logging/tscClock.h"
 
+#include <spdlog/common.h>
+#include <spdlog/fmt/fmt.h>
 #include <spdlog/logger.h>
 
+#ifndef PROJECT_LOG_ACTIVE_LEVEL
+	/*! @def PROJECT_LOG_ACTIVE_LEVEL
+		@brief The lowest spdlog level (e.g. `SPDLOG_LEVEL_INFO`) whose Logger calls are compiled in.
+		@details Calls to the level-named Logger methods below this level compile to an immediate `std::nullopt`, so neither spdlog nor the
+	   format arguments are touched. The call-site argument expressions are still evaluated, as for any function call. Defaults to
+	   `SPDLOG_LEVEL_TRACE` (everything compiled in); the Makefile release flags raise it.
+	*/
+	#define PROJECT_LOG_ACTIVE_LEVEL SPDLOG_LEVEL_TRACE
+#endif
+
 /*! @namespace Project::Utility::Debug::Logging Provides debug and diagnostic logging facilities.
 	@date --/--/----
 	@version x.x.x
@@ -27,10 +63,29 @@
 */
 namespace Project::Utility::Debug::Logging
 {
+	/*! @concept RuntimeFormatString
+		@brief Tests whether a type is a format string that can only be checked at runtime.
+		@details Satisfied by anything convertible to `std::string_view` except character arrays. String literals therefore select the
+	   compile-time checked `fmt::format_string` overloads of @ref Logger, while `std::string`, `std::string_view` and `const char *` values
+	   select the runtime overloads.
+		@tparam T The type to test.
+	*/
+	template <typename T>
+	concept RuntimeFormatString = std::convertible_to<const T &, std::string_view> && !std::is_array_v<std::remove_cvref_t<T>>;
+
+	using Structured::kv;
+
+	class ModuleLogger;
+
 	/*! @class Logger logger.h "include/Utility/Debug/Logging/logger.h"
 		@brief A static-only wrapper around spdlog that provides global logging through deferred initialization.
 		@details All constructors, copy/move operators, and the destructor are deleted to prevent instantiation. Call @ref initialize before
 	   any logging methods. Internal state is stored via function-local statics to avoid static-initialization-order issues.
+
+	   The current spdlog logger and its sinks are published together as one immutable state through an atomic shared pointer, so
+	   @ref initialize and the renaming methods can replace them while other threads are logging. A call that is already running finishes on
+	   the state it started with; each thread notices a replacement with a single atomic load of a generation counter and only then takes a
+	   new reference. Replaced states are flushed on a background thread and destroyed there once no thread still refers to them.
 	*/
 	class Logger
 	{
@@ -55,42 +110,107 @@ namespace Project::Utility::Debug::Logging
 
 			// MARK: Getter
 
-			/*! @brief Gets the current logging level of the underlying spdlog logger.
+			/*! @brief Gets the logging level set by @ref setLevel, or applied from spdlog's registry by @ref initialize.
 				@pre @ref initialize must have been called before invoking this method.
-				@return The current spdlog logging level.
+				@return The current logging level.
 			*/
 			ATTR_NODISCARD static spdlog::level::level_enum getLevel();
 
+			/*! @brief Checks whether a record at @p level would be written, or kept for a backtrace, without touching the spdlog logger.
+				@details Compares against @ref PROJECT_LOG_ACTIVE_LEVEL and the level cached by @ref setLevel and @ref initialize. Marked noexcept
+			   because it is a single relaxed atomic load, suitable for guarding expensive argument computation at call sites.
+				@param[in] level The level to test.
+				@return true if the record passes both the compile-time and runtime level thresholds.
+			*/
+			ATTR_NODISCARD static bool isEnabled(const spdlog::level::level_enum level) noexcept
+			{
+				return level >= PROJECT_LOG_ACTIVE_LEVEL && level >= mActiveLevel.load(std::memory_order_relaxed);
+			}
+
+			/*! @brief Gets the number of records the asynchronous, binary or per-thread sink has discarded because of its overflow policy or a
+			   failed write, or the mapped sink has discarded at its size limit.
+				@return The dropped-record count of the current sink, or 0 when the logger is synchronous or uninitialized.
+			*/
+			ATTR_NODISCARD static Project::Core::ul getDroppedCount();
+
+			/*! @brief Checks whether consecutive identical records are being collapsed.
+				@return true between @ref setDeduplication calls that turned it on and off.
+			*/
+			ATTR_NODISCARD static bool isDeduplicating() noexcept
+			{
+				return mDeduplication.load(std::memory_order_relaxed) != 0;
+			}
+
 			// MARK: Setters
 
-			/*! @brief Sets the logging level of the underlying spdlog logger.
+			/*! @brief Sets the logging level of the underlying spdlog logger and of the cached level used by @ref isEnabled.
+				@details The level is also the one every @ref ModuleLogger without an override follows, so the module table is resolved
+			   again and republished with it; the spdlog logger's own level stays low enough for the most verbose module.
 				@pre @ref initialize must have been called before invoking this method.
+				@warning Changing the level directly on the spdlog logger bypasses the cache; records above the cached level are still filtered
+			   by spdlog, but records below it are discarded before spdlog sees them.
 				@param[in] level The spdlog level to set (e.g., spdlog::level::debug).
 			*/
 			static void setLevel(spdlog::level::level_enum level);
 
-			/*! @brief Replaces the logger with a new one using the given name, keeping the current file.
-				@details Destroys the existing spdlog logger and creates a new one via @ref initializeLogger.
+			/*! @brief Sets the level of @p module and of every module below it in the dotted hierarchy, replacing any earlier override with
+			   the same name.
+				@details The module table is resolved again and republished together with a new state, so logging threads switch to the new
+			   levels all at once on their next call. The spdlog logger's own level is lowered as far as the most verbose module needs.
+				@pre @ref initialize must have been called before invoking this method.
+				@param[in] module The module's dotted name, e.g. "net" for "net.http" too; "" covers every module without a closer override.
+				@param[in] level The level the module's records must reach.
+			*/
+			static void setModuleLevel(std::string_view module, spdlog::level::level_enum level);
+
+			/*! @brief Removes the override set for @p module, so it falls back to its closest overridden ancestor or to @ref setLevel's level.
+				@pre @ref initialize must have been called before invoking this method.
+				@param[in] module The name the override was set for.
+			*/
+			static void resetModuleLevel(std::string_view module);
+
+			/*! @brief Turns the collapsing of consecutive identical records on or off for every thread; takes effect on each thread's next call.
+				@details While on, each record is compared with the previous record the same thread wrote (see @ref RepeatFilter) by its format,
+			   level and raw arguments, so only records that are written get formatted; calls with arguments that have no binary encoding, or a
+			   runtime format, are formatted first and compared by their text. A repeat is counted instead of written. When the run ends, or
+			   after @ref LOGGING_REPEAT_SUMMARY_INTERVAL if it does not, one record at the repeated level reports it, e.g.
+			   `previous message repeated 41 times between 2024-05-01T12:34:56.789012Z and 2024-05-01T12:34:57.000001Z: disk full`. Runs
+			   still open are also reported when deduplication is turned off and, into the outgoing file, when the logger is re-initialized
+			   or renamed; the run of a thread that exits is reported by the next such call, or the next deduplicated record on any thread.
+			   While off, a call pays one relaxed load for the check. Structured records with fields are never collapsed, and records kept for
+			   a backtrace are not affected.
+				@param[in] enabled Whether to collapse repeats. Turning it on again starts every thread afresh.
+			*/
+			static void setDeduplication(bool enabled);
+
+			/*! @brief Replaces the logger with a new one using the given name, keeping the current file and options.
+				@details Creates a new spdlog logger via @ref initialize and swaps it in; the file is never truncated. Calls on other threads keep
+			   running throughout and never observe a missing logger.
 				@pre @ref initialize must have been called before invoking this method.
-				@post The internal logger is replaced; the previous logger is destroyed.
+				@post The internal logger is replaced; the previous logger is flushed and retired in the background. On failure the previous
+			   logger stays in place.
 				@param[in] loggerName The new name for the logger.
 				@throws std::runtime_error If spdlog re-initialization fails.
 			*/
 			ATTR_NODISCARD static bool setLoggerName(const std::string &loggerName);
 
-			/*! @brief Replaces the logger with a new one writing to the given file, keeping the current name.
-				@details Destroys the existing spdlog logger and creates a new one via @ref initializeLogger.
+			/*! @brief Replaces the logger with a new one writing to the given file, keeping the current name and options.
+				@details Creates a new spdlog logger via @ref initialize and swaps it in; the file is never truncated. Calls on other threads keep
+			   running throughout and never observe a missing logger.
 				@pre @ref initialize must have been called before invoking this method.
-				@post The internal logger is replaced; the previous logger is destroyed.
+				@post The internal logger is replaced; the previous logger is flushed and retired in the background. On failure the previous
+			   logger stays in place.
 				@param[in] fileName The new file path for log output.
 				@throws std::runtime_error If spdlog re-initialization fails.
 			*/
 			ATTR_NODISCARD static bool setFileName(const std::string &fileName);
 
-			/*! @brief Replaces the logger with a new one using the given name and file, keeping the current settings.
-				@details Destroys the existing spdlog logger and creates a new one via @ref initializeLogger.
+			/*! @brief Replaces the logger with a new one using the given name and file, keeping the current options.
+				@details Creates a new spdlog logger via @ref initialize and swaps it in; the file is never truncated. Calls on other threads keep
+			   running throughout and never observe a missing logger.
 				@pre @ref initialize must have been called before invoking this method.
-				@post The internal logger is replaced; the previous logger is destroyed.
+				@post The internal logger is replaced; the previous logger is flushed and retired in the background. On failure the previous
+			   logger stays in place.
 				@param[in] loggerName The new name for the logger.
 				@param[in] fileName The new file path for log output.
 				@throws std::runtime_error If spdlog re-initialization fails.
@@ -100,199 +220,1527 @@ namespace Project::Utility::Debug::Logging
 			// MARK: Static Member Function
 
 			/*! @brief Initializes the static logger with the given name and output file.
-				@details Creates a new spdlog file logger via spdlog::basic_logger_mt and stores it internally. Must be called before any
-			   logging methods (trace, debug, info, etc.).
+				@details Forwards to the @ref LoggerOptions overload with default options, so the logger is synchronous and only
+			   @p truncateFile is taken from the caller. Must be called before any logging methods (trace, debug, info, etc.).
 				@param[in] loggerName The name used to identify the logger within spdlog's registry.
 				@param[in] fileName The path to the log output file.
 				@param[in] truncateFile If true, the file at `fileName` will be truncated (cleared) before the logger is created. Defaults
 			   to false.
-				@throws std::runtime_error If spdlog initialization or file truncation fails.
+				@return true if the logger was created, false if truncation, file opening or registration failed.
 			*/
 			ATTR_NODISCARD static bool initialize(std::string_view loggerName, std::string_view fileName, const bool truncateFile = false);
 
+			/*! @brief Initializes the static logger with the given name, output file and options.
+				@details The sink, threads and handlers the new logger needs are chosen from @p options; each @ref LoggerOptions field documents
+			   what it changes. The options are kept for later calls to @ref setLoggerName, @ref setFileName and @ref setLoggerAndFileName.
+				@param[in] loggerName The name used to identify the logger within spdlog's registry.
+				@param[in] fileName The path to the log output file.
+				@param[in] options The settings for the new logger.
+				@return true if the logger was created, false if truncation, file opening or registration failed.
+				@throws std::system_error If the asynchronous, binary or per-thread writer thread, or the rotation archiver thread, cannot be
+			   started.
+			*/
+			ATTR_NODISCARD static bool initialize(std::string_view loggerName, std::string_view fileName, const LoggerOptions &options);
+
+			/*! @brief Gets the child logger of module @p name, registering the module the first time it is asked for.
+				@details Each module is given an index into a flat table of effective levels; keep the returned logger (e.g. in a static) so
+			   the name is only looked up once. Up to @ref LOGGING_MAX_MODULES modules can be registered; later ones share the root module's
+			   level.
+				@param[in] name The module's dotted name, e.g. "net.http".
+				@return The module's logger. It may be created before @ref initialize and stays valid across reinitialization.
+				@throws std::bad_alloc If the module cannot be registered.
+			*/
+			ATTR_NODISCARD static ModuleLogger module(std::string_view name);
+
 			// MARK: Static Template Member Functions
 
-			/*! @brief Logs a message at the specified level.
+			/*! @brief Logs a message at the specified level using a format string checked at compile time.
 				@pre @ref initialize must have been called before invoking this method.
 				@tparam Args The types of the format arguments.
-				@param[in] format The fmt-style format string.
+				@param[in] level The spdlog level to log at.
+				@param[in] format The fmt-style format string; a mismatch with @p args is a compile error.
 				@param[in] args The arguments to format into the message.
-				@param[in] level The spdlog level to log at (defaults to spdlog::level::info).
+				@return std::nullopt on success, or @ref LOG_LOG_FAILURE if spdlog reported an error.
 			*/
 			template <typename... Args>
-			ATTR_NODISCARD static std::optional<std::string_view> log(spdlog::level::level_enum level, const std::string_view &format,
+			ATTR_NODISCARD static std::optional<std::string_view> log(spdlog::level::level_enum level, fmt::format_string<Args...> format,
 																	  Args &&...args)
 			{
-				const std::shared_ptr<spdlog::logger> &logger = getLoggerInstance();
+				return write(level, LOG_LOG_FAILURE, format, std::forward<Args>(args)...);
+			}
 
-				try
-				{
-					logger->log(level, fmt::runtime(format), std::forward<Args>(args)...);
-				}
-				catch (const spdlog::spdlog_ex &ex)
-				{
-					return LOG_LOG_FAILURE;
-				}
+			/*! @brief Logs a message at the specified level using a format string only known at runtime.
+				@details The format is parsed and validated on every call; prefer the compile-time overload whenever the format is a literal.
+				@pre @ref initialize must have been called before invoking this method.
+				@tparam Format A string type satisfying @ref RuntimeFormatString.
+				@tparam Args The types of the format arguments.
+				@param[in] level The spdlog level to log at.
+				@param[in] format The fmt-style format string.
+				@param[in] args The arguments to format into the message.
+				@return std::nullopt on success, or @ref LOG_LOG_FAILURE if spdlog reported an error (e.g. a malformed format).
+			*/
+			template <RuntimeFormatString Format, typename... Args>
+			ATTR_NODISCARD static std::optional<std::string_view> log(spdlog::level::level_enum level, const Format &format, Args &&...args)
+			{
+				return write(level, LOG_LOG_FAILURE, fmt::runtime(format), std::forward<Args>(args)...);
+			}
 
-				return std::nullopt;
+			/*! @brief Logs a structured record at the specified level: a fixed message plus typed key/value fields.
+				@details Build the fields with @ref Structured::kv, e.g. `Logger::log(level, "request done", kv("latency_us", 42), kv("path", path))`.
+			   @ref LoggerOptions::recordFormat decides whether the record is written as JSON Lines, logfmt or the message followed by logfmt
+			   fields; each field's encoder is chosen at compile time from its type and writes into a per-thread buffer, so the call allocates
+			   nothing once that buffer has grown to fit its records. The message must be a literal and is never treated as a format string.
+				@pre @ref initialize must have been called before invoking this method.
+				@tparam N The size of the message literal.
+				@tparam Fields The @ref Structured::Field types.
+				@param[in] level The spdlog level to log at.
+				@param[in] message The message.
+				@param[in] fields The fields, in the order they are written.
+				@return std::nullopt on success, or @ref LOG_LOG_FAILURE if spdlog reported an error.
+			*/
+			template <std::size_t N, Structured::StructuredField... Fields>
+				requires (sizeof...(Fields) > 0)
+			ATTR_NODISCARD static std::optional<std::string_view> log(spdlog::level::level_enum level, const char (&message)[N], // NOLINT(cppcoreguidelines-avoid-c-arrays,hicpp-avoid-c-arrays,modernize-avoid-c-arrays)
+																	  Fields &&...fields)
+			{
+				return write(level, LOG_LOG_FAILURE, std::string_view{message}, std::forward<Fields>(fields)...);
+			}
+
+			/*! @brief Logs a message at the trace level using a format string checked at compile time.
+				@pre @ref initialize must have been called before invoking this method.
+				@tparam Args The types of the format arguments.
+				@param[in] format The fmt-style format string; a mismatch with @p args is a compile error.
+				@param[in] args The arguments to format into the message.
+				@return std::nullopt on success, or @ref TRACE_LOG_FAILURE if spdlog reported an error.
+			*/
+			template <typename... Args>
+			ATTR_NODISCARD static std::optional<std::string_view> trace(fmt::format_string<Args...> format, Args &&...args)
+			{
+				return writeAt<spdlog::level::trace>(TRACE_LOG_FAILURE, format, std::forward<Args>(args)...);
 			}
 
-			/*! @brief Logs a message at the trace level.
+			/*! @brief Logs a message at the trace level using a format string only known at runtime.
 				@pre @ref initialize must have been called before invoking this method.
+				@tparam Format A string type satisfying @ref RuntimeFormatString.
 				@tparam Args The types of the format arguments.
 				@param[in] format The fmt-style format string.
 				@param[in] args The arguments to format into the message.
+				@return std::nullopt on success, or @ref TRACE_LOG_FAILURE if spdlog reported an error (e.g. a malformed format).
+			*/
+			template <RuntimeFormatString Format, typename... Args>
+			ATTR_NODISCARD static std::optional<std::string_view> trace(const Format &format, Args &&...args)
+			{
+				return writeAt<spdlog::level::trace>(TRACE_LOG_FAILURE, fmt::runtime(format), std::forward<Args>(args)...);
+			}
+
+			/*! @brief Logs a structured record at the trace level: a fixed message plus typed key/value fields.
+				@details See the structured @ref log overload.
+				@pre @ref initialize must have been called before invoking this method.
+				@tparam N The size of the message literal.
+				@tparam Fields The @ref Structured::Field types.
+				@param[in] message The message; never treated as a format string.
+				@param[in] fields The fields, in the order they are written.
+				@return std::nullopt on success, or @ref TRACE_LOG_FAILURE if spdlog reported an error.
+			*/
+			template <std::size_t N, Structured::StructuredField... Fields>
+				requires (sizeof...(Fields) > 0)
+			ATTR_NODISCARD static std::optional<std::string_view> trace(const char (&message)[N], Fields &&...fields) // NOLINT(cppcoreguidelines-avoid-c-arrays,hicpp-avoid-c-arrays,modernize-avoid-c-arrays)
+			{
+				return writeAt<spdlog::level::trace>(TRACE_LOG_FAILURE, std::string_view{message}, std::forward<Fields>(fields)...);
+			}
+
+			/*! @brief Logs a message at the debug level using a format string checked at compile time.
+				@pre @ref initialize must have been called before invoking this method.
+				@tparam Args The types of the format arguments.
+				@param[in] format The fmt-style format string; a mismatch with @p args is a compile error.
+				@param[in] args The arguments to format into the message.
+				@return std::nullopt on success, or @ref DEBUG_LOG_FAILURE if spdlog reported an error.
 			*/
 			template <typename... Args>
-			ATTR_NODISCARD static std::optional<std::string_view> trace(const std::string_view &format, Args &&...args)
+			ATTR_NODISCARD static std::optional<std::string_view> debug(fmt::format_string<Args...> format, Args &&...args)
 			{
-				const std::shared_ptr<spdlog::logger> &logger = getLoggerInstance();
+				return writeAt<spdlog::level::debug>(DEBUG_LOG_FAILURE, format, std::forward<Args>(args)...);
+			}
 
-				try
-				{
-					logger->trace(fmt::runtime(format), std::forward<Args>(args)...);
-				}
-				catch (const spdlog::spdlog_ex &ex)
-				{
-					return TRACE_LOG_FAILURE;
-				}
+			/*! @brief Logs a message at the debug level using a format string only known at runtime.
+				@pre @ref initialize must have been called before invoking this method.
+				@tparam Format A string type satisfying @ref RuntimeFormatString.
+				@tparam Args The types of the format arguments.
+				@param[in] format The fmt-style format string.
+				@param[in] args The arguments to format into the message.
+				@return std::nullopt on success, or @ref DEBUG_LOG_FAILURE if spdlog reported an error (e.g. a malformed format).
+			*/
+			template <RuntimeFormatString Format, typename... Args>
+			ATTR_NODISCARD static std::optional<std::string_view> debug(const Format &format, Args &&...args)
+			{
+				return writeAt<spdlog::level::debug>(DEBUG_LOG_FAILURE, fmt::runtime(format), std::forward<Args>(args)...);
+			}
 
-				return std::nullopt;
+			/*! @brief Logs a structured record at the debug level: a fixed message plus typed key/value fields.
+				@details See the structured @ref log overload.
+				@pre @ref initialize must have been called before invoking this method.
+				@tparam N The size of the message literal.
+				@tparam Fields The @ref Structured::Field types.
+				@param[in] message The message; never treated as a format string.
+				@param[in] fields The fields, in the order they are written.
+				@return std::nullopt on success, or @ref DEBUG_LOG_FAILURE if spdlog reported an error.
+			*/
+			template <std::size_t N, Structured::StructuredField... Fields>
+				requires (sizeof...(Fields) > 0)
+			ATTR_NODISCARD static std::optional<std::string_view> debug(const char (&message)[N], Fields &&...fields) // NOLINT(cppcoreguidelines-avoid-c-arrays,hicpp-avoid-c-arrays,modernize-avoid-c-arrays)
+			{
+				return writeAt<spdlog::level::debug>(DEBUG_LOG_FAILURE, std::string_view{message}, std::forward<Fields>(fields)...);
+			}
+
+			/*! @brief Logs a message at the info level using a format string checked at compile time.
+				@pre @ref initialize must have been called before invoking this method.
+				@tparam Args The types of the format arguments.
+				@param[in] format The fmt-style format string; a mismatch with @p args is a compile error.
+				@param[in] args The arguments to format into the message.
+				@return std::nullopt on success, or @ref INFO_LOG_FAILURE if spdlog reported an error.
+			*/
+			template <typename... Args>
+			ATTR_NODISCARD static std::optional<std::string_view> info(fmt::format_string<Args...> format, Args &&...args)
+			{
+				return writeAt<spdlog::level::info>(INFO_LOG_FAILURE, format, std::forward<Args>(args)...);
 			}
 
-			/*! @brief Logs a message at the debug level.
+			/*! @brief Logs a message at the info level using a format string only known at runtime.
 				@pre @ref initialize must have been called before invoking this method.
+				@tparam Format A string type satisfying @ref RuntimeFormatString.
 				@tparam Args The types of the format arguments.
 				@param[in] format The fmt-style format string.
 				@param[in] args The arguments to format into the message.
+				@return std::nullopt on success, or @ref INFO_LOG_FAILURE if spdlog reported an error (e.g. a malformed format).
+			*/
+			template <RuntimeFormatString Format, typename... Args>
+			ATTR_NODISCARD static std::optional<std::string_view> info(const Format &format, Args &&...args)
+			{
+				return writeAt<spdlog::level::info>(INFO_LOG_FAILURE, fmt::runtime(format), std::forward<Args>(args)...);
+			}
+
+			/*! @brief Logs a structured record at the info level: a fixed message plus typed key/value fields.
+				@details See the structured @ref log overload.
+				@pre @ref initialize must have been called before invoking this method.
+				@tparam N The size of the message literal.
+				@tparam Fields The @ref Structured::Field types.
+				@param[in] message The message; never treated as a format string.
+				@param[in] fields The fields, in the order they are written.
+				@return std::nullopt on success, or @ref INFO_LOG_FAILURE if spdlog reported an error.
+			*/
+			template <std::size_t N, Structured::StructuredField... Fields>
+				requires (sizeof...(Fields) > 0)
+			ATTR_NODISCARD static std::optional<std::string_view> info(const char (&message)[N], Fields &&...fields) // NOLINT(cppcoreguidelines-avoid-c-arrays,hicpp-avoid-c-arrays,modernize-avoid-c-arrays)
+			{
+				return writeAt<spdlog::level::info>(INFO_LOG_FAILURE, std::string_view{message}, std::forward<Fields>(fields)...);
+			}
+
+			/*! @brief Logs a message at the warn level using a format string checked at compile time.
+				@pre @ref initialize must have been called before invoking this method.
+				@tparam Args The types of the format arguments.
+				@param[in] format The fmt-style format string; a mismatch with @p args is a compile error.
+				@param[in] args The arguments to format into the message.
+				@return std::nullopt on success, or @ref WARN_LOG_FAILURE if spdlog reported an error.
 			*/
 			template <typename... Args>
-			ATTR_NODISCARD static std::optional<std::string_view> debug(const std::string_view &format, Args &&...args)
+			ATTR_NODISCARD static std::optional<std::string_view> warn(fmt::format_string<Args...> format, Args &&...args)
 			{
-				const std::shared_ptr<spdlog::logger> &logger = getLoggerInstance();
+				return writeAt<spdlog::level::warn>(WARN_LOG_FAILURE, format, std::forward<Args>(args)...);
+			}
 
-				try
-				{
-					logger->debug(fmt::runtime(format), std::forward<Args>(args)...);
-				}
-				catch (const spdlog::spdlog_ex &ex)
-				{
-					return DEBUG_LOG_FAILURE;
-				}
+			/*! @brief Logs a message at the warn level using a format string only known at runtime.
+				@pre @ref initialize must have been called before invoking this method.
+				@tparam Format A string type satisfying @ref RuntimeFormatString.
+				@tparam Args The types of the format arguments.
+				@param[in] format The fmt-style format string.
+				@param[in] args The arguments to format into the message.
+				@return std::nullopt on success, or @ref WARN_LOG_FAILURE if spdlog reported an error (e.g. a malformed format).
+			*/
+			template <RuntimeFormatString Format, typename... Args>
+			ATTR_NODISCARD static std::optional<std::string_view> warn(const Format &format, Args &&...args)
+			{
+				return writeAt<spdlog::level::warn>(WARN_LOG_FAILURE, fmt::runtime(format), std::forward<Args>(args)...);
+			}
 
-				return std::nullopt;
+			/*! @brief Logs a structured record at the warn level: a fixed message plus typed key/value fields.
+				@details See the structured @ref log overload.
+				@pre @ref initialize must have been called before invoking this method.
+				@tparam N The size of the message literal.
+				@tparam Fields The @ref Structured::Field types.
+				@param[in] message The message; never treated as a format string.
+				@param[in] fields The fields, in the order they are written.
+				@return std::nullopt on success, or @ref WARN_LOG_FAILURE if spdlog reported an error.
+			*/
+			template <std::size_t N, Structured::StructuredField... Fields>
+				requires (sizeof...(Fields) > 0)
+			ATTR_NODISCARD static std::optional<std::string_view> warn(const char (&message)[N], Fields &&...fields) // NOLINT(cppcoreguidelines-avoid-c-arrays,hicpp-avoid-c-arrays,modernize-avoid-c-arrays)
+			{
+				return writeAt<spdlog::level::warn>(WARN_LOG_FAILURE, std::string_view{message}, std::forward<Fields>(fields)...);
+			}
+
+			/*! @brief Logs a message at the error level using a format string checked at compile time.
+				@pre @ref initialize must have been called before invoking this method.
+				@tparam Args The types of the format arguments.
+				@param[in] format The fmt-style format string; a mismatch with @p args is a compile error.
+				@param[in] args The arguments to format into the message.
+				@return std::nullopt on success, or @ref ERROR_LOG_FAILURE if spdlog reported an error.
+			*/
+			template <typename... Args>
+			ATTR_NODISCARD static std::optional<std::string_view> error(fmt::format_string<Args...> format, Args &&...args)
+			{
+				return writeAt<spdlog::level::err>(ERROR_LOG_FAILURE, format, std::forward<Args>(args)...);
 			}
 
-			/*! @brief Logs a message at the info level.
+			/*! @brief Logs a message at the error level using a format string only known at runtime.
 				@pre @ref initialize must have been called before invoking this method.
+				@tparam Format A string type satisfying @ref RuntimeFormatString.
 				@tparam Args The types of the format arguments.
 				@param[in] format The fmt-style format string.
 				@param[in] args The arguments to format into the message.
+				@return std::nullopt on success, or @ref ERROR_LOG_FAILURE if spdlog reported an error (e.g. a malformed format).
+			*/
+			template <RuntimeFormatString Format, typename... Args>
+			ATTR_NODISCARD static std::optional<std::string_view> error(const Format &format, Args &&...args)
+			{
+				return writeAt<spdlog::level::err>(ERROR_LOG_FAILURE, fmt::runtime(format), std::forward<Args>(args)...);
+			}
+
+			/*! @brief Logs a structured record at the error level: a fixed message plus typed key/value fields.
+				@details See the structured @ref log overload.
+				@pre @ref initialize must have been called before invoking this method.
+				@tparam N The size of the message literal.
+				@tparam Fields The @ref Structured::Field types.
+				@param[in] message The message; never treated as a format string.
+				@param[in] fields The fields, in the order they are written.
+				@return std::nullopt on success, or @ref ERROR_LOG_FAILURE if spdlog reported an error.
+			*/
+			template <std::size_t N, Structured::StructuredField... Fields>
+				requires (sizeof...(Fields) > 0)
+			ATTR_NODISCARD static std::optional<std::string_view> error(const char (&message)[N], Fields &&...fields) // NOLINT(cppcoreguidelines-avoid-c-arrays,hicpp-avoid-c-arrays,modernize-avoid-c-arrays)
+			{
+				return writeAt<spdlog::level::err>(ERROR_LOG_FAILURE, std::string_view{message}, std::forward<Fields>(fields)...);
+			}
+
+			/*! @brief Logs a message at the critical level using a format string checked at compile time.
+				@pre @ref initialize must have been called before invoking this method.
+				@tparam Args The types of the format arguments.
+				@param[in] format The fmt-style format string; a mismatch with @p args is a compile error.
+				@param[in] args The arguments to format into the message.
+				@return std::nullopt on success, or @ref CRITICAL_LOG_FAILURE if spdlog reported an error.
 			*/
 			template <typename... Args>
-			ATTR_NODISCARD static std::optional<std::string_view> info(const std::string_view &format, Args &&...args)
+			ATTR_NODISCARD static std::optional<std::string_view> critical(fmt::format_string<Args...> format, Args &&...args)
 			{
-				const std::shared_ptr<spdlog::logger> &logger = getLoggerInstance();
+				return writeAt<spdlog::level::critical>(CRITICAL_LOG_FAILURE, format, std::forward<Args>(args)...);
+			}
 
-				try
+			/*! @brief Logs a message at the critical level using a format string only known at runtime.
+				@pre @ref initialize must have been called before invoking this method.
+				@tparam Format A string type satisfying @ref RuntimeFormatString.
+				@tparam Args The types of the format arguments.
+				@param[in] format The fmt-style format string.
+				@param[in] args The arguments to format into the message.
+				@return std::nullopt on success, or @ref CRITICAL_LOG_FAILURE if spdlog reported an error (e.g. a malformed format).
+			*/
+			template <RuntimeFormatString Format, typename... Args>
+			ATTR_NODISCARD static std::optional<std::string_view> critical(const Format &format, Args &&...args)
+			{
+				return writeAt<spdlog::level::critical>(CRITICAL_LOG_FAILURE, fmt::runtime(format), std::forward<Args>(args)...);
+			}
+
+			/*! @brief Logs a structured record at the critical level: a fixed message plus typed key/value fields.
+				@details See the structured @ref log overload.
+				@pre @ref initialize must have been called before invoking this method.
+				@tparam N The size of the message literal.
+				@tparam Fields The @ref Structured::Field types.
+				@param[in] message The message; never treated as a format string.
+				@param[in] fields The fields, in the order they are written.
+				@return std::nullopt on success, or @ref CRITICAL_LOG_FAILURE if spdlog reported an error.
+			*/
+			template <std::size_t N, Structured::StructuredField... Fields>
+				requires (sizeof...(Fields) > 0)
+			ATTR_NODISCARD static std::optional<std::string_view> critical(const char (&message)[N], Fields &&...fields) // NOLINT(cppcoreguidelines-avoid-c-arrays,hicpp-avoid-c-arrays,modernize-avoid-c-arrays)
+			{
+				return writeAt<spdlog::level::critical>(CRITICAL_LOG_FAILURE, std::string_view{message}, std::forward<Fields>(fields)...);
+			}
+
+		private:
+			friend class ModuleLogger;
+
+			// MARK: Private Static Template Member Functions
+
+			/*! @brief Forwards a record to the spdlog logger and converts spdlog errors into a failure message.
+				@tparam Format Either a compile-time checked fmt::format_string or the result of fmt::runtime.
+				@tparam Args The types of the format arguments.
+				@param[in] level The spdlog level to log at.
+				@param[in] failureMessage The message returned when spdlog throws spdlog::spdlog_ex.
+				@param[in] format The format string.
+				@param[in] args The arguments to format into the message.
+				@return std::nullopt on success, otherwise @p failureMessage.
+			*/
+			template <typename Format, typename... Args>
+			ATTR_NODISCARD static std::optional<std::string_view> write(spdlog::level::level_enum level, std::string_view failureMessage,
+																		Format &&format, Args &&...args)
+			{
+				if (!isEnabled(level))
 				{
-					logger->info(fmt::runtime(format), std::forward<Args>(args)...);
+					return std::nullopt;
 				}
-				catch (const spdlog::spdlog_ex &ex)
+
+				const StateGuard guard{};
+				const State *state{guard.get()};
+
+				// The level is published after the first state, so a thread racing the first initialize may see one without the other
+				if (state == nullptr) ATTR_UNLIKELY
 				{
-					return INFO_LOG_FAILURE;
+					return std::nullopt;
 				}
 
-				return std::nullopt;
+				// A record below the logger's level only gets this far because the backtrace keeps it
+				if (state->options.backtrace.records != 0 && level < state->level) ATTR_UNLIKELY
+				{
+					return keepBacktrace(*state, level, failureMessage, format, args...);
+				}
+
+				return dispatch(*state, level, failureMessage, std::forward<Format>(format), std::forward<Args>(args)...);
 			}
 
-			/*! @brief Logs a message at the warn level.
-				@pre @ref initialize must have been called before invoking this method.
-				@tparam Args The types of the format arguments.
-				@param[in] format The fmt-style format string.
+			/*! @brief Forwards a @ref ModuleLogger record to the spdlog logger if its module's level lets it through.
+				@details The module's effective level is one relaxed load from @ref mModuleLevels, so a disabled record never pins the state.
+			   An enabled one is checked again against the pinned state's table, which a concurrent reconfiguration may have replaced. Records
+			   below the module's level are dropped, never kept for a backtrace.
+				@tparam Format Either a compile-time checked fmt::format_string, the result of fmt::runtime, or a structured record's message.
+				@tparam Args The types of the format arguments or structured fields.
+				@param[in] module The record's module.
+				@param[in] level The spdlog level to log at.
+				@param[in] failureMessage The message returned when spdlog throws spdlog::spdlog_ex.
+				@param[in] format The format string.
 				@param[in] args The arguments to format into the message.
+				@return std::nullopt on success or when the level is disabled, otherwise @p failureMessage.
 			*/
-			template <typename... Args>
-			ATTR_NODISCARD static std::optional<std::string_view> warn(const std::string_view &format, Args &&...args)
+			template <typename Format, typename... Args>
+			ATTR_NODISCARD static std::optional<std::string_view> writeModule(ModuleId module, spdlog::level::level_enum level,
+																			  std::string_view failureMessage, Format &&format, Args &&...args)
 			{
-				const std::shared_ptr<spdlog::logger> &logger = getLoggerInstance();
+				if (level < PROJECT_LOG_ACTIVE_LEVEL || level < moduleLevel(module))
+				{
+					return std::nullopt;
+				}
 
-				try
+				const StateGuard guard{};
+				const State *state{guard.get()};
+
+				if (state == nullptr || level < state->modules.level(module))
 				{
-					logger->warn(fmt::runtime(format), std::forward<Args>(args)...);
+					return std::nullopt;
 				}
-				catch (const spdlog::spdlog_ex &ex)
+
+				return dispatch(*state, level, failureMessage, std::forward<Format>(format), std::forward<Args>(args)...);
+			}
+
+			/*! @brief Hands a record to the binary sink, deferring formatting whenever the format and every argument allow it.
+				@details Compile-time checked formats have static storage, so their address can serve as the call-site id; runtime formats and
+			   arguments without a binary encoding are formatted here and stored as text instead.
+				@tparam Format Either a compile-time checked fmt::format_string or the result of fmt::runtime.
+				@tparam Args The types of the format arguments.
+				@param[in] sink The current binary sink.
+				@param[in] buffers The size of the calling thread's formatting buffers.
+				@param[in] level The spdlog level to log at.
+				@param[in] failureMessage The message returned when formatting fails.
+				@param[in] format The format string.
+				@param[in] args The arguments to record.
+				@return std::nullopt on success, otherwise @p failureMessage.
+			*/
+			template <typename Format, typename... Args>
+			ATTR_NODISCARD static std::optional<std::string_view> writeBinary(BinarySink &sink, const FormatBufferOptions &buffers,
+																			  spdlog::level::level_enum level, std::string_view failureMessage,
+																			  const Format &format, Args &...args)
+			{
+				// Only compile-time checked formats convert to a string view; fmt::runtime wrappers expose theirs as a member
+				constexpr bool checked{std::is_convertible_v<const Format &, fmt::string_view>};
+
+				if constexpr (checked && (Binary::BinaryArgument<Args> && ...))
+				{
+					const fmt::string_view text{format};
+					sink.logDeferred(level, std::string_view{text.data(), text.size()}, args...);
+				}
+				else
 				{
-					return WARN_LOG_FAILURE;
+					FormatBuffer message{FormatBuffer::Use::Message, buffers};
+
+					if (!formatMessage(message.get(), format, args...))
+					{
+						return failureMessage;
+					}
+
+					sink.logFormatted(level, message.view());
 				}
 
 				return std::nullopt;
 			}
 
-			/*! @brief Logs a message at the error level.
-				@pre @ref initialize must have been called before invoking this method.
+			/*! @brief Formats a message on the calling thread.
+				@tparam Format Either a compile-time checked fmt::format_string or the result of fmt::runtime.
 				@tparam Args The types of the format arguments.
-				@param[in] format The fmt-style format string.
+				@param[out] buffer Receives the message; cleared first.
+				@param[in] format The format string.
 				@param[in] args The arguments to format into the message.
+				@return false if fmt rejected the format or arguments.
 			*/
-			template <typename... Args>
-			ATTR_NODISCARD static std::optional<std::string_view> error(const std::string_view &format, Args &&...args)
+			template <typename Format, typename... Args>
+			ATTR_NODISCARD static bool formatMessage(spdlog::memory_buf_t &buffer, const Format &format, Args &...args)
 			{
-				const std::shared_ptr<spdlog::logger> &logger = getLoggerInstance();
+				buffer.clear();
 
 				try
 				{
-					logger->error(fmt::runtime(format), std::forward<Args>(args)...);
+					// Only compile-time checked formats convert to a string view; fmt::runtime wrappers expose theirs as a member
+					if constexpr (std::is_convertible_v<const Format &, fmt::string_view>)
+					{
+						fmt::vformat_to(std::back_inserter(buffer), fmt::string_view{format}, fmt::make_format_args(args...));
+					}
+					else
+					{
+						fmt::vformat_to(std::back_inserter(buffer), format.str, fmt::make_format_args(args...));
+					}
 				}
-				catch (const spdlog::spdlog_ex &ex)
+				catch (const fmt::format_error &ex)
 				{
-					return ERROR_LOG_FAILURE;
+					return false;
 				}
 
-				return std::nullopt;
+				return true;
 			}
 
-			/*! @brief Logs a message at the critical level.
-				@pre @ref initialize must have been called before invoking this method.
+			/*! @brief Forwards a record whose level is known at compile time, discarding it entirely when the level is compiled out.
+				@tparam Level The spdlog level of the record.
+				@tparam Format Either a compile-time checked fmt::format_string or the result of fmt::runtime.
 				@tparam Args The types of the format arguments.
-				@param[in] format The fmt-style format string.
+				@param[in] failureMessage The message returned when spdlog throws spdlog::spdlog_ex.
+				@param[in] format The format string.
 				@param[in] args The arguments to format into the message.
+				@return std::nullopt on success or when the level is disabled, otherwise @p failureMessage.
 			*/
-			template <typename... Args>
-			ATTR_NODISCARD static std::optional<std::string_view> critical(const std::string_view &format, Args &&...args)
+			template <spdlog::level::level_enum Level, typename Format, typename... Args>
+			ATTR_NODISCARD static std::optional<std::string_view> writeAt(std::string_view failureMessage, Format &&format, Args &&...args)
 			{
-				const std::shared_ptr<spdlog::logger> &logger = getLoggerInstance();
-
-				try
+				if constexpr (Level < PROJECT_LOG_ACTIVE_LEVEL)
 				{
-					logger->critical(fmt::runtime(format), std::forward<Args>(args)...);
+					return std::nullopt;
 				}
-				catch (const spdlog::spdlog_ex &ex)
+				else
 				{
-					return CRITICAL_LOG_FAILURE;
+					return write(Level, failureMessage, std::forward<Format>(format), std::forward<Args>(args)...);
 				}
+			}
 
-				return std::nullopt;
+			/*! @brief Forwards a @ref ModuleLogger record whose level is known at compile time, discarding it entirely when the level is
+			   compiled out.
+				@tparam Level The spdlog level of the record.
+				@tparam Format Either a compile-time checked fmt::format_string, the result of fmt::runtime, or a structured record's message.
+				@tparam Args The types of the format arguments or structured fields.
+				@param[in] module The record's module.
+				@param[in] failureMessage The message returned when spdlog throws spdlog::spdlog_ex.
+				@param[in] format The format string.
+				@param[in] args The arguments to format into the message.
+				@return std::nullopt on success or when the level is disabled, otherwise @p failureMessage.
+			*/
+			template <spdlog::level::level_enum Level, typename Format, typename... Args>
+			ATTR_NODISCARD static std::optional<std::string_view> writeModuleAt(ModuleId module, std::string_view failureMessage, Format &&format,
+																				Args &&...args)
+			{
+				if constexpr (Level < PROJECT_LOG_ACTIVE_LEVEL)
+				{
+					return std::nullopt;
+				}
+				else
+				{
+					return writeModule(module, Level, failureMessage, std::forward<Format>(format), std::forward<Args>(args)...);
+				}
 			}
 
-		private:
 			// MARK: Private Static Member Functions
 
-			/*! @brief Provides access to the function-local static spdlog logger instance.
-				@return A reference to the shared pointer holding the spdlog logger. The reference remains valid for the lifetime of the
-			   program.
+			/*! @struct State logger.h "include/Utility/Debug/Logging/logger.h"
+				@brief Everything one initialization created, published as a unit and never modified afterwards.
 			*/
-			static std::shared_ptr<spdlog::logger> &getLoggerInstance();
+			struct State
+			{
+				std::string name{};								   /*!< The registry name of @ref logger */
+				std::string fileName{};							   /*!< The file @ref logger writes to */
+				LoggerOptions options{};						   /*!< The options @ref logger was created with */
+				spdlog::level::level_enum level{spdlog::level::info}; /*!< The level set by @ref setLevel; modules without an override use it */
+				ModuleLevels modules{};							   /*!< Each module's effective level, resolved from @ref level and the overrides */
+				std::shared_ptr<spdlog::logger> logger{};		   /*!< The spdlog logger */
+				std::shared_ptr<AsyncSink> asyncSink{};			   /*!< The logger's sink in asynchronous and io_uring modes */
+				std::shared_ptr<BinarySink> binarySink{};		   /*!< The logger's sink in binary mode */
+				std::shared_ptr<PerThreadSink> perThreadSink{};	   /*!< The logger's sink in per-thread mode */
+				std::shared_ptr<MappedFileSink> mappedSink{};	   /*!< The logger's sink in mapped mode */
+				std::shared_ptr<RateLimiter> rateLimiter{};		   /*!< The per-call-site limits; empty when none are configured */
+				std::shared_ptr<GroupCommit> groupCommit{};		   /*!< Syncs durable records; empty when durability is disabled */
+			};
+
+			/*! @struct Reader logger.h "include/Utility/Debug/Logging/logger.h"
+				@brief A thread's announcement of the state generation its current call is using, linked into the list the retirer scans.
+				@details Constructed on a thread's first logging call and unlinked when the thread exits. Between calls @ref generation is
+			   @ref IDLE, so a thread that has stopped logging never holds a replaced state, its sinks or its file.
+			*/
+			struct Reader
+			{
+				static constexpr Project::Core::ul IDLE{std::numeric_limits<Project::Core::ul>::max()}; /*!< Announced between calls */
+
+				/*! @brief Links the reader into @ref mReaders. */
+				Reader() noexcept;
+
+				// Do not allow copies or moves; the list holds a pointer to this object
+
+				Reader(const Reader &) = delete;
+				Reader(Reader &&) = delete;
+				Reader &operator=(const Reader &) = delete;
+				Reader &operator=(Reader &&) = delete;
+
+				/*! @brief Unlinks the reader from @ref mReaders. */
+				~Reader();
 
-			/*! @brief Provides access to the function-local static logger name string.
-				@return A reference to the stored logger name. The reference remains valid for the lifetime of the program.
+				std::atomic<Project::Core::ul> generation{IDLE}; /*!< The generation pinned by the current call, or @ref IDLE */
+				Project::Core::ul depth{0};						 /*!< Calls in progress on this thread; a sink may log from inside one */
+				Project::Core::ul cachedGeneration{0};			 /*!< The @ref mGeneration value @ref cached was loaded at */
+				const State *cached{nullptr};					 /*!< The state this thread last logged through */
+				Reader *next{nullptr};							 /*!< The next reader in @ref mReaders; guarded by @ref mReaderMutex */
+			};
+
+			/*! @class StateGuard logger.h "include/Utility/Debug/Logging/logger.h"
+				@brief Pins the current state for the duration of one logging call.
+				@details The guard announces the generation it read in the thread's @ref Reader before loading the state, and withdraws the
+			   announcement when the call returns. The retirer only destroys a replaced state once no reader announces a generation older than
+			   the one that replaced it. The thread's cached pointer is reused while the generation is unchanged, so a call costs one store and
+			   two loads and never touches a shared reference count. Once @ref mAsymmetricFence is set the store and loads are relaxed: the
+			   retirer interrupts every running thread with membarrier before it scans, which orders them as a fence here would.
 			*/
-			static std::string &getLoggerName();
+			class StateGuard
+			{
+				public:
+					/*! @brief Announces the current generation and loads its state. */
+					StateGuard() noexcept : mReader{localReader()}
+					{
+						// A nested call runs under the generation the outermost call pinned
+						if (mReader.depth++ != 0) ATTR_UNLIKELY
+						{
+							return;
+						}
+
+						Project::Core::ul generation{mGeneration.load(std::memory_order_relaxed)};
+
+						// Either the retirer's scan sees the announcement, or the announcement is retried against the newer generation
+						while (true)
+						{
+							Project::Core::ul current{};
+
+							// The retirer's membarrier stands in for the fence between the store and the load, so the call only stops the compiler.
+							// The load still acquires: publishState stores a state before bumping the generation, so a reader that sees the new
+							// generation must also see that state, or it would cache the replaced one under a generation that lets it be freed.
+							if (mAsymmetricFence.load(std::memory_order_relaxed)) ATTR_LIKELY
+							{
+								mReader.generation.store(generation, std::memory_order_relaxed);
+								std::atomic_signal_fence(std::memory_order_seq_cst);
+								current = mGeneration.load(std::memory_order_acquire);
+							}
+							else
+							{
+								mReader.generation.store(generation, std::memory_order_seq_cst);
+								current = mGeneration.load(std::memory_order_seq_cst);
+							}
+
+							if (current == generation) ATTR_LIKELY
+							{
+								break;
+							}
+
+							generation = current;
+						}
+
+						if (mReader.cachedGeneration != generation) ATTR_UNLIKELY
+						{
+							mReader.cached = mCurrentState.load(std::memory_order_acquire);
+							mReader.cachedGeneration = generation;
+						}
+					}
 
-			/*! @brief Provides access to the function-local static file name string.
-				@return A reference to the stored file name. The reference remains valid for the lifetime of the program.
+					// Do not allow copies or moves; the guard's lifetime is the pin
+
+					StateGuard(const StateGuard &) = delete;
+					StateGuard(StateGuard &&) = delete;
+					StateGuard &operator=(const StateGuard &) = delete;
+					StateGuard &operator=(StateGuard &&) = delete;
+
+					/*! @brief Withdraws the announcement once the outermost call on the thread returns. */
+					~StateGuard()
+					{
+						if (--mReader.depth == 0) ATTR_LIKELY
+						{
+							mReader.generation.store(Reader::IDLE, std::memory_order_release);
+						}
+					}
+
+					/*! @brief Gets the pinned state.
+						@return The current state, or nullptr before the first successful @ref initialize. Valid while the guard lives.
+					*/
+					ATTR_NODISCARD const State *get() const noexcept
+					{
+						return mReader.cached;
+					}
+
+				private:
+					/*! @brief Gets the calling thread's reader, linking it into @ref mReaders on first use.
+						@return A reference to the thread's reader. The reference remains valid until the thread exits.
+					*/
+					static Reader &localReader() noexcept
+					{
+						thread_local Reader reader{};
+						return reader;
+					}
+
+					Reader &mReader; /*!< The calling thread's reader */
+			};
+
+			/*! @brief Encodes a message and structured fields as one record in the state's @ref RecordFormat and hands it to the sinks.
+				@details The record is built in the calling thread's @ref FormatBuffer::Use::Record buffer and passed to spdlog as finished text together with its timestamp, so the
+			   time in a JSON or logfmt record is the one spdlog would have stamped. Binary sinks receive the record in @ref RecordFormat::Text,
+			   since their decoder applies its own pattern.
+				@tparam Fields The @ref Structured::Field types.
+				@param[in] state The current state.
+				@param[in] level The spdlog level to log at.
+				@param[in] failureMessage The message returned when spdlog throws spdlog::spdlog_ex.
+				@param[in] message The record's message.
+				@param[in] fields The record's fields.
+				@return std::nullopt on success, otherwise @p failureMessage.
 			*/
-			static std::string &getFileNameStore();
+			template <typename... Fields>
+			ATTR_NODISCARD static std::optional<std::string_view> writeRecord(const State &state, spdlog::level::level_enum level,
+																			  std::string_view failureMessage, std::string_view message,
+																			  const Fields &...fields)
+			{
+				FormatBuffer record{FormatBuffer::Use::Record, state.options.formatBuffers};
+
+				const spdlog::log_clock::time_point time{TscClock::now(state.options.clock)};
+				const RecordFormat format{state.binarySink ? RecordFormat::Text : state.options.recordFormat};
+
+				Structured::encode(record.get(), format, time, level, state.name, message, fields...);
+
+				if (state.binarySink)
+				{
+					state.binarySink->logFormatted(level, record.view());
+					return std::nullopt;
+				}
+
+				try
+				{
+					state.logger->log(time, spdlog::source_loc{}, level, spdlog::string_view_t{record.get().data(), record.get().size()});
+				}
+				catch (const spdlog::spdlog_ex &ex)
+				{
+					return failureMessage;
+				}
+
+				return std::nullopt;
+			}
+
+			/*! @brief Applies the rate limit, hands a record that passed its level check to the sinks, and waits for a durable record's sync.
+				@tparam Format Either a compile-time checked fmt::format_string, the result of fmt::runtime, or a structured record's message.
+				@tparam Args The types of the format arguments or structured fields.
+				@param[in] state The current state.
+				@param[in] level The spdlog level to log at.
+				@param[in] failureMessage The message returned when spdlog throws spdlog::spdlog_ex.
+				@param[in] format The format string.
+				@param[in] args The arguments to format into the message.
+				@return std::nullopt on success, @ref DURABLE_LOG_FAILURE if a durable record could not be synced, otherwise @p failureMessage.
+			*/
+			template <typename Format, typename... Args>
+			ATTR_NODISCARD static std::optional<std::string_view> dispatch(const State &state, spdlog::level::level_enum level,
+																		   std::string_view failureMessage, Format &&format, Args &&...args)
+			{
+				if (state.rateLimiter) ATTR_UNLIKELY
+				{
+					// Compile-time checked formats and structured messages have static storage, so their address identifies the call site
+					if constexpr (std::is_convertible_v<const Format &, fmt::string_view>)
+					{
+						const fmt::string_view site{format};
+						const RateLimiter::Admission admission{state.rateLimiter->admit(site.data(), steadyNanoseconds())};
+
+						if (admission.suppressed != 0)
+						{
+							writeSummary(state, level, admission.suppressed, std::string_view{site.data(), site.size()});
+						}
+
+						if (!admission.write)
+						{
+							return std::nullopt;
+						}
+					}
+				}
+
+				if (state.groupCommit && level >= state.options.durability.level) ATTR_UNLIKELY
+				{
+					const std::optional<std::string_view> result{
+						deliver(state, level, failureMessage, std::forward<Format>(format), std::forward<Args>(args)...)};
+
+					if (result.has_value() || state.groupCommit->commit(*state.logger))
+					{
+						return result;
+					}
+
+					return DURABLE_LOG_FAILURE;
+				}
+
+				return deliver(state, level, failureMessage, std::forward<Format>(format), std::forward<Args>(args)...);
+			}
+
+			/*! @brief Dumps the backtrace ahead of errors and hands a record to the sinks in the form the state calls for.
+				@tparam Format Either a compile-time checked fmt::format_string, the result of fmt::runtime, or a structured record's message.
+				@tparam Args The types of the format arguments or structured fields.
+				@param[in] state The current state.
+				@param[in] level The spdlog level to log at.
+				@param[in] failureMessage The message returned when spdlog throws spdlog::spdlog_ex.
+				@param[in] format The format string.
+				@param[in] args The arguments to format into the message.
+				@return std::nullopt on success, otherwise @p failureMessage.
+			*/
+			template <typename Format, typename... Args>
+			ATTR_NODISCARD static std::optional<std::string_view> deliver(const State &state, spdlog::level::level_enum level,
+																		  std::string_view failureMessage, Format &&format, Args &&...args)
+			{
+				if (state.options.backtrace.records != 0 && level >= spdlog::level::err) ATTR_UNLIKELY
+				{
+					dumpBacktrace(state);
+				}
+
+				if constexpr (sizeof...(Args) > 0 && (Structured::StructuredField<Args> && ...))
+				{
+					return writeRecord(state, level, failureMessage, format, args...);
+				}
+				else
+				{
+					const Project::Core::ul epoch{mDeduplication.load(std::memory_order_relaxed)};
+
+					if (epoch != 0) ATTR_UNLIKELY
+					{
+						if constexpr (std::is_convertible_v<const Format &, fmt::string_view> && (Binary::BinaryArgument<Args> && ...))
+						{
+							// The format and raw arguments identify the record, so a repeat is never formatted
+							if (repeatsPrevious(state, level, epoch, format, args...))
+							{
+								return std::nullopt;
+							}
+						}
+						else
+						{
+							return deliverDeduplicated(state, level, failureMessage, epoch, format, args...);
+						}
+					}
+
+					if (state.binarySink)
+					{
+						return writeBinary(*state.binarySink, state.options.formatBuffers, level, failureMessage, format, args...);
+					}
+
+					// spdlog would format into a fresh buffer of its own, which allocates once a message outgrows its inline storage; the
+					// calling thread's buffer keeps its capacity from one record to the next
+					FormatBuffer message{FormatBuffer::Use::Message, state.options.formatBuffers};
+					const bool formatted{formatMessage(message.get(), format, args...)};
+
+					// Machine-readable files hold nothing but records, so a plain call becomes a record without fields; and spdlog only takes
+					// a caller's timestamp with text that is already formatted
+					if (state.options.recordFormat != RecordFormat::Text || state.options.clock == ClockSource::Tsc)
+					{
+						if (!formatted)
+						{
+							return failureMessage;
+						}
+
+						return writeRecord(state, level, failureMessage, message.view());
+					}
+
+					try
+					{
+						if (formatted) ATTR_LIKELY
+						{
+							state.logger->log(level, spdlog::string_view_t{message.get().data(), message.get().size()});
+						}
+						else
+						{
+							// spdlog reports a malformed format through its error handler, which the application may have replaced
+							state.logger->log(level, std::forward<Format>(format), std::forward<Args>(args)...);
+						}
+					}
+					catch (const spdlog::spdlog_ex &ex)
+					{
+						return failureMessage;
+					}
+
+					return std::nullopt;
+				}
+			}
+
+			/*! @brief Lets the calling thread's @ref RepeatFilter decide from the format and raw arguments whether a record repeats the
+			   previous one, and writes any run it ended.
+				@tparam Args The types of the format arguments, each with a binary encoding.
+				@param[in] state The current state.
+				@param[in] level The spdlog level to log at.
+				@param[in] epoch The current @ref mDeduplication value.
+				@param[in] format The compile-time checked format string.
+				@param[in] args The arguments to format into the message.
+				@return true if the record was counted as a repeat and must not be written.
+				@throws std::bad_alloc If the filter cannot store the arguments.
+			*/
+			template <typename Format, typename... Args>
+			ATTR_NODISCARD static bool repeatsPrevious(const State &state, spdlog::level::level_enum level, const Project::Core::ul epoch,
+													   const Format &format, const Args &...args)
+			{
+				if (RepeatFilter::hasOrphaned()) ATTR_UNLIKELY
+				{
+					RepeatFilter::reportOrphaned([&state](const RepeatFilter::Run &run) { writeRepeats(state, run); });
+				}
+
+				const fmt::string_view text{format};
+				const std::string_view view{text.data(), text.size()};
+				const RepeatFilter::Verdict verdict{
+					getRepeatFilter().observe(epoch, text.data(), level, view, TscClock::now(state.options.clock), args...)};
+
+				if (verdict.run.repeats != 0)
+				{
+					writeRepeats(state, verdict.run);
+				}
+
+				return !verdict.write;
+			}
+
+			/*! @brief Formats a record whose arguments have no binary encoding, or whose format is only known at runtime, lets the calling
+			   thread's @ref RepeatFilter decide from its text whether it repeats the previous one, and writes the record and any run it ended.
+				@tparam Format Either a compile-time checked fmt::format_string or the result of fmt::runtime.
+				@tparam Args The types of the format arguments.
+				@param[in] state The current state.
+				@param[in] level The spdlog level to log at.
+				@param[in] failureMessage The message returned when formatting fails or spdlog throws spdlog::spdlog_ex.
+				@param[in] epoch The current @ref mDeduplication value.
+				@param[in] format The format string.
+				@param[in] args The arguments to format into the message.
+				@return std::nullopt on success or when the record was counted as a repeat, otherwise @p failureMessage.
+			*/
+			template <typename Format, typename... Args>
+			ATTR_NODISCARD static std::optional<std::string_view> deliverDeduplicated(const State &state, spdlog::level::level_enum level,
+																					  std::string_view failureMessage, const Project::Core::ul epoch,
+																					  const Format &format, Args &...args)
+			{
+				if (RepeatFilter::hasOrphaned()) ATTR_UNLIKELY
+				{
+					RepeatFilter::reportOrphaned([&state](const RepeatFilter::Run &run) { writeRepeats(state, run); });
+				}
+
+				FormatBuffer message{FormatBuffer::Use::Message, state.options.formatBuffers};
+
+				if (!formatMessage(message.get(), format, args...))
+				{
+					return failureMessage;
+				}
+
+				// Only compile-time checked formats convert to a string view; fmt::runtime wrappers expose theirs as a member
+				const void *formatId{nullptr};
+
+				if constexpr (std::is_convertible_v<const Format &, fmt::string_view>)
+				{
+					formatId = fmt::string_view{format}.data();
+				}
+				else
+				{
+					formatId = format.str.data();
+				}
+
+				const std::string_view text{message.view()};
+				const spdlog::log_clock::time_point time{TscClock::now(state.options.clock)};
+				const RepeatFilter::Verdict verdict{getRepeatFilter().observe(epoch, formatId, level, Binary::PREFORMATTED_FORMAT, time, text)};
+
+				if (verdict.run.repeats != 0)
+				{
+					writeRepeats(state, verdict.run);
+				}
+
+				if (!verdict.write)
+				{
+					return std::nullopt;
+				}
+
+				if (state.binarySink)
+				{
+					state.binarySink->logFormatted(level, text);
+					return std::nullopt;
+				}
+
+				if (state.options.recordFormat != RecordFormat::Text || state.options.clock == ClockSource::Tsc)
+				{
+					return writeRecord(state, level, failureMessage, text);
+				}
+
+				try
+				{
+					state.logger->log(level, spdlog::string_view_t{text.data(), text.size()});
+				}
+				catch (const spdlog::spdlog_ex &ex)
+				{
+					return failureMessage;
+				}
+
+				return std::nullopt;
+			}
+
+			/*! @brief Keeps a record below the logger's level in the calling thread's backtrace ring instead of writing it.
+				@details Compile-time checked formats whose arguments all have a binary encoding are stored unformatted; anything else is
+			   formatted (structured records fully encoded) here and stored as text.
+				@tparam Format Either a compile-time checked fmt::format_string, the result of fmt::runtime, or a structured record's message.
+				@tparam Args The types of the format arguments or structured fields.
+				@param[in] state The current state.
+				@param[in] level The record's level.
+				@param[in] failureMessage The message returned when formatting fails.
+				@param[in] format The format string or message.
+				@param[in] args The arguments or fields.
+				@return std::nullopt on success, otherwise @p failureMessage.
+			*/
+			template <typename Format, typename... Args>
+			ATTR_NODISCARD static std::optional<std::string_view> keepBacktrace(const State &state, spdlog::level::level_enum level,
+																				std::string_view failureMessage, const Format &format, Args &...args)
+			{
+				BacktraceRing &ring{getBacktraceRing(state.options.backtrace)};
+				const BacktraceRing::Record record{.level = level, .time = TscClock::now(state.options.clock),
+													.format = Binary::PREFORMATTED_FORMAT};
+
+				if constexpr (sizeof...(Args) > 0 && (Structured::StructuredField<Args> && ...))
+				{
+					FormatBuffer encoded{FormatBuffer::Use::Record, state.options.formatBuffers};
+					Structured::encode(encoded.get(), state.binarySink ? RecordFormat::Text : state.options.recordFormat, record.time, level,
+									   state.name, format, args...);
+
+					const std::string_view text{encoded.view()};
+					BacktraceRing::Record complete{record};
+					complete.complete = true;
+					static_cast<void>(ring.push(complete, Binary::encodedSize(text),
+												[text](BacktraceRing::Writer &writer) { Binary::encodeArgument(writer, text); }));
+				}
+				else if constexpr (std::is_convertible_v<const Format &, fmt::string_view> && (Binary::BinaryArgument<Args> && ...))
+				{
+					const fmt::string_view text{format};
+					BacktraceRing::Record deferred{record};
+					deferred.format = std::string_view{text.data(), text.size()};
+					static_cast<void>(ring.push(deferred, (std::size_t{0} + ... + Binary::encodedSize(args)),
+												[&args...](BacktraceRing::Writer &writer) { (Binary::encodeArgument(writer, args), ...); }));
+				}
+				else
+				{
+					FormatBuffer message{FormatBuffer::Use::Message, state.options.formatBuffers};
+
+					if (!formatMessage(message.get(), format, args...))
+					{
+						return failureMessage;
+					}
+
+					const std::string_view text{message.view()};
+					static_cast<void>(ring.push(record, Binary::encodedSize(text),
+												[text](BacktraceRing::Writer &writer) { Binary::encodeArgument(writer, text); }));
+				}
+
+				return std::nullopt;
+			}
+
+			/*! @brief Writes every record kept in the calling thread's backtrace ring, oldest first, straight to the logger's sinks.
+				@details Bypasses the logger's level so the records keep their own levels. A record that fails to format or write is skipped.
+				@param[in] state The current state.
+			*/
+			static void dumpBacktrace(const State &state);
+
+			/*! @brief Gets the calling thread's backtrace ring, replacing it if it was created for different limits.
+				@param[in] options The current backtrace settings.
+				@return The ring. Valid until the calling thread's next call with different limits.
+				@throws std::bad_alloc If a new ring cannot be allocated.
+			*/
+			static BacktraceRing &getBacktraceRing(const BacktraceOptions &options);
+
+			/*! @brief Writes the "suppressed N similar messages" record for a call site whose records the rate limiter held back.
+				@details The record goes through @ref writeRecord at the site's level, so it honours the state's @ref RecordFormat. A failure
+			   to write it is ignored; the caller's own record reports failures.
+				@param[in] state The current state.
+				@param[in] level The call site's level.
+				@param[in] suppressed The number of records held back.
+				@param[in] site The call site's format string or message.
+			*/
+			static void writeSummary(const State &state, spdlog::level::level_enum level, Project::Core::ul suppressed, std::string_view site);
+
+			/*! @brief Writes the record that reports a run of repeats @ref RepeatFilter held back.
+				@details The record goes through @ref writeRecord at the run's level, so it honours the state's @ref RecordFormat. A failure to
+			   write it is ignored; the caller's own record reports failures.
+				@param[in] state The current state.
+				@param[in] run The run to report.
+			*/
+			static void writeRepeats(const State &state, const RepeatFilter::Run &run);
+
+			/*! @brief Writes every run of repeats still open on any thread, and every run left by a thread that exited, to @p state.
+				@param[in] state The state the runs were counted against.
+				@return true if any run was written.
+			*/
+			ATTR_NODISCARD static bool reportRepeats(const State &state);
+
+			/*! @brief Gets the calling thread's repeat filter.
+				@return The filter. Valid for the lifetime of the calling thread.
+			*/
+			static RepeatFilter &getRepeatFilter();
+
+			/*! @brief Reads the monotonic clock the rate limiter measures its buckets against.
+				@return Nanoseconds since an unspecified epoch.
+			*/
+			ATTR_NODISCARD static Project::Core::sl steadyNanoseconds() noexcept;
+
+			/*! @brief Gets the lowest level a call must have to reach @p state: its level, or the backtrace's if that is lower.
+				@param[in] state The state to inspect.
+				@return The level to publish in @ref mActiveLevel.
+			*/
+			ATTR_NODISCARD ATTR_PURE static spdlog::level::level_enum activeLevel(const State &state);
+
+			/*! @brief Resolves @p next's module table, aligns the spdlog logger's level with it, and publishes @p next as the current state.
+				@pre The caller holds @ref getReconfigureMutex.
+				@param[in] next The state to publish.
+				@param[in] current The state being replaced, retired afterwards; empty for the first state.
+			*/
+			static void publishState(std::shared_ptr<State> next, std::shared_ptr<const State> current);
+
+			/*! @brief Provides access to the function-local static published state.
+				@return A reference to the atomic pointer holding the current state; empty before the first successful @ref initialize. The
+			   reference remains valid for the lifetime of the program.
+			*/
+			static std::atomic<std::shared_ptr<const State>> &getStateInstance();
+
+			/*! @brief Provides access to the function-local static mutex that serializes @ref initialize calls.
+				@return A reference to the mutex. The reference remains valid for the lifetime of the program.
+			*/
+			ATTR_NODISCARD ATTR_CONST static std::mutex &getReconfigureMutex();
+
+			/*! @brief Hands a replaced state to the background retirer, which destroys it once no logging call can still be using it.
+				@param[in] state The state that was just replaced.
+				@param[in] generation The @ref mGeneration value published with its replacement.
+			*/
+			static void retireState(std::shared_ptr<const State> state, Project::Core::ul generation);
+
+			/*! @brief Gets the effective level of @p module as last published.
+				@param[in] module The module's id.
+				@return The module's level, or spdlog::level::off before the first @ref initialize.
+			*/
+			ATTR_NODISCARD static spdlog::level::level_enum moduleLevel(const ModuleId module) noexcept
+			{
+				return mModuleLevels[module].load(std::memory_order_relaxed); // NOLINT(cppcoreguidelines-pro-bounds-constant-array-index)
+			}
+
+			/*! @brief Gets the oldest generation a logging call is currently using.
+				@details Issues a process-wide membarrier first when @ref mAsymmetricFence is set, so relaxed announcements are visible to the scan.
+				@return The smallest generation announced in @ref mReaders, or @ref Reader::IDLE when no call is in progress.
+			*/
+			ATTR_NODISCARD static Project::Core::ul oldestActiveGeneration();
+
+			// MARK: Private Static Members
+
+			/*! @brief Mirror of the level set by @ref setLevel, lowered to @ref BacktraceOptions::level when a backtrace is kept, read on
+			   every call so disabled records never reach spdlog.
+				@details Constant-initialized, so it is safe to read before @ref initialize (every record is discarded until then).
+			*/
+			static inline std::atomic<spdlog::level::level_enum> mActiveLevel{spdlog::level::off};
+
+			/*! @brief Mirror of each module's effective level in the current state, indexed by @ref ModuleId and read on every
+			   @ref ModuleLogger call so disabled records never pin the state.
+				@details Constant-initialized to spdlog::level::off, so it is safe to read before @ref initialize.
+			*/
+			static inline std::array<std::atomic<spdlog::level::level_enum>, LOGGING_MAX_MODULES> mModuleLevels{
+				[]<std::size_t... Module>(std::index_sequence<Module...>) {
+					return std::array<std::atomic<spdlog::level::level_enum>, LOGGING_MAX_MODULES>{(static_cast<void>(Module), spdlog::level::off)...};
+				}(std::make_index_sequence<LOGGING_MAX_MODULES>{})};
+
+			/*! @brief The deduplication epoch set by @ref setDeduplication; 0 while repeats are written like any other record.
+				@details Each time deduplication is turned on it gets a new value, so runs a thread counted before are never continued.
+			*/
+			static inline std::atomic<Project::Core::ul> mDeduplication{0};
+
+			/*! @brief Bumped after every state swap so logging threads know to reload their cached pointer. */
+			static inline std::atomic<Project::Core::ul> mGeneration{0};
+
+			/*! @brief The state held by @ref getStateInstance, as a raw pointer for @ref StateGuard. */
+			static inline std::atomic<const State *> mCurrentState{nullptr};
+
+			/*! @brief Set once the process is registered for expedited membarrier, letting @ref StateGuard announce without a fence.
+				@details Until then, or on kernels without it, announcements and scans are sequentially consistent instead.
+			*/
+			static inline std::atomic<bool> mAsymmetricFence{false};
+
+			/*! @brief Serializes changes to @ref mReaders and the retirer's scans of it.
+				@details Constant-initialized, so it outlives the retirer and every thread's @ref Reader.
+			*/
+			static inline std::mutex mReaderMutex{};
+
+			/*! @brief The head of the list of every thread's @ref Reader. */
+			static inline Reader *mReaders{nullptr};
+	};
+
+	/*! @class ModuleLogger logger.h "include/Utility/Debug/Logging/logger.h"
+		@brief A named child of @ref Logger whose records are filtered by their module's level instead of the global one.
+		@details Obtained from @ref Logger::module, e.g. `static const ModuleLogger HTTP{Logger::module("net.http")};`. Records go to the same
+	   file, in the same mode and format, as @ref Logger's own; only the level check differs. The module's effective level comes from the
+	   closest override in its dotted hierarchy (see @ref Logger::setModuleLevel and @ref LoggerOptions::moduleLevels) and is looked up by
+	   index in a flat table of atomic levels published with the logger's state, so the check is a single relaxed load, like
+	   @ref Logger::isEnabled. Copyable and trivially
+	   cheap to pass around.
+		@date --/--/----
+		@version x.x.x
+		@since x.x.x
+		@author Matthew Moore
+	*/
+	class ModuleLogger
+	{
+		public:
+			// MARK: Getters
+
+			/*! @brief Gets the module's index into the level table.
+				@return The id assigned when the module was registered.
+			*/
+			ATTR_NODISCARD ModuleId id() const noexcept
+			{
+				return mId;
+			}
+
+			/*! @brief Gets the module's effective level.
+				@return The level the module's records must reach, or spdlog::level::off before @ref Logger::initialize.
+			*/
+			ATTR_NODISCARD spdlog::level::level_enum getLevel() const noexcept
+			{
+				return Logger::moduleLevel(mId);
+			}
+
+			/*! @brief Checks whether a record at @p level from this module would be written.
+				@param[in] level The level to test.
+				@return true if the record passes both the compile-time threshold and the module's level.
+			*/
+			ATTR_NODISCARD bool isEnabled(const spdlog::level::level_enum level) const noexcept
+			{
+				return level >= PROJECT_LOG_ACTIVE_LEVEL && level >= getLevel();
+			}
+
+			// MARK: Template Member Functions
+
+			/*! @brief Logs a message at the specified level using a format string checked at compile time.
+				@details See @ref Logger::log.
+				@tparam Args The types of the format arguments.
+				@param[in] level The spdlog level to log at.
+				@param[in] format The fmt-style format string; a mismatch with @p args is a compile error.
+				@param[in] args The arguments to format into the message.
+				@return std::nullopt on success or when the module's level filters the record, or @ref LOG_LOG_FAILURE if spdlog reported an
+			   error.
+			*/
+			template <typename... Args>
+			ATTR_NODISCARD std::optional<std::string_view> log(spdlog::level::level_enum level, fmt::format_string<Args...> format,
+															   Args &&...args) const
+			{
+				return Logger::writeModule(mId, level, LOG_LOG_FAILURE, format, std::forward<Args>(args)...);
+			}
+
+			/*! @brief Logs a message at the specified level using a format string only known at runtime.
+				@details See @ref Logger::log.
+				@tparam Format A string type satisfying @ref RuntimeFormatString.
+				@tparam Args The types of the format arguments.
+				@param[in] level The spdlog level to log at.
+				@param[in] format The fmt-style format string.
+				@param[in] args The arguments to format into the message.
+				@return std::nullopt on success or when the module's level filters the record, or @ref LOG_LOG_FAILURE if spdlog reported an
+			   error.
+			*/
+			template <RuntimeFormatString Format, typename... Args>
+			ATTR_NODISCARD std::optional<std::string_view> log(spdlog::level::level_enum level, const Format &format, Args &&...args) const
+			{
+				return Logger::writeModule(mId, level, LOG_LOG_FAILURE, fmt::runtime(format), std::forward<Args>(args)...);
+			}
+
+			/*! @brief Logs a structured record at the specified level: a fixed message plus typed key/value fields.
+				@details See the structured @ref Logger::log overload.
+				@tparam N The size of the message literal.
+				@tparam Fields The @ref Structured::Field types.
+				@param[in] level The spdlog level to log at.
+				@param[in] message The message; never treated as a format string.
+				@param[in] fields The fields, in the order they are written.
+				@return std::nullopt on success or when the module's level filters the record, or @ref LOG_LOG_FAILURE if spdlog reported an
+			   error.
+			*/
+			template <std::size_t N, Structured::StructuredField... Fields>
+				requires (sizeof...(Fields) > 0)
+			ATTR_NODISCARD std::optional<std::string_view> log(spdlog::level::level_enum level, const char (&message)[N], // NOLINT(cppcoreguidelines-avoid-c-arrays,hicpp-avoid-c-arrays,modernize-avoid-c-arrays)
+															   Fields &&...fields) const
+			{
+				return Logger::writeModule(mId, level, LOG_LOG_FAILURE, std::string_view{message}, std::forward<Fields>(fields)...);
+			}
+
+			/*! @brief Logs a message at the trace level using a format string checked at compile time.
+				@tparam Args The types of the format arguments.
+				@param[in] format The fmt-style format string; a mismatch with @p args is a compile error.
+				@param[in] args The arguments to format into the message.
+				@return std::nullopt on success or when the module's level filters the record, or @ref TRACE_LOG_FAILURE if spdlog reported an
+			   error.
+			*/
+			template <typename... Args>
+			ATTR_NODISCARD std::optional<std::string_view> trace(fmt::format_string<Args...> format, Args &&...args) const
+			{
+				return Logger::writeModuleAt<spdlog::level::trace>(mId, TRACE_LOG_FAILURE, format, std::forward<Args>(args)...);
+			}
+
+			/*! @brief Logs a message at the trace level using a format string only known at runtime.
+				@tparam Format A string type satisfying @ref RuntimeFormatString.
+				@tparam Args The types of the format arguments.
+				@param[in] format The fmt-style format string.
+				@param[in] args The arguments to format into the message.
+				@return std::nullopt on success or when the module's level filters the record, or @ref TRACE_LOG_FAILURE if spdlog reported an
+			   error.
+			*/
+			template <RuntimeFormatString Format, typename... Args>
+			ATTR_NODISCARD std::optional<std::string_view> trace(const Format &format, Args &&...args) const
+			{
+				return Logger::writeModuleAt<spdlog::level::trace>(mId, TRACE_LOG_FAILURE, fmt::runtime(format), std::forward<Args>(args)...);
+			}
+
+			/*! @brief Logs a structured record at the trace level: a fixed message plus typed key/value fields.
+				@tparam N The size of the message literal.
+				@tparam Fields The @ref Structured::Field types.
+				@param[in] message The message; never treated as a format string.
+				@param[in] fields The fields, in the order they are written.
+				@return std::nullopt on success or when the module's level filters the record, or @ref TRACE_LOG_FAILURE if spdlog reported an
+			   error.
+			*/
+			template <std::size_t N, Structured::StructuredField... Fields>
+				requires (sizeof...(Fields) > 0)
+			ATTR_NODISCARD std::optional<std::string_view> trace(const char (&message)[N], Fields &&...fields) const // NOLINT(cppcoreguidelines-avoid-c-arrays,hicpp-avoid-c-arrays,modernize-avoid-c-arrays)
+			{
+				return Logger::writeModuleAt<spdlog::level::trace>(mId, TRACE_LOG_FAILURE, std::string_view{message}, std::forward<Fields>(fields)...);
+			}
+
+			/*! @brief Logs a message at the debug level using a format string checked at compile time.
+				@tparam Args The types of the format arguments.
+				@param[in] format The fmt-style format string; a mismatch with @p args is a compile error.
+				@param[in] args The arguments to format into the message.
+				@return std::nullopt on success or when the module's level filters the record, or @ref DEBUG_LOG_FAILURE if spdlog reported an
+			   error.
+			*/
+			template <typename... Args>
+			ATTR_NODISCARD std::optional<std::string_view> debug(fmt::format_string<Args...> format, Args &&...args) const
+			{
+				return Logger::writeModuleAt<spdlog::level::debug>(mId, DEBUG_LOG_FAILURE, format, std::forward<Args>(args)...);
+			}
+
+			/*! @brief Logs a message at the debug level using a format string only known at runtime.
+				@tparam Format A string type satisfying @ref RuntimeFormatString.
+				@tparam Args The types of the format arguments.
+				@param[in] format The fmt-style format string.
+				@param[in] args The arguments to format into the message.
+				@return std::nullopt on success or when the module's level filters the record, or @ref DEBUG_LOG_FAILURE if spdlog reported an
+			   error.
+			*/
+			template <RuntimeFormatString Format, typename... Args>
+			ATTR_NODISCARD std::optional<std::string_view> debug(const Format &format, Args &&...args) const
+			{
+				return Logger::writeModuleAt<spdlog::level::debug>(mId, DEBUG_LOG_FAILURE, fmt::runtime(format), std::forward<Args>(args)...);
+			}
+
+			/*! @brief Logs a structured record at the debug level: a fixed message plus typed key/value fields.
+				@tparam N The size of the message literal.
+				@tparam Fields The @ref Structured::Field types.
+				@param[in] message The message; never treated as a format string.
+				@param[in] fields The fields, in the order they are written.
+				@return std::nullopt on success or when the module's level filters the record, or @ref DEBUG_LOG_FAILURE if spdlog reported an
+			   error.
+			*/
+			template <std::size_t N, Structured::StructuredField... Fields>
+				requires (sizeof...(Fields) > 0)
+			ATTR_NODISCARD std::optional<std::string_view> debug(const char (&message)[N], Fields &&...fields) const // NOLINT(cppcoreguidelines-avoid-c-arrays,hicpp-avoid-c-arrays,modernize-avoid-c-arrays)
+			{
+				return Logger::writeModuleAt<spdlog::level::debug>(mId, DEBUG_LOG_FAILURE, std::string_view{message}, std::forward<Fields>(fields)...);
+			}
+
+			/*! @brief Logs a message at the info level using a format string checked at compile time.
+				@tparam Args The types of the format arguments.
+				@param[in] format The fmt-style format string; a mismatch with @p args is a compile error.
+				@param[in] args The arguments to format into the message.
+				@return std::nullopt on success or when the module's level filters the record, or @ref INFO_LOG_FAILURE if spdlog reported an
+			   error.
+			*/
+			template <typename... Args>
+			ATTR_NODISCARD std::optional<std::string_view> info(fmt::format_string<Args...> format, Args &&...args) const
+			{
+				return Logger::writeModuleAt<spdlog::level::info>(mId, INFO_LOG_FAILURE, format, std::forward<Args>(args)...);
+			}
+
+			/*! @brief Logs a message at the info level using a format string only known at runtime.
+				@tparam Format A string type satisfying @ref RuntimeFormatString.
+				@tparam Args The types of the format arguments.
+				@param[in] format The fmt-style format string.
+				@param[in] args The arguments to format into the message.
+				@return std::nullopt on success or when the module's level filters the record, or @ref INFO_LOG_FAILURE if spdlog reported an
+			   error.
+			*/
+			template <RuntimeFormatString Format, typename... Args>
+			ATTR_NODISCARD std::optional<std::string_view> info(const Format &format, Args &&...args) const
+			{
+				return Logger::writeModuleAt<spdlog::level::info>(mId, INFO_LOG_FAILURE, fmt::runtime(format), std::forward<Args>(args)...);
+			}
+
+			/*! @brief Logs a structured record at the info level: a fixed message plus typed key/value fields.
+				@tparam N The size of the message literal.
+				@tparam Fields The @ref Structured::Field types.
+				@param[in] message The message; never treated as a format string.
+				@param[in] fields The fields, in the order they are written.
+				@return std::nullopt on success or when the module's level filters the record, or @ref INFO_LOG_FAILURE if spdlog reported an
+			   error.
+			*/
+			template <std::size_t N, Structured::StructuredField... Fields>
+				requires (sizeof...(Fields) > 0)
+			ATTR_NODISCARD std::optional<std::string_view> info(const char (&message)[N], Fields &&...fields) const // NOLINT(cppcoreguidelines-avoid-c-arrays,hicpp-avoid-c-arrays,modernize-avoid-c-arrays)
+			{
+				return Logger::writeModuleAt<spdlog::level::info>(mId, INFO_LOG_FAILURE, std::string_view{message}, std::forward<Fields>(fields)...);
+			}
+
+			/*! @brief Logs a message at the warn level using a format string checked at compile time.
+				@tparam Args The types of the format arguments.
+				@param[in] format The fmt-style format string; a mismatch with @p args is a compile error.
+				@param[in] args The arguments to format into the message.
+				@return std::nullopt on success or when the module's level filters the record, or @ref WARN_LOG_FAILURE if spdlog reported an
+			   error.
+			*/
+			template <typename... Args>
+			ATTR_NODISCARD std::optional<std::string_view> warn(fmt::format_string<Args...> format, Args &&...args) const
+			{
+				return Logger::writeModuleAt<spdlog::level::warn>(mId, WARN_LOG_FAILURE, format, std::forward<Args>(args)...);
+			}
+
+			/*! @brief Logs a message at the warn level using a format string only known at runtime.
+				@tparam Format A string type satisfying @ref RuntimeFormatString.
+				@tparam Args The types of the format arguments.
+				@param[in] format The fmt-style format string.
+				@param[in] args The arguments to format into the message.
+				@return std::nullopt on success or when the module's level filters the record, or @ref WARN_LOG_FAILURE if spdlog reported an
+			   error.
+			*/
+			template <RuntimeFormatString Format, typename... Args>
+			ATTR_NODISCARD std::optional<std::string_view> warn(const Format &format, Args &&...args) const
+			{
+				return Logger::writeModuleAt<spdlog::level::warn>(mId, WARN_LOG_FAILURE, fmt::runtime(format), std::forward<Args>(args)...);
+			}
+
+			/*! @brief Logs a structured record at the warn level: a fixed message plus typed key/value fields.
+				@tparam N The size of the message literal.
+				@tparam Fields The @ref Structured::Field types.
+				@param[in] message The message; never treated as a format string.
+				@param[in] fields The fields, in the order they are written.
+				@return std::nullopt on success or when the module's level filters the record, or @ref WARN_LOG_FAILURE if spdlog reported an
+			   error.
+			*/
+			template <std::size_t N, Structured::StructuredField... Fields>
+				requires (sizeof...(Fields) > 0)
+			ATTR_NODISCARD std::optional<std::string_view> warn(const char (&message)[N], Fields &&...fields) const // NOLINT(cppcoreguidelines-avoid-c-arrays,hicpp-avoid-c-arrays,modernize-avoid-c-arrays)
+			{
+				return Logger::writeModuleAt<spdlog::level::warn>(mId, WARN_LOG_FAILURE, std::string_view{message}, std::forward<Fields>(fields)...);
+			}
+
+			/*! @brief Logs a message at the error level using a format string checked at compile time.
+				@tparam Args The types of the format arguments.
+				@param[in] format The fmt-style format string; a mismatch with @p args is a compile error.
+				@param[in] args The arguments to format into the message.
+				@return std::nullopt on success or when the module's level filters the record, or @ref ERROR_LOG_FAILURE if spdlog reported an
+			   error.
+			*/
+			template <typename... Args>
+			ATTR_NODISCARD std::optional<std::string_view> error(fmt::format_string<Args...> format, Args &&...args) const
+			{
+				return Logger::writeModuleAt<spdlog::level::err>(mId, ERROR_LOG_FAILURE, format, std::forward<Args>(args)...);
+			}
+
+			/*! @brief Logs a message at the error level using a format string only known at runtime.
+				@tparam Format A string type satisfying @ref RuntimeFormatString.
+				@tparam Args The types of the format arguments.
+				@param[in] format The fmt-style format string.
+				@param[in] args The arguments to format into the message.
+				@return std::nullopt on success or when the module's level filters the record, or @ref ERROR_LOG_FAILURE if spdlog reported an
+			   error.
+			*/
+			template <RuntimeFormatString Format, typename... Args>
+			ATTR_NODISCARD std::optional<std::string_view> error(const Format &format, Args &&...args) const
+			{
+				return Logger::writeModuleAt<spdlog::level::err>(mId, ERROR_LOG_FAILURE, fmt::runtime(format), std::forward<Args>(args)...);
+			}
+
+			/*! @brief Logs a structured record at the error level: a fixed message plus typed key/value fields.
+				@tparam N The size of the message literal.
+				@tparam Fields The @ref Structured::Field types.
+				@param[in] message The message; never treated as a format string.
+				@param[in] fields The fields, in the order they are written.
+				@return std::nullopt on success or when the module's level filters the record, or @ref ERROR_LOG_FAILURE if spdlog reported an
+			   error.
+			*/
+			template <std::size_t N, Structured::StructuredField... Fields>
+				requires (sizeof...(Fields) > 0)
+			ATTR_NODISCARD std::optional<std::string_view> error(const char (&message)[N], Fields &&...fields) const // NOLINT(cppcoreguidelines-avoid-c-arrays,hicpp-avoid-c-arrays,modernize-avoid-c-arrays)
+			{
+				return Logger::writeModuleAt<spdlog::level::err>(mId, ERROR_LOG_FAILURE, std::string_view{message}, std::forward<Fields>(fields)...);
+			}
+
+			/*! @brief Logs a message at the critical level using a format string checked at compile time.
+				@tparam Args The types of the format arguments.
+				@param[in] format The fmt-style format string; a mismatch with @p args is a compile error.
+				@param[in] args The arguments to format into the message.
+				@return std::nullopt on success or when the module's level filters the record, or @ref CRITICAL_LOG_FAILURE if spdlog reported an
+			   error.
+			*/
+			template <typename... Args>
+			ATTR_NODISCARD std::optional<std::string_view> critical(fmt::format_string<Args...> format, Args &&...args) const
+			{
+				return Logger::writeModuleAt<spdlog::level::critical>(mId, CRITICAL_LOG_FAILURE, format, std::forward<Args>(args)...);
+			}
+
+			/*! @brief Logs a message at the critical level using a format string only known at runtime.
+				@tparam Format A string type satisfying @ref RuntimeFormatString.
+				@tparam Args The types of the format arguments.
+				@param[in] format The fmt-style format string.
+				@param[in] args The arguments to format into the message.
+				@return std::nullopt on success or when the module's level filters the record, or @ref CRITICAL_LOG_FAILURE if spdlog reported an
+			   error.
+			*/
+			template <RuntimeFormatString Format, typename... Args>
+			ATTR_NODISCARD std::optional<std::string_view> critical(const Format &format, Args &&...args) const
+			{
+				return Logger::writeModuleAt<spdlog::level::critical>(mId, CRITICAL_LOG_FAILURE, fmt::runtime(format), std::forward<Args>(args)...);
+			}
+
+			/*! @brief Logs a structured record at the critical level: a fixed message plus typed key/value fields.
+				@tparam N The size of the message literal.
+				@tparam Fields The @ref Structured::Field types.
+				@param[in] message The message; never treated as a format string.
+				@param[in] fields The fields, in the order they are written.
+				@return std::nullopt on success or when the module's level filters the record, or @ref CRITICAL_LOG_FAILURE if spdlog reported an
+			   error.
+			*/
+			template <std::size_t N, Structured::StructuredField... Fields>
+				requires (sizeof...(Fields) > 0)
+			ATTR_NODISCARD std::optional<std::string_view> critical(const char (&message)[N], Fields &&...fields) const // NOLINT(cppcoreguidelines-avoid-c-arrays,hicpp-avoid-c-arrays,modernize-avoid-c-arrays)
+			{
+				return Logger::writeModuleAt<spdlog::level::critical>(mId, CRITICAL_LOG_FAILURE, std::string_view{message}, std::forward<Fields>(fields)...);
+			}
+
+		private:
+			friend class Logger;
+
+			/*! @brief Creates the logger of an already registered module.
+				@param[in] id The module's id.
+			*/
+			explicit ModuleLogger(const ModuleId id) noexcept : mId{id}
+			{
+			}
+
+			ModuleId mId; /*!< The module's index into the level table */
 	};
 } // namespace Project::Utility::Debug::Logging
 
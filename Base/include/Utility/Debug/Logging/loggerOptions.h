@@ -0,0 +1,278 @@
+/*! @file loggerOptions.h
+	@brief Contains the option types that select how the static Logger writes its records.
+	@date --/--/----
+	@version x.x.x
+	@since x.x.x
+	@author Matthew Moore
+*/
+
+#ifndef INCLUDE_UTILITY_DEBUG_LOGGING_LOGGEROPTIONS_H
+#define INCLUDE_UTILITY_DEBUG_LOGGING_LOGGEROPTIONS_H
+
+#include <chrono>
+#include <string>
+#include <vector>
+
+#include "Core/typedefs.h"
+#include "Utility/Debug/Logging/constants.h"
+
+#include <spdlog/common.h>
+
+namespace Project::Utility::Debug::Logging
+{
+	/*! @enum LoggerMode
+		@brief Selects the thread that performs file I/O for a log record.
+		@date --/--/----
+		@version x.x.x
+		@since x.x.x
+		@author Matthew Moore
+	*/
+	enum class LoggerMode : Project::Core::ub
+	{
+		Synchronous,  /*!< The calling thread writes the record through spdlog's mutex-protected file sink */
+		Asynchronous, /*!< The calling thread formats the record into a lock-free queue drained by a dedicated writer thread */
+		Binary,		  /*!< The calling thread copies the raw arguments into its own buffer; the file is turned into text offline */
+		PerThread,	  /*!< The calling thread formats the record into its own buffer; a writer thread merges the buffers by timestamp */
+		Mapped,		  /*!< The calling thread formats the record straight into a memory-mapped file; the kernel writes the pages back */
+		Uring,		  /*!< Like Asynchronous, but the writer thread batches records into registered buffers written through io_uring */
+	};
+
+	/*! @enum OverflowPolicy
+		@brief Selects what an asynchronous, binary or per-thread log call does when the record queue is full.
+		@note In binary and per-thread modes only the writer thread may consume a thread's buffer, so @ref DropOldest behaves like
+	   @ref DropNewest.
+		@date --/--/----
+		@version x.x.x
+		@since x.x.x
+		@author Matthew Moore
+	*/
+	enum class OverflowPolicy : Project::Core::ub
+	{
+		Block,		/*!< The calling thread yields until the writer frees a slot; no records are lost */
+		DropNewest, /*!< The record being logged is discarded and counted */
+		DropOldest, /*!< The oldest queued record is discarded and counted to make room for the new one */
+	};
+
+	/*! @enum SyncPolicy
+		@brief Selects how a flush of the memory-mapped sink makes its records durable.
+		@details Without an msync the kernel still writes dirty pages back on its own schedule, so records survive a process crash either way;
+	   the policy only matters for a machine crash or power loss.
+		@date --/--/----
+		@version x.x.x
+		@since x.x.x
+		@author Matthew Moore
+	*/
+	enum class SyncPolicy : Project::Core::ub
+	{
+		Never,		  /*!< Flushes do nothing; write-back is left entirely to the kernel */
+		Asynchronous, /*!< Flushes schedule write-back of the pages written since the last flush (MS_ASYNC) without waiting */
+		Synchronous,  /*!< Flushes block until the pages written since the last flush reach the device (MS_SYNC) */
+	};
+
+	/*! @enum RecordFormat
+		@brief Selects how a record's message and structured fields are laid out in the log file.
+		@details Structured fields are the `kv(...)` arguments of the structured @ref Logger overloads. In the two machine-readable formats
+	   plain calls are written as records without fields, so every line of the file parses the same way. Binary files always use @ref Text,
+	   since their decoder applies its own pattern.
+		@date --/--/----
+		@version x.x.x
+		@since x.x.x
+		@author Matthew Moore
+	*/
+	enum class RecordFormat : Project::Core::ub
+	{
+		Text,	   /*!< spdlog's pattern around the message; structured fields are appended to the message as logfmt pairs */
+		JsonLines, /*!< One JSON object per line holding ts, level, logger, msg and the fields; the logger's pattern becomes `%v` */
+		Logfmt,	   /*!< One logfmt line holding ts, level, logger, msg and the fields; the logger's pattern becomes `%v` */
+	};
+
+	/*! @enum ClockSource
+		@brief Selects how the Logger reads the time it stamps on each record.
+		@date --/--/----
+		@version x.x.x
+		@since x.x.x
+		@author Matthew Moore
+	*/
+	enum class ClockSource : Project::Core::ub
+	{
+		System, /*!< Every record reads the system clock */
+		Tsc		/*!< Records read the CPU's time-stamp counter, converted with a calibrated rate; the system clock where it is not invariant */
+	};
+
+	/*! @struct RotationOptions loggerOptions.h "include/Utility/Debug/Logging/loggerOptions.h"
+		@brief Selects when the log file is rotated and what happens to the finished segments.
+		@details Rotation renames the active file to `<stem>.<UTC yyyymmddTHHMMSS>.<nnn><extension>` and reopens the original name, so
+	   segments sort by name in the order they were written. With both triggers left at zero the file is never rotated. Compression and
+	   pruning run on a low-priority background thread, never on a thread that is writing records.
+		@date --/--/----
+		@version x.x.x
+		@since x.x.x
+		@author Matthew Moore
+	*/
+	struct RotationOptions
+	{
+		Project::Core::ul maxBytes{0};		/*!< Rotate before a write would take the active file past this size; 0 disables size rotation */
+		std::chrono::seconds interval{0};	/*!< Rotate at every multiple of this since the epoch (UTC); 0 disables time rotation */
+		Project::Core::ul maxFiles{0};		/*!< Rotated segments to keep, oldest deleted first; 0 keeps them all */
+		bool compress{false};				/*!< Whether to gzip each rotated segment */
+	};
+
+	/*! @struct UringOptions loggerOptions.h "include/Utility/Debug/Logging/loggerOptions.h"
+		@brief Sizes the batch buffers of the io_uring file written in @ref LoggerMode::Uring mode (see @ref UringFile).
+		@details Up to @ref queueDepth buffers of @ref batchBytes are in use at once, so the writer thread can keep that much data in flight
+	   while it goes on filling the next buffer. Where io_uring is unavailable the file falls back to `pwrite` from the writer thread.
+		@date --/--/----
+		@version x.x.x
+		@since x.x.x
+		@author Matthew Moore
+	*/
+	struct UringOptions
+	{
+		Project::Core::ul queueDepth{LOGGING_URING_QUEUE_DEPTH};	/*!< Batch buffers, and so writes in flight; 0 selects the `pwrite` fallback */
+		Project::Core::ul batchBytes{LOGGING_URING_BATCH_BYTES};	/*!< Bytes per batch buffer */
+	};
+
+	/*! @struct DurabilityOptions loggerOptions.h "include/Utility/Debug/Logging/loggerOptions.h"
+		@brief Makes records at or above a level durable before the call that logs them returns.
+		@details A durable call writes its record as usual, then waits for a @ref GroupCommit: one thread flushes the logger and
+	   fdatasyncs the file on behalf of every thread waiting at that moment, so durable logging gets cheaper per record as more threads
+	   log at once rather than queueing behind one sync each. @ref maxWait trades a little latency for larger groups. Disabled by
+	   default.
+		@date --/--/----
+		@version x.x.x
+		@since x.x.x
+		@author Matthew Moore
+	*/
+	struct DurabilityOptions
+	{
+		spdlog::level::level_enum level{spdlog::level::off};	/*!< The lowest level whose records are synced before returning; off disables */
+		std::chrono::microseconds maxWait{0};					/*!< How long a sync waits for more threads to join it; 0 syncs at once */
+	};
+
+	/*! @struct FormatBufferOptions loggerOptions.h "include/Utility/Debug/Logging/loggerOptions.h"
+		@brief Sizes the per-thread buffers the Logger formats messages and records into (see @ref FormatBuffer).
+		@details Each buffer is reserved at @ref initialBytes on a thread's first record, grows as larger records need it, and keeps its
+	   size from then on, so steady-state logging allocates nothing. A buffer that has grown beyond @ref maxBytes is given back once the
+	   record that needed it is written, so one huge record does not pin its memory to the thread for good.
+		@date --/--/----
+		@version x.x.x
+		@since x.x.x
+		@author Matthew Moore
+	*/
+	struct FormatBufferOptions
+	{
+		Project::Core::ul initialBytes{LOGGING_FORMAT_BUFFER_BYTES};	 /*!< The size each buffer is reserved at */
+		Project::Core::ul maxBytes{LOGGING_FORMAT_BUFFER_LIMIT_BYTES}; /*!< The high-water mark above which a buffer shrinks after use */
+	};
+
+	/*! @struct BacktraceOptions loggerOptions.h "include/Utility/Debug/Logging/loggerOptions.h"
+		@brief Selects how many records below the logger's level each thread keeps in memory for an error to dump.
+		@details With @ref records above zero, a record below the logger's level but at or above @ref level is not written; it goes into
+	   the calling thread's ring instead, evicting the oldest record when the ring is full. When the same thread then logs at error or
+	   critical, the kept records are written ahead of that record, oldest first and with their original levels and timestamps, and the
+	   ring is emptied. Compile-time checked calls whose arguments all satisfy @ref Binary::BinaryArgument are kept unformatted and only
+	   formatted if they are dumped.
+		@date --/--/----
+		@version x.x.x
+		@since x.x.x
+		@author Matthew Moore
+	*/
+	struct BacktraceOptions
+	{
+		Project::Core::ul records{0};							/*!< Records each thread keeps; 0 disables the backtrace */
+		Project::Core::ul maxBytes{LOGGING_BACKTRACE_BYTES};	/*!< Memory each thread's ring may use, including per-record overhead */
+		spdlog::level::level_enum level{spdlog::level::trace};	/*!< The lowest level kept */
+	};
+
+	/*! @struct RateLimitOptions loggerOptions.h "include/Utility/Debug/Logging/loggerOptions.h"
+		@brief Limits how many records each call site may write, so one hot statement cannot flood the file.
+		@details A call site is a compile-time checked format string, or a structured record's message, identified by its address; calls
+	   with runtime format strings are never limited. Each site gets its own token bucket holding @ref burst tokens and refilled at
+	   @ref perSecond, and records may additionally be sampled at random. Held-back records are counted and reported as a
+	   "suppressed N similar messages" record at the site's level by the site's next written record, and every @ref summaryInterval while the
+	   site stays flooded. Everything defaults to off.
+		@date --/--/----
+		@version x.x.x
+		@since x.x.x
+		@author Matthew Moore
+	*/
+	struct RateLimitOptions
+	{
+		Project::Core::ul burst{0};			/*!< Records a site may write back to back; 0 disables the token bucket */
+		double perSecond{0.0};				/*!< Tokens added to each site's bucket per second; 0 or less disables the token bucket */
+		double sampleRate{1.0};				/*!< Probability that a record is considered at all, checked before the bucket; 1 keeps all */
+		std::chrono::milliseconds summaryInterval{LOGGING_RATE_LIMIT_SUMMARY_INTERVAL}; /*!< How often a flooded site reports; 0 waits for its next written record */
+		Project::Core::ul sites{LOGGING_RATE_LIMIT_SITES};								/*!< Call sites tracked, rounded up to a power of two */
+	};
+
+	/*! @struct ModuleLevel loggerOptions.h "include/Utility/Debug/Logging/loggerOptions.h"
+		@brief Overrides the level of one module and every module below it in the dotted hierarchy (see @ref ModuleLevels).
+		@date --/--/----
+		@version x.x.x
+		@since x.x.x
+		@author Matthew Moore
+	*/
+	struct ModuleLevel
+	{
+		std::string module{};									 /*!< The module's dotted name, e.g. "net" for "net.http" too */
+		spdlog::level::level_enum level{spdlog::level::info};	 /*!< The level its records must reach */
+	};
+
+	/*! @struct LoggerOptions loggerOptions.h "include/Utility/Debug/Logging/loggerOptions.h"
+		@brief Collects the settings accepted by @ref Logger::initialize.
+		@details Designed for designated initialization, e.g. `LoggerOptions{.mode = LoggerMode::Asynchronous}`; every member has a default that
+	   matches the behaviour of the original synchronous logger.
+		@date --/--/----
+		@version x.x.x
+		@since x.x.x
+		@author Matthew Moore
+	*/
+	struct LoggerOptions
+	{
+		bool truncateFile{false}; /*!< Whether to clear the log file before the logger is created */
+
+		/*! @brief Which thread performs file I/O.
+			@details Asynchronous and io_uring records go through an @ref AsyncSink queue, binary records through a @ref BinarySink that
+		   copies the raw arguments of compile-time checked calls and leaves formatting to @ref Binary::decode, per-thread records through a
+		   @ref PerThreadSink and mapped records through a @ref MappedFileSink.
+		*/
+		LoggerMode mode{LoggerMode::Synchronous};
+
+		OverflowPolicy overflowPolicy{OverflowPolicy::Block};			  /*!< What an asynchronous call does when the queue is full */
+		Project::Core::ul queueCapacity{LOGGING_ASYNC_QUEUE_CAPACITY};	  /*!< Asynchronous and io_uring queue slots, rounded up to a power of two */
+		Project::Core::ul threadBufferBytes{LOGGING_THREAD_BUFFER_BYTES}; /*!< Binary and per-thread buffer size, rounded up to a power of two */
+		Project::Core::ul extentBytes{LOGGING_MAPPED_EXTENT_BYTES};		  /*!< Mapped-file growth step, rounded up to a whole number of pages */
+		Project::Core::ul mappedLimitBytes{LOGGING_MAPPED_LIMIT_BYTES};	  /*!< Largest size a mapped log file may reach */
+		SyncPolicy syncPolicy{SyncPolicy::Never};						  /*!< What a flush of the mapped file does */
+
+		/*! @brief When to rotate the file (see @ref RotatingFile).
+			@details Honoured in synchronous, asynchronous and per-thread modes, on whichever thread performs the file I/O; binary, mapped and
+		   io_uring files are never rotated.
+		*/
+		RotationOptions rotation{};
+
+		UringOptions uring{}; /*!< The io_uring queue depth and batch size in io_uring mode */
+
+		/*! @brief How messages and structured fields are laid out.
+			@details The machine-readable formats replace the logger's pattern with `%v` and write every record, structured or not, as one
+		   line; binary files are excepted.
+		*/
+		RecordFormat recordFormat{RecordFormat::Text};
+
+		BacktraceOptions backtrace{};			 /*!< Which records below the logger's level are kept in memory for errors to dump */
+		RateLimitOptions rateLimit{};			 /*!< How many records each compile-time checked call site may write */
+		std::vector<ModuleLevel> moduleLevels{}; /*!< Level overrides for @ref ModuleLogger records; later entries win over equal names */
+		ClockSource clock{ClockSource::System};	 /*!< Where record timestamps come from; @ref TscClock is calibrated by @ref Logger::initialize */
+		DurabilityOptions durability{};			 /*!< Which records are on disk before their call returns */
+
+		/*! @brief Whether a fatal signal writes pending records and a stack trace before the process dies.
+			@details @ref CrashHandler is installed on the log file, or on a `.crash` file beside it for binary and mapped files; when false,
+		   any handler installed earlier is removed.
+		*/
+		bool crashHandler{false};
+
+		FormatBufferOptions formatBuffers{}; /*!< The size and high-water mark of each thread's formatting buffers */
+	};
+} // namespace Project::Utility::Debug::Logging
+
+#endif
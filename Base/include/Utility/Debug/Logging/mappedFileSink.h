@@ -0,0 +1,153 @@
+/*! @file mappedFileSink.h
+	@brief Contains the declaration of an spdlog sink that appends records to a memory-mapped, pre-allocated log file.
+	@date --/--/----
+	@version x.x.x
+	@since x.x.x
+	@author Matthew Moore
+*/
+
+#ifndef INCLUDE_UTILITY_DEBUG_LOGGING_MAPPEDFILESINK_H
+#define INCLUDE_UTILITY_DEBUG_LOGGING_MAPPEDFILESINK_H
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <string>
+
+#include "Core/attributeMacros.h"
+#include "Core/typedefs.h"
+#include "Utility/Debug/Logging/constants.h"
+#include "Utility/Debug/Logging/loggerOptions.h"
+
+#include <spdlog/common.h>
+#include <spdlog/details/log_msg.h>
+#include <spdlog/formatter.h>
+#include <spdlog/sinks/sink.h>
+
+namespace Project::Utility::Debug::Logging
+{
+	using Project::Core::ul;
+
+	/*! @class MappedFileSink mappedFileSink.h "include/Utility/Debug/Logging/mappedFileSink.h"
+		@brief An spdlog sink that formats each record on the calling thread and copies it straight into a shared mapping of the log file.
+		@details The constructor reserves address space for the whole file up to its size limit. The file is then grown one extent at a time:
+	   the extent is allocated on disk with fallocate and mapped into its place in the reservation, so the mapping stays contiguous and a
+	   record never has to be split. A call claims its bytes by advancing an atomic end-of-data offset and copies the formatted line there;
+	   unless the file needs a new extent it makes no system call and takes no lock, and the kernel writes the dirty pages back on its own.
+	   Records therefore survive a crash of the process as soon as the call returns; @ref SyncPolicy controls what a flush adds on top.
+
+	   Destroying the sink truncates the file to the bytes actually written. A file left padded with the zeros of an unused extent (because
+	   the process died first) is trimmed back to its last record when it is next opened. Formatters are cloned per thread because spdlog's
+	   pattern formatter caches timestamp state and is not safe to share.
+		@note Bytes are claimed in call order, so a reader of the live file may briefly see a zero-filled gap where a record is being copied.
+	   A flush waits until every claimed record is copied before it syncs, so it never makes such a gap durable.
+		@date --/--/----
+		@version x.x.x
+		@since x.x.x
+		@author Matthew Moore
+	*/
+	class MappedFileSink final : public spdlog::sinks::sink
+	{
+		public:
+			// MARK: Constructors & Destructor
+
+			/*! @brief Opens or creates @p fileName, reserves address space for it and maps the data already in it.
+				@param[in] fileName The path of the log file; new records are appended after any existing ones.
+				@param[in] extentBytes How much the file grows by whenever it runs out of space; rounded up to a whole number of pages.
+				@param[in] limitBytes The largest size the file may reach, existing content included; rounded up to a whole number of extents.
+				Records that would not fit are discarded and counted.
+				@param[in] policy What @ref flush does.
+				@throws spdlog::spdlog_ex If the file cannot be opened, inspected or mapped, is already larger than the size limit, or the address
+			   space cannot be reserved.
+			*/
+			MappedFileSink(const std::string &fileName, const ul extentBytes, const ul limitBytes, const SyncPolicy policy);
+
+			// Do not allow copies or moves; the per-thread formatter caches identify this sink by id
+
+			MappedFileSink(const MappedFileSink &) = delete;
+			MappedFileSink(MappedFileSink &&) = delete;
+			MappedFileSink &operator=(const MappedFileSink &) = delete;
+			MappedFileSink &operator=(MappedFileSink &&) = delete;
+
+			/*! @brief Applies the sync policy one last time, unmaps the file and truncates it to the bytes written. */
+			~MappedFileSink() override;
+
+			// MARK: Getters
+
+			/*! @brief Gets the number of records discarded because they would have taken the file past its size limit.
+				@return The running total since construction.
+			*/
+			ATTR_NODISCARD ul droppedCount() const noexcept;
+
+			/*! @brief Gets the size of the file's data, excluding the pre-allocated space after it.
+				@return The offset the next record will be written at.
+			*/
+			ATTR_NODISCARD ul size() const noexcept;
+
+			// MARK: spdlog::sinks::sink
+
+			/*! @brief Formats @p msg and copies it into the mapping.
+				@param[in] msg The record produced by spdlog::logger.
+				@throws spdlog::spdlog_ex If the file needs another extent and it cannot be allocated or mapped; the record is not written.
+				@throws std::bad_alloc If the thread's formatter cannot be allocated.
+			*/
+			void log(const spdlog::details::log_msg &msg) override;
+
+			/*! @brief Applies the sync policy to the records written since the previous flush.
+				@throws spdlog::spdlog_ex If msync fails.
+			*/
+			void flush() override;
+
+			/*! @brief Replaces the formatter with a pattern formatter for @p pattern.
+				@param[in] pattern An spdlog pattern string.
+			*/
+			void set_pattern(const std::string &pattern) override;
+
+			/*! @brief Replaces the formatter used by every thread on its next record.
+				@param[in] sinkFormatter The new prototype formatter; each logging thread receives its own clone.
+			*/
+			void set_formatter(std::unique_ptr<spdlog::formatter> sinkFormatter) override;
+
+		private:
+			// MARK: Private Member Functions
+
+			/*! @brief Gets the calling thread's formatter clone, refreshing it if the prototype changed or belongs to another sink.
+				@return A formatter owned by the calling thread; valid until the thread's next call into any MappedFileSink.
+			*/
+			spdlog::formatter &threadFormatter();
+
+			/*! @brief Allocates and maps extents until the first @p end bytes of the file are mapped.
+				@param[in] end The file offset that must be mapped; at most the size limit.
+				@throws spdlog::spdlog_ex If an extent cannot be allocated or mapped.
+			*/
+			void grow(const ul end);
+
+			/*! @brief Waits for claimed records to be copied, then applies @p policy to the bytes written since the last sync.
+				@param[in] policy The sync to perform; @ref SyncPolicy::Never does nothing.
+				@return 0 on success, otherwise the errno value from msync.
+			*/
+			int sync(const SyncPolicy policy) noexcept;
+
+			const ul mId;								 /*!< Distinguishes this sink from earlier ones in per-thread formatter caches */
+			const ul mPageBytes;						 /*!< The system page size */
+			const ul mExtentBytes;						 /*!< The file's growth step; a whole number of pages */
+			const ul mLimitBytes;						 /*!< The size of the address space reservation; a whole number of extents */
+			const SyncPolicy mPolicy;					 /*!< What flush() does */
+			std::string mFileName;						 /*!< The file's path, for error messages */
+			int mFile{-1};								 /*!< The file descriptor */
+			std::byte *mBase{nullptr};					 /*!< The start of the reservation; file offset N lives at mBase + N */
+			std::atomic<ul> mEnd{0};					 /*!< The end of the data; calls claim bytes by advancing it */
+			std::atomic<ul> mCopied{0};					 /*!< mEnd's starting value plus the bytes copied so far; equals mEnd when no copy is in flight */
+			std::atomic<ul> mMapped{0};					 /*!< How much of the file is allocated and mapped */
+			std::atomic<ul> mDropped{0};				 /*!< Records discarded at the size limit */
+			std::mutex mGrowMutex{};					 /*!< Serializes extent allocation */
+			std::mutex mSyncMutex{};					 /*!< Guards mSynced */
+			ul mSynced{0};								 /*!< The end of the data at the last sync */
+			std::mutex mFormatterMutex{};				 /*!< Guards mFormatter against concurrent set_formatter calls */
+			std::unique_ptr<spdlog::formatter> mFormatter; /*!< The prototype cloned into each thread */
+			std::atomic<ul> mFormatterGeneration{0};	 /*!< Bumped whenever mFormatter is replaced */
+	};
+} // namespace Project::Utility::Debug::Logging
+
+#endif
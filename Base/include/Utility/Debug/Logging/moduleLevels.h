@@ -0,0 +1,95 @@
+/*! @file moduleLevels.h
+	@brief Contains the declaration of the module registry and the flat table of per-module log levels resolved from its hierarchy.
+	@date --/--/----
+	@version x.x.x
+	@since x.x.x
+	@author Matthew Moore
+*/
+
+#ifndef INCLUDE_UTILITY_DEBUG_LOGGING_MODULELEVELS_H
+#define INCLUDE_UTILITY_DEBUG_LOGGING_MODULELEVELS_H
+
+#include <array>
+#include <string_view>
+#include <vector>
+
+#include "Core/attributeMacros.h"
+#include "Core/typedefs.h"
+#include "Utility/Debug/Logging/constants.h"
+#include "Utility/Debug/Logging/loggerOptions.h"
+
+#include <spdlog/common.h>
+
+namespace Project::Utility::Debug::Logging
+{
+	/*! @brief Identifies a registered module; an index into @ref ModuleLevels. */
+	using ModuleId = Project::Core::ui;
+
+	/*! @brief The id of the root module, the empty name that every other module descends from. */
+	inline constexpr ModuleId ROOT_MODULE{0};
+
+	/*! @class ModuleLevels moduleLevels.h "include/Utility/Debug/Logging/moduleLevels.h"
+		@brief The effective level of every registered module, resolved once from a hierarchy of overrides into a flat array.
+		@details Module names form a hierarchy through their dots: `"net.http"` descends from `"net"`, which descends from the root module
+	   `""`. A module's effective level is the one given by the most specific override among itself and its ancestors, or the fallback
+	   level when none applies. Resolution happens whenever the levels change, so looking a module up afterwards is a single indexed load.
+	   Modules are registered process-wide and keep their id for the life of the process.
+		@date --/--/----
+		@version x.x.x
+		@since x.x.x
+		@author Matthew Moore
+	*/
+	class ModuleLevels
+	{
+		public:
+			// MARK: Getters
+
+			/*! @brief Gets the effective level of @p module.
+				@param[in] module The module's id, as returned by @ref registerModule.
+				@return The level records from the module must reach.
+			*/
+			ATTR_NODISCARD spdlog::level::level_enum level(const ModuleId module) const noexcept
+			{
+				return static_cast<spdlog::level::level_enum>(mLevels[module]); // NOLINT(cppcoreguidelines-pro-bounds-constant-array-index)
+			}
+
+			/*! @brief Gets the lowest effective level of any registered module.
+				@return The level the spdlog logger must let through for every module's records to reach the sinks.
+			*/
+			ATTR_NODISCARD ATTR_PURE spdlog::level::level_enum lowest() const noexcept;
+
+			// MARK: Static Member Functions
+
+			/*! @brief Registers @p name as a module, or finds it if it is already registered. Thread-safe.
+				@param[in] name The module's dotted name, e.g. `"net.http"`.
+				@return The module's id, or @ref ROOT_MODULE when @ref LOGGING_MAX_MODULES modules are registered already.
+				@throws std::bad_alloc If the name cannot be stored.
+			*/
+			ATTR_NODISCARD static ModuleId registerModule(std::string_view name);
+
+			/*! @brief Gets the number of registered modules, the root module included.
+				@return The count; ids below it are in use.
+			*/
+			ATTR_NODISCARD static ModuleId moduleCount();
+
+			/*! @brief Resolves the effective level of every registered module.
+				@param[in] fallback The level of modules that no override applies to.
+				@param[in] overrides Levels for modules and, through them, their descendants.
+				@return The resolved table.
+			*/
+			ATTR_NODISCARD static ModuleLevels resolve(spdlog::level::level_enum fallback, const std::vector<ModuleLevel> &overrides);
+
+			/*! @brief Tests whether @p ancestor is @p name itself or one of the modules it descends from.
+				@param[in] ancestor The candidate ancestor's name.
+				@param[in] name The module's name.
+				@return true for the root module, an equal name, or a prefix of @p name that ends just before a dot.
+			*/
+			ATTR_NODISCARD ATTR_PURE static bool covers(std::string_view ancestor, std::string_view name) noexcept;
+
+		private:
+			std::array<Project::Core::ub, LOGGING_MAX_MODULES> mLevels{}; /*!< Each module's level, indexed by its id */
+			spdlog::level::level_enum mLowest{spdlog::level::off};		   /*!< The lowest level in @ref mLevels in use */
+	};
+} // namespace Project::Utility::Debug::Logging
+
+#endif
@@ -0,0 +1,126 @@
+/*! @file perThreadSink.h
+	@brief Contains the declaration of an spdlog sink that gives every logging thread its own buffer and merges them on a writer thread.
+	@date --/--/----
+	@version x.x.x
+	@since x.x.x
+	@author Matthew Moore
+*/
+
+#ifndef INCLUDE_UTILITY_DEBUG_LOGGING_PERTHREADSINK_H
+#define INCLUDE_UTILITY_DEBUG_LOGGING_PERTHREADSINK_H
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <span>
+#include <string>
+
+#include "Core/attributeMacros.h"
+#include "Core/typedefs.h"
+#include "Utility/Debug/Logging/constants.h"
+#include "Utility/Debug/Logging/loggerOptions.h"
+#include "Utility/Debug/Logging/threadBufferWriter.h"
+
+#include <spdlog/common.h>
+#include <spdlog/details/log_msg.h>
+#include <spdlog/formatter.h>
+#include <spdlog/sinks/sink.h>
+
+namespace Project::Utility::Debug::Logging
+{
+	using Project::Core::sl;
+	using Project::Core::ul;
+
+	/*! @class PerThreadSink perThreadSink.h "include/Utility/Debug/Logging/perThreadSink.h"
+		@brief An spdlog sink that formats records on the calling thread into that thread's own single-producer buffer.
+		@details Unlike @ref AsyncSink, whose producers all claim slots from one shared queue, every thread here writes into a private
+	   @ref Containers::ByteRing::ByteRing owned by a @ref ThreadBufferWriter, so concurrent callers never touch the same cache line. The
+	   writer thread drains every buffer, merges the records by timestamp and writes them to the file. Formatters are cloned per thread
+	   because spdlog's pattern formatter caches timestamp state and is not safe to share.
+		@note Records are written in timestamp order within each writer pass; see @ref ThreadBufferWriter for the exact guarantee.
+		@date --/--/----
+		@version x.x.x
+		@since x.x.x
+		@author Matthew Moore
+	*/
+	class PerThreadSink final : public spdlog::sinks::sink
+	{
+		public:
+			// MARK: Constructors & Destructor
+
+			/*! @brief Opens @p fileName for appending and starts the writer thread.
+				@param[in] fileName The path of the file that receives the formatted records.
+				@param[in] threadBufferBytes The minimum size of each thread's buffer; rounded up to a power of two.
+				@param[in] policy What @ref log does when its thread's buffer is full.
+				@param[in] interval How long the writer sleeps between polls when no buffer is half full and nobody flushes.
+				@param[in] rotation When the writer thread rotates the file; never by default.
+				@throws spdlog::spdlog_ex If the file cannot be opened.
+				@throws std::system_error If the writer or archiver thread cannot be started.
+			*/
+			PerThreadSink(const std::string &fileName, const ul threadBufferBytes, const OverflowPolicy policy,
+						  const std::chrono::milliseconds interval = LOGGING_THREAD_BUFFER_WRITER_INTERVAL, const RotationOptions &rotation = {});
+
+			// Do not allow copies or moves; the per-thread formatter caches identify this sink by id
+
+			PerThreadSink(const PerThreadSink &) = delete;
+			PerThreadSink(PerThreadSink &&) = delete;
+			PerThreadSink &operator=(const PerThreadSink &) = delete;
+			PerThreadSink &operator=(PerThreadSink &&) = delete;
+
+			/*! @brief Writes every buffered record, flushes the file and joins the writer thread. */
+			~PerThreadSink() override;
+
+			// MARK: Getters
+
+			/*! @brief Gets the number of records discarded by the overflow policy or too large for a thread buffer, plus failed file writes.
+				@return The running total since construction. A failed write loses a whole batch but counts once.
+			*/
+			ATTR_NODISCARD ul droppedCount() const noexcept;
+
+			// MARK: spdlog::sinks::sink
+
+			/*! @brief Formats @p msg and copies it into the calling thread's buffer.
+				@param[in] msg The record produced by spdlog::logger.
+				@throws std::bad_alloc If the thread's buffer or formatter cannot be allocated.
+			*/
+			void log(const spdlog::details::log_msg &msg) override;
+
+			/*! @brief Blocks until every record logged before the call has been written and the file has been flushed. */
+			void flush() override;
+
+			/*! @brief Replaces the formatter with a pattern formatter for @p pattern.
+				@param[in] pattern An spdlog pattern string.
+			*/
+			void set_pattern(const std::string &pattern) override;
+
+			/*! @brief Replaces the formatter used by every thread on its next record.
+				@param[in] sinkFormatter The new prototype formatter; each logging thread receives its own clone.
+			*/
+			void set_formatter(std::unique_ptr<spdlog::formatter> sinkFormatter) override;
+
+		private:
+			// MARK: Private Member Functions
+
+			/*! @brief Gets the calling thread's formatter clone, refreshing it if the prototype changed or belongs to another sink.
+				@return A formatter owned by the calling thread; valid until the thread's next call into any PerThreadSink.
+			*/
+			spdlog::formatter &threadFormatter();
+
+			/*! @brief Appends one buffered record, which is already the formatted line, to @p batch. Writer thread only.
+				@param[in,out] batch The batch to append to.
+				@param[in] timestamp Unused; the line already contains its formatted time.
+				@param[in] body The formatted line.
+			*/
+			static void appendRecord(spdlog::memory_buf_t &batch, sl timestamp, std::span<const std::byte> body);
+
+			const ul mId;								 /*!< Distinguishes this sink from earlier ones in per-thread formatter caches */
+			std::mutex mFormatterMutex{};				 /*!< Guards mFormatter against concurrent set_formatter calls */
+			std::unique_ptr<spdlog::formatter> mFormatter; /*!< The prototype cloned into each thread */
+			std::atomic<ul> mFormatterGeneration{0};	 /*!< Bumped whenever mFormatter is replaced */
+			ThreadBufferWriter mWriter;					 /*!< The per-thread buffers and writer thread; declared last so it is joined first */
+	};
+} // namespace Project::Utility::Debug::Logging
+
+#endif
@@ -0,0 +1,126 @@
+/*! @file rateLimiter.h
+	@brief Contains the declaration of the per-call-site token bucket and sampler that keeps a hot log statement from flooding the file.
+	@date --/--/----
+	@version x.x.x
+	@since x.x.x
+	@author Matthew Moore
+*/
+
+#ifndef INCLUDE_UTILITY_DEBUG_LOGGING_RATELIMITER_H
+#define INCLUDE_UTILITY_DEBUG_LOGGING_RATELIMITER_H
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+
+#include "Core/attributeMacros.h"
+#include "Core/hardware.h"
+#include "Core/typedefs.h"
+#include "Utility/Debug/Logging/loggerOptions.h"
+
+namespace Project::Utility::Debug::Logging
+{
+	using Project::Core::CACHE_LINE_SIZE;
+	using Project::Core::sl;
+	using Project::Core::ul;
+
+	/*! @class RateLimiter rateLimiter.h "include/Utility/Debug/Logging/rateLimiter.h"
+		@brief Decides, per call site, whether a log record is written, and how many records were held back since the site last reported.
+		@details A call site is identified by the address of its format string, which for a literal has static storage duration. Each site
+	   owns a slot in a fixed-size open-addressing table, claimed with one compare-and-swap the first time the site logs; when the table is
+	   full, new sites are never limited. A site's records are first sampled at random with @ref RateLimitOptions::sampleRate, then pass a
+	   token bucket of @ref RateLimitOptions::burst tokens refilled at @ref RateLimitOptions::perSecond, kept as a single theoretical arrival
+	   time (the generic cell rate algorithm) so an admitted call costs one relaxed load and one compare-and-swap. Held-back records are only
+	   counted; the count is handed to the next admitted call, or to a held-back call once @ref RateLimitOptions::summaryInterval has passed
+	   since the site last reported, so a flood is summarised periodically even if it never lets up. The first record a site holds back is
+	   reported straight away, which marks where the flood began.
+		@date --/--/----
+		@version x.x.x
+		@since x.x.x
+		@author Matthew Moore
+	*/
+	class RateLimiter
+	{
+		public:
+			/*! @struct Admission rateLimiter.h "include/Utility/Debug/Logging/rateLimiter.h"
+				@brief The verdict for one record.
+			*/
+			struct Admission
+			{
+				bool write{true};	/*!< Whether the record should be written */
+				ul suppressed{0};	/*!< Records held back at this site that the caller should now report; 0 for nothing to report */
+			};
+
+			// MARK: Constructors & Destructor
+
+			/*! @brief Creates a limiter for @ref RateLimitOptions::sites call sites.
+				@param[in] options The limits; the site count is rounded up to a power of two.
+				@throws std::bad_alloc If the site table cannot be allocated.
+			*/
+			explicit RateLimiter(const RateLimitOptions &options);
+
+			// Do not allow copies or moves; the site table is shared by every logging thread
+
+			RateLimiter(const RateLimiter &) = delete;
+			RateLimiter(RateLimiter &&) = delete;
+			RateLimiter &operator=(const RateLimiter &) = delete;
+			RateLimiter &operator=(RateLimiter &&) = delete;
+			~RateLimiter() = default;
+
+			// MARK: Utility
+
+			/*! @brief Decides whether a record from @p site is written.
+				@param[in] site The call site's identity, normally the address of its format string; must not be nullptr.
+				@param[in] now The current time in nanoseconds of any monotonic clock, the same clock on every call.
+				@return The verdict. Thread-safe and lock-free.
+			*/
+			ATTR_NODISCARD Admission admit(const void *site, const sl now) noexcept;
+
+			// MARK: Static Member Functions
+
+			/*! @brief Tests whether @p options limit anything at all.
+				@param[in] options The options to test.
+				@return true if a token bucket or sampling is configured.
+			*/
+			ATTR_NODISCARD ATTR_PURE static bool enabled(const RateLimitOptions &options) noexcept;
+
+		private:
+			/*! @struct Site rateLimiter.h "include/Utility/Debug/Logging/rateLimiter.h"
+				@brief One call site's bucket and held-back count, on its own cache line so busy sites do not slow each other down.
+			*/
+			struct alignas(CACHE_LINE_SIZE) Site
+			{
+				std::atomic<const void *> key{nullptr};	 /*!< The site's identity; nullptr while the slot is free */
+				std::atomic<sl> arrival{0};				 /*!< The bucket's theoretical arrival time in nanoseconds */
+				std::atomic<ul> suppressed{0};			 /*!< Records held back since the site last reported */
+				std::atomic<sl> reported{0};			 /*!< When the site last reported held-back records */
+			};
+
+			/*! @brief Finds @p site's slot, claiming a free one the first time the site is seen.
+				@param[in] site The call site's identity.
+				@return The slot, or nullptr if the table is full.
+			*/
+			ATTR_NODISCARD Site *find(const void *site) noexcept;
+
+			/*! @brief Takes a token from @p slot's bucket.
+				@param[in,out] slot The call site's slot.
+				@param[in] now The current time in nanoseconds.
+				@return true if a token was available.
+			*/
+			ATTR_NODISCARD bool take(Site &slot, const sl now) const noexcept;
+
+			/*! @brief Draws from the calling thread's random stream to decide whether a record survives sampling.
+				@return true if the record is kept.
+			*/
+			ATTR_NODISCARD bool sampled() const noexcept;
+
+			const std::size_t mMask;					/*!< The table size minus one */
+			const sl mInterval;							/*!< Nanoseconds per token; 0 when the bucket is disabled */
+			const sl mTolerance;						/*!< How far ahead of now the arrival time may run: burst tokens' worth */
+			const ul mSampleThreshold;					/*!< A random 64-bit value below this keeps the record */
+			const sl mSummaryInterval;					/*!< Nanoseconds between reports from a site that stays flooded */
+			const std::unique_ptr<Site[]> mSites;		/*!< The open-addressing site table */
+	};
+} // namespace Project::Utility::Debug::Logging
+
+#endif
@@ -0,0 +1,275 @@
+/*! @file repeatFilter.h
+	@brief Contains the declaration of the per-thread filter that collapses consecutive identical log records into one repeat count.
+	@date --/--/----
+	@version x.x.x
+	@since x.x.x
+	@author Matthew Moore
+*/
+
+#ifndef INCLUDE_UTILITY_DEBUG_LOGGING_REPEATFILTER_H
+#define INCLUDE_UTILITY_DEBUG_LOGGING_REPEATFILTER_H
+
+#include <atomic>
+#include <chrono>
+#include <concepts>
+#include <cstddef>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "Core/attributeMacros.h"
+#include "Core/typedefs.h"
+#include "Utility/Debug/Logging/binaryFormat.h"
+
+#include <spdlog/common.h>
+
+namespace Project::Utility::Debug::Logging
+{
+	using Project::Core::ul;
+
+	/*! @class RepeatFilter repeatFilter.h "include/Utility/Debug/Logging/repeatFilter.h"
+		@brief Recognises a record that repeats the previous one from the same thread, and counts it instead of letting it be written.
+		@details A record is identified by its format id, its level and its arguments encoded by @ref Binary::encodeArgument, so it is
+	   recognised before anything is formatted; a caller with arguments that have no binary encoding formats them first and passes the text
+	   as the only argument of @ref Binary::PREFORMATTED_FORMAT. The filter keeps a 64-bit fingerprint of the last record written, so a
+	   different record costs one hash and one comparison; the stored arguments are only compared byte for byte when the fingerprints match,
+	   so a hash collision never swallows a record. Repeats are counted together with the times of the first and last of them, and the run
+	   is handed back for the caller to report as soon as a different record arrives, or once @p interval has passed since the run's first
+	   repeat, so a record that repeats forever is still reported periodically. Every filter is registered, so a run still open can be
+	   collected from any thread by @ref reportOpen; when a filter is destroyed with one open, it is kept for @ref reportOrphaned.
+		@note Only the owning thread may call @ref observe; the static members may be called from any thread.
+		@date --/--/----
+		@version x.x.x
+		@since x.x.x
+		@author Matthew Moore
+	*/
+	class RepeatFilter
+	{
+		public:
+			/*! @struct Run repeatFilter.h "include/Utility/Debug/Logging/repeatFilter.h"
+				@brief Repeats that were held back and should now be reported.
+			*/
+			struct Run
+			{
+				ul repeats{0};										 /*!< How many records were held back; 0 when there is nothing to report */
+				spdlog::level::level_enum level{spdlog::level::off}; /*!< The repeated record's level */
+				spdlog::log_clock::time_point first{};				 /*!< When the first held-back record was logged */
+				spdlog::log_clock::time_point last{};				 /*!< When the last held-back record was logged */
+				std::string_view format{};							 /*!< The repeated record's format string */
+				std::string_view payload{};							 /*!< Its encoded arguments; valid until the next @ref observe */
+			};
+
+			/*! @struct Verdict repeatFilter.h "include/Utility/Debug/Logging/repeatFilter.h"
+				@brief The decision for one record.
+			*/
+			struct Verdict
+			{
+				bool write{true}; /*!< Whether the record should be written */
+				Run run{};		  /*!< A run to report first; its repeats are 0 when there is none */
+			};
+
+			// MARK: Constructors & Destructor
+
+			/*! @brief Creates a filter that has seen no records and registers it for @ref reportOpen.
+				@param[in] interval How long a run may last before it is reported even though it has not ended.
+				@throws std::bad_alloc If the filter cannot be registered.
+			*/
+			explicit RepeatFilter(const std::chrono::nanoseconds interval);
+
+			// Do not allow copies or moves; the registry holds the filter's address
+
+			RepeatFilter(const RepeatFilter &) = delete;
+			RepeatFilter(RepeatFilter &&) = delete;
+			RepeatFilter &operator=(const RepeatFilter &) = delete;
+			RepeatFilter &operator=(RepeatFilter &&) = delete;
+
+			/*! @brief Unregisters the filter, keeping a run still open for @ref reportOrphaned.
+				@details The run is not reported here, because the thread's other thread-local state the report would be written through may
+			   already be gone.
+			*/
+			~RepeatFilter();
+
+			// MARK: Utility
+
+			/*! @brief Decides whether a record is written or counted as a repeat of the previous one.
+				@tparam Args The types of the record's arguments.
+				@param[in] epoch Identifies the period deduplication has been on; a record from a different one never counts as a repeat.
+				@param[in] id The record's format id; the address of its format string.
+				@param[in] level The record's level.
+				@param[in] format The format string @p args are reported with; must have static storage duration.
+				@param[in] now The record's timestamp.
+				@param[in] args The record's arguments, encoded but not formatted.
+				@return The verdict.
+				@throws std::bad_alloc If the stored arguments need to grow and allocation fails.
+			*/
+			template <Binary::BinaryArgument... Args>
+			ATTR_NODISCARD Verdict observe(const ul epoch, const void *id, const spdlog::level::level_enum level,
+										   const std::string_view format, const spdlog::log_clock::time_point now, const Args &...args)
+			{
+				mCandidate.clear();
+				mCandidate.reserve((std::size_t{0} + ... + Binary::encodedSize(args)));
+
+				ATTR_MAYBE_UNUSED Output output{mCandidate};
+				(Binary::encodeArgument(output, args), ...);
+
+				return decide(epoch, id, level, format, now);
+			}
+
+			// MARK: Static Member Functions
+
+			/*! @brief Hands every run still open on any thread, and every orphaned run, to @p report, and makes each filter forget its
+			   record so the next one is written.
+				@tparam Report A callable taking a `const Run &`.
+				@param[in] report Writes a run; called with the registry locked, so it must not create or destroy a filter.
+			*/
+			template <typename Report>
+				requires(std::invocable<Report &, const Run &>)
+			static void reportOpen(Report &&report)
+			{
+				Registry &registry{getRegistry()};
+				const std::scoped_lock lock(registry.mutex);
+
+				for (RepeatFilter *filter : registry.filters)
+				{
+					const std::scoped_lock filterLock(filter->mMutex);
+
+					if (filter->mRepeats != 0)
+					{
+						report(filter->currentRun());
+					}
+
+					filter->mRepeats = 0;
+					filter->mEpoch = 0;
+				}
+
+				reportOrphans(registry, report);
+			}
+
+			/*! @brief Hands every run whose filter was destroyed while it was open to @p report.
+				@tparam Report A callable taking a `const Run &`.
+				@param[in] report Writes a run; called with the registry locked, so it must not create or destroy a filter.
+			*/
+			template <typename Report>
+				requires(std::invocable<Report &, const Run &>)
+			static void reportOrphaned(Report &&report)
+			{
+				Registry &registry{getRegistry()};
+				const std::scoped_lock lock(registry.mutex);
+
+				reportOrphans(registry, report);
+			}
+
+			/*! @brief Checks whether a destroyed filter left a run for @ref reportOrphaned, without locking.
+				@return true if there may be an orphaned run.
+			*/
+			ATTR_NODISCARD static bool hasOrphaned() noexcept
+			{
+				return mOrphaned.load(std::memory_order_relaxed);
+			}
+
+		private:
+			/*! @struct Output repeatFilter.h "include/Utility/Debug/Logging/repeatFilter.h"
+				@brief Appends encoded arguments to a buffer that has already reserved room for them; satisfies @ref Binary::ByteOutput.
+			*/
+			struct Output
+			{
+				spdlog::memory_buf_t &buffer; /*!< The buffer written to */
+
+				/*! @brief Appends @p size bytes from @p data.
+					@param[in] data The bytes to append.
+					@param[in] size The number of bytes to append; within the reserved capacity.
+				*/
+				void put(const void *data, const std::size_t size) noexcept
+				{
+					const char *bytes{static_cast<const char *>(data)};
+					buffer.append(bytes, bytes + size);
+				}
+			};
+
+			/*! @struct Orphan repeatFilter.h "include/Utility/Debug/Logging/repeatFilter.h"
+				@brief A run whose filter was destroyed before it was reported, with its own copy of the encoded arguments.
+			*/
+			struct Orphan
+			{
+				Run run{};			   /*!< The run; its payload is replaced by @ref payload when reported */
+				std::string payload{}; /*!< The run's encoded arguments */
+			};
+
+			/*! @struct Registry repeatFilter.h "include/Utility/Debug/Logging/repeatFilter.h"
+				@brief Every live filter and every orphaned run.
+			*/
+			struct Registry
+			{
+				std::mutex mutex{};					   /*!< Guards both lists */
+				std::vector<RepeatFilter *> filters{}; /*!< The live filters */
+				std::vector<Orphan> orphans{};		   /*!< Runs left by destroyed filters */
+			};
+
+			/*! @brief Compares the record in @ref mCandidate with the stored one and counts or replaces it.
+				@param[in] epoch The deduplication epoch.
+				@param[in] id The format id.
+				@param[in] level The level.
+				@param[in] format The format string.
+				@param[in] now The record's timestamp.
+				@return The verdict.
+				@throws std::bad_alloc If the stored arguments need to grow and allocation fails.
+			*/
+			ATTR_NODISCARD Verdict decide(const ul epoch, const void *id, const spdlog::level::level_enum level,
+										  const std::string_view format, const spdlog::log_clock::time_point now);
+
+			/*! @brief Hashes a record's identity.
+				@param[in] id The format id.
+				@param[in] level The level.
+				@param[in] payload The encoded arguments.
+				@return The fingerprint.
+			*/
+			ATTR_NODISCARD static ul fingerprint(const void *id, const spdlog::level::level_enum level, std::string_view payload) noexcept;
+
+			/*! @brief Describes the current run.
+				@return The run, viewing @ref mCurrent.
+			*/
+			ATTR_NODISCARD ATTR_PURE Run currentRun() const noexcept;
+
+			/*! @brief Reports and discards the orphaned runs.
+				@tparam Report A callable taking a `const Run &`.
+				@param[in,out] registry The registry, already locked.
+				@param[in] report Writes a run.
+			*/
+			template <typename Report>
+			static void reportOrphans(Registry &registry, Report &report)
+			{
+				for (Orphan &orphan : registry.orphans)
+				{
+					orphan.run.payload = orphan.payload;
+					report(orphan.run);
+				}
+
+				registry.orphans.clear();
+				mOrphaned.store(false, std::memory_order_relaxed);
+			}
+
+			/*! @brief Gets the registry of every filter.
+				@return The registry.
+			*/
+			ATTR_NODISCARD static Registry &getRegistry() noexcept;
+
+			static inline std::atomic<bool> mOrphaned{false}; /*!< Whether @ref Registry::orphans may be non-empty */
+
+			std::mutex mMutex{};								  /*!< Guards the run against @ref reportOpen on another thread */
+			const std::chrono::nanoseconds mInterval;			  /*!< The longest a run goes unreported */
+			ul mEpoch{0};										  /*!< The epoch of the stored record; 0 before the first */
+			ul mFingerprint{0};									  /*!< The stored record's fingerprint */
+			const void *mId{nullptr};							  /*!< The stored record's format id */
+			spdlog::level::level_enum mLevel{spdlog::level::off}; /*!< The stored record's level */
+			std::string_view mFormat{};							  /*!< The stored record's format string */
+			ul mRepeats{0};										  /*!< Repeats of the stored record not yet reported */
+			spdlog::log_clock::time_point mFirst{};				  /*!< When the first unreported repeat was logged */
+			spdlog::log_clock::time_point mLast{};				  /*!< When the last unreported repeat was logged */
+			spdlog::memory_buf_t mCandidate{};					  /*!< The arguments of the record being observed */
+			spdlog::memory_buf_t mCurrent{};					  /*!< The stored record's arguments */
+			spdlog::memory_buf_t mPrevious{};					  /*!< The arguments of the run just ended, kept for the caller's report */
+	};
+} // namespace Project::Utility::Debug::Logging
+
+#endif
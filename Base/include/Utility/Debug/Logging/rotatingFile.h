@@ -0,0 +1,145 @@
+/*! @file rotatingFile.h
+	@brief Contains the declaration of the log file wrapper that rotates by size or wall-clock boundary and archives segments in the background.
+	@date --/--/----
+	@version x.x.x
+	@since x.x.x
+	@author Matthew Moore
+*/
+
+#ifndef INCLUDE_UTILITY_DEBUG_LOGGING_ROTATINGFILE_H
+#define INCLUDE_UTILITY_DEBUG_LOGGING_ROTATINGFILE_H
+
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <filesystem>
+#include <mutex>
+#include <string>
+#include <thread>
+
+#include "Core/attributeMacros.h"
+#include "Core/typedefs.h"
+#include "Utility/Debug/Logging/crashHandler.h"
+#include "Utility/Debug/Logging/loggerOptions.h"
+
+#include <spdlog/common.h>
+#include <spdlog/details/file_helper.h>
+
+namespace Project::Utility::Debug::Logging
+{
+	using Project::Core::ul;
+
+	/*! @class RotatingFile rotatingFile.h "include/Utility/Debug/Logging/rotatingFile.h"
+		@brief An append-only log file that rotates itself according to @ref RotationOptions.
+		@details Offers the same write/flush calls as spdlog's file_helper, so a sink's writer can use it in its place. A write that would
+	   take the file past @ref RotationOptions::maxBytes, or the first write after a wall-clock boundary, first renames the file to a
+	   timestamped segment and reopens the original name; that is two system calls on the writing thread. Compressing and pruning the
+	   segments happens on a background thread running at the lowest scheduling priority, so a slow gzip never holds up a writer.
+		@note A single write is never split, so a segment may exceed @ref RotationOptions::maxBytes by at most one write. Not thread-safe;
+	   callers serialize writes as they would for file_helper.
+		@date --/--/----
+		@version x.x.x
+		@since x.x.x
+		@author Matthew Moore
+	*/
+	class RotatingFile
+	{
+		public:
+			// MARK: Constructors & Destructor
+
+			/*! @brief Opens @p fileName for appending and, if segments need compressing or pruning, starts the archiver thread.
+				@details With time rotation enabled, a non-empty file last modified before the current boundary is rotated by the first write.
+				@param[in] fileName The path of the active log file.
+				@param[in] options When to rotate and what to do with the segments.
+				@throws spdlog::spdlog_ex If the file cannot be opened.
+				@throws std::system_error If the archiver thread cannot be started.
+			*/
+			RotatingFile(const std::string &fileName, const RotationOptions &options);
+
+			// Do not allow copies or moves; the archiver thread holds a pointer to this object
+
+			RotatingFile(const RotatingFile &) = delete;
+			RotatingFile(RotatingFile &&) = delete;
+			RotatingFile &operator=(const RotatingFile &) = delete;
+			RotatingFile &operator=(RotatingFile &&) = delete;
+
+			/*! @brief Closes the file, then waits for the archiver to finish every segment already handed to it. */
+			~RotatingFile();
+
+			// MARK: Getters
+
+			/*! @brief Gets the number of bytes counted towards the size trigger of the active file.
+				@return The active file's size, or 0 after a rotation that failed and will be retried.
+			*/
+			ATTR_NODISCARD ATTR_PURE ul size() const noexcept;
+
+			// MARK: Utility
+
+			/*! @brief Appends @p bytes to the active file, rotating first if a trigger has fired.
+				@details A failed rename is not an error: the records keep going to the active file and rotation is retried once a trigger
+			   fires again.
+				@param[in] bytes The bytes to write.
+				@throws spdlog::spdlog_ex If the active file cannot be reopened after a rotation or the write fails.
+			*/
+			void write(const spdlog::memory_buf_t &bytes);
+
+			/*! @brief Flushes the active file's stdio buffer.
+				@throws spdlog::spdlog_ex If the flush fails.
+			*/
+			void flush();
+
+			// MARK: Static Member Functions
+
+			/*! @brief Builds the path a segment of @p active rotated at @p time receives.
+				@param[in] active The path of the active log file.
+				@param[in] time The rotation time.
+				@param[in] sequence Distinguishes segments rotated within the same second; at most 999.
+				@return `<stem>.<yyyymmddTHHMMSS>.<nnn><extension>` in the directory of @p active.
+			*/
+			ATTR_NODISCARD static std::filesystem::path segmentPath(const std::filesystem::path &active, const std::chrono::sys_seconds time,
+																	const unsigned sequence);
+
+			/*! @brief Tests whether @p candidate is a rotated segment of @p active, compressed or not.
+				@param[in] active The path of the active log file.
+				@param[in] candidate The path to test; only its file name is inspected.
+				@return true if @p candidate has the form produced by @ref segmentPath, optionally followed by `.gz`.
+			*/
+			ATTR_NODISCARD static bool isSegment(const std::filesystem::path &active, const std::filesystem::path &candidate);
+
+		private:
+			// MARK: Private Member Functions
+
+			/*! @brief Tests whether a rotation trigger fires for a write of @p incoming bytes, skipping time boundaries an empty file crosses.
+				@param[in] incoming The size of the write about to happen.
+				@return true if the file should be rotated first.
+			*/
+			bool rotationDue(const std::size_t incoming);
+
+			/*! @brief Renames the active file to a new segment, reopens the original name and queues the segment for archiving.
+				@throws spdlog::spdlog_ex If the active file cannot be reopened.
+			*/
+			void rotate();
+
+			/*! @brief The archiver thread body: compresses and prunes each queued segment until the file is destroyed. */
+			void archiverLoop();
+
+			/*! @brief Deletes the oldest segments of the active file until at most @ref RotationOptions::maxFiles remain. */
+			void prune() const;
+
+			const std::filesystem::path mPath;						 /*!< The active file */
+			const RotationOptions mOptions;							 /*!< The rotation settings */
+			spdlog::details::file_helper mFile{CrashHandler::streamEvents()}; /*!< The active file's stdio handle; drained on a crash */
+			bool mOpen{false};										 /*!< Whether mFile is open; false after a failed reopen */
+			ul mSize{0};											 /*!< Bytes counted towards maxBytes */
+			std::chrono::system_clock::time_point mNextRotation{};	 /*!< The next wall-clock boundary; unused without time rotation */
+			std::chrono::sys_seconds mSegmentSecond{};				 /*!< The second the last segment was named in */
+			unsigned mNextSequence{0};								 /*!< The next sequence number free in mSegmentSecond */
+			std::mutex mArchiveMutex{};								 /*!< Guards mArchiveQueue and mStopping */
+			std::condition_variable mArchiveCondition{};			 /*!< Signalled when a segment is queued or the file is destroyed */
+			std::deque<std::filesystem::path> mArchiveQueue{};		 /*!< Segments waiting for the archiver */
+			bool mStopping{false};									 /*!< Set by the destructor */
+			std::thread mArchiver{};								 /*!< Compresses and prunes segments; only started when there is work */
+	};
+} // namespace Project::Utility::Debug::Logging
+
+#endif
@@ -0,0 +1,63 @@
+/*! @file rotatingFileSink.h
+	@brief Contains the declaration of a synchronous spdlog file sink that rotates its file by size or wall-clock boundary.
+	@date --/--/----
+	@version x.x.x
+	@since x.x.x
+	@author Matthew Moore
+*/
+
+#ifndef INCLUDE_UTILITY_DEBUG_LOGGING_ROTATINGFILESINK_H
+#define INCLUDE_UTILITY_DEBUG_LOGGING_ROTATINGFILESINK_H
+
+#include <mutex>
+#include <string>
+
+#include "Utility/Debug/Logging/loggerOptions.h"
+#include "Utility/Debug/Logging/rotatingFile.h"
+
+#include <spdlog/details/log_msg.h>
+#include <spdlog/sinks/base_sink.h>
+
+namespace Project::Utility::Debug::Logging
+{
+	/*! @class RotatingFileSink rotatingFileSink.h "include/Utility/Debug/Logging/rotatingFileSink.h"
+		@brief The synchronous counterpart of spdlog's basic_file_sink_mt that writes through a @ref RotatingFile.
+		@details Records are formatted on the calling thread into its @ref FormatBuffer::Use::Sink buffer and written under the sink's mutex,
+	   so a steady stream of records allocates nothing. Only a write that triggers a rotation pays for the rename and reopen, and compression
+	   happens on the file's archiver thread. With no rotation trigger set this is the plain synchronous mode's sink.
+		@date --/--/----
+		@version x.x.x
+		@since x.x.x
+		@author Matthew Moore
+	*/
+	class RotatingFileSink final : public spdlog::sinks::base_sink<std::mutex>
+	{
+		public:
+			/*! @brief Opens @p fileName for appending.
+				@param[in] fileName The path of the active log file.
+				@param[in] options When to rotate and what to do with the segments.
+				@param[in] buffers The size of the buffer each calling thread formats its records into.
+				@throws spdlog::spdlog_ex If the file cannot be opened.
+				@throws std::system_error If the archiver thread cannot be started.
+			*/
+			RotatingFileSink(const std::string &fileName, const RotationOptions &options, const FormatBufferOptions &buffers = {});
+
+		protected:
+			/*! @brief Formats @p msg and writes it to the active file, rotating first if a trigger has fired.
+				@param[in] msg The record produced by spdlog::logger.
+				@throws spdlog::spdlog_ex If the write or a reopen after rotation fails.
+			*/
+			void sink_it_(const spdlog::details::log_msg &msg) override;
+
+			/*! @brief Flushes the active file.
+				@throws spdlog::spdlog_ex If the flush fails.
+			*/
+			void flush_() override;
+
+		private:
+			RotatingFile mFile;					/*!< The rotating output file */
+			const FormatBufferOptions mBuffers; /*!< The size of the calling threads' formatting buffers */
+	};
+} // namespace Project::Utility::Debug::Logging
+
+#endif
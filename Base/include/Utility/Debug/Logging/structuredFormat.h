@@ -0,0 +1,245 @@
+/*! @file structuredFormat.h
+	@brief Contains the key/value field type of structured log records and the compile-time encoders that lay them out as JSON Lines or
+   logfmt.
+	@date --/--/----
+	@version x.x.x
+	@since x.x.x
+	@author Matthew Moore
+*/
+
+#ifndef INCLUDE_UTILITY_DEBUG_LOGGING_STRUCTUREDFORMAT_H
+#define INCLUDE_UTILITY_DEBUG_LOGGING_STRUCTUREDFORMAT_H
+
+#include <cmath>
+#include <cstddef>
+#include <iterator>
+#include <string_view>
+#include <type_traits>
+
+#include "Core/attributeMacros.h"
+#include "Core/cconcepts.h"
+#include "Utility/Debug/Logging/loggerOptions.h"
+
+#include <spdlog/common.h>
+#include <spdlog/fmt/fmt.h>
+
+/*! @namespace Project::Utility::Debug::Logging::Structured
+	@brief Builds structured log records: a message plus typed key/value fields, encoded straight into a caller-owned byte buffer.
+	@details A record is laid out according to a @ref RecordFormat:
+	- @ref RecordFormat::JsonLines: `{"ts":"2024-01-02T03:04:05.123456Z","level":"info","logger":"name","msg":"text","key":value,...}`
+	- @ref RecordFormat::Logfmt: `ts=2024-01-02T03:04:05.123456Z level=info logger=name msg=text key=value ...`
+	- @ref RecordFormat::Text: `text key=value ...`, the rest of the line being left to spdlog's pattern.
+
+	Which encoder a field uses is decided at compile time from its type, and every encoder appends to the buffer directly, so a record costs no
+   allocation once the buffer has grown to fit it. Keys are written as given; they are expected to be identifiers chosen by the
+   programmer, and should not repeat `ts`, `level`, `logger` or `msg`.
+	@date --/--/----
+	@version x.x.x
+	@since x.x.x
+	@author Matthew Moore
+*/
+namespace Project::Utility::Debug::Logging::Structured
+{
+	using Project::Core::FloatingPoint;
+	using Project::Core::Integral;
+	using Project::Core::SignedIntegral;
+
+	/*! @concept StringValue
+		@brief Tests whether a field value is encoded as a string.
+		@tparam T The value type, cv/ref qualifiers ignored.
+	*/
+	template <typename T>
+	concept StringValue = std::is_convertible_v<const std::remove_cvref_t<T> &, std::string_view> &&
+						  !std::is_same_v<std::remove_cvref_t<T>, std::nullptr_t>;
+
+	/*! @concept FieldValue
+		@brief Tests whether a type can be the value of a structured field.
+		@details Satisfied by `bool`, `char` (encoded as a one-character string), the other integral and floating-point types, and anything
+	   convertible to `std::string_view`.
+		@tparam T The value type, cv/ref qualifiers ignored.
+	*/
+	template <typename T>
+	concept FieldValue = Integral<std::remove_cvref_t<T>> || FloatingPoint<std::remove_cvref_t<T>> || StringValue<T>;
+
+	/*! @brief The type a @ref Field stores for a value of type @p T: strings are viewed, everything else is copied.
+		@tparam T A @ref FieldValue type.
+	*/
+	template <FieldValue T>
+	using StoredValue = std::conditional_t<StringValue<T>, std::string_view, std::remove_cvref_t<T>>;
+
+	/*! @struct Field structuredFormat.h "include/Utility/Debug/Logging/structuredFormat.h"
+		@brief One key/value pair of a structured record.
+		@details Holds views, not copies, of its key and string value, so it must not outlive the call it is passed to; build it with
+	   @ref kv inside the argument list.
+		@tparam T The stored value type, see @ref StoredValue.
+	*/
+	template <typename T>
+	struct Field
+	{
+		std::string_view key{}; /*!< The field name */
+		T value{};				/*!< The field value */
+	};
+
+	/*! @brief Tests whether a type is a @ref Field.
+		@tparam T The type to test.
+	*/
+	template <typename T>
+	constexpr bool IS_FIELD{false};
+
+	/*! @brief Tests whether a type is a @ref Field.
+		@tparam T The stored value type.
+	*/
+	template <typename T>
+	constexpr bool IS_FIELD<Field<T>>{true};
+
+	/*! @concept StructuredField
+		@brief Tests whether a log argument is a @ref Field, selecting the structured @ref Logger overloads.
+		@tparam T The argument type, cv/ref qualifiers ignored.
+	*/
+	template <typename T>
+	concept StructuredField = IS_FIELD<std::remove_cvref_t<T>>;
+
+	/*! @brief Builds a structured field.
+		@tparam T A @ref FieldValue type.
+		@param[in] key The field name.
+		@param[in] value The field value; strings are viewed, not copied.
+		@return The field.
+	*/
+	template <FieldValue T>
+	constexpr Field<StoredValue<T>> kv(const std::string_view key, const T &value) noexcept
+	{
+		return Field<StoredValue<T>>{key, StoredValue<T>{value}};
+	}
+
+	/*! @brief Appends @p text as a quoted JSON string, escaping quotes, backslashes and control characters.
+		@param[in,out] buffer Receives the encoded string.
+		@param[in] text The text to encode; bytes of 0x80 and above are copied as they are, so UTF-8 passes through.
+	*/
+	void appendJsonString(spdlog::memory_buf_t &buffer, std::string_view text);
+
+	/*! @brief Appends @p text as a logfmt value, quoting and escaping it only when it is empty or contains a space, `=`, `"` or a control
+	   character.
+		@param[in,out] buffer Receives the encoded value.
+		@param[in] text The text to encode.
+	*/
+	void appendLogfmtString(spdlog::memory_buf_t &buffer, std::string_view text);
+
+	/*! @brief Appends the record's opening: timestamp, level, logger name and message in @p format, or just the message for
+	   @ref RecordFormat::Text.
+		@details The timestamp is RFC 3339 in UTC with microseconds.
+		@param[in,out] buffer Receives the encoded header.
+		@param[in] format The record layout.
+		@param[in] time The record's timestamp.
+		@param[in] level The record's level.
+		@param[in] loggerName The logger's name.
+		@param[in] message The record's message.
+	*/
+	void appendHeader(spdlog::memory_buf_t &buffer, RecordFormat format, spdlog::log_clock::time_point time, spdlog::level::level_enum level,
+					  std::string_view loggerName, std::string_view message);
+
+	/*! @brief Appends the record's closing; the brace of a JSON object and nothing for the other formats.
+		@param[in,out] buffer Receives the closing.
+		@param[in] format The record layout.
+	*/
+	void appendFooter(spdlog::memory_buf_t &buffer, RecordFormat format);
+
+	/*! @brief Appends a field value encoded for @p format.
+		@tparam T The stored value type.
+		@param[in,out] buffer Receives the encoded value.
+		@param[in] format The record layout.
+		@param[in] value The value to encode.
+	*/
+	template <typename T>
+	void appendValue(spdlog::memory_buf_t &buffer, const RecordFormat format, const T &value)
+	{
+		if constexpr (std::is_same_v<T, bool>)
+		{
+			const std::string_view text{value ? "true" : "false"};
+			buffer.append(text.data(), text.data() + text.size());
+		}
+		else if constexpr (std::is_same_v<T, char>)
+		{
+			appendValue(buffer, format, std::string_view{&value, 1});
+		}
+		else if constexpr (FloatingPoint<T>)
+		{
+			// JSON has no spelling for infinities or NaN
+			if (format == RecordFormat::JsonLines && !std::isfinite(value)) ATTR_UNLIKELY
+			{
+				const std::string_view text{"null"};
+				buffer.append(text.data(), text.data() + text.size());
+				return;
+			}
+
+			fmt::format_to(std::back_inserter(buffer), "{}", value);
+		}
+		else if constexpr (SignedIntegral<T>)
+		{
+			const fmt::format_int text{static_cast<long long>(value)};
+			buffer.append(text.data(), text.data() + text.size());
+		}
+		else if constexpr (Integral<T>)
+		{
+			const fmt::format_int text{static_cast<unsigned long long>(value)};
+			buffer.append(text.data(), text.data() + text.size());
+		}
+		else if constexpr (StringValue<T>)
+		{
+			if (format == RecordFormat::JsonLines)
+			{
+				appendJsonString(buffer, value);
+			}
+			else
+			{
+				appendLogfmtString(buffer, value);
+			}
+		}
+	}
+
+	/*! @brief Appends one field, separator and key included, encoded for @p format.
+		@tparam T The stored value type.
+		@param[in,out] buffer Receives the encoded field.
+		@param[in] format The record layout.
+		@param[in] field The field to encode.
+	*/
+	template <typename T>
+	void appendField(spdlog::memory_buf_t &buffer, const RecordFormat format, const Field<T> &field)
+	{
+		if (format == RecordFormat::JsonLines)
+		{
+			buffer.push_back(',');
+			appendJsonString(buffer, field.key);
+			buffer.push_back(':');
+		}
+		else
+		{
+			buffer.push_back(' ');
+			buffer.append(field.key.data(), field.key.data() + field.key.size());
+			buffer.push_back('=');
+		}
+
+		appendValue(buffer, format, field.value);
+	}
+
+	/*! @brief Encodes a complete record, without the trailing newline, into @p buffer.
+		@tparam T The stored value types of the fields.
+		@param[in,out] buffer Receives the record; cleared first.
+		@param[in] format The record layout.
+		@param[in] time The record's timestamp.
+		@param[in] level The record's level.
+		@param[in] loggerName The logger's name.
+		@param[in] message The record's message.
+		@param[in] fields The record's fields, in order.
+	*/
+	template <typename... T>
+	void encode(spdlog::memory_buf_t &buffer, const RecordFormat format, const spdlog::log_clock::time_point time,
+				const spdlog::level::level_enum level, const std::string_view loggerName, const std::string_view message, const Field<T> &...fields)
+	{
+		buffer.clear();
+		appendHeader(buffer, format, time, level, loggerName, message);
+		(appendField(buffer, format, fields), ...);
+		appendFooter(buffer, format);
+	}
+} // namespace Project::Utility::Debug::Logging::Structured
+
+#endif
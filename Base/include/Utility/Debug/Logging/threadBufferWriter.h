@@ -0,0 +1,237 @@
+/*! @file threadBufferWriter.h
+	@brief Contains the declaration of the per-thread record buffers and timestamp-merging writer thread shared by the buffered sinks.
+	@date --/--/----
+	@version x.x.x
+	@since x.x.x
+	@author Matthew Moore
+*/
+
+#ifndef INCLUDE_UTILITY_DEBUG_LOGGING_THREADBUFFERWRITER_H
+#define INCLUDE_UTILITY_DEBUG_LOGGING_THREADBUFFERWRITER_H
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <span>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+#include "Core/attributeMacros.h"
+#include "Core/cconcepts.h"
+#include "Core/typedefs.h"
+#include "Utility/Containers/ByteRing/byteRing.h"
+#include "Utility/Debug/Logging/binaryFormat.h"
+#include "Utility/Debug/Logging/constants.h"
+#include "Utility/Debug/Logging/loggerOptions.h"
+#include "Utility/Debug/Logging/rotatingFile.h"
+
+#include <spdlog/common.h>
+
+namespace Project::Utility::Debug::Logging
+{
+	using Project::Core::InvocableWithArgs;
+	using Project::Core::sl;
+	using Project::Core::ui;
+	using Project::Core::ul;
+
+	/*! @class ThreadBufferWriter threadBufferWriter.h "include/Utility/Debug/Logging/threadBufferWriter.h"
+		@brief Gives every logging thread its own @ref Containers::ByteRing::ByteRing and merges them into one file on a single writer thread.
+		@details A thread's first @ref push registers a buffer with this writer; after that, a push only touches memory the thread owns and
+	   the ring's producer cursor, so threads never contend with each other. Each record is framed with its timestamp. The writer thread polls
+	   at a fixed interval (or earlier when a buffer passes half full or a caller flushes), drains every buffer, and
+	   merges the drained records by timestamp before handing them to the owning sink's @ref AppendRecord callback and writing the batch.
+		@note Records are ordered by timestamp within each writer pass. A record whose thread was preempted between taking its timestamp and
+	   publishing it can still land after a newer record from another thread that was written in an earlier pass; records from one thread
+	   always keep their order.
+		@note Owners must declare their ThreadBufferWriter after every member its callbacks use, so the writer thread is joined first.
+		@date --/--/----
+		@version x.x.x
+		@since x.x.x
+		@author Matthew Moore
+	*/
+	class ThreadBufferWriter
+	{
+		public:
+			using Ring = Containers::ByteRing::ByteRing;
+
+			/*! @brief Called on the writer thread before a batch's records are appended; may append a preamble to the batch. */
+			using PrepareBatch = std::function<void(spdlog::memory_buf_t &batch)>;
+
+			/*! @brief Called on the writer thread once per record, in timestamp order; appends the record's file form to the batch. */
+			using AppendRecord = std::function<void(spdlog::memory_buf_t &batch, sl timestamp, std::span<const std::byte> body)>;
+
+			/*! @brief The number of bytes the frame adds in front of each record body in a thread buffer. */
+			static constexpr std::size_t FRAME_SIZE{sizeof(sl) + sizeof(ui)};
+
+			// MARK: Constructors & Destructor
+
+			/*! @brief Opens @p fileName for appending, writes @p header and starts the writer thread.
+				@param[in] fileName The path of the log file.
+				@param[in] header Bytes written once, straight after opening; may be empty.
+				@param[in] threadBufferBytes The minimum size of each thread's buffer; rounded up to a power of two.
+				@param[in] policy What a push does when its thread's buffer is full. DropOldest behaves as DropNewest, since only the writer
+			   may release ring bytes.
+				@param[in] prepare Called before each batch's records are appended.
+				@param[in] append Called for each record.
+				@param[in] interval How long the writer sleeps between polls when nobody wakes it.
+				@param[in] rotation When the writer thread rotates the file; never by default. The header is only written to the first file, so
+			   owners that need one must leave rotation disabled.
+				@throws spdlog::spdlog_ex If the file cannot be opened or the header cannot be written.
+				@throws std::system_error If the writer or archiver thread cannot be started.
+			*/
+			ThreadBufferWriter(const std::string &fileName, std::string_view header, const ul threadBufferBytes, const OverflowPolicy policy,
+							   PrepareBatch prepare, AppendRecord append,
+							   const std::chrono::milliseconds interval = LOGGING_THREAD_BUFFER_WRITER_INTERVAL, const RotationOptions &rotation = {});
+
+			// Do not allow copies or moves; the writer thread and the per-thread buffer caches hold pointers to this object
+
+			ThreadBufferWriter(const ThreadBufferWriter &) = delete;
+			ThreadBufferWriter(ThreadBufferWriter &&) = delete;
+			ThreadBufferWriter &operator=(const ThreadBufferWriter &) = delete;
+			ThreadBufferWriter &operator=(ThreadBufferWriter &&) = delete;
+
+			/*! @brief Writes every buffered record, flushes the file and joins the writer thread. */
+			~ThreadBufferWriter();
+
+			// MARK: Getters
+
+			/*! @brief Gets the number of records discarded by the overflow policy or too large for a thread buffer, plus failed file writes.
+				@return The running total since construction. A failed write loses a whole batch but counts once.
+			*/
+			ATTR_NODISCARD ul droppedCount() const noexcept;
+
+			// MARK: Utility
+
+			/*! @brief Writes one record into the calling thread's buffer, applying the overflow policy when it is full.
+				@tparam Fill A callable invocable with `Ring::Writer &` that writes exactly @p bodySize bytes.
+				@param[in] timestamp The record's timestamp in nanoseconds; the writer merges threads' records in this order.
+				@param[in] bodySize The number of bytes @p fill writes.
+				@param[in] fill Writes the record body.
+				@throws std::bad_alloc If the calling thread's buffer cannot be allocated.
+			*/
+			template <InvocableWithArgs<Ring::Writer &> Fill>
+			void push(const sl timestamp, const std::size_t bodySize, Fill &&fill)
+			{
+				const std::size_t size{FRAME_SIZE + bodySize};
+
+				const auto write = [&](Ring::Writer &writer) {
+					Binary::put(writer, timestamp);
+					Binary::put(writer, static_cast<ui>(bodySize));
+					fill(writer);
+				};
+
+				Ring &ring{threadBuffer().ring};
+
+				if (size > ring.capacity()) ATTR_UNLIKELY
+				{
+					mDropped.fetch_add(1, std::memory_order_relaxed);
+					return;
+				}
+
+				while (!ring.tryPush(size, write))
+				{
+					if (mPolicy != OverflowPolicy::Block)
+					{
+						mDropped.fetch_add(1, std::memory_order_relaxed);
+						return;
+					}
+
+					wakeWriter();
+					std::this_thread::yield();
+				}
+
+				if (ring.size() > ring.capacity() / 2) ATTR_UNLIKELY
+				{
+					wakeWriter();
+				}
+			}
+
+			/*! @brief Blocks until every record pushed before the call has been written and the file has been flushed. */
+			void flush();
+
+		private:
+			/*! @struct ThreadBuffer threadBufferWriter.h "include/Utility/Debug/Logging/threadBufferWriter.h"
+				@brief One thread's buffer in one writer, shared between the thread's cache and the writer.
+			*/
+			struct ThreadBuffer
+			{
+				explicit ThreadBuffer(const ul owner, const std::size_t capacity) : writerId{owner}, ring{capacity}
+				{
+				}
+
+				const ul writerId;				   /*!< The writer this buffer belongs to */
+				Ring ring;						   /*!< The records pushed by the thread */
+				std::atomic<bool> abandoned{false}; /*!< Set when the thread exits; the writer drops the buffer once it is empty */
+				std::atomic<bool> closed{false};	   /*!< Set when the writer is destroyed; the thread drops its cached reference */
+			};
+
+			/*! @struct Pending threadBufferWriter.h "include/Utility/Debug/Logging/threadBufferWriter.h"
+				@brief The records drained from one thread buffer during the current pass.
+			*/
+			struct Pending
+			{
+				std::vector<std::byte> bytes{}; /*!< Whole framed records, in the thread's order */
+				std::size_t offset{0};			/*!< The frame of the next record to merge */
+			};
+
+			// MARK: Private Member Functions
+
+			/*! @brief Gets the calling thread's buffer in this writer, creating and registering it on first use.
+				@return A buffer only the calling thread writes to.
+			*/
+			ThreadBuffer &threadBuffer();
+
+			/*! @brief Wakes the writer thread before its poll interval expires. */
+			void wakeWriter();
+
+			/*! @brief The writer thread body: drains, flushes and sleeps until the writer is destroyed. */
+			void writerLoop();
+
+			/*! @brief Moves every thread's published records into the file, merged by timestamp.
+				@return true if any record was written.
+			*/
+			bool drain();
+
+			/*! @brief Appends the records in mPending to mBatch in timestamp order. */
+			void merge();
+
+			/*! @brief Tests whether every registered thread buffer is empty.
+				@return true if the writer has nothing to do.
+			*/
+			bool buffersEmpty();
+
+			/*! @brief Refreshes the writer's private copy of the buffer list if threads registered since the last refresh. */
+			void refreshBuffers();
+
+			const ul mId;									 /*!< Distinguishes this writer from earlier ones in per-thread buffer caches */
+			const std::size_t mThreadBufferBytes;			 /*!< The capacity of each new thread buffer */
+			const OverflowPolicy mPolicy;					 /*!< What to do when a thread buffer is full */
+			const std::chrono::milliseconds mInterval;		 /*!< How long the writer sleeps between polls */
+			const PrepareBatch mPrepare;					 /*!< The owner's batch preamble callback */
+			const AppendRecord mAppend;						 /*!< The owner's per-record callback */
+			RotatingFile mFile;								 /*!< The output file; only touched by the writer thread after construction */
+			std::mutex mBuffersMutex{};						 /*!< Guards mBuffers */
+			std::vector<std::shared_ptr<ThreadBuffer>> mBuffers{}; /*!< Every thread buffer registered with this writer */
+			std::atomic<ul> mBuffersVersion{0};				 /*!< Bumped whenever mBuffers changes */
+			std::vector<std::shared_ptr<ThreadBuffer>> mWriterBuffers{}; /*!< The writer's copy of mBuffers */
+			ul mWriterBuffersVersion{0};					 /*!< The mBuffersVersion mWriterBuffers was copied at */
+			std::vector<Pending> mPending{};				 /*!< Scratch space the writer drains each buffer into, parallel to mWriterBuffers */
+			spdlog::memory_buf_t mBatch{};					 /*!< Scratch space the writer collects one pass of records in */
+			std::atomic<ul> mDropped{0};					 /*!< Records discarded or lost */
+			std::mutex mWakeMutex{};						 /*!< Guards mWakeups */
+			std::condition_variable mWakeCondition{};		 /*!< Signalled whenever mWakeups is bumped */
+			ul mWakeups{0};									 /*!< Bumped to end the writer's current sleep early */
+			std::atomic<bool> mStopping{false};				 /*!< Set by the destructor to end the writer loop */
+			std::atomic<ul> mFlushRequested{0};				 /*!< Bumped by flush() */
+			std::atomic<ul> mFlushCompleted{0};				 /*!< The mFlushRequested value the writer last completed */
+			std::thread mWriter{};							 /*!< The writer thread; started last in the constructor */
+	};
+} // namespace Project::Utility::Debug::Logging
+
+#endif
@@ -0,0 +1,54 @@
+/*! @file timestampCache.h
+	@brief Contains the declaration of the formatter that rewrites only the changed part of a record's timestamp text.
+	@date --/--/----
+	@version x.x.x
+	@since x.x.x
+	@author Matthew Moore
+*/
+
+#ifndef INCLUDE_UTILITY_DEBUG_LOGGING_TIMESTAMPCACHE_H
+#define INCLUDE_UTILITY_DEBUG_LOGGING_TIMESTAMPCACHE_H
+
+#include <array>
+#include <cstddef>
+#include <limits>
+#include <string_view>
+
+#include "Core/attributeMacros.h"
+#include "Core/typedefs.h"
+
+#include <spdlog/common.h>
+
+namespace Project::Utility::Debug::Logging
+{
+	/*! @class TimestampCache timestampCache.h "include/Utility/Debug/Logging/timestampCache.h"
+		@brief Formats timestamps as RFC 3339 UTC text with microseconds, e.g. `2024-05-01T12:34:56.789012Z`, keeping the last text around.
+		@details The date and time of day are only converted and formatted when the whole second changes; within a second only the six
+	   microsecond digits are rewritten in place. Records arrive in roughly increasing time, so almost every call takes the short path.
+		@note Not thread-safe; keep one per thread.
+		@date --/--/----
+		@version x.x.x
+		@since x.x.x
+		@author Matthew Moore
+	*/
+	class TimestampCache
+	{
+		public:
+			/*! @brief The length of every formatted timestamp. */
+			static constexpr std::size_t LENGTH{27};
+
+			// MARK: Utility
+
+			/*! @brief Formats @p time.
+				@param[in] time The time to format.
+				@return The text; valid until the next call.
+			*/
+			ATTR_NODISCARD std::string_view format(spdlog::log_clock::time_point time);
+
+		private:
+			Project::Core::sl mSeconds{std::numeric_limits<Project::Core::sl>::min()}; /*!< The whole second @ref mText holds */
+			std::array<char, LENGTH> mText{};											 /*!< The last timestamp formatted */
+	};
+} // namespace Project::Utility::Debug::Logging
+
+#endif
@@ -0,0 +1,90 @@
+/*! @file tscClock.h
+	@brief Contains the declaration of the clock that stamps log records from the CPU's time-stamp counter.
+	@date --/--/----
+	@version x.x.x
+	@since x.x.x
+	@author Matthew Moore
+*/
+
+#ifndef INCLUDE_UTILITY_DEBUG_LOGGING_TSCCLOCK_H
+#define INCLUDE_UTILITY_DEBUG_LOGGING_TSCCLOCK_H
+
+#include "Core/attributeMacros.h"
+#include "Core/typedefs.h"
+#include "Utility/Debug/Logging/loggerOptions.h"
+
+#include <spdlog/common.h>
+
+namespace Project::Utility::Debug::Logging
+{
+	/*! @class TscClock tscClock.h "include/Utility/Debug/Logging/tscClock.h"
+		@brief A system-clock substitute that reads the time-stamp counter instead of calling into the kernel on every record.
+		@details The counter's rate is measured once against the steady clock, over @ref LOGGING_TSC_CALIBRATION, the first time the clock
+	   is used. Each thread then keeps an anchor pairing a counter reading with a system-clock reading and converts later readings relative
+	   to it with one multiply and shift; the anchor is renewed every @ref LOGGING_TSC_REANCHOR_INTERVAL, which bounds both the drift from a
+	   slightly wrong rate and the lag behind system-clock adjustments. Timestamps can therefore step back by a few microseconds when a thread
+	   renews its anchor. Only a counter the CPU reports as invariant (constant rate, synchronized across cores, running through sleep
+	   states) is used; anywhere else, including on non-x86 builds, the clock reads the system clock.
+		@date --/--/----
+		@version x.x.x
+		@since x.x.x
+		@author Matthew Moore
+	*/
+	class TscClock
+	{
+		public:
+			// Do not allow instantiation; the calibration is process-wide
+
+			TscClock() = delete;
+			TscClock(const TscClock &) = delete;
+			TscClock(TscClock &&) = delete;
+			TscClock &operator=(const TscClock &) = delete;
+			TscClock &operator=(TscClock &&) = delete;
+			~TscClock() = delete;
+
+			// MARK: Static Member Functions
+
+			/*! @brief Tests whether the time-stamp counter is used, calibrating it on the first call.
+				@details The first call blocks for @ref LOGGING_TSC_CALIBRATION on x86 CPUs with an invariant counter; call it during start-up
+			   so no logging thread pays for it.
+				@return true if @ref now reads the counter, false if it reads the system clock.
+			*/
+			ATTR_NODISCARD static bool available() noexcept;
+
+			/*! @brief Reads the current time.
+				@return The time on the system clock's scale, from the counter when @ref available is true.
+			*/
+			ATTR_NODISCARD static spdlog::log_clock::time_point now() noexcept;
+
+			/*! @brief Reads the current time from @p source.
+				@param[in] source The clock the caller was configured with.
+				@return @ref now for @ref ClockSource::Tsc, otherwise the system clock.
+			*/
+			ATTR_NODISCARD static spdlog::log_clock::time_point now(const ClockSource source) noexcept
+			{
+				return source == ClockSource::Tsc ? now() : spdlog::log_clock::now();
+			}
+
+		private:
+			/*! @struct Calibration tscClock.h "include/Utility/Debug/Logging/tscClock.h"
+				@brief The counter's measured rate, fixed after the first use.
+			*/
+			struct Calibration
+			{
+				bool invariant{false};				/*!< Whether the counter is used at all */
+				Project::Core::ul multiplier{0};	/*!< Nanoseconds per tick, scaled by 2^@ref SHIFT */
+				Project::Core::ul reanchorTicks{0};	/*!< Ticks in @ref LOGGING_TSC_REANCHOR_INTERVAL */
+			};
+
+			/*! @brief The fixed-point scale of @ref Calibration::multiplier; ticks within one anchor interval times the multiplier stay far
+			   below 2^64 at any counter rate. */
+			static constexpr unsigned SHIFT{24};
+
+			/*! @brief Provides access to the function-local static calibration, measuring it on the first call.
+				@return The calibration, valid for the lifetime of the program.
+			*/
+			ATTR_NODISCARD static const Calibration &getCalibration() noexcept;
+	};
+} // namespace Project::Utility::Debug::Logging
+
+#endif
@@ -0,0 +1,189 @@
+/*! @file uringFile.h
+	@brief Contains the declaration of the log file that batches records into registered buffers and writes them through io_uring.
+	@date --/--/----
+	@version x.x.x
+	@since x.x.x
+	@author Matthew Moore
+*/
+
+#ifndef INCLUDE_UTILITY_DEBUG_LOGGING_URINGFILE_H
+#define INCLUDE_UTILITY_DEBUG_LOGGING_URINGFILE_H
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "Core/attributeMacros.h"
+#include "Core/typedefs.h"
+#include "Utility/Debug/Logging/loggerOptions.h"
+
+#include <spdlog/common.h>
+
+namespace Project::Utility::Debug::Logging
+{
+	using Project::Core::ui;
+	using Project::Core::ul;
+
+	/*! @class UringFile uringFile.h "include/Utility/Debug/Logging/uringFile.h"
+		@brief An append-only log file that keeps several batches of records in flight at once through an io_uring instance.
+		@details Offers the same write/flush calls as @ref RotatingFile, so @ref AsyncSink's writer thread can use it in its place. Records
+	   are copied into one of @ref UringOptions::queueDepth buffers of @ref UringOptions::batchBytes each, registered with the kernel once
+	   so a write needs no page pinning. Every buffer gets its file offset when it starts filling, so batches can complete in any order;
+	   the buffers filled since the last submission go to the kernel together as one chain of linked fixed-buffer writes with a single
+	   system call, and the thread only waits for the kernel when every buffer is in flight or on @ref flush. A write the kernel completes
+	   short, fails or cancels is finished with `pwrite`. Where io_uring is unavailable, or with a queue depth of 0, one buffer is written
+	   with `pwrite` each time it fills, which still turns many records into one system call.
+		@note Records are only guaranteed to be in the file after @ref flush. Records lost to a failed write are counted, not reported. Not
+	   thread-safe; callers serialize writes as they would for file_helper.
+		@date --/--/----
+		@version x.x.x
+		@since x.x.x
+		@author Matthew Moore
+	*/
+	class UringFile
+	{
+		public:
+			// MARK: Constructors & Destructor
+
+			/*! @brief Opens @p fileName for appending, sets up the ring and registers the buffers.
+				@details Failing to set up the ring or register the buffers is not an error; the file falls back to `pwrite` (see
+			   @ref usingUring).
+				@param[in] fileName The path of the log file.
+				@param[in] options The number of buffers in flight and the size of each.
+				@throws spdlog::spdlog_ex If the file cannot be opened.
+				@throws std::bad_alloc If the buffers cannot be allocated.
+			*/
+			UringFile(const std::string &fileName, const UringOptions &options);
+
+			// Do not allow copies or moves; the kernel holds the addresses of the buffers
+
+			UringFile(const UringFile &) = delete;
+			UringFile(UringFile &&) = delete;
+			UringFile &operator=(const UringFile &) = delete;
+			UringFile &operator=(UringFile &&) = delete;
+
+			/*! @brief Writes every buffered record, waits for the writes in flight, then tears down the ring and closes the file. */
+			~UringFile();
+
+			// MARK: Getters
+
+			/*! @brief Tests whether writes go through io_uring.
+				@return false if the ring could not be set up, or was abandoned after a failed submission, and `pwrite` is used instead.
+			*/
+			ATTR_NODISCARD ATTR_PURE bool usingUring() const noexcept;
+
+			/*! @brief Gets the number of records that could not be written to the file.
+				@return The running total since construction; safe to call from any thread.
+			*/
+			ATTR_NODISCARD ul lostRecords() const noexcept;
+
+			// MARK: Utility
+
+			/*! @brief Appends @p bytes to the current buffer, handing the buffer to the kernel when it is full.
+				@details A record larger than a buffer is written on its own with `pwrite`, after the buffers ahead of it are submitted.
+				@param[in] bytes One formatted record.
+			*/
+			void write(const spdlog::memory_buf_t &bytes) noexcept;
+
+			/*! @brief Submits the partly filled buffer and blocks until every write handed to the kernel has completed. */
+			void flush() noexcept;
+
+		private:
+			/*! @struct Buffer uringFile.h "include/Utility/Debug/Logging/uringFile.h"
+				@brief One registered batch buffer and the file range it is destined for.
+			*/
+			struct Buffer
+			{
+				std::byte *data{nullptr};	/*!< The buffer's bytes, inside mStorage */
+				std::size_t size{0};		/*!< Bytes filled so far */
+				ul offset{0};				/*!< Where in the file the first byte goes */
+				ul records{0};				/*!< Records in the buffer, counted as lost if it cannot be written */
+			};
+
+			/*! @struct Ring uringFile.h "include/Utility/Debug/Logging/uringFile.h"
+				@brief The io_uring instance and the pointers into its shared submission and completion rings.
+			*/
+			struct Ring
+			{
+				int fd{-1};						/*!< The ring's file descriptor; -1 when io_uring is not used */
+				void *rings{nullptr};			/*!< The submission ring mapping, which also holds the completion ring when shared */
+				std::size_t ringsSize{0};		/*!< The length of rings */
+				void *completions{nullptr};		/*!< The completion ring mapping when the kernel maps it separately; nullptr otherwise */
+				std::size_t completionsSize{0}; /*!< The length of completions */
+				void *entries{nullptr};			/*!< The submission queue entries mapping */
+				std::size_t entriesSize{0};		/*!< The length of entries */
+				ui *sqTail{nullptr};			/*!< The submission tail this thread advances */
+				ui sqMask{0};					/*!< The submission ring size minus one */
+				ui *sqArray{nullptr};			/*!< Maps submission ring slots to entries */
+				ui *cqHead{nullptr};			/*!< The completion head this thread advances */
+				ui *cqTail{nullptr};			/*!< The kernel's completion tail */
+				ui cqMask{0};					/*!< The completion ring size minus one */
+				void *cqes{nullptr};			/*!< The completion queue entries */
+				bool fixed{false};				/*!< Whether the buffers are registered, allowing fixed-buffer writes */
+				bool usable{false};				/*!< Whether new batches are submitted through the ring */
+			};
+
+			// MARK: Private Member Functions
+
+			/*! @brief Creates the ring, maps its queues and registers the buffers; leaves mRing unused on any failure.
+				@param[in] depth The number of submission queue entries to ask for.
+			*/
+			void setupRing(const ui depth);
+
+			/*! @brief Unmaps the queues and closes the ring, after which every write uses `pwrite`. */
+			void teardownRing() noexcept;
+
+			/*! @brief Stops submitting through the ring after a failed submission; the entries the kernel did not take are written with
+			   `pwrite`.
+				@param[in] rejected The number of entries at the end of the last chain that the kernel did not take.
+			*/
+			void abandonRing(const std::size_t rejected) noexcept;
+
+			/*! @brief Takes a free buffer for the next records, reaping completions until one is free.
+				@return The index of the buffer, now starting at the current end of the file.
+			*/
+			std::size_t acquire() noexcept;
+
+			/*! @brief Marks the buffer being filled as ready for submission, if it holds anything. */
+			void seal() noexcept;
+
+			/*! @brief Hands every ready buffer to the kernel as one linked chain, or writes them with `pwrite` without a ring. */
+			void submit() noexcept;
+
+			/*! @brief Processes the completions the kernel has posted.
+				@param[in] wait Whether to block until at least one completion arrives.
+			*/
+			void reap(const bool wait) noexcept;
+
+			/*! @brief Finishes a batch the kernel did not write in full, then frees its buffer.
+				@param[in] index The buffer.
+				@param[in] result The kernel's result: the bytes written, or a negated errno.
+			*/
+			void complete(const std::size_t index, const int result) noexcept;
+
+			/*! @brief Writes @p size bytes at @p offset with `pwrite`, retrying partial writes and interruptions.
+				@param[in] data The bytes to write.
+				@param[in] size The number of bytes.
+				@param[in] offset Where in the file they go.
+				@return true if every byte was written.
+			*/
+			ATTR_NODISCARD bool writeAt(const std::byte *data, std::size_t size, ul offset) const noexcept;
+
+			const std::string mFileName;				 /*!< The path of the log file, for error messages */
+			const std::size_t mBatchBytes;				 /*!< The size of each buffer */
+			int mFile{-1};								 /*!< The log file's descriptor */
+			ul mOffset{0};								 /*!< Where the next record goes: the end of the file plus everything buffered */
+			std::unique_ptr<std::byte[]> mStorage{};	 /*!< Every buffer's bytes, allocated in one block */
+			std::vector<Buffer> mBuffers{};				 /*!< The batch buffers */
+			std::vector<std::size_t> mFree{};			 /*!< Buffers neither filling, ready nor in flight */
+			std::vector<std::size_t> mReady{};			 /*!< Full buffers waiting to be submitted, in file order */
+			std::size_t mCurrent{0};					 /*!< The buffer being filled; mBuffers.size() when none */
+			std::size_t mInFlight{0};					 /*!< Buffers submitted and not yet completed */
+			Ring mRing{};								 /*!< The io_uring instance */
+			std::atomic<ul> mLost{0};					 /*!< Records that could not be written */
+	};
+} // namespace Project::Utility::Debug::Logging
+
+#endif
@@ -0,0 +1,32 @@
+/*! @file constants.h
+	@brief Contains the constant definitions for use with metrics.
+	@date --/--/----
+	@version x.x.x
+	@since x.x.x
+	@author Matthew Moore
+*/
+
+#ifndef INCLUDE_UTILITY_DEBUG_METRICS_CONSTANTS_H
+#define INCLUDE_UTILITY_DEBUG_METRICS_CONSTANTS_H
+
+#include <chrono>
+#include <string_view>
+
+#include "Core/typedefs.h"
+
+namespace Project::Utility::Debug::Metrics
+{
+	/*! @brief The most shards a metric is split into; machines with more CPUs share shards between them. Must be a power of two. */
+	inline constexpr Project::Core::ul METRICS_MAX_SHARDS{64};
+
+	/*! @brief The number of bits of a histogram value kept below its leading one, so each power of two is split into eight buckets. */
+	inline constexpr unsigned METRICS_HISTOGRAM_SUB_BUCKET_BITS{3};
+
+	/*! @brief The default file the metrics exporter writes its snapshots to. */
+	inline constexpr std::string_view METRICS_FILE_NAME{"project.prom"};
+
+	/*! @brief The default time between two snapshots written by the metrics exporter. */
+	inline constexpr std::chrono::milliseconds METRICS_EXPORT_INTERVAL{10'000};
+} // namespace Project::Utility::Debug::Metrics
+
+#endif
@@ -0,0 +1,85 @@
+/*! @file counter.h
+	@brief Contains the declaration of the monotonically increasing metric whose increments are spread over per-CPU shards.
+	@date --/--/----
+	@version x.x.x
+	@since x.x.x
+	@author Matthew Moore
+*/
+
+#ifndef INCLUDE_UTILITY_DEBUG_METRICS_COUNTER_H
+#define INCLUDE_UTILITY_DEBUG_METRICS_COUNTER_H
+
+#include <atomic>
+#include <memory>
+
+#include "Core/attributeMacros.h"
+#include "Core/hardware.h"
+#include "Core/typedefs.h"
+#include "Utility/Debug/Metrics/constants.h"
+#include "Utility/Debug/Metrics/shards.h"
+
+namespace Project::Utility::Debug::Metrics
+{
+	using Project::Core::CACHE_LINE_SIZE;
+	using Project::Core::ul;
+
+	/*! @class Counter counter.h "include/Utility/Debug/Metrics/counter.h"
+		@brief A count that only goes up, such as requests served or bytes written.
+		@details The count is split into one cache-line-sized slot per @ref Shards shard. An increment is a single relaxed `fetch_add` on
+	   the slot of the CPU the caller runs on, so threads on different CPUs never contend or share a line; reading the count sums the
+	   slots, which only the exporter does. The count wraps at 2^64.
+		@date --/--/----
+		@version x.x.x
+		@since x.x.x
+		@author Matthew Moore
+	*/
+	class Counter
+	{
+		public:
+			// MARK: Constructors & Destructor
+
+			/*! @brief Creates a counter at zero with one slot per shard.
+				@throws std::bad_alloc If the slots cannot be allocated.
+			*/
+			Counter();
+
+			// Do not allow copies or moves; callers keep references handed out by the registry
+
+			Counter(const Counter &) = delete;
+			Counter(Counter &&) = delete;
+			Counter &operator=(const Counter &) = delete;
+			Counter &operator=(Counter &&) = delete;
+			~Counter() = default;
+
+			// MARK: Getters
+
+			/*! @brief Sums the shards.
+				@return The count. Increments racing with the read may or may not be included.
+			*/
+			ATTR_NODISCARD ul value() const noexcept;
+
+			// MARK: Utility
+
+			/*! @brief Adds @p amount to the count.
+				@param[in] amount The amount to add.
+			*/
+			void add(const ul amount = 1) noexcept
+			{
+				mSlots[Shards::current(mMask)].value.fetch_add(amount, std::memory_order_relaxed);
+			}
+
+		private:
+			/*! @struct Slot counter.h "include/Utility/Debug/Metrics/counter.h"
+				@brief One shard's part of the count, alone on its cache line.
+			*/
+			struct alignas(CACHE_LINE_SIZE) Slot
+			{
+				std::atomic<ul> value{0}; /*!< The increments made on this shard */
+			};
+
+			const ul mMask;					/*!< One less than the number of slots */
+			std::unique_ptr<Slot[]> mSlots; /*!< One slot per shard */
+	};
+} // namespace Project::Utility::Debug::Metrics
+
+#endif
@@ -0,0 +1,79 @@
+/*! @file gauge.h
+	@brief Contains the declaration of the metric that holds a value which can go up and down.
+	@date --/--/----
+	@version x.x.x
+	@since x.x.x
+	@author Matthew Moore
+*/
+
+#ifndef INCLUDE_UTILITY_DEBUG_METRICS_GAUGE_H
+#define INCLUDE_UTILITY_DEBUG_METRICS_GAUGE_H
+
+#include <atomic>
+
+#include "Core/attributeMacros.h"
+#include "Core/hardware.h"
+#include "Core/typedefs.h"
+#include "Utility/Debug/Metrics/constants.h"
+
+namespace Project::Utility::Debug::Metrics
+{
+	using Project::Core::CACHE_LINE_SIZE;
+	using Project::Core::sl;
+
+	/*! @class Gauge gauge.h "include/Utility/Debug/Metrics/gauge.h"
+		@brief A current level, such as queue depth or open connections.
+		@details Unlike a @ref Counter the value is not sharded: a @ref set has to replace every earlier update, which a sum over shards
+	   cannot express. The value sits alone on its cache line, and every operation is a single relaxed atomic.
+		@date --/--/----
+		@version x.x.x
+		@since x.x.x
+		@author Matthew Moore
+	*/
+	class alignas(CACHE_LINE_SIZE) Gauge
+	{
+		public:
+			// MARK: Getters
+
+			/*! @brief Gets the value.
+				@return The value.
+			*/
+			ATTR_NODISCARD sl value() const noexcept
+			{
+				return mValue.load(std::memory_order_relaxed);
+			}
+
+			// MARK: Setters
+
+			/*! @brief Replaces the value.
+				@param[in] value The new value.
+			*/
+			void set(const sl value) noexcept
+			{
+				mValue.store(value, std::memory_order_relaxed);
+			}
+
+			// MARK: Utility
+
+			/*! @brief Adds @p amount to the value.
+				@param[in] amount The amount to add; negative to subtract.
+			*/
+			void add(const sl amount = 1) noexcept
+			{
+				mValue.fetch_add(amount, std::memory_order_relaxed);
+			}
+
+			/*! @brief Subtracts @p amount from the value.
+				@param[in] amount The amount to subtract.
+			*/
+			void subtract(const sl amount = 1) noexcept
+			{
+				mValue.fetch_sub(amount, std::memory_order_relaxed);
+			}
+
+		private:
+			std::atomic<sl> mValue{0}; /*!< The value */
+	};
+} // namespace Project::Utility::Debug::Metrics
+
+#endif
@@ -0,0 +1,152 @@
+/*! @file histogram.h
+	@brief Contains the declaration of the log-linear histogram metric whose buckets are spread over per-CPU shards.
+	@date --/--/----
+	@version x.x.x
+	@since x.x.x
+	@author Matthew Moore
+*/
+
+#ifndef INCLUDE_UTILITY_DEBUG_METRICS_HISTOGRAM_H
+#define INCLUDE_UTILITY_DEBUG_METRICS_HISTOGRAM_H
+
+#include <array>
+#include <atomic>
+#include <bit>
+#include <limits>
+#include <memory>
+
+#include "Core/attributeMacros.h"
+#include "Core/hardware.h"
+#include "Core/typedefs.h"
+#include "Utility/Debug/Metrics/constants.h"
+#include "Utility/Debug/Metrics/shards.h"
+
+namespace Project::Utility::Debug::Metrics
+{
+	using Project::Core::CACHE_LINE_SIZE;
+	using Project::Core::ul;
+
+	/*! @class Histogram histogram.h "include/Utility/Debug/Metrics/histogram.h"
+		@brief The distribution of unsigned values, such as latencies in nanoseconds or sizes in bytes.
+		@details Buckets are log-linear: values below 8 get a bucket each, and every power of two above that is split into 8 equal
+	   buckets, so a bucket's width is at most 1/8 of its lower bound across the whole 64-bit range, in 496 buckets. The bucket of a value
+	   is found with one bit scan and two shifts. Each @ref Shards shard owns a full set of buckets and a sum, starting on its own cache
+	   line; recording a value is a relaxed `fetch_add` on its bucket and one on the sum, both on the calling CPU's shard.
+		@note The sum wraps at 2^64.
+		@date --/--/----
+		@version x.x.x
+		@since x.x.x
+		@author Matthew Moore
+	*/
+	class Histogram
+	{
+		public:
+			/*! @brief The number of buckets each power of two is split into. */
+			static constexpr ul SUB_BUCKETS{ul{1} << METRICS_HISTOGRAM_SUB_BUCKET_BITS};
+
+			/*! @brief The number of buckets covering every 64-bit value. */
+			static constexpr ul BUCKETS{(64 - METRICS_HISTOGRAM_SUB_BUCKET_BITS + 1) * SUB_BUCKETS};
+
+			/*! @struct Snapshot histogram.h "include/Utility/Debug/Metrics/histogram.h"
+				@brief The histogram's buckets summed over its shards.
+			*/
+			struct Snapshot
+			{
+				std::array<ul, BUCKETS> buckets{}; /*!< The values recorded in each bucket */
+				ul count{0};					   /*!< The values recorded in all buckets */
+				ul sum{0};						   /*!< The sum of the values recorded */
+
+				/*! @brief Estimates a quantile as the upper bound of the bucket holding it.
+					@param[in] quantile The quantile, from 0 to 1.
+					@return The estimate; 0 for an empty snapshot.
+				*/
+				ATTR_NODISCARD ATTR_PURE ul quantile(const double quantile) const noexcept;
+			};
+
+			// MARK: Constructors & Destructor
+
+			/*! @brief Creates an empty histogram with one set of buckets per shard.
+				@throws std::bad_alloc If the buckets cannot be allocated.
+			*/
+			Histogram();
+
+			// Do not allow copies or moves; callers keep references handed out by the registry
+
+			Histogram(const Histogram &) = delete;
+			Histogram(Histogram &&) = delete;
+			Histogram &operator=(const Histogram &) = delete;
+			Histogram &operator=(Histogram &&) = delete;
+			~Histogram() = default;
+
+			// MARK: Getters
+
+			/*! @brief Sums the shards.
+				@return The buckets, count and sum. Values recorded while the snapshot is taken may or may not be included.
+			*/
+			ATTR_NODISCARD Snapshot snapshot() const noexcept;
+
+			// MARK: Utility
+
+			/*! @brief Records @p value.
+				@param[in] value The value to record.
+			*/
+			void record(const ul value) noexcept
+			{
+				Shard &shard{mShards[Shards::current(mMask)]};
+
+				shard.buckets[bucketIndex(value)].fetch_add(1, std::memory_order_relaxed);
+				shard.sum.fetch_add(value, std::memory_order_relaxed);
+			}
+
+			// MARK: Static Member Functions
+
+			/*! @brief Finds the bucket @p value is recorded in.
+				@param[in] value The value.
+				@return The bucket index, below @ref BUCKETS.
+			*/
+			ATTR_NODISCARD static constexpr ul bucketIndex(const ul value) noexcept
+			{
+				if (value < SUB_BUCKETS)
+				{
+					return value;
+				}
+
+				const ul exponent{static_cast<ul>(std::numeric_limits<ul>::digits - std::countl_zero(value)) - 1};
+				const ul shift{exponent - METRICS_HISTOGRAM_SUB_BUCKET_BITS};
+
+				return ((shift + 1) * SUB_BUCKETS) + ((value >> shift) & (SUB_BUCKETS - 1));
+			}
+
+			/*! @brief Finds the largest value recorded in @p bucket.
+				@param[in] bucket The bucket index, below @ref BUCKETS.
+				@return The bucket's inclusive upper bound.
+			*/
+			ATTR_NODISCARD static constexpr ul bucketUpperBound(const ul bucket) noexcept
+			{
+				if (bucket < SUB_BUCKETS)
+				{
+					return bucket;
+				}
+
+				const ul shift{(bucket / SUB_BUCKETS) - 1};
+				const ul lower{(SUB_BUCKETS + (bucket % SUB_BUCKETS)) << shift};
+
+				return lower + ((ul{1} << shift) - 1);
+			}
+
+		private:
+			/*! @struct Shard histogram.h "include/Utility/Debug/Metrics/histogram.h"
+				@brief One shard's buckets and sum, starting on a cache line of its own.
+			*/
+			struct alignas(CACHE_LINE_SIZE) Shard
+			{
+				std::array<std::atomic<ul>, BUCKETS> buckets{}; /*!< The values recorded on this shard in each bucket */
+				std::atomic<ul> sum{0};							 /*!< The sum of the values recorded on this shard */
+			};
+
+			const ul mMask;					  /*!< One less than the number of shards */
+			std::unique_ptr<Shard[]> mShards; /*!< One set of buckets per shard */
+	};
+} // namespace Project::Utility::Debug::Metrics
+
+#endif
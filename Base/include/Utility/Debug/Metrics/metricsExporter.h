@@ -0,0 +1,120 @@
+/*! @file metricsExporter.h
+	@brief Contains the declaration of the background writer that periodically exports a metrics registry to a Prometheus or JSON file.
+	@date --/--/----
+	@version x.x.x
+	@since x.x.x
+	@author Matthew Moore
+*/
+
+#ifndef INCLUDE_UTILITY_DEBUG_METRICS_METRICSEXPORTER_H
+#define INCLUDE_UTILITY_DEBUG_METRICS_METRICSEXPORTER_H
+
+#include <atomic>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+
+#include "Core/attributeMacros.h"
+#include "Core/typedefs.h"
+#include "Utility/Debug/Logging/rotatingFile.h"
+#include "Utility/Debug/Metrics/metricsOptions.h"
+#include "Utility/Debug/Metrics/registry.h"
+
+#include <spdlog/common.h>
+
+namespace Project::Utility::Debug::Metrics
+{
+	using Project::Core::ul;
+
+	/*! @class MetricsExporter metricsExporter.h "include/Utility/Debug/Metrics/metricsExporter.h"
+		@brief Snapshots a @ref Registry every @ref ExportOptions::interval on a background thread and writes the snapshot to a file.
+		@details Snapshots are rendered into the exporter thread's @ref Logging::FormatBuffer and written with the Logger's file machinery.
+	   A Prometheus snapshot is written to `<file>.tmp` and renamed over the file, so a textfile collector never reads half a snapshot. A
+	   JSON snapshot is appended as one line through a @ref Logging::RotatingFile, so the file keeps a history that rotates and is pruned
+	   like a log file. Histograms are exported with only their non-empty buckets.
+		@date --/--/----
+		@version x.x.x
+		@since x.x.x
+		@author Matthew Moore
+	*/
+	class MetricsExporter
+	{
+		public:
+			// MARK: Constructors & Destructor
+
+			/*! @brief Starts exporting @p registry to @p fileName.
+				@param[in] registry The metrics to export; must outlive the exporter.
+				@param[in] fileName The file to write.
+				@param[in] options The format, period and rotation.
+				@throws spdlog::spdlog_ex If a JSON file cannot be opened.
+				@throws std::system_error If the exporter thread cannot be started.
+			*/
+			MetricsExporter(const Registry &registry, std::string fileName, const ExportOptions &options = {});
+
+			// Do not allow copies or moves; the exporter thread holds a pointer to this object
+
+			MetricsExporter(const MetricsExporter &) = delete;
+			MetricsExporter(MetricsExporter &&) = delete;
+			MetricsExporter &operator=(const MetricsExporter &) = delete;
+			MetricsExporter &operator=(MetricsExporter &&) = delete;
+
+			/*! @brief Stops the exporter thread and writes a final snapshot, so the file ends with the last values. */
+			~MetricsExporter();
+
+			// MARK: Getters
+
+			/*! @brief Gets the number of snapshots that could not be written.
+				@return The failed exports since construction.
+			*/
+			ATTR_NODISCARD ul getFailedExports() const noexcept;
+
+			// MARK: Utility
+
+			/*! @brief Snapshots the registry and writes it now, on the calling thread.
+				@return true if the snapshot was written; false, counted in @ref getFailedExports, if anything threw.
+			*/
+			bool exportNow();
+
+			// MARK: Static Member Functions
+
+			/*! @brief Renders @p snapshot in the Prometheus text exposition format.
+				@param[in] snapshot The values.
+				@param[out] buffer Receives the text, appended.
+			*/
+			static void renderPrometheus(const Registry::Snapshot &snapshot, spdlog::memory_buf_t &buffer);
+
+			/*! @brief Renders @p snapshot as one line of JSON with the time it was taken.
+				@param[in] snapshot The values.
+				@param[in] time When the snapshot was taken.
+				@param[out] buffer Receives the line, newline included, appended.
+			*/
+			static void renderJson(const Registry::Snapshot &snapshot, spdlog::log_clock::time_point time, spdlog::memory_buf_t &buffer);
+
+		private:
+			// MARK: Private Member Functions
+
+			/*! @brief The exporter thread body: exports every interval until the exporter is destroyed. */
+			void exporterLoop();
+
+			/*! @brief Writes @p bytes to a temporary file and renames it over the export file.
+				@param[in] bytes The complete file contents.
+				@throws spdlog::spdlog_ex If the temporary file cannot be written or renamed.
+			*/
+			void replaceFile(const spdlog::memory_buf_t &bytes) const;
+
+			const Registry &mRegistry;							/*!< The exported metrics */
+			const std::string mFileName;						/*!< The export file */
+			const ExportOptions mOptions;						/*!< The format, period and rotation */
+			std::unique_ptr<Logging::RotatingFile> mFile{};	/*!< The appended file; only used for JSON */
+			std::atomic<ul> mFailedExports{0};					/*!< Snapshots that could not be written */
+			std::mutex mExportMutex{};							/*!< Serializes exports from the thread and from exportNow */
+			std::mutex mStopMutex{};							/*!< Guards mStopping */
+			std::condition_variable mStopCondition{};			/*!< Signalled when the exporter is destroyed */
+			bool mStopping{false};								/*!< Set by the destructor */
+			std::thread mExporter{};							/*!< Writes a snapshot every interval; not started for interval 0 */
+	};
+} // namespace Project::Utility::Debug::Metrics
+
+#endif
@@ -0,0 +1,48 @@
+/*! @file metricsOptions.h
+	@brief Contains the option types that select how the metrics exporter writes its snapshots.
+	@date --/--/----
+	@version x.x.x
+	@since x.x.x
+	@author Matthew Moore
+*/
+
+#ifndef INCLUDE_UTILITY_DEBUG_METRICS_METRICSOPTIONS_H
+#define INCLUDE_UTILITY_DEBUG_METRICS_METRICSOPTIONS_H
+
+#include <chrono>
+
+#include "Core/typedefs.h"
+#include "Utility/Debug/Logging/loggerOptions.h"
+#include "Utility/Debug/Metrics/constants.h"
+
+namespace Project::Utility::Debug::Metrics
+{
+	/*! @enum ExportFormat
+		@brief Selects the layout of the snapshots the metrics exporter writes, and so how the file holds them.
+		@date --/--/----
+		@version x.x.x
+		@since x.x.x
+		@author Matthew Moore
+	*/
+	enum class ExportFormat : Project::Core::ub
+	{
+		Prometheus, /*!< Prometheus text exposition format; each snapshot atomically replaces the file, as the textfile collector expects */
+		JsonLines,	/*!< One JSON object per snapshot, appended to the file, which rotates like a log file */
+	};
+
+	/*! @struct ExportOptions metricsOptions.h "include/Utility/Debug/Metrics/metricsOptions.h"
+		@brief Selects the format, period and file handling of a @ref MetricsExporter.
+		@date --/--/----
+		@version x.x.x
+		@since x.x.x
+		@author Matthew Moore
+	*/
+	struct ExportOptions
+	{
+		ExportFormat format{ExportFormat::Prometheus};					/*!< The snapshot layout */
+		std::chrono::milliseconds interval{METRICS_EXPORT_INTERVAL};	/*!< The time between snapshots; 0 only exports on request */
+		Logging::RotationOptions rotation{};							/*!< When an appended JSON file rotates; unused for Prometheus */
+	};
+} // namespace Project::Utility::Debug::Metrics
+
+#endif
@@ -0,0 +1,188 @@
+/*! @file registry.h
+	@brief Contains the declaration of the named collection of counters, gauges and histograms that the metrics exporter snapshots.
+	@date --/--/----
+	@version x.x.x
+	@since x.x.x
+	@author Matthew Moore
+*/
+
+#ifndef INCLUDE_UTILITY_DEBUG_METRICS_REGISTRY_H
+#define INCLUDE_UTILITY_DEBUG_METRICS_REGISTRY_H
+
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <set>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "Core/attributeMacros.h"
+#include "Core/typedefs.h"
+#include "Utility/Debug/Metrics/counter.h"
+#include "Utility/Debug/Metrics/gauge.h"
+#include "Utility/Debug/Metrics/histogram.h"
+
+namespace Project::Utility::Debug::Metrics
+{
+	using Project::Core::sl;
+	using Project::Core::ul;
+
+	/*! @class Registry registry.h "include/Utility/Debug/Metrics/registry.h"
+		@brief Owns the process's metrics under unique names and takes consistent-enough snapshots of them all for export.
+		@details Looking a metric up takes the registry's mutex, so callers look each one up once and keep the reference, which stays valid
+	   for the registry's lifetime; updating a metric through it never touches the registry at all. Names follow the Prometheus rules:
+	   ASCII letters, digits, `_` and `:`, not starting with a digit.
+		@date --/--/----
+		@version x.x.x
+		@since x.x.x
+		@author Matthew Moore
+	*/
+	class Registry
+	{
+		public:
+			/*! @struct Value registry.h "include/Utility/Debug/Metrics/registry.h"
+				@brief A counter's or gauge's value at the time of a snapshot.
+				@tparam T The value type.
+			*/
+			template <typename T>
+			struct Value
+			{
+				std::string_view name{}; /*!< The metric's name; valid for the registry's lifetime */
+				std::string_view help{}; /*!< The metric's description; valid for the registry's lifetime */
+				T value{};				 /*!< The value */
+			};
+
+			/*! @struct Distribution registry.h "include/Utility/Debug/Metrics/registry.h"
+				@brief A histogram's buckets at the time of a snapshot.
+			*/
+			struct Distribution
+			{
+				std::string_view name{};		 /*!< The metric's name; valid for the registry's lifetime */
+				std::string_view help{};		 /*!< The metric's description; valid for the registry's lifetime */
+				Histogram::Snapshot histogram{}; /*!< The buckets, count and sum */
+			};
+
+			/*! @struct Snapshot registry.h "include/Utility/Debug/Metrics/registry.h"
+				@brief Every metric's value, each list in registration order.
+			*/
+			struct Snapshot
+			{
+				std::vector<Value<ul>> counters{};		  /*!< The counters */
+				std::vector<Value<sl>> gauges{};		  /*!< The gauges */
+				std::vector<Distribution> histograms{}; /*!< The histograms */
+
+				Snapshot() = default;
+				Snapshot(const Snapshot &) = default;
+				Snapshot(Snapshot &&) noexcept = default;
+				Snapshot &operator=(const Snapshot &) = default;
+				Snapshot &operator=(Snapshot &&) noexcept = default;
+
+				/*! @brief Frees the lists; defined out of line, as three vectors are too much to inline at every caller's cleanup. */
+				~Snapshot();
+			};
+
+			// MARK: Constructors & Destructor
+
+			/*! @brief Creates an empty registry. */
+			Registry();
+
+			// Do not allow copies or moves; callers keep references to the metrics
+
+			Registry(const Registry &) = delete;
+			Registry(Registry &&) = delete;
+			Registry &operator=(const Registry &) = delete;
+			Registry &operator=(Registry &&) = delete;
+			/*! @brief Destroys every metric; references handed out by the getters dangle afterwards. */
+			~Registry();
+
+			// MARK: Getters
+
+			/*! @brief Gets the counter named @p name, creating it if it does not exist yet.
+				@param[in] name The metric's name.
+				@param[in] help A one-line description; only used when the counter is created.
+				@return The counter.
+				@throws std::invalid_argument If @p name is not a valid metric name or belongs to a gauge or histogram.
+				@throws std::bad_alloc If the counter cannot be created.
+			*/
+			ATTR_NODISCARD Counter &counter(std::string_view name, std::string_view help = {});
+
+			/*! @brief Gets the gauge named @p name, creating it if it does not exist yet.
+				@param[in] name The metric's name.
+				@param[in] help A one-line description; only used when the gauge is created.
+				@return The gauge.
+				@throws std::invalid_argument If @p name is not a valid metric name or belongs to a counter or histogram.
+				@throws std::bad_alloc If the gauge cannot be created.
+			*/
+			ATTR_NODISCARD Gauge &gauge(std::string_view name, std::string_view help = {});
+
+			/*! @brief Gets the histogram named @p name, creating it if it does not exist yet.
+				@param[in] name The metric's name.
+				@param[in] help A one-line description; only used when the histogram is created.
+				@return The histogram.
+				@throws std::invalid_argument If @p name is not a valid metric name or belongs to a counter or gauge.
+				@throws std::bad_alloc If the histogram cannot be created.
+			*/
+			ATTR_NODISCARD Histogram &histogram(std::string_view name, std::string_view help = {});
+
+			/*! @brief Reads every metric.
+				@details Each metric is read on its own, so updates racing with the snapshot may show up in one metric and not yet in another.
+				@return The values.
+				@throws std::bad_alloc If the snapshot cannot be allocated.
+			*/
+			ATTR_NODISCARD Snapshot snapshot() const;
+
+			// MARK: Static Member Functions
+
+			/*! @brief Gets the process-wide registry.
+				@return The registry, created on first use.
+			*/
+			ATTR_NODISCARD static Registry &global();
+
+			/*! @brief Tests whether @p name is a valid metric name.
+				@param[in] name The name to test.
+				@return true if @p name is non-empty, consists of ASCII letters, digits, `_` and `:`, and does not start with a digit.
+			*/
+			ATTR_NODISCARD ATTR_PURE static bool validName(std::string_view name) noexcept;
+
+		private:
+			/*! @struct Entry registry.h "include/Utility/Debug/Metrics/registry.h"
+				@brief A metric together with its name and description.
+				@tparam Metric The metric type.
+			*/
+			template <typename Metric>
+			struct Entry
+			{
+				/*! @brief Creates the metric.
+					@param[in] entryName The metric's name.
+					@param[in] entryHelp The metric's description.
+				*/
+				Entry(std::string_view entryName, std::string_view entryHelp) : name{entryName}, help{entryHelp}
+				{
+				}
+
+				const std::string name; /*!< The metric's name */
+				const std::string help; /*!< The metric's description */
+				Metric metric{};		/*!< The metric */
+			};
+
+			/*! @brief Finds the metric named @p name in @p entries, or creates it there.
+				@tparam Metric The metric type.
+				@param[in,out] entries The metrics of that type; a deque so that existing metrics never move.
+				@param[in] name The metric's name.
+				@param[in] help The metric's description.
+				@return The metric.
+				@throws std::invalid_argument If @p name is not valid or belongs to a metric of another type.
+			*/
+			template <typename Metric>
+			ATTR_NODISCARD Metric &findOrCreate(std::deque<Entry<Metric>> &entries, std::string_view name, std::string_view help);
+
+			mutable std::mutex mMutex{};					  /*!< Guards the metric lists and mNames, never the metrics */
+			std::deque<Entry<Counter>> mCounters{};			  /*!< The counters, in registration order */
+			std::deque<Entry<Gauge>> mGauges{};				  /*!< The gauges, in registration order */
+			std::deque<Entry<Histogram>> mHistograms{};		  /*!< The histograms, in registration order */
+			std::set<std::string, std::less<>> mNames{};	  /*!< Every registered name, whatever its type */
+	};
+} // namespace Project::Utility::Debug::Metrics
+
+#endif
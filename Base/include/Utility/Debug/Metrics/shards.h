@@ -0,0 +1,72 @@
+/*! @file shards.h
+	@brief Contains the declaration of the mapping from the calling CPU to the shard of a metric it updates.
+	@date --/--/----
+	@version x.x.x
+	@since x.x.x
+	@author Matthew Moore
+*/
+
+#ifndef INCLUDE_UTILITY_DEBUG_METRICS_SHARDS_H
+#define INCLUDE_UTILITY_DEBUG_METRICS_SHARDS_H
+
+#include <sched.h>
+
+#include "Core/attributeMacros.h"
+#include "Core/typedefs.h"
+
+/*! @namespace Project::Utility::Debug::Metrics
+	@brief Counters, gauges and histograms cheap enough to update on hot paths, and an exporter that writes their snapshots to a file.
+	@date --/--/----
+	@version x.x.x
+	@since x.x.x
+	@author Matthew Moore
+*/
+namespace Project::Utility::Debug::Metrics
+{
+	using Project::Core::ul;
+
+	/*! @class Shards shards.h "include/Utility/Debug/Metrics/shards.h"
+		@brief Picks the shard of a metric the calling thread updates, so that threads on different CPUs never write the same cache line.
+		@details Shards are indexed by the CPU the thread is running on, read through `sched_getcpu`, which glibc answers from the thread's
+	   restartable-sequence area without a system call. A thread can migrate between reading its CPU and updating the shard, so updates stay
+	   atomic; they are just almost never contended. Where the CPU cannot be read, each thread keeps a shard of its own choosing instead.
+		@date --/--/----
+		@version x.x.x
+		@since x.x.x
+		@author Matthew Moore
+	*/
+	class Shards
+	{
+		public:
+			// MARK: Getters
+
+			/*! @brief Gets the number of shards each metric is split into.
+				@return The CPU count rounded up to a power of two, at most @ref METRICS_MAX_SHARDS.
+			*/
+			ATTR_NODISCARD static ul count() noexcept;
+
+			/*! @brief Gets the shard the calling thread should update.
+				@param[in] mask One less than @ref count.
+				@return The shard index.
+			*/
+			ATTR_NODISCARD static ul current(const ul mask) noexcept
+			{
+				const int cpu{::sched_getcpu()};
+
+				if (cpu >= 0) ATTR_LIKELY
+				{
+					return static_cast<ul>(cpu) & mask;
+				}
+
+				return threadShard() & mask;
+			}
+
+		private:
+			/*! @brief Gets the shard picked for the calling thread when its CPU cannot be read.
+				@return An index spread over the whole word; the caller masks it.
+			*/
+			ATTR_NODISCARD static ul threadShard() noexcept;
+	};
+} // namespace Project::Utility::Debug::Metrics
+
+#endif
@@ -0,0 +1,189 @@
+/*! \file perfCounters.cpp
+	\brief Contains the function definitions for the group of Linux hardware performance counters
+	\date --/--/----
+	\version x.x.x
+	\since x.x.x
+	\author Matthew Moore
+*/
+
+#include "Utility/Clock/perfCounters.h"
+
+#include <array>
+#include <cerrno>
+#include <cstddef>
+#include <string>
+#include <string_view>
+#include <system_error>
+
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+#include "Core/attributeMacros.h"
+
+namespace Project::Utility::Clock
+{
+	namespace
+	{
+		/*! @brief The generic hardware event behind each @ref PerfCounters::Event, in the same order. */
+		constexpr std::array<ul, PerfCounters::EVENTS> HARDWARE_EVENTS{PERF_COUNT_HW_CPU_CYCLES, PERF_COUNT_HW_INSTRUCTIONS,
+																	   PERF_COUNT_HW_CACHE_MISSES, PERF_COUNT_HW_BRANCH_MISSES};
+
+		/*! @brief The display name of each @ref PerfCounters::Event, in the same order. */
+		constexpr std::array<std::string_view, PerfCounters::EVENTS> EVENT_NAMES{"cycles", "instructions", "cache misses", "branch misses"};
+
+		/*! @brief The layout of a group read with PERF_FORMAT_GROUP, PERF_FORMAT_ID and both running times: the member count, the times
+		   enabled and running, then a value and id per member. */
+		using GroupRead = std::array<ul, 3 + (2 * PerfCounters::EVENTS)>;
+
+		/*! @brief Opens one hardware event for the calling thread.
+			@param[in] config The PERF_COUNT_HW_* event.
+			@param[in] leader The group leader's descriptor, or -1 to make this event the leader.
+			@return The new descriptor, or -1 with errno set.
+		*/
+		int openEvent(const ul config, const int leader) noexcept
+		{
+			perf_event_attr attributes{};
+			attributes.size = sizeof(attributes);
+			attributes.type = PERF_TYPE_HARDWARE;
+			attributes.config = config;
+			attributes.read_format = PERF_FORMAT_GROUP | PERF_FORMAT_ID | PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+
+			// Only user-space work is counted, which perf_event_paranoid up to 2 allows without privileges
+			attributes.exclude_kernel = 1;
+			attributes.exclude_hv = 1;
+
+			// The group starts together once every member is open
+			if (leader < 0)
+			{
+				attributes.disabled = 1;
+			}
+
+			return static_cast<int>(::syscall(__NR_perf_event_open, &attributes, 0, -1, leader, PERF_FLAG_FD_CLOEXEC)); // NOLINT(cppcoreguidelines-pro-type-vararg)
+		}
+	} // namespace
+
+	// MARK: Constructors & Destructor
+
+	PerfCounters::PerfCounters() noexcept
+	{
+		for (std::size_t event{0}; event < EVENTS; ++event)
+		{
+			const int file{openEvent(HARDWARE_EVENTS[event], mLeader)};
+
+			if (file < 0)
+			{
+				if (mError == 0)
+				{
+					mError = errno;
+				}
+
+				continue;
+			}
+
+			ul id{0};
+
+			if (::ioctl(file, PERF_EVENT_IOC_ID, &id) != 0) // NOLINT(cppcoreguidelines-pro-type-vararg)
+			{
+				::close(file);
+				continue;
+			}
+
+			mFiles[event] = file;
+			mIds[event] = id;
+
+			if (mLeader < 0)
+			{
+				mLeader = file;
+			}
+		}
+
+		if (mLeader >= 0)
+		{
+			static_cast<void>(::ioctl(mLeader, PERF_EVENT_IOC_RESET, PERF_IOC_FLAG_GROUP));	 // NOLINT(cppcoreguidelines-pro-type-vararg)
+			static_cast<void>(::ioctl(mLeader, PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP)); // NOLINT(cppcoreguidelines-pro-type-vararg)
+		}
+	}
+
+	PerfCounters::~PerfCounters()
+	{
+		// Members close before the leader, which the kernel requires of a group
+		for (std::size_t event{EVENTS}; event-- > 0;)
+		{
+			if (mFiles[event] >= 0 && mFiles[event] != mLeader)
+			{
+				::close(mFiles[event]);
+			}
+		}
+
+		if (mLeader >= 0)
+		{
+			::close(mLeader);
+		}
+	}
+
+	// MARK: Getters
+
+	ATTR_NODISCARD ATTR_PURE bool PerfCounters::available() const noexcept
+	{
+		return mLeader >= 0;
+	}
+
+	ATTR_NODISCARD ATTR_PURE bool PerfCounters::available(const Event event) const noexcept
+	{
+		return mFiles[static_cast<std::size_t>(event)] >= 0;
+	}
+
+	ATTR_NODISCARD std::string PerfCounters::unavailableReason() const
+	{
+		return mError == 0 ? std::string{} : std::error_code{mError, std::system_category()}.message();
+	}
+
+	// MARK: Utility
+
+	ATTR_NODISCARD PerfCounters::Reading PerfCounters::read() const noexcept
+	{
+		Reading reading{};
+		GroupRead group{};
+
+		if (mLeader < 0 || ::read(mLeader, group.data(), sizeof(group)) <= 0)
+		{
+			return reading;
+		}
+
+		const ul members{group[0]};
+		const ul enabled{group[1]};
+		const ul running{group[2]};
+
+		if (running == 0)
+		{
+			return reading;
+		}
+
+		for (std::size_t member{0}; member < members && member < EVENTS; ++member)
+		{
+			const ul value{group[3 + (2 * member)]};
+			const ul id{group[4 + (2 * member)]};
+
+			for (std::size_t event{0}; event < EVENTS; ++event)
+			{
+				if (mFiles[event] >= 0 && mIds[event] == id)
+				{
+					// A multiplexed group only counted for running out of enabled nanoseconds, so extrapolate to the whole interval
+					reading.values[event] =
+						running == enabled ? value : static_cast<ul>(static_cast<double>(value) * static_cast<double>(enabled) / static_cast<double>(running));
+				}
+			}
+		}
+
+		return reading;
+	}
+
+	// MARK: Static Member Functions
+
+	ATTR_NODISCARD ATTR_CONST std::string_view PerfCounters::name(const Event event) noexcept
+	{
+		return EVENT_NAMES[static_cast<std::size_t>(event)];
+	}
+} // namespace Project::Utility::Clock
@@ -0,0 +1,317 @@
+/*! \file asyncSink.cpp
+	\brief Contains the function definitions for the asynchronous file sink
+	\date --/--/----
+	\version x.x.x
+	\since x.x.x
+	\author Matthew Moore
+*/
+
+#include "Utility/Debug/Logging/asyncSink.h"
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <variant>
+
+#include "Core/attributeMacros.h"
+#include "Utility/Debug/Logging/crashHandler.h"
+#include "Utility/Debug/Logging/loggerOptions.h"
+
+#include <spdlog/common.h>
+#include <spdlog/details/log_msg.h>
+#include <spdlog/formatter.h>
+#include <spdlog/pattern_formatter.h>
+
+namespace Project::Utility::Debug::Logging
+{
+	namespace
+	{
+		/*! @struct ThreadFormatter
+			@brief The calling thread's private clone of an AsyncSink formatter.
+		*/
+		struct ThreadFormatter
+		{
+			ul sinkId{0};									/*!< The sink the clone was taken from; 0 when empty */
+			ul generation{0};								/*!< The sink's formatter generation at clone time */
+			std::unique_ptr<spdlog::formatter> formatter{}; /*!< The cloned formatter */
+		};
+
+		/*! @brief Hands out a process-unique id for each AsyncSink so stale per-thread clones are detected even if addresses are reused.
+			@return A non-zero id.
+		*/
+		ul nextSinkId() noexcept
+		{
+			static std::atomic<ul> sinkId{0};
+			return sinkId.fetch_add(1, std::memory_order_relaxed) + 1;
+		}
+	} // namespace
+
+	// MARK: Constructors & Destructor
+
+	AsyncSink::AsyncSink(const std::string &fileName, const ul capacity, const OverflowPolicy policy, const RotationOptions &rotation)
+		: mId{nextSinkId()}, mPolicy{policy}, mQueue{static_cast<std::size_t>(capacity)}, mFile{std::in_place_type<RotatingFile>, fileName, rotation},
+		  mFormatter{std::make_unique<spdlog::pattern_formatter>()}
+	{
+		startWriter();
+	}
+
+	AsyncSink::AsyncSink(const std::string &fileName, const ul capacity, const OverflowPolicy policy, const UringOptions &uring)
+		: mId{nextSinkId()}, mPolicy{policy}, mQueue{static_cast<std::size_t>(capacity)}, mFile{std::in_place_type<UringFile>, fileName, uring},
+		  mFormatter{std::make_unique<spdlog::pattern_formatter>()}
+	{
+		startWriter();
+	}
+
+	AsyncSink::~AsyncSink()
+	{
+		CrashHandler::removeDrain(this);
+
+		mStopping.store(true, std::memory_order_release);
+		mWakeups.fetch_add(1, std::memory_order_release);
+		mWakeups.notify_one();
+
+		if (mWriter.joinable())
+		{
+			mWriter.join();
+		}
+	}
+
+	// MARK: Getters
+
+	ATTR_NODISCARD ul AsyncSink::droppedCount() const noexcept
+	{
+		// The io_uring file only learns that a batch was lost when its write completes, so it keeps its own count
+		const auto *uring{std::get_if<UringFile>(&mFile)};
+		return mDropped.load(std::memory_order_relaxed) + (uring != nullptr ? uring->lostRecords() : 0);
+	}
+
+	ATTR_NODISCARD ATTR_PURE bool AsyncSink::crashDrainRegistered() const noexcept
+	{
+		return mCrashDrain;
+	}
+
+	// MARK: spdlog::sinks::sink
+
+	void AsyncSink::log(const spdlog::details::log_msg &msg)
+	{
+		enqueue(msg);
+		wakeWriter();
+	}
+
+	void AsyncSink::flush()
+	{
+		const ul target{mQueue.enqueuePosition()};
+		ul flushed{mFlushedPosition.load(std::memory_order_acquire)};
+
+		while (flushed < target)
+		{
+			wakeWriter();
+			mFlushedPosition.wait(flushed, std::memory_order_acquire);
+			flushed = mFlushedPosition.load(std::memory_order_acquire);
+		}
+	}
+
+	void AsyncSink::set_pattern(const std::string &pattern)
+	{
+		set_formatter(std::make_unique<spdlog::pattern_formatter>(pattern));
+	}
+
+	void AsyncSink::set_formatter(std::unique_ptr<spdlog::formatter> sinkFormatter)
+	{
+		const std::scoped_lock lock(mFormatterMutex);
+
+		mFormatter = std::move(sinkFormatter);
+		mFormatterGeneration.fetch_add(1, std::memory_order_release);
+	}
+
+	// MARK: Private Member Functions
+
+	void AsyncSink::startWriter()
+	{
+		// Registered only once nothing can throw, so a failed constructor never leaves the crash handler pointing at a destroyed sink
+		mWriter = std::thread{&AsyncSink::writerLoop, this};
+		mCrashDrain = CrashHandler::addDrain(&AsyncSink::drainPending, this);
+	}
+
+	spdlog::formatter &AsyncSink::threadFormatter()
+	{
+		thread_local ThreadFormatter cache{};
+
+		if (!cache.formatter || cache.sinkId != mId || cache.generation != mFormatterGeneration.load(std::memory_order_acquire)) ATTR_UNLIKELY
+		{
+			const std::scoped_lock lock(mFormatterMutex);
+
+			cache.formatter = mFormatter->clone();
+			cache.sinkId = mId;
+			cache.generation = mFormatterGeneration.load(std::memory_order_relaxed);
+		}
+
+		return *cache.formatter;
+	}
+
+	void AsyncSink::enqueue(const spdlog::details::log_msg &msg)
+	{
+		spdlog::formatter &formatter{threadFormatter()};
+
+		const auto fill = [&formatter, &msg](spdlog::memory_buf_t &record) {
+			record.clear();
+			formatter.format(msg, record);
+		};
+
+		switch (mPolicy)
+		{
+			case OverflowPolicy::DropNewest:
+				if (!mQueue.tryPush(fill))
+				{
+					mDropped.fetch_add(1, std::memory_order_relaxed);
+				}
+				break;
+			case OverflowPolicy::DropOldest:
+				while (!mQueue.tryPush(fill))
+				{
+					if (mQueue.tryPop([](const spdlog::memory_buf_t & /*record*/) noexcept {}))
+					{
+						mDropped.fetch_add(1, std::memory_order_relaxed);
+					}
+					else
+					{
+						// The oldest slot is still being formatted or written; back off as Block does instead of spinning on it
+						wakeWriter();
+						std::this_thread::yield();
+					}
+				}
+				break;
+			case OverflowPolicy::Block:
+			default:
+				while (!mQueue.tryPush(fill))
+				{
+					wakeWriter();
+					std::this_thread::yield();
+				}
+				break;
+		}
+	}
+
+	void AsyncSink::wakeWriter() noexcept
+	{
+		// Pairs with the fence in writerLoop: either the writer sees the new record, or this thread sees that the writer is asleep.
+		std::atomic_thread_fence(std::memory_order_seq_cst);
+
+		if (mWriterSleeping.load(std::memory_order_relaxed))
+		{
+			mWakeups.fetch_add(1, std::memory_order_release);
+			mWakeups.notify_one();
+		}
+	}
+
+	void AsyncSink::writerLoop()
+	{
+		while (true)
+		{
+			const ul drained{drain()};
+
+			if (mQueue.dequeuePosition() != mFlushedPosition.load(std::memory_order_relaxed))
+			{
+				publishFlushed();
+			}
+
+			const bool pending{mQueue.dequeuePosition() != mQueue.enqueuePosition()};
+
+			if (mStopping.load(std::memory_order_acquire))
+			{
+				if (!pending)
+				{
+					break;
+				}
+
+				continue;
+			}
+
+			if (pending)
+			{
+				if (drained == 0)
+				{
+					// A producer has claimed a slot but not finished formatting into it yet
+					std::this_thread::yield();
+				}
+
+				continue;
+			}
+
+			const ul wakeups{mWakeups.load(std::memory_order_acquire)};
+			mWriterSleeping.store(true, std::memory_order_relaxed);
+			std::atomic_thread_fence(std::memory_order_seq_cst);
+
+			if (mQueue.enqueuePosition() == mQueue.dequeuePosition() && !mStopping.load(std::memory_order_relaxed))
+			{
+				mWakeups.wait(wakeups, std::memory_order_acquire);
+			}
+
+			mWriterSleeping.store(false, std::memory_order_relaxed);
+		}
+	}
+
+	ul AsyncSink::drain()
+	{
+		const auto write = [this](const spdlog::memory_buf_t &record) {
+			try
+			{
+				std::visit([&record](auto &file) { file.write(record); }, mFile);
+			}
+			catch (const spdlog::spdlog_ex &ex)
+			{
+				mDropped.fetch_add(1, std::memory_order_relaxed);
+			}
+		};
+
+		// Bounded so that a steady stream of records cannot postpone flushing indefinitely
+		const std::size_t batch{mQueue.capacity()};
+		std::size_t count{0};
+
+		while (count < batch)
+		{
+			// Between the pop and the write a record is in neither buffer the crash handler drains
+			const CrashHandler::WriteScope scope{};
+
+			if (!mQueue.tryPop(write))
+			{
+				break;
+			}
+
+			++count;
+		}
+
+		return count;
+	}
+
+	void AsyncSink::publishFlushed()
+	{
+		const ul position{mQueue.dequeuePosition()};
+
+		try
+		{
+			const CrashHandler::WriteScope scope{};
+			std::visit([](auto &file) { file.flush(); }, mFile);
+		}
+		catch (const spdlog::spdlog_ex &ex)
+		{
+			// The records are already handed to stdio; a failed flush is retried on the next publish
+		}
+
+		mFlushedPosition.store(position, std::memory_order_release);
+		mFlushedPosition.notify_all();
+	}
+
+	// MARK: Private Static Member Functions
+
+	void AsyncSink::drainPending(const void *context, const int file) noexcept
+	{
+		// Records the writer thread has already popped sit in the file's stdio buffer, which the file's own drain writes out
+		static_cast<const AsyncSink *>(context)->mQueue.forEachPublished(
+			[file](const spdlog::memory_buf_t &record) { CrashHandler::writeRaw(file, std::string_view{record.data(), record.size()}); });
+	}
+} // namespace Project::Utility::Debug::Logging
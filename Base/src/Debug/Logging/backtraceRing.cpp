@@ -0,0 +1,134 @@
+/*! \file backtraceRing.cpp
+	\brief Contains the function definitions for the per-thread ring of recent low-level log records
+	\date --/--/----
+	\version x.x.x
+	\since x.x.x
+	\author Matthew Moore
+*/
+
+#include "Utility/Debug/Logging/backtraceRing.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstring>
+#include <memory>
+#include <string_view>
+
+#include "Core/attributeMacros.h"
+#include "Core/typedefs.h"
+
+#include <spdlog/common.h>
+
+namespace Project::Utility::Debug::Logging
+{
+	// MARK: Constructors & Destructor
+
+	BacktraceRing::BacktraceRing(const ul records, const ul bytes) : mRecordLimit{std::max(records, ul{1})},
+																	 mByteLimit{std::max(bytes, ul{sizeof(Header)})},
+																	 mStorage{std::make_unique<std::byte[]>(mByteLimit)}
+	{
+	}
+
+	// MARK: Getters
+
+	ATTR_NODISCARD ATTR_PURE ul BacktraceRing::recordLimit() const noexcept
+	{
+		return mRecordLimit;
+	}
+
+	ATTR_NODISCARD ATTR_PURE ul BacktraceRing::byteLimit() const noexcept
+	{
+		return mByteLimit;
+	}
+
+	ATTR_NODISCARD ATTR_PURE ul BacktraceRing::size() const noexcept
+	{
+		return mCount;
+	}
+
+	// MARK: Private Member Functions
+
+	bool BacktraceRing::reserve(const Record &record, const std::size_t payloadSize)
+	{
+		const std::size_t total{sizeof(Header) + payloadSize};
+
+		if (total > mByteLimit)
+		{
+			return false;
+		}
+
+		while (true)
+		{
+			// With nothing kept, start from the beginning so that any record up to the byte limit fits
+			if (mCount == 0)
+			{
+				mHead = 0;
+				mTail = 0;
+			}
+
+			const std::size_t offset{mHead % mByteLimit};
+			const std::size_t start{offset + total > mByteLimit ? mHead + (mByteLimit - offset) : mHead};
+
+			if (mCount < mRecordLimit && start + total - mTail <= mByteLimit)
+			{
+				// A gap too small for a header is recognised by its size alone; a larger one is marked so take() can skip it
+				if (start != mHead && mByteLimit - offset >= sizeof(Header))
+				{
+					const Header padding{.payloadSize = static_cast<Project::Core::ui>(mByteLimit - offset - sizeof(Header))};
+					std::memcpy(mStorage.get() + offset, &padding, sizeof(Header));
+				}
+
+				mHead = start;
+				break;
+			}
+
+			static_cast<void>(take());
+		}
+
+		const Header header{.nanoseconds = std::chrono::duration_cast<std::chrono::nanoseconds>(record.time.time_since_epoch()).count(),
+							.format = record.format.data(),
+							.formatSize = static_cast<Project::Core::ui>(record.format.size()),
+							.payloadSize = static_cast<Project::Core::ui>(payloadSize),
+							.level = static_cast<Project::Core::ub>(record.level),
+							.complete = record.complete};
+		std::memcpy(mStorage.get() + (mHead % mByteLimit), &header, sizeof(Header));
+		++mCount;
+
+		return true;
+	}
+
+	BacktraceRing::Record BacktraceRing::take()
+	{
+		while (true)
+		{
+			const std::size_t offset{mTail % mByteLimit};
+
+			if (mByteLimit - offset < sizeof(Header))
+			{
+				mTail += mByteLimit - offset;
+				continue;
+			}
+
+			Header header{};
+			std::memcpy(&header, mStorage.get() + offset, sizeof(Header));
+			mTail += sizeof(Header) + header.payloadSize;
+
+			if (header.format == nullptr)
+			{
+				continue;
+			}
+
+			--mCount;
+
+			const auto *payload{reinterpret_cast<const char *>(mStorage.get() + offset + sizeof(Header))}; // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+
+			return Record{.level = static_cast<spdlog::level::level_enum>(header.level),
+						  .time = spdlog::log_clock::time_point{
+							  std::chrono::duration_cast<spdlog::log_clock::duration>(std::chrono::nanoseconds{header.nanoseconds})},
+						  .format = std::string_view{header.format, header.formatSize},
+						  .complete = header.complete,
+						  .payload = std::string_view{payload, header.payloadSize}};
+		}
+	}
+} // namespace Project::Utility::Debug::Logging
@@ -0,0 +1,352 @@
+/*! \file binaryDecoder.cpp
+	\brief Contains the function definitions for decoding binary log files
+	\date --/--/----
+	\version x.x.x
+	\since x.x.x
+	\author Matthew Moore
+*/
+
+#include "Utility/Debug/Logging/binaryDecoder.h"
+
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstring>
+#include <istream>
+#include <iterator>
+#include <memory>
+#include <optional>
+#include <ostream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "Core/attributeMacros.h"
+#include "Core/typedefs.h"
+#include "Utility/Debug/Logging/binaryFormat.h"
+#include "Utility/Debug/Logging/constants.h"
+
+#include <spdlog/common.h>
+#include <spdlog/details/log_msg.h>
+#include <spdlog/pattern_formatter.h>
+
+// spdlog only wraps the core fmt headers; pick the dynamic argument store from whichever fmt it was configured with
+#ifdef SPDLOG_FMT_EXTERNAL
+	#include <fmt/args.h>
+#else
+	#include <spdlog/fmt/bundled/args.h>
+#endif
+
+namespace Project::Utility::Debug::Logging::Binary
+{
+	namespace
+	{
+		/*! @brief Reads a fixed-size value written in native byte order.
+			@tparam T A trivially copyable type.
+			@param[in,out] input The stream to read from.
+			@param[out] value Receives the value.
+			@return true if enough bytes were available.
+		*/
+		template <typename T>
+		ATTR_NODISCARD bool read(std::istream &input, T &value)
+		{
+			return static_cast<bool>(input.read(reinterpret_cast<char *>(&value), sizeof(T))); // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+		}
+
+		/*! @brief Reads a length-prefixed string.
+			@param[in,out] input The stream to read from.
+			@param[out] text Receives the string.
+			@return true if enough bytes were available.
+		*/
+		ATTR_NODISCARD bool readString(std::istream &input, std::string &text)
+		{
+			ui size{0};
+
+			if (!read(input, size))
+			{
+				return false;
+			}
+
+			text.resize(size);
+
+			return static_cast<bool>(input.read(text.data(), static_cast<std::streamsize>(size)));
+		}
+
+		/*! @brief Reads a fixed-size value out of a record payload.
+			@tparam T A trivially copyable type.
+			@param[in,out] payload The unread part of the payload; advanced past the value.
+			@param[out] value Receives the value.
+			@return true if enough bytes were available.
+		*/
+		template <typename T>
+		ATTR_NODISCARD bool take(std::string_view &payload, T &value)
+		{
+			if (payload.size() < sizeof(T))
+			{
+				return false;
+			}
+
+			std::memcpy(&value, payload.data(), sizeof(T));
+			payload.remove_prefix(sizeof(T));
+
+			return true;
+		}
+
+		/*! @brief Decodes a record payload into fmt arguments.
+			@param[in] payload The encoded arguments. String arguments are referenced, not copied, so @p payload must outlive @p arguments.
+			@param[out] arguments Receives one argument per encoded value.
+			@return true if the payload was well formed.
+		*/
+		ATTR_NODISCARD bool decodeArguments(std::string_view payload, fmt::dynamic_format_arg_store<fmt::format_context> &arguments)
+		{
+			while (!payload.empty())
+			{
+				ArgumentTag tag{};
+
+				if (!take(payload, tag))
+				{
+					return false;
+				}
+
+				switch (tag)
+				{
+					case ArgumentTag::Bool:
+					{
+						ub value{0};
+						if (!take(payload, value))
+						{
+							return false;
+						}
+						arguments.push_back(value != 0);
+						break;
+					}
+					case ArgumentTag::Char:
+					{
+						char value{0};
+						if (!take(payload, value))
+						{
+							return false;
+						}
+						arguments.push_back(value);
+						break;
+					}
+					case ArgumentTag::Signed:
+					{
+						sl value{0};
+						if (!take(payload, value))
+						{
+							return false;
+						}
+						arguments.push_back(value);
+						break;
+					}
+					case ArgumentTag::Unsigned:
+					{
+						ul value{0};
+						if (!take(payload, value))
+						{
+							return false;
+						}
+						arguments.push_back(value);
+						break;
+					}
+					case ArgumentTag::Float:
+					{
+						float value{0};
+						if (!take(payload, value))
+						{
+							return false;
+						}
+						arguments.push_back(value);
+						break;
+					}
+					case ArgumentTag::Double:
+					{
+						double value{0};
+						if (!take(payload, value))
+						{
+							return false;
+						}
+						arguments.push_back(value);
+						break;
+					}
+					case ArgumentTag::String:
+					{
+						ui size{0};
+						if (!take(payload, size) || payload.size() < size)
+						{
+							return false;
+						}
+						arguments.push_back(fmt::string_view{payload.data(), size});
+						payload.remove_prefix(size);
+						break;
+					}
+					case ArgumentTag::Pointer:
+					{
+						ul value{0};
+						if (!take(payload, value))
+						{
+							return false;
+						}
+						arguments.push_back(reinterpret_cast<const void *>(value)); // NOLINT(performance-no-int-to-ptr)
+						break;
+					}
+					default:
+						return false;
+				}
+			}
+
+			return true;
+		}
+	} // namespace
+
+	ATTR_NODISCARD std::optional<std::string_view> decode(std::istream &input, std::ostream &output, const std::string &pattern)
+	{
+		std::unique_ptr<spdlog::formatter> formatter{pattern.empty() ? std::make_unique<spdlog::pattern_formatter>()
+																	 : std::make_unique<spdlog::pattern_formatter>(pattern)};
+
+		bool sawHeader{false};
+		std::string loggerName{};
+		std::vector<std::string> formats{};
+		std::string payload{};
+		spdlog::memory_buf_t message{};
+		spdlog::memory_buf_t line{};
+
+		while (true)
+		{
+			const std::istream::int_type next{input.peek()};
+
+			if (next == std::istream::traits_type::eof())
+			{
+				return sawHeader ? std::nullopt : std::optional<std::string_view>{BINARY_DECODE_HEADER_FAILURE};
+			}
+
+			if (std::istream::traits_type::to_char_type(next) == MAGIC.front())
+			{
+				std::array<char, MAGIC.size()> magic{};
+				ui version{0};
+
+				if (!read(input, magic) || magic != MAGIC || !read(input, version) || version != VERSION || !readString(input, loggerName))
+				{
+					return BINARY_DECODE_HEADER_FAILURE;
+				}
+
+				// Ids are assigned per process, so a session appended by another process starts from a clean table
+				sawHeader = true;
+				formats.clear();
+				continue;
+			}
+
+			if (!sawHeader)
+			{
+				return BINARY_DECODE_HEADER_FAILURE;
+			}
+
+			EntryKind kind{};
+			static_cast<void>(read(input, kind));
+
+			if (kind == EntryKind::Definition)
+			{
+				ui id{0};
+				std::string format{};
+
+				if (!read(input, id) || !readString(input, format))
+				{
+					return BINARY_DECODE_TRUNCATED_FAILURE;
+				}
+
+				// Ids are defined densely and in order, so anything else means the file is damaged
+				if (id > formats.size())
+				{
+					return BINARY_DECODE_CORRUPT_FAILURE;
+				}
+
+				if (id == formats.size())
+				{
+					formats.push_back(std::move(format));
+				}
+				else
+				{
+					formats[id] = std::move(format);
+				}
+				continue;
+			}
+
+			if (kind != EntryKind::Record)
+			{
+				return BINARY_DECODE_CORRUPT_FAILURE;
+			}
+
+			ub level{0};
+			ui id{0};
+			sl nanoseconds{0};
+			ul threadId{0};
+			ui payloadSize{0};
+
+			if (!read(input, level) || !read(input, id) || !read(input, nanoseconds) || !read(input, threadId) || !read(input, payloadSize))
+			{
+				return BINARY_DECODE_TRUNCATED_FAILURE;
+			}
+
+			payload.resize(payloadSize);
+
+			if (!input.read(payload.data(), static_cast<std::streamsize>(payloadSize)))
+			{
+				return BINARY_DECODE_TRUNCATED_FAILURE;
+			}
+
+			const std::string_view format{id == PREFORMATTED_FORMAT_ID ? PREFORMATTED_FORMAT
+									  : id < formats.size()			 ? std::string_view{formats[id]}
+																	 : std::string_view{}};
+			fmt::dynamic_format_arg_store<fmt::format_context> arguments{};
+
+			if (format.empty() || level >= spdlog::level::n_levels || !decodeArguments(payload, arguments))
+			{
+				return BINARY_DECODE_CORRUPT_FAILURE;
+			}
+
+			message.clear();
+
+			try
+			{
+				fmt::vformat_to(std::back_inserter(message), fmt::string_view{format.data(), format.size()}, arguments);
+			}
+			catch (const fmt::format_error &error)
+			{
+				return BINARY_DECODE_FORMAT_FAILURE;
+			}
+
+			const spdlog::log_clock::time_point time{
+				std::chrono::duration_cast<spdlog::log_clock::duration>(std::chrono::nanoseconds{nanoseconds})};
+			spdlog::details::log_msg record{time, spdlog::source_loc{}, loggerName, static_cast<spdlog::level::level_enum>(level),
+											spdlog::string_view_t{message.data(), message.size()}};
+			record.thread_id = threadId;
+
+			line.clear();
+			formatter->format(record, line);
+			output.write(line.data(), static_cast<std::streamsize>(line.size()));
+		}
+	}
+
+	ATTR_NODISCARD bool formatPayload(const std::string_view format, const std::string_view payload, spdlog::memory_buf_t &output)
+	{
+		fmt::dynamic_format_arg_store<fmt::format_context> arguments{};
+		output.clear();
+
+		if (!decodeArguments(payload, arguments))
+		{
+			return false;
+		}
+
+		try
+		{
+			fmt::vformat_to(std::back_inserter(output), fmt::string_view{format.data(), format.size()}, arguments);
+		}
+		catch (const fmt::format_error &error)
+		{
+			return false;
+		}
+
+		return true;
+	}
+} // namespace Project::Utility::Debug::Logging::Binary
@@ -0,0 +1,186 @@
+/*! \file binarySink.cpp
+	\brief Contains the function definitions for the binary deferred-formatting sink
+	\date --/--/----
+	\version x.x.x
+	\since x.x.x
+	\author Matthew Moore
+*/
+
+#include "Utility/Debug/Logging/binarySink.h"
+
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <span>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+#include "Core/attributeMacros.h"
+#include "Utility/Debug/Logging/binaryFormat.h"
+#include "Utility/Debug/Logging/loggerOptions.h"
+#include "Utility/Debug/Logging/threadBufferWriter.h"
+
+#include <spdlog/common.h>
+#include <spdlog/details/log_msg.h>
+#include <spdlog/formatter.h>
+
+namespace Project::Utility::Debug::Logging
+{
+	namespace
+	{
+		/*! @struct FormatRegistry
+			@brief The process-wide mapping between format strings and ids; ids are never reused so per-thread caches never go stale.
+		*/
+		struct FormatRegistry
+		{
+			std::mutex mutex{};										  /*!< Guards the other members */
+			std::vector<std::string_view> formats{Binary::PREFORMATTED_FORMAT}; /*!< Indexed by id */
+			std::unordered_map<std::string_view, ui> ids{{Binary::PREFORMATTED_FORMAT, Binary::PREFORMATTED_FORMAT_ID}}; /*!< Keyed by text */
+		};
+
+		/*! @brief Provides access to the function-local static format registry.
+			@details Deliberately never destroyed: sinks owned by other statics (such as Logger's) drain during static destruction, which
+		   may run after a normal function-local static registry has already been torn down.
+			@return The registry; valid for the lifetime of the program.
+		*/
+		FormatRegistry &formatRegistry()
+		{
+			static FormatRegistry *const registry{new FormatRegistry{}}; // NOLINT(cppcoreguidelines-owning-memory)
+			return *registry;
+		}
+
+		/*! @brief Appends a fixed-size value to @p buffer in native byte order.
+			@tparam T A trivially copyable type.
+			@param[in,out] buffer The buffer to append to.
+			@param[in] value The value to append.
+		*/
+		template <typename T>
+		void append(spdlog::memory_buf_t &buffer, const T &value)
+		{
+			const auto *bytes{reinterpret_cast<const char *>(&value)}; // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+			buffer.append(bytes, bytes + sizeof(T));
+		}
+
+		/*! @brief Appends a length-prefixed string to @p buffer.
+			@param[in,out] buffer The buffer to append to.
+			@param[in] text The string to append.
+		*/
+		void appendString(spdlog::memory_buf_t &buffer, const std::string_view text)
+		{
+			append(buffer, static_cast<ui>(text.size()));
+			buffer.append(text.data(), text.data() + text.size());
+		}
+	} // namespace
+
+	// MARK: Constructors & Destructor
+
+	BinarySink::BinarySink(const std::string &fileName, const std::string_view loggerName, const ul threadBufferBytes,
+						   const OverflowPolicy policy, const ClockSource clock)
+		: mClock{clock},
+		  mWriter{fileName,
+				  header(loggerName),
+				  threadBufferBytes,
+				  policy,
+				  [this](spdlog::memory_buf_t &batch) { defineFormats(batch); },
+				  &BinarySink::appendRecord}
+	{
+	}
+
+	BinarySink::~BinarySink() = default;
+
+	// MARK: Getters
+
+	ATTR_NODISCARD ul BinarySink::droppedCount() const noexcept
+	{
+		return mWriter.droppedCount();
+	}
+
+	// MARK: Utility
+
+	void BinarySink::logFormatted(const spdlog::level::level_enum level, const std::string_view text)
+	{
+		logDeferred(level, Binary::PREFORMATTED_FORMAT, text);
+	}
+
+	// MARK: spdlog::sinks::sink
+
+	void BinarySink::log(const spdlog::details::log_msg &msg)
+	{
+		const std::string_view text{msg.payload.data(), msg.payload.size()};
+
+		push(msg.level, Binary::PREFORMATTED_FORMAT_ID, msg.time, msg.thread_id, Binary::encodedSize(text),
+			 [text](ThreadBufferWriter::Ring::Writer &writer) { Binary::encodeArgument(writer, text); });
+	}
+
+	void BinarySink::flush()
+	{
+		mWriter.flush();
+	}
+
+	void BinarySink::set_pattern(const std::string & /*pattern*/)
+	{
+	}
+
+	void BinarySink::set_formatter(std::unique_ptr<spdlog::formatter> /*sinkFormatter*/)
+	{
+	}
+
+	// MARK: Private Member Functions
+
+	ui BinarySink::registerFormat(const std::string_view format)
+	{
+		FormatRegistry &registry{formatRegistry()};
+		const std::scoped_lock lock(registry.mutex);
+
+		const auto [entry, inserted]{registry.ids.try_emplace(format, static_cast<ui>(registry.formats.size()))};
+
+		if (inserted)
+		{
+			registry.formats.push_back(format);
+		}
+
+		return entry->second;
+	}
+
+	void BinarySink::registeredFormats(const ui first, std::vector<std::string_view> &formats)
+	{
+		FormatRegistry &registry{formatRegistry()};
+		const std::scoped_lock lock(registry.mutex);
+
+		formats.assign(registry.formats.begin() + first, registry.formats.end());
+	}
+
+	std::string BinarySink::header(const std::string_view loggerName)
+	{
+		spdlog::memory_buf_t bytes{};
+		bytes.append(Binary::MAGIC.data(), Binary::MAGIC.data() + Binary::MAGIC.size());
+		append(bytes, Binary::VERSION);
+		appendString(bytes, loggerName);
+
+		return std::string{bytes.data(), bytes.size()};
+	}
+
+	void BinarySink::defineFormats(spdlog::memory_buf_t &batch)
+	{
+		// Every id in the batch was registered before its record was published, so the registry already holds it
+		registeredFormats(mDefinedFormats, mNewFormats);
+
+		for (const std::string_view format : mNewFormats)
+		{
+			append(batch, Binary::EntryKind::Definition);
+			append(batch, mDefinedFormats++);
+			appendString(batch, format);
+		}
+	}
+
+	void BinarySink::appendRecord(spdlog::memory_buf_t &batch, const sl timestamp, const std::span<const std::byte> body)
+	{
+		const auto *data{reinterpret_cast<const char *>(body.data())}; // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+
+		batch.append(data, data + TIMESTAMP_OFFSET);
+		append(batch, timestamp);
+		batch.append(data + TIMESTAMP_OFFSET, data + body.size());
+	}
+} // namespace Project::Utility::Debug::Logging
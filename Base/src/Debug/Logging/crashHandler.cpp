@@ -0,0 +1,397 @@
+/*! \file crashHandler.cpp
+	\brief Contains the function definitions for the fatal-signal handler that drains pending log records
+	\date --/--/----
+	\version x.x.x
+	\since x.x.x
+	\author Matthew Moore
+*/
+
+#include "Utility/Debug/Logging/crashHandler.h"
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cerrno>
+#include <climits>
+#include <csignal>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <ctime>
+#include <mutex>
+#include <string>
+#include <string_view>
+
+#include <execinfo.h>
+#include <fcntl.h>
+#include <sched.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "Core/attributeMacros.h"
+#include "Core/typedefs.h"
+#include "Utility/Debug/Logging/constants.h"
+
+#include <spdlog/common.h>
+
+namespace Project::Utility::Debug::Logging
+{
+	using Project::Core::ul;
+
+	namespace
+	{
+		/*! @brief The permissions the report file is created with if a rotation has just removed it. */
+		constexpr mode_t REPORT_MODE{S_IRUSR | S_IWUSR | S_IRGRP | S_IROTH}; // NOLINT(hicpp-signed-bitwise)
+
+		/*! @brief The signals the handler reports; each one ends the process by default. */
+		constexpr std::array<int, 5> FATAL_SIGNALS{SIGSEGV, SIGBUS, SIGFPE, SIGILL, SIGABRT};
+
+		/*! @struct DrainSlot
+			@brief One registered drain; free while context is nullptr.
+		*/
+		struct DrainSlot
+		{
+			std::atomic<CrashHandler::Drain> drain{nullptr}; /*!< The function to call; published after context is claimed */
+			std::atomic<const void *> context{nullptr};		 /*!< The sink's context; claimed with a compare-and-swap */
+		};
+
+		// The handler's state lives at namespace scope so it is constant-initialized: the handler must never run a static initializer
+
+		std::array<DrainSlot, LOGGING_CRASH_DRAINS> drains{};					  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
+		std::array<struct sigaction, FATAL_SIGNALS.size()> previousActions{};	  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
+		std::array<char, PATH_MAX> reportPath{};								  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
+		std::atomic<bool> active{false};										  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
+		std::atomic<bool> handling{false};										  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
+		std::atomic<ul> openScopes{0};											  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
+		std::mutex installMutex{};												  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
+		alignas(16) std::array<std::byte, LOGGING_CRASH_STACK_BYTES> alternateStack{}; // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
+
+		/*! @brief Names a fatal signal.
+			@param[in] signal The signal number.
+			@return The signal's macro name, or "signal" for anything else.
+		*/
+		std::string_view signalName(const int signal) noexcept
+		{
+			switch (signal)
+			{
+				case SIGSEGV:
+					return "SIGSEGV";
+				case SIGBUS:
+					return "SIGBUS";
+				case SIGFPE:
+					return "SIGFPE";
+				case SIGILL:
+					return "SIGILL";
+				case SIGABRT:
+					return "SIGABRT";
+				default:
+					return "signal";
+			}
+		}
+
+		/*! @brief Formats @p value without allocating.
+			@param[out] buffer Receives the digits, right-aligned.
+			@param[in] value The value to format.
+			@param[in] base 10 or 16.
+			@param[in] width The minimum number of digits; shorter values are zero-padded.
+			@return A view of the digits inside @p buffer.
+		*/
+		std::string_view formatNumber(std::array<char, 24> &buffer, std::uintptr_t value, const unsigned base, const std::size_t width) noexcept
+		{
+			constexpr std::string_view DIGITS{"0123456789abcdef"};
+			std::size_t position{buffer.size()};
+
+			do
+			{
+				buffer.at(--position) = DIGITS.at(value % base);
+				value /= base;
+			} while ((value != 0 || buffer.size() - position < width) && position != 0);
+
+			return std::string_view{buffer.data() + position, buffer.size() - position};
+		}
+
+		/*! @brief Finds the index of @p signal in FATAL_SIGNALS.
+			@param[in] signal The signal number.
+			@return The index, or FATAL_SIGNALS.size() if the signal is not handled.
+		*/
+		std::size_t signalIndex(const int signal) noexcept
+		{
+			std::size_t index{0};
+
+			while (index < FATAL_SIGNALS.size() && FATAL_SIGNALS.at(index) != signal)
+			{
+				++index;
+			}
+
+			return index;
+		}
+
+		/*! @brief Reads the monotonic clock; async-signal-safe, unlike std::chrono::steady_clock::now() in principle.
+			@return The time in nanoseconds.
+		*/
+		std::int64_t monotonicNanoseconds() noexcept
+		{
+			constexpr std::int64_t NANOSECONDS_PER_SECOND{1'000'000'000};
+			timespec now{};
+			::clock_gettime(CLOCK_MONOTONIC, &now);
+			return (now.tv_sec * NANOSECONDS_PER_SECOND) + now.tv_nsec;
+		}
+
+		/*! @brief Waits until no @ref CrashHandler::WriteScope is open, or until @ref LOGGING_CRASH_QUIESCE_TIMEOUT has passed. */
+		void quiesce() noexcept
+		{
+			const std::int64_t deadline{monotonicNanoseconds() + std::chrono::nanoseconds{LOGGING_CRASH_QUIESCE_TIMEOUT}.count()};
+
+			while (openScopes.load(std::memory_order_seq_cst) != 0 && monotonicNanoseconds() < deadline)
+			{
+				::sched_yield();
+			}
+		}
+
+		/*! @brief Appends the crash report: the signal, the faulting address and the stack.
+			@param[in] file The report file.
+			@param[in] signal The signal number.
+			@param[in] info What raised the signal.
+		*/
+		void writeReport(const int file, const int signal, const siginfo_t *info) noexcept
+		{
+			constexpr std::size_t ADDRESS_DIGITS{sizeof(std::uintptr_t) * 2};
+			std::array<char, 24> number{};
+
+			CrashHandler::writeRaw(file, "[crash] fatal signal ");
+			CrashHandler::writeRaw(file, signalName(signal));
+			CrashHandler::writeRaw(file, " (");
+			CrashHandler::writeRaw(file, formatNumber(number, static_cast<std::uintptr_t>(signal), 10, 1));
+			CrashHandler::writeRaw(file, ") at address 0x");
+			CrashHandler::writeRaw(file, formatNumber(number, reinterpret_cast<std::uintptr_t>(info != nullptr ? info->si_addr : nullptr), 16, // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast,cppcoreguidelines-pro-type-union-access)
+													  ADDRESS_DIGITS));
+			CrashHandler::writeRaw(file, "\n[crash] stack trace:\n");
+
+			std::array<void *, LOGGING_CRASH_FRAMES> frames{};
+			const int depth{::backtrace(frames.data(), static_cast<int>(frames.size()))};
+			::backtrace_symbols_fd(frames.data(), depth, file);
+		}
+	} // namespace
+
+	// MARK: WriteScope
+
+	CrashHandler::WriteScope::WriteScope() noexcept
+	{
+		openScopes.fetch_add(1, std::memory_order_seq_cst);
+
+		// Pairs with the handler setting handling before it reads openScopes: either it waits for this scope, or this thread stops here
+		if (handling.load(std::memory_order_seq_cst)) ATTR_UNLIKELY
+		{
+			openScopes.fetch_sub(1, std::memory_order_seq_cst);
+
+			while (true)
+			{
+				::pause();
+			}
+		}
+	}
+
+	CrashHandler::WriteScope::~WriteScope()
+	{
+		openScopes.fetch_sub(1, std::memory_order_seq_cst);
+	}
+
+	// MARK: Static Member Functions
+
+	ATTR_NODISCARD bool CrashHandler::install(const std::string &fileName)
+	{
+		const std::scoped_lock lock(installMutex);
+
+		if (fileName.empty() || fileName.size() >= reportPath.size())
+		{
+			return false;
+		}
+
+		const int opened{::open(fileName.c_str(), O_WRONLY | O_APPEND | O_CREAT | O_CLOEXEC, REPORT_MODE)}; // NOLINT(hicpp-signed-bitwise,cppcoreguidelines-pro-type-vararg)
+
+		if (opened < 0)
+		{
+			return false;
+		}
+
+		::close(opened);
+
+		// The handler opens the path itself, so a report after a rotation lands in the live file rather than the archived one
+		std::ranges::fill(reportPath, '\0');
+		std::ranges::copy(fileName, reportPath.begin());
+
+		if (active.load(std::memory_order_acquire))
+		{
+			return true;
+		}
+
+		// The first backtrace() loads the unwinder, which allocates; do it here rather than in the handler
+		std::array<void *, 1> frame{};
+		static_cast<void>(::backtrace(frame.data(), static_cast<int>(frame.size())));
+
+		stack_t stack{};
+		stack.ss_sp = alternateStack.data();
+		stack.ss_size = alternateStack.size();
+		static_cast<void>(::sigaltstack(&stack, nullptr));
+
+		struct sigaction action{};
+		action.sa_sigaction = &CrashHandler::handle; // NOLINT(cppcoreguidelines-pro-type-union-access)
+		action.sa_flags = SA_SIGINFO | SA_ONSTACK;	  // NOLINT(hicpp-signed-bitwise)
+		sigemptyset(&action.sa_mask);
+
+		for (std::size_t index{0}; index < FATAL_SIGNALS.size(); ++index)
+		{
+			static_cast<void>(::sigaction(FATAL_SIGNALS.at(index), &action, &previousActions.at(index)));
+		}
+
+		active.store(true, std::memory_order_release);
+		return true;
+	}
+
+	void CrashHandler::uninstall() noexcept
+	{
+		const std::scoped_lock lock(installMutex);
+
+		if (!active.load(std::memory_order_acquire))
+		{
+			return;
+		}
+
+		for (std::size_t index{0}; index < FATAL_SIGNALS.size(); ++index)
+		{
+			static_cast<void>(::sigaction(FATAL_SIGNALS.at(index), &previousActions.at(index), nullptr));
+		}
+
+		active.store(false, std::memory_order_release);
+	}
+
+	ATTR_NODISCARD bool CrashHandler::installed() noexcept
+	{
+		return active.load(std::memory_order_acquire);
+	}
+
+	bool CrashHandler::addDrain(Drain drain, const void *context) noexcept
+	{
+		for (DrainSlot &slot : drains)
+		{
+			const void *expected{nullptr};
+
+			if (slot.context.compare_exchange_strong(expected, context, std::memory_order_acq_rel))
+			{
+				slot.drain.store(drain, std::memory_order_release);
+				return true;
+			}
+		}
+
+		return false;
+	}
+
+	void CrashHandler::removeDrain(const void *context) noexcept
+	{
+		for (DrainSlot &slot : drains)
+		{
+			if (slot.context.load(std::memory_order_acquire) == context)
+			{
+				slot.drain.store(nullptr, std::memory_order_release);
+				slot.context.store(nullptr, std::memory_order_release);
+				return;
+			}
+		}
+	}
+
+	ATTR_NODISCARD ATTR_CONST spdlog::file_event_handlers CrashHandler::streamEvents()
+	{
+		spdlog::file_event_handlers events{};
+		events.after_open = [](const spdlog::filename_t & /*fileName*/, std::FILE *stream) noexcept {
+			static_cast<void>(addDrain(&drainStream, stream));
+		};
+		events.before_close = [](const spdlog::filename_t & /*fileName*/, std::FILE *stream) noexcept { removeDrain(stream); };
+		return events;
+	}
+
+	void CrashHandler::writeRaw(const int file, std::string_view text) noexcept
+	{
+		while (!text.empty())
+		{
+			const ssize_t written{::write(file, text.data(), text.size())};
+
+			if (written < 0 && errno == EINTR)
+			{
+				continue;
+			}
+
+			if (written <= 0)
+			{
+				return;
+			}
+
+			text.remove_prefix(static_cast<std::size_t>(written));
+		}
+	}
+
+	// MARK: Private Static Member Functions
+
+	void CrashHandler::handle(const int signal, siginfo_t *info, void * /*context*/) noexcept
+	{
+		const int savedErrno{errno};
+
+		// Only the first fatal signal reports; a second one, from another thread or from a drain, goes straight to the old disposition
+		if (!handling.exchange(true, std::memory_order_seq_cst))
+		{
+			quiesce();
+
+			const int file{::open(reportPath.data(), O_WRONLY | O_APPEND | O_CREAT | O_CLOEXEC, REPORT_MODE)}; // NOLINT(hicpp-signed-bitwise,cppcoreguidelines-pro-type-vararg)
+
+			for (const DrainSlot &slot : drains)
+			{
+				const void *context{slot.context.load(std::memory_order_acquire)};
+				const Drain drain{slot.drain.load(std::memory_order_acquire)};
+
+				if (context != nullptr && drain != nullptr)
+				{
+					drain(context, file);
+				}
+			}
+
+			if (file >= 0)
+			{
+				writeReport(file, signal, info);
+				::close(file);
+			}
+		}
+
+		const std::size_t index{signalIndex(signal)};
+
+		if (index < FATAL_SIGNALS.size())
+		{
+			struct sigaction previous{previousActions.at(index)};
+
+			// An ignored fault would only fault again on return
+			if (previous.sa_handler == SIG_IGN) // NOLINT(cppcoreguidelines-pro-type-union-access,cppcoreguidelines-pro-type-cstyle-cast)
+			{
+				previous.sa_handler = SIG_DFL; // NOLINT(cppcoreguidelines-pro-type-union-access,cppcoreguidelines-pro-type-cstyle-cast)
+			}
+
+			static_cast<void>(::sigaction(signal, &previous, nullptr));
+		}
+
+		errno = savedErrno;
+		static_cast<void>(::raise(signal));
+	}
+
+	void CrashHandler::drainStream(const void *context, int /*file*/) noexcept
+	{
+#if defined(__GLIBC__)
+		// glibc keeps a stream's unwritten bytes between these two public members of FILE
+		const auto *stream{static_cast<const std::FILE *>(context)};
+
+		if (stream->_IO_write_ptr > stream->_IO_write_base)
+		{
+			writeRaw(stream->_fileno, std::string_view{stream->_IO_write_base, static_cast<std::size_t>(stream->_IO_write_ptr - stream->_IO_write_base)});
+		}
+#else
+		static_cast<void>(context);
+#endif
+	}
+} // namespace Project::Utility::Debug::Logging
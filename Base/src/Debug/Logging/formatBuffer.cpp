@@ -0,0 +1,62 @@
+/*! \file formatBuffer.cpp
+	\brief Contains the function definitions for the lease on one of the calling thread's pre-sized formatting buffers
+	\date --/--/----
+	\version x.x.x
+	\since x.x.x
+	\author Matthew Moore
+*/
+
+#include "Utility/Debug/Logging/formatBuffer.h"
+
+#include <array>
+#include <string_view>
+
+#include "Core/attributeMacros.h"
+#include "Utility/Debug/Logging/loggerOptions.h"
+
+#include <spdlog/common.h>
+
+namespace Project::Utility::Debug::Logging
+{
+	// MARK: Constructors & Destructor
+
+	FormatBuffer::FormatBuffer(const Use use, const FormatBufferOptions &options)
+		: mBuffer{buffers()[static_cast<std::size_t>(use)]}, mMaxBytes{options.maxBytes}
+	{
+		mBuffer.clear();
+
+		if (mBuffer.capacity() < options.initialBytes) ATTR_UNLIKELY
+		{
+			mBuffer.reserve(options.initialBytes);
+		}
+	}
+
+	FormatBuffer::~FormatBuffer()
+	{
+		if (mBuffer.capacity() > mMaxBytes) ATTR_UNLIKELY
+		{
+			mBuffer = spdlog::memory_buf_t{};
+		}
+	}
+
+	// MARK: Getters
+
+	ATTR_NODISCARD ATTR_PURE spdlog::memory_buf_t &FormatBuffer::get() noexcept
+	{
+		return mBuffer;
+	}
+
+	ATTR_NODISCARD ATTR_PURE std::string_view FormatBuffer::view() const noexcept
+	{
+		return std::string_view{mBuffer.data(), mBuffer.size()};
+	}
+
+	// MARK: Private Static Member Functions
+
+	ATTR_NODISCARD std::array<spdlog::memory_buf_t, FormatBuffer::USES> &FormatBuffer::buffers() noexcept
+	{
+		// Value-initialising the array would copy-list-initialise each buffer, which their explicit constructor forbids
+		thread_local std::array<spdlog::memory_buf_t, USES> perThread;
+		return perThread;
+	}
+} // namespace Project::Utility::Debug::Logging
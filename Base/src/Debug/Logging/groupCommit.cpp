@@ -0,0 +1,183 @@
+/*! \file groupCommit.cpp
+	\brief Contains the function definitions for the group commit of durable log records
+	\date --/--/----
+	\version x.x.x
+	\since x.x.x
+	\author Matthew Moore
+*/
+
+#include "Utility/Debug/Logging/groupCommit.h"
+
+#include <atomic>
+#include <cerrno>
+#include <chrono>
+#include <condition_variable>
+#include <exception>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <utility>
+
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <sys/types.h>
+#include <unistd.h>
+
+#include "Core/attributeMacros.h"
+
+#include <spdlog/common.h>
+#include <spdlog/logger.h>
+
+namespace Project::Utility::Debug::Logging
+{
+	namespace
+	{
+		/*! @brief Syncs the data of the file behind @p file.
+			@param[in] file The descriptor to sync.
+			@return true on success, or if the file does not support syncing (e.g. a character device).
+		*/
+		bool syncData(const int file) noexcept
+		{
+			if (::fdatasync(file) == 0)
+			{
+				return true;
+			}
+
+			return errno == EINVAL || errno == EROFS;
+		}
+	} // namespace
+
+	// MARK: Constructors & Destructor
+
+	GroupCommit::GroupCommit(std::string fileName, const std::chrono::microseconds maxWait) : mFileName{std::move(fileName)}, mMaxWait{maxWait}
+	{
+		mFile = open();
+
+		if (mFile < 0)
+		{
+			spdlog::throw_spdlog_ex("Failed opening file " + mFileName + " for syncing", errno);
+		}
+	}
+
+	GroupCommit::~GroupCommit()
+	{
+		::close(mFile);
+	}
+
+	// MARK: Getters
+
+	ATTR_NODISCARD ul GroupCommit::syncCount() const noexcept
+	{
+		return mSyncs.load(std::memory_order_relaxed);
+	}
+
+	// MARK: Utility
+
+	ATTR_NODISCARD bool GroupCommit::commit(spdlog::logger &logger)
+	{
+		std::unique_lock lock(mMutex);
+
+		// The caller's records were handed to the logger before this point, so any sync whose batch includes the ticket covers them
+		const ul ticket{++mRequested};
+
+		while (mDurable < ticket)
+		{
+			if (mSyncing)
+			{
+				mSynced.wait(lock);
+				continue;
+			}
+
+			mSyncing = true;
+
+			if (mMaxWait != std::chrono::microseconds::zero())
+			{
+				lock.unlock();
+				std::this_thread::sleep_for(mMaxWait);
+				lock.lock();
+			}
+
+			const ul batch{mRequested};
+			lock.unlock();
+
+			const bool durable{sync(logger)};
+
+			lock.lock();
+			mSyncing = false;
+
+			if (durable)
+			{
+				mDurable = batch;
+			}
+
+			mSynced.notify_all();
+
+			// After a failure the followers keep waiting, and the first of them retries with a sync of its own
+			if (!durable)
+			{
+				return false;
+			}
+		}
+
+		return true;
+	}
+
+	// MARK: Private Member Functions
+
+	ATTR_NODISCARD bool GroupCommit::sync(spdlog::logger &logger)
+	{
+		// A throwing error handler, or an allocation failure inside spdlog, fails this sync instead of leaving mSyncing set forever
+		try
+		{
+			logger.flush();
+		}
+		catch (const std::exception &error)
+		{
+			return false;
+		}
+
+		mSyncs.fetch_add(1, std::memory_order_relaxed);
+
+		struct stat current{};
+
+		// A rotation leaves the tail of the old file behind the old descriptor; sync it before following the path
+		if (::stat(mFileName.c_str(), &current) == 0 && (current.st_dev != mDevice || current.st_ino != mInode))
+		{
+			const bool replacedDurable{syncData(mFile)};
+			const int reopened{open()};
+
+			if (reopened >= 0)
+			{
+				::close(mFile);
+				mFile = reopened;
+			}
+
+			if (!replacedDurable)
+			{
+				return false;
+			}
+		}
+
+		return syncData(mFile);
+	}
+
+	ATTR_NODISCARD int GroupCommit::open()
+	{
+		const int file{::open(mFileName.c_str(), O_RDONLY | O_CLOEXEC)}; // NOLINT(cppcoreguidelines-pro-type-vararg,hicpp-signed-bitwise)
+
+		if (file < 0)
+		{
+			return file;
+		}
+
+		struct stat status{};
+
+		if (::fstat(file, &status) == 0)
+		{
+			mDevice = status.st_dev;
+			mInode = status.st_ino;
+		}
+
+		return file;
+	}
+} // namespace Project::Utility::Debug::Logging
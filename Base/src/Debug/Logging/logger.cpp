@@ -8,129 +8,675 @@
 
 #include "Utility/Debug/Logging/logger.h"
 
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <exception>
 #include <fstream>
+#include <iterator>
 #include <memory>
+#include <mutex>
 #include <string>
 #include <string_view>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include <linux/membarrier.h>
+#include <sys/syscall.h>
+#include <unistd.h>
 
 #include "Core/attributeMacros.h"
+#include "Core/typedefs.h"
+#include "Utility/Debug/Logging/asyncSink.h"
+#include "Utility/Debug/Logging/backtraceRing.h"
+#include "Utility/Debug/Logging/binaryDecoder.h"
+#include "Utility/Debug/Logging/binaryFormat.h"
+#include "Utility/Debug/Logging/binarySink.h"
+#include "Utility/Debug/Logging/constants.h"
+#include "Utility/Debug/Logging/crashHandler.h"
+#include "Utility/Debug/Logging/formatBuffer.h"
+#include "Utility/Debug/Logging/groupCommit.h"
+#include "Utility/Debug/Logging/loggerOptions.h"
+#include "Utility/Debug/Logging/mappedFileSink.h"
+#include "Utility/Debug/Logging/moduleLevels.h"
+#include "Utility/Debug/Logging/perThreadSink.h"
+#include "Utility/Debug/Logging/rateLimiter.h"
+#include "Utility/Debug/Logging/repeatFilter.h"
+#include "Utility/Debug/Logging/rotatingFileSink.h"
+#include "Utility/Debug/Logging/structuredFormat.h"
+#include "Utility/Debug/Logging/timestampCache.h"
+#include "Utility/Debug/Logging/tscClock.h"
 
 #include <spdlog/common.h>
+#include <spdlog/details/log_msg.h>
+#include <spdlog/fmt/fmt.h>
 #include <spdlog/logger.h>
-#include <spdlog/sinks/basic_file_sink.h>
 #include <spdlog/spdlog.h>
 
 namespace Project::Utility::Debug::Logging
 {
+	namespace
+	{
+		/*! @brief Issues a membarrier command for the calling process.
+			@param[in] command The MEMBARRIER_CMD_* value.
+			@return true if the kernel accepted the command.
+		*/
+		bool membarrier(const int command) noexcept
+		{
+			return ::syscall(__NR_membarrier, command, 0U, 0) == 0; // NOLINT(cppcoreguidelines-pro-type-vararg)
+		}
+
+		/*! @class StateRetirer
+			@brief Destroys replaced Logger states once no logging call can still be using them, all on its own thread.
+			@details Each retired state is held through an aliasing pointer to its spdlog logger, so the pointer's use count is the state's,
+		   and tagged with the generation published with its replacement. A state is destroyed once every logging call in progress announces
+		   that generation or a later one and no other owner is left, so sink teardown (joining writer threads, closing files) stays off the
+		   logging threads. Threads between calls announce nothing, so an idle thread never delays it.
+		*/
+		class StateRetirer
+		{
+			public:
+				/*! @brief Starts the retirer thread.
+					@param[in] oldestActive Returns the oldest generation a logging call is currently using.
+				*/
+				explicit StateRetirer(Project::Core::ul (*oldestActive)()) : mOldestActive{oldestActive}
+				{
+				}
+
+				// Do not allow copies or moves; the thread holds a pointer to this object
+
+				StateRetirer(const StateRetirer &) = delete;
+				StateRetirer(StateRetirer &&) = delete;
+				StateRetirer &operator=(const StateRetirer &) = delete;
+				StateRetirer &operator=(StateRetirer &&) = delete;
+
+				~StateRetirer()
+				{
+					{
+						const std::scoped_lock lock(mMutex);
+						mStopping = true;
+					}
+
+					mCondition.notify_one();
+					mThread.join();
+				}
+
+				/*! @brief Queues @p logger for destruction.
+					@param[in] logger Aliases the retired state, sharing its reference count.
+					@param[in] generation The generation published with the state's replacement.
+				*/
+				void retire(std::shared_ptr<spdlog::logger> logger, const Project::Core::ul generation)
+				{
+					{
+						const std::scoped_lock lock(mMutex);
+						mRetired.push_back(Retired{generation, std::move(logger)});
+					}
+
+					mCondition.notify_one();
+				}
+
+			private:
+				/*! @struct Retired
+					@brief A replaced state awaiting destruction.
+				*/
+				struct Retired
+				{
+					Project::Core::ul generation{0};		  /*!< The generation published with the state's replacement */
+					std::shared_ptr<spdlog::logger> logger{}; /*!< Aliases the state, sharing its reference count */
+				};
+
+				/*! @brief The retirer thread body: destroys every state no call can reach, then waits for more or rechecks the rest. */
+				void run()
+				{
+					std::unique_lock lock(mMutex);
+
+					while (true)
+					{
+						std::vector<std::shared_ptr<spdlog::logger>> released{};
+						const Project::Core::ul oldest{mOldestActive()};
+
+						// A call announcing a newer generation reloads the state, so once the retirer is the only owner nothing can reach it
+						std::erase_if(mRetired, [&released, oldest](Retired &retired) {
+							if (retired.generation > oldest || retired.logger.use_count() != 1)
+							{
+								return false;
+							}
+
+							released.push_back(std::move(retired.logger));
+							return true;
+						});
+
+						lock.unlock();
+
+						// Destroying a state drains and closes its sinks
+						released.clear();
+
+						lock.lock();
+
+						if (mStopping)
+						{
+							break;
+						}
+
+						const std::size_t pending{mRetired.size()};
+						const auto arrived = [this, pending]() { return mStopping || mRetired.size() != pending; };
+
+						if (pending == 0)
+						{
+							mCondition.wait(lock, arrived);
+						}
+						else
+						{
+							mCondition.wait_for(lock, LOGGING_RETIRE_INTERVAL, arrived);
+						}
+					}
+				}
+
+				Project::Core::ul (*mOldestActive)();		   /*!< Returns the oldest generation in use */
+				std::mutex mMutex{};						   /*!< Guards the members below */
+				std::condition_variable mCondition{};		   /*!< Signalled when a state arrives or the retirer stops */
+				std::vector<Retired> mRetired{};			   /*!< States waiting for the calls using them to return */
+				bool mStopping{false};						   /*!< Set by the destructor */
+				std::thread mThread{&StateRetirer::run, this}; /*!< The retirer thread; declared last so it starts last */
+		};
+	} // namespace
+
 	// MARK: Getter
 
 	ATTR_NODISCARD spdlog::level::level_enum Logger::getLevel()
 	{
-		return getLoggerInstance()->level();
+		return getStateInstance().load(std::memory_order_acquire)->level;
+	}
+
+	ATTR_NODISCARD Project::Core::ul Logger::getDroppedCount()
+	{
+		const std::shared_ptr<const State> state{getStateInstance().load(std::memory_order_acquire)};
+
+		if (!state)
+		{
+			return 0;
+		}
+
+		if (state->binarySink)
+		{
+			return state->binarySink->droppedCount();
+		}
+
+		if (state->perThreadSink)
+		{
+			return state->perThreadSink->droppedCount();
+		}
+
+		if (state->mappedSink)
+		{
+			return state->mappedSink->droppedCount();
+		}
+
+		return state->asyncSink ? state->asyncSink->droppedCount() : 0;
 	}
 
 	// MARK: Setters
 
+	void Logger::setDeduplication(const bool enabled)
+	{
+		static std::atomic<Project::Core::ul> epochs{0};
+
+		mDeduplication.store(enabled ? epochs.fetch_add(1, std::memory_order_relaxed) + 1 : 0, std::memory_order_relaxed);
+
+		if (enabled)
+		{
+			return;
+		}
+
+		// Every thread's open run is reported now rather than waiting for a record that may never come
+		const std::shared_ptr<const State> state{getStateInstance().load(std::memory_order_acquire)};
+
+		if (state)
+		{
+			static_cast<void>(reportRepeats(*state));
+		}
+	}
+
 	void Logger::setLevel(spdlog::level::level_enum level)
 	{
-		getLoggerInstance()->set_level(level);
+		const std::scoped_lock lock(getReconfigureMutex());
+
+		const std::shared_ptr<const State> current{getStateInstance().load(std::memory_order_acquire)};
+		std::shared_ptr<State> next{std::make_shared<State>(*current)};
+
+		next->level = level;
+		publishState(std::move(next), current);
+	}
+
+	void Logger::setModuleLevel(const std::string_view module, const spdlog::level::level_enum level)
+	{
+		const std::scoped_lock lock(getReconfigureMutex());
+
+		const std::shared_ptr<const State> current{getStateInstance().load(std::memory_order_acquire)};
+		std::shared_ptr<State> next{std::make_shared<State>(*current)};
+
+		std::erase_if(next->options.moduleLevels, [module](const ModuleLevel &entry) { return entry.module == module; });
+		next->options.moduleLevels.push_back(ModuleLevel{.module = std::string{module}, .level = level});
+		publishState(std::move(next), current);
+	}
+
+	void Logger::resetModuleLevel(const std::string_view module)
+	{
+		const std::scoped_lock lock(getReconfigureMutex());
+
+		const std::shared_ptr<const State> current{getStateInstance().load(std::memory_order_acquire)};
+		std::shared_ptr<State> next{std::make_shared<State>(*current)};
+
+		std::erase_if(next->options.moduleLevels, [module](const ModuleLevel &entry) { return entry.module == module; });
+		publishState(std::move(next), current);
 	}
 
 	ATTR_NODISCARD bool Logger::setLoggerName(const std::string &loggerName)
 	{
-		return initialize(loggerName, getFileNameStore());
+		const std::shared_ptr<const State> state{getStateInstance().load(std::memory_order_acquire)};
+
+		return setLoggerAndFileName(loggerName, state ? state->fileName : std::string{});
 	}
 
 	ATTR_NODISCARD bool Logger::setFileName(const std::string &fileName)
 	{
-		return initialize(getLoggerName(), fileName);
+		const std::shared_ptr<const State> state{getStateInstance().load(std::memory_order_acquire)};
+
+		return setLoggerAndFileName(state ? state->name : std::string{}, fileName);
 	}
 
 	ATTR_NODISCARD bool Logger::setLoggerAndFileName(const std::string &loggerName, const std::string &fileName)
 	{
-		return initialize(loggerName, fileName);
+		const std::shared_ptr<const State> state{getStateInstance().load(std::memory_order_acquire)};
+
+		LoggerOptions options{state ? state->options : LoggerOptions{}};
+		options.truncateFile = false;
+
+		return initialize(loggerName, fileName, options);
 	}
 
 	// MARK: Static Member Function
 
 	bool Logger::initialize(std::string_view loggerName, std::string_view fileName, const bool truncateFile)
 	{
-		const std::string convertedLoggerName{loggerName}; // LCOV_EXCL_BR_LINE — uncovered branch is the compiler-generated throw edge from
-														   // std::string construction (std::bad_alloc)
-		const std::string convertedFileName{fileName};	   // LCOV_EXCL_BR_LINE — uncovered branch is the compiler-generated throw edge from
-														   // std::string construction (std::bad_alloc)
+		return initialize(loggerName, fileName, LoggerOptions{.truncateFile = truncateFile});
+	}
+
+	bool Logger::initialize(std::string_view loggerName, std::string_view fileName, const LoggerOptions &options)
+	{
+		// LCOV_EXCL_BR_START — uncovered branches are compiler-generated throw edges from make_shared and std::string construction
+		// Aggregate-initialised in place, so no temporary State has to be destroyed on the throwing path
+		std::shared_ptr<State> next{std::make_shared<State>(std::string{loggerName}, std::string{fileName}, options)};
+		// LCOV_EXCL_BR_STOP
 
-		if (getLoggerInstance()) // LCOV_EXCL_BR_LINE — uncovered branch is the compiler-generated throw edge from shared_ptr bool
-								 // conversion
+		// Calibrate before any thread logs, so none of them stalls for it
+		if (options.clock == ClockSource::Tsc)
 		{
-			spdlog::drop(getLoggerName()); // LCOV_EXCL_BR_LINE — uncovered branches are compiler-generated throw edges from getLoggerName()
-										   // and spdlog::drop()
+			static_cast<void>(TscClock::available());
 		}
 
-		getLoggerInstance().reset(); // LCOV_EXCL_BR_LINE — uncovered branch is the compiler-generated throw edge from the accessor call
+		const std::scoped_lock lock(getReconfigureMutex());
 
-		getLoggerName() = convertedLoggerName;	// LCOV_EXCL_BR_LINE — uncovered branches are compiler-generated throw edges from accessor
-												// call and string assignment
-		getFileNameStore() = convertedFileName; // LCOV_EXCL_BR_LINE — uncovered branches are compiler-generated throw edges from accessor
-												// call and string assignment
-
-		if (truncateFile)
+		if (options.truncateFile)
 		{
 			// LCOV_EXCL_BR_START — uncovered branch is the compiler-generated throw edge from ofstream construction
-			std::ofstream ofs(convertedFileName, std::ofstream::out | std::ofstream::trunc);
+			std::ofstream ofs(next->fileName, std::ofstream::out | std::ofstream::trunc);
 			// LCOV_EXCL_BR_STOP
-			
+
 			if (!ofs.is_open())
 			{
 				return false;
 			}
 		}
 
+		const std::shared_ptr<const State> current{getStateInstance().load(std::memory_order_acquire)};
+		bool dropped{false};
+
 		try
 		{
-			// LCOV_EXCL_BR_START — uncovered branch is the compiler-generated throw edge from shared_ptr assignment
-			getLoggerInstance() = spdlog::basic_logger_mt(convertedLoggerName, convertedFileName);
+			// The sinks open their files and start their threads here, while the current logger keeps serving every caller
+			// LCOV_EXCL_BR_START — uncovered branches are compiler-generated throw edges from make_shared and shared_ptr assignment
+			if (options.mode == LoggerMode::Asynchronous)
+			{
+				next->asyncSink = std::make_shared<AsyncSink>(next->fileName, options.queueCapacity, options.overflowPolicy, options.rotation);
+				next->logger = std::make_shared<spdlog::logger>(next->name, next->asyncSink);
+			}
+			else if (options.mode == LoggerMode::Uring)
+			{
+				next->asyncSink = std::make_shared<AsyncSink>(next->fileName, options.queueCapacity, options.overflowPolicy, options.uring);
+				next->logger = std::make_shared<spdlog::logger>(next->name, next->asyncSink);
+			}
+			else if (options.mode == LoggerMode::Binary)
+			{
+				next->binarySink = std::make_shared<BinarySink>(next->fileName, next->name, options.threadBufferBytes, options.overflowPolicy,
+																options.clock);
+				next->logger = std::make_shared<spdlog::logger>(next->name, next->binarySink);
+			}
+			else if (options.mode == LoggerMode::PerThread)
+			{
+				next->perThreadSink = std::make_shared<PerThreadSink>(next->fileName, options.threadBufferBytes, options.overflowPolicy,
+																	  LOGGING_THREAD_BUFFER_WRITER_INTERVAL, options.rotation);
+				next->logger = std::make_shared<spdlog::logger>(next->name, next->perThreadSink);
+			}
+			else if (options.mode == LoggerMode::Mapped)
+			{
+				next->mappedSink = std::make_shared<MappedFileSink>(next->fileName, options.extentBytes, options.mappedLimitBytes, options.syncPolicy);
+				next->logger = std::make_shared<spdlog::logger>(next->name, next->mappedSink);
+			}
+			else
+			{
+				// Without a trigger the file never rotates, and the sink formats into the thread's buffer instead of a fresh one per record
+				next->logger = std::make_shared<spdlog::logger>(
+					next->name, std::make_shared<RotatingFileSink>(next->fileName, options.rotation, options.formatBuffers));
+			}
 			// LCOV_EXCL_BR_STOP
+
+			// The sink has created the file by now, so the commit can open it
+			if (options.durability.level != spdlog::level::off)
+			{
+				next->groupCommit = std::make_shared<GroupCommit>(next->fileName, options.durability.maxWait);
+			}
+
+			// Hand the registry name over; only the current logger's own entry is dropped, never one registered by someone else
+			if (current && spdlog::get(current->name) == current->logger)
+			{
+				spdlog::drop(current->name);
+				dropped = true;
+			}
+
+			// Applies the registry's level, formatter and error handler, then registers; throws spdlog_ex on a duplicate name
+			spdlog::initialize_logger(next->logger);
+
+			// Structured records are complete lines already; the registry's pattern would wrap them in a second timestamp and level
+			if (options.recordFormat != RecordFormat::Text)
+			{
+				next->logger->set_pattern("%v");
+			}
+
+			if (next->asyncSink && !next->asyncSink->crashDrainRegistered()) ATTR_UNLIKELY
+			{
+				next->logger->warn(LOGGING_CRASH_DRAIN_UNAVAILABLE);
+			}
 		}
 		// LCOV_EXCL_BR_START — uncovered branch is the catch-clause type-mismatch fallthrough; only reachable if a non-spdlog_ex escapes
-		// basic_logger_mt (e.g. std::bad_alloc)
+		// (e.g. std::bad_alloc)
 		catch (const spdlog::spdlog_ex &ex)
 		{
+			if (dropped)
+			{
+				spdlog::register_logger(current->logger);
+			}
+
 			return false;
 		}
 		// LCOV_EXCL_BR_STOP
 
+		if (RateLimiter::enabled(options.rateLimit))
+		{
+			next->rateLimiter = std::make_shared<RateLimiter>(options.rateLimit);
+		}
+
+		next->level = next->logger->level();
+
+		// Binary and mapped files have a layout of their own, so their crash reports go next to them rather than into them
+		const std::string crashFileName{options.mode == LoggerMode::Binary || options.mode == LoggerMode::Mapped ? next->fileName + ".crash"
+																												   : next->fileName};
+		publishState(std::move(next), current);
+
+		if (options.crashHandler)
+		{
+			// Without a report file the logger still works; only the crash report is lost
+			static_cast<void>(CrashHandler::install(crashFileName));
+		}
+		else
+		{
+			CrashHandler::uninstall();
+		}
+
 		return true;
 	}
 
+	ATTR_NODISCARD ModuleLogger Logger::module(const std::string_view name)
+	{
+		const std::scoped_lock lock(getReconfigureMutex());
+
+		const ModuleId known{ModuleLevels::moduleCount()};
+		const ModuleId id{ModuleLevels::registerModule(name)};
+		const std::shared_ptr<const State> current{getStateInstance().load(std::memory_order_acquire)};
+
+		// A new module has no entry in the published table yet; before the first initialize there is no table to update
+		if (current && id >= known)
+		{
+			publishState(std::make_shared<State>(*current), current);
+		}
+
+		return ModuleLogger{id};
+	}
+
+	// MARK: Private Static Member Functions
+
+	void Logger::dumpBacktrace(const State &state)
+	{
+		// Runs before the record that triggered the dump takes any buffer of its own
+		FormatBuffer message{FormatBuffer::Use::Message, state.options.formatBuffers};
+		FormatBuffer record{FormatBuffer::Use::Record, state.options.formatBuffers};
+
+		const RecordFormat format{state.binarySink ? RecordFormat::Text : state.options.recordFormat};
+
+		getBacktraceRing(state.options.backtrace).drain([&state, &message, &record, format](const BacktraceRing::Record &kept) {
+			if (!Binary::formatPayload(kept.format, kept.payload, message.get()))
+			{
+				return;
+			}
+
+			spdlog::string_view_t text{message.get().data(), message.get().size()};
+
+			if (!kept.complete && format != RecordFormat::Text)
+			{
+				Structured::encode(record.get(), format, kept.time, kept.level, state.name, std::string_view{text.data(), text.size()});
+				text = spdlog::string_view_t{record.get().data(), record.get().size()};
+			}
+
+			const spdlog::details::log_msg entry{kept.time, spdlog::source_loc{}, state.name, kept.level, text};
+
+			for (const spdlog::sink_ptr &sink : state.logger->sinks())
+			{
+				if (!sink->should_log(kept.level))
+				{
+					continue;
+				}
+
+				try
+				{
+					sink->log(entry);
+				}
+				catch (const spdlog::spdlog_ex &ex)
+				{
+					// Losing one context record must not stop the rest, or the error record that follows
+				}
+			}
+		});
+	}
+
+	void Logger::writeSummary(const State &state, const spdlog::level::level_enum level, const Project::Core::ul suppressed,
+							  const std::string_view site)
+	{
+		FormatBuffer message{FormatBuffer::Use::Summary, state.options.formatBuffers};
+		fmt::format_to(std::back_inserter(message.get()), "suppressed {} similar messages: {}", suppressed, site);
+
+		static_cast<void>(writeRecord(state, level, std::string_view{}, message.view()));
+	}
+
+	void Logger::writeRepeats(const State &state, const RepeatFilter::Run &run)
+	{
+		thread_local TimestampCache timestamps{};
+
+		// The run was identified by its raw arguments, so this is where its message is formatted a second time
+		FormatBuffer repeated{FormatBuffer::Use::Repeated, state.options.formatBuffers};
+
+		if (!Binary::formatPayload(run.format, run.payload, repeated.get()))
+		{
+			return;
+		}
+
+		FormatBuffer message{FormatBuffer::Use::Summary, state.options.formatBuffers};
+		fmt::format_to(std::back_inserter(message.get()), "previous message repeated {} times between {}", run.repeats,
+					   timestamps.format(run.first));
+		fmt::format_to(std::back_inserter(message.get()), " and {}: {}", timestamps.format(run.last), repeated.view());
+
+		static_cast<void>(writeRecord(state, run.level, std::string_view{}, message.view()));
+	}
+
+	ATTR_NODISCARD bool Logger::reportRepeats(const State &state)
+	{
+		bool reported{false};
+
+		RepeatFilter::reportOpen([&state, &reported](const RepeatFilter::Run &run) {
+			writeRepeats(state, run);
+			reported = true;
+		});
+
+		return reported;
+	}
+
+	RepeatFilter &Logger::getRepeatFilter()
+	{
+		thread_local RepeatFilter filter{LOGGING_REPEAT_SUMMARY_INTERVAL};
+		return filter;
+	}
+
+	ATTR_NODISCARD Project::Core::sl Logger::steadyNanoseconds() noexcept
+	{
+		return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+	}
+
+	BacktraceRing &Logger::getBacktraceRing(const BacktraceOptions &options)
+	{
+		thread_local std::unique_ptr<BacktraceRing> ring{};
+		thread_local BacktraceOptions created{};
+
+		if (!ring || created.records != options.records || created.maxBytes != options.maxBytes) ATTR_UNLIKELY
+		{
+			ring = std::make_unique<BacktraceRing>(options.records, options.maxBytes);
+			created = options;
+		}
+
+		return *ring;
+	}
+
+	ATTR_NODISCARD ATTR_PURE spdlog::level::level_enum Logger::activeLevel(const State &state)
+	{
+		return state.options.backtrace.records != 0 ? std::min(state.level, state.options.backtrace.level) : state.level;
+	}
+
+	void Logger::publishState(std::shared_ptr<State> next, std::shared_ptr<const State> current)
+	{
+		next->modules = ModuleLevels::resolve(next->level, next->options.moduleLevels);
+
+		// spdlog filters every record again, so its level must admit the most verbose module as well as the logger's own level
+		next->logger->set_level(std::min(next->level, next->modules.lowest()));
+
+		const spdlog::level::level_enum level{activeLevel(*next)};
+		const ModuleLevels &modules{next->modules}; // The published state keeps it alive after next is moved
+
+		// Runs counted against the outgoing logger are reported to it, not to its replacement, and flushed before it is retired
+		if (current && current->logger != next->logger && reportRepeats(*current))
+		{
+			current->logger->flush();
+		}
+
+		// Registered once, before the first state; readers keep their sequentially consistent announcements if the kernel refuses
+		static const bool expedited{membarrier(MEMBARRIER_CMD_REGISTER_PRIVATE_EXPEDITED)};
+		mAsymmetricFence.store(expedited, std::memory_order_relaxed);
+
+		mCurrentState.store(next.get(), std::memory_order_release);
+		getStateInstance().store(std::move(next), std::memory_order_release);
+
+		// Sequentially consistent, so a call that announced the old generation either shows up in the retirer's scan or sees the new one
+		const Project::Core::ul generation{mGeneration.fetch_add(1, std::memory_order_seq_cst) + 1};
+		mActiveLevel.store(level, std::memory_order_relaxed);
+
+		for (ModuleId module{0}; module < LOGGING_MAX_MODULES; ++module)
+		{
+			mModuleLevels[module].store(modules.level(module), std::memory_order_relaxed); // NOLINT(cppcoreguidelines-pro-bounds-constant-array-index)
+		}
+
+		if (current)
+		{
+			retireState(std::move(current), generation);
+		}
+	}
+
+	void Logger::retireState(std::shared_ptr<const State> state, const Project::Core::ul generation)
+	{
+		static StateRetirer retirer{&Logger::oldestActiveGeneration};
+
+		spdlog::logger *const logger{state->logger.get()};
+		retirer.retire(std::shared_ptr<spdlog::logger>{std::move(state), logger}, generation);
+	}
+
+	ATTR_NODISCARD Project::Core::ul Logger::oldestActiveGeneration()
+	{
+		// Runs a full barrier on every thread of the process, so a relaxed announcement made before it is visible to the loads below
+		if (mAsymmetricFence.load(std::memory_order_relaxed))
+		{
+			static_cast<void>(membarrier(MEMBARRIER_CMD_PRIVATE_EXPEDITED));
+		}
+
+		const std::scoped_lock lock(mReaderMutex);
+		Project::Core::ul oldest{Reader::IDLE};
+
+		for (const Reader *reader{mReaders}; reader != nullptr; reader = reader->next)
+		{
+			oldest = std::min(oldest, reader->generation.load(std::memory_order_seq_cst));
+		}
+
+		return oldest;
+	}
+
+	Logger::Reader::Reader() noexcept
+	{
+		const std::scoped_lock lock(mReaderMutex);
+		next = mReaders;
+		mReaders = this;
+	}
+
+	Logger::Reader::~Reader()
+	{
+		const std::scoped_lock lock(mReaderMutex);
+		Reader **link{&mReaders};
+
+		while (*link != this)
+		{
+			link = &(*link)->next;
+		}
+
+		*link = next;
+	}
+
 // GCC incorrectly suggests returns_nonnull for reference-returning functions; suppress since references are inherently non-null.
 #if defined(ATTR_GCC) && !defined(ATTR_CLANG)
 	#pragma GCC diagnostic push
 	#pragma GCC diagnostic ignored "-Wsuggest-attribute=returns_nonnull"
 #endif
 
-	std::shared_ptr<spdlog::logger> &Logger::getLoggerInstance()
-	{
-		static std::shared_ptr<spdlog::logger>
-			logger; // LCOV_EXCL_BR_LINE — fourth branch is the __cxa_atexit destructor-registration failure path, only reachable on OOM
-		return logger;
-	}
-
-	std::string &Logger::getLoggerName()
+	std::atomic<std::shared_ptr<const Logger::State>> &Logger::getStateInstance()
 	{
-		static std::string loggerName; // LCOV_EXCL_BR_LINE — fourth branch is the __cxa_atexit destructor-registration failure path,
-									   // only reachable on OOM
-		return loggerName;
+		static std::atomic<std::shared_ptr<const State>>
+			state; // LCOV_EXCL_BR_LINE — fourth branch is the __cxa_atexit destructor-registration failure path, only reachable on OOM
+		return state;
 	}
 
-	std::string &Logger::getFileNameStore()
+	ATTR_NODISCARD ATTR_CONST std::mutex &Logger::getReconfigureMutex()
 	{
-		static std::string fileName; // LCOV_EXCL_BR_LINE — fourth branch is the __cxa_atexit destructor-registration failure path, only
-									 // reachable on OOM
-		return fileName;
+		static std::mutex mutex;
+		return mutex;
 	}
 
 #if defined(ATTR_GCC) && !defined(ATTR_CLANG)
 	#pragma GCC diagnostic pop
 #endif
-} // namespace Project::Utility::Debug::Logging
\ No newline at end of file
+} // namespace Project::Utility::Debug::Logging
@@ -0,0 +1,323 @@
+/*! \file mappedFileSink.cpp
+	\brief Contains the function definitions for the memory-mapped file sink
+	\date --/--/----
+	\version x.x.x
+	\since x.x.x
+	\author Matthew Moore
+*/
+
+#include "Utility/Debug/Logging/mappedFileSink.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <cstddef>
+#include <cstring>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <utility>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/types.h>
+#include <unistd.h>
+
+#include "Core/attributeMacros.h"
+#include "Utility/Debug/Logging/loggerOptions.h"
+
+#include <spdlog/common.h>
+#include <spdlog/details/log_msg.h>
+#include <spdlog/formatter.h>
+#include <spdlog/pattern_formatter.h>
+
+namespace Project::Utility::Debug::Logging
+{
+	namespace
+	{
+		/*! @struct ThreadFormatter
+			@brief The calling thread's private clone of a MappedFileSink formatter.
+		*/
+		struct ThreadFormatter
+		{
+			ul sinkId{0};									/*!< The sink the clone was taken from; 0 when empty */
+			ul generation{0};								/*!< The sink's formatter generation at clone time */
+			std::unique_ptr<spdlog::formatter> formatter{}; /*!< The cloned formatter */
+		};
+
+		/*! @brief Hands out a process-unique id for each MappedFileSink so stale per-thread clones are detected even if addresses are reused.
+			@return A non-zero id.
+		*/
+		ul nextSinkId() noexcept
+		{
+			static std::atomic<ul> sinkId{0};
+			return sinkId.fetch_add(1, std::memory_order_relaxed) + 1;
+		}
+
+		/*! @brief Rounds @p value up to a multiple of @p step.
+			@param[in] value The value to round; 0 is treated as 1 so the result is never 0.
+			@param[in] step The multiple; must not be 0.
+			@return The smallest multiple of @p step that is at least @p value.
+		*/
+		ul roundUp(const ul value, const ul step) noexcept
+		{
+			return ((std::max<ul>(value, 1) + step - 1) / step) * step;
+		}
+	} // namespace
+
+	// MARK: Constructors & Destructor
+
+	MappedFileSink::MappedFileSink(const std::string &fileName, const ul extentBytes, const ul limitBytes, const SyncPolicy policy)
+		: mId{nextSinkId()}, mPageBytes{static_cast<ul>(::sysconf(_SC_PAGESIZE))}, mExtentBytes{roundUp(extentBytes, mPageBytes)},
+		  mLimitBytes{roundUp(limitBytes, mExtentBytes)}, mPolicy{policy}, mFileName{fileName},
+		  mFormatter{std::make_unique<spdlog::pattern_formatter>()}
+	{
+		mFile = ::open(mFileName.c_str(), O_RDWR | O_CREAT | O_CLOEXEC, S_IRUSR | S_IWUSR | S_IRGRP | S_IROTH); // NOLINT(hicpp-signed-bitwise)
+
+		if (mFile < 0)
+		{
+			spdlog::throw_spdlog_ex("Failed opening file " + mFileName + " for writing", errno);
+		}
+
+		struct stat status{};
+
+		if (::fstat(mFile, &status) != 0)
+		{
+			const int error{errno};
+			::close(mFile);
+			spdlog::throw_spdlog_ex("Failed to get the size of " + mFileName, error);
+		}
+
+		const auto existing{static_cast<ul>(status.st_size)};
+
+		if (existing > mLimitBytes)
+		{
+			::close(mFile);
+			spdlog::throw_spdlog_ex("The file " + mFileName + " is already larger than the mapped size limit");
+		}
+
+		// Reserve the whole range without committing memory, so extents can be mapped in place as the file grows
+		void *const reservation{::mmap(nullptr, mLimitBytes, PROT_NONE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE, -1, 0)};
+
+		if (reservation == MAP_FAILED) // NOLINT(cppcoreguidelines-pro-type-cstyle-cast)
+		{
+			const int error{errno};
+			::close(mFile);
+			spdlog::throw_spdlog_ex("Failed to reserve address space for " + mFileName, error);
+		}
+
+		mBase = static_cast<std::byte *>(reservation);
+
+		if (existing == 0)
+		{
+			return;
+		}
+
+		try
+		{
+			grow(existing);
+		}
+		catch (const spdlog::spdlog_ex &ex)
+		{
+			::munmap(mBase, mLimitBytes);
+			::close(mFile);
+			throw;
+		}
+
+		// A process that died with the file open leaves the rest of its last extent zero-filled; resume after the last record instead
+		const std::byte *end{mBase + existing};
+
+		while (end != mBase && *(end - 1) == std::byte{0})
+		{
+			--end;
+		}
+
+		mEnd.store(static_cast<ul>(end - mBase), std::memory_order_relaxed);
+		mCopied.store(static_cast<ul>(end - mBase), std::memory_order_relaxed);
+		mSynced = static_cast<ul>(end - mBase);
+	}
+
+	MappedFileSink::~MappedFileSink()
+	{
+		static_cast<void>(sync(mPolicy));
+
+		::munmap(mBase, mLimitBytes);
+
+		// Give back the pre-allocated space past the last record; a failure only leaves zero padding that the next open trims
+		static_cast<void>(::ftruncate(mFile, static_cast<off_t>(mEnd.load(std::memory_order_acquire))));
+
+		if (mPolicy == SyncPolicy::Synchronous)
+		{
+			static_cast<void>(::fdatasync(mFile));
+		}
+
+		::close(mFile);
+	}
+
+	// MARK: Getters
+
+	ATTR_NODISCARD ul MappedFileSink::droppedCount() const noexcept
+	{
+		return mDropped.load(std::memory_order_relaxed);
+	}
+
+	ATTR_NODISCARD ul MappedFileSink::size() const noexcept
+	{
+		return mEnd.load(std::memory_order_acquire);
+	}
+
+	// MARK: spdlog::sinks::sink
+
+	void MappedFileSink::log(const spdlog::details::log_msg &msg)
+	{
+		thread_local spdlog::memory_buf_t line{};
+
+		line.clear();
+		threadFormatter().format(msg, line);
+
+		const ul size{line.size()};
+		ul begin{mEnd.load(std::memory_order_relaxed)};
+
+		// Claim [begin, begin + size) only once it is mapped, so a failed extent never leaves a hole in the file
+		while (true)
+		{
+			const ul end{begin + size};
+
+			if (end > mLimitBytes) ATTR_UNLIKELY
+			{
+				mDropped.fetch_add(1, std::memory_order_relaxed);
+				return;
+			}
+
+			if (end > mMapped.load(std::memory_order_acquire)) ATTR_UNLIKELY
+			{
+				grow(end);
+			}
+
+			if (mEnd.compare_exchange_weak(begin, end, std::memory_order_relaxed, std::memory_order_relaxed))
+			{
+				break;
+			}
+		}
+
+		std::memcpy(mBase + begin, line.data(), size);
+		mCopied.fetch_add(size, std::memory_order_release);
+	}
+
+	void MappedFileSink::flush()
+	{
+		const int error{sync(mPolicy)};
+
+		if (error != 0)
+		{
+			spdlog::throw_spdlog_ex("Failed to sync " + mFileName, error);
+		}
+	}
+
+	void MappedFileSink::set_pattern(const std::string &pattern)
+	{
+		set_formatter(std::make_unique<spdlog::pattern_formatter>(pattern));
+	}
+
+	void MappedFileSink::set_formatter(std::unique_ptr<spdlog::formatter> sinkFormatter)
+	{
+		const std::scoped_lock lock(mFormatterMutex);
+
+		mFormatter = std::move(sinkFormatter);
+		mFormatterGeneration.fetch_add(1, std::memory_order_release);
+	}
+
+	// MARK: Private Member Functions
+
+	spdlog::formatter &MappedFileSink::threadFormatter()
+	{
+		thread_local ThreadFormatter cache{};
+
+		if (!cache.formatter || cache.sinkId != mId || cache.generation != mFormatterGeneration.load(std::memory_order_acquire)) ATTR_UNLIKELY
+		{
+			const std::scoped_lock lock(mFormatterMutex);
+
+			cache.formatter = mFormatter->clone();
+			cache.sinkId = mId;
+			cache.generation = mFormatterGeneration.load(std::memory_order_relaxed);
+		}
+
+		return *cache.formatter;
+	}
+
+	void MappedFileSink::grow(const ul end)
+	{
+		const std::scoped_lock lock(mGrowMutex);
+
+		ul mapped{mMapped.load(std::memory_order_relaxed)};
+
+		while (mapped < end)
+		{
+			const auto offset{static_cast<off_t>(mapped)};
+			const auto length{static_cast<off_t>(mExtentBytes)};
+
+			// Allocating up front means a full disk fails here rather than with SIGBUS on a later store into the mapping
+			const int error{::posix_fallocate(mFile, offset, length)};
+
+			if (error != 0)
+			{
+				spdlog::throw_spdlog_ex("Failed to allocate space in " + mFileName, error);
+			}
+
+			if (::mmap(mBase + mapped, mExtentBytes, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_FIXED, mFile, offset) ==
+				MAP_FAILED) // NOLINT(cppcoreguidelines-pro-type-cstyle-cast)
+			{
+				spdlog::throw_spdlog_ex("Failed to map " + mFileName, errno);
+			}
+
+			mapped += mExtentBytes;
+			mMapped.store(mapped, std::memory_order_release);
+		}
+	}
+
+	int MappedFileSink::sync(const SyncPolicy policy) noexcept
+	{
+		if (policy == SyncPolicy::Never)
+		{
+			return 0;
+		}
+
+		const std::scoped_lock lock(mSyncMutex);
+
+		// Claimed bytes may still be zeros, and syncing them would make a torn record durable, so wait until every claim is copied.
+		// mCopied never passes mEnd, so once it matches a later load of mEnd nothing claimed before that load is still being copied.
+		ul end{};
+
+		while (true)
+		{
+			const ul copied{mCopied.load(std::memory_order_acquire)};
+			end = mEnd.load(std::memory_order_relaxed);
+
+			if (copied == end) ATTR_LIKELY
+			{
+				break;
+			}
+
+			std::this_thread::yield();
+		}
+
+		if (end == mSynced)
+		{
+			return 0;
+		}
+
+		// msync needs a page-aligned start; the partial page before mSynced is simply written again
+		const ul begin{mSynced - (mSynced % mPageBytes)};
+
+		if (::msync(mBase + begin, end - begin, policy == SyncPolicy::Synchronous ? MS_SYNC : MS_ASYNC) != 0)
+		{
+			return errno;
+		}
+
+		mSynced = end;
+
+		return 0;
+	}
+} // namespace Project::Utility::Debug::Logging
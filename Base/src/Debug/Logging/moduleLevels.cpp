@@ -0,0 +1,126 @@
+/*! \file moduleLevels.cpp
+	\brief Contains the function definitions for the module registry and the resolution of per-module log levels
+	\date --/--/----
+	\version x.x.x
+	\since x.x.x
+	\author Matthew Moore
+*/
+
+#include "Utility/Debug/Logging/moduleLevels.h"
+
+#include <algorithm>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "Core/attributeMacros.h"
+#include "Core/typedefs.h"
+#include "Utility/Debug/Logging/constants.h"
+#include "Utility/Debug/Logging/loggerOptions.h"
+
+#include <spdlog/common.h>
+
+namespace Project::Utility::Debug::Logging
+{
+	namespace
+	{
+		/*! @struct Registry
+			@brief The names of every registered module, indexed by id.
+		*/
+		struct Registry
+		{
+			std::mutex mutex{};							/*!< Guards @ref names */
+			std::vector<std::string> names{""};			/*!< Module names; the root module is registered from the start */
+		};
+
+		/*! @brief Provides access to the function-local static registry.
+			@return The registry, valid for the lifetime of the program.
+		*/
+		Registry &getRegistry()
+		{
+			static Registry registry{};
+			return registry;
+		}
+	} // namespace
+
+	// MARK: Getters
+
+	ATTR_NODISCARD ATTR_PURE spdlog::level::level_enum ModuleLevels::lowest() const noexcept
+	{
+		return mLowest;
+	}
+
+	// MARK: Static Member Functions
+
+	ATTR_NODISCARD ModuleId ModuleLevels::registerModule(const std::string_view name)
+	{
+		Registry &registry{getRegistry()};
+		const std::scoped_lock lock(registry.mutex);
+
+		const auto found{std::ranges::find(registry.names, name)};
+
+		if (found != registry.names.end())
+		{
+			return static_cast<ModuleId>(found - registry.names.begin());
+		}
+
+		if (registry.names.size() == LOGGING_MAX_MODULES)
+		{
+			return ROOT_MODULE;
+		}
+
+		registry.names.emplace_back(name);
+		return static_cast<ModuleId>(registry.names.size() - 1);
+	}
+
+	ATTR_NODISCARD ModuleId ModuleLevels::moduleCount()
+	{
+		Registry &registry{getRegistry()};
+		const std::scoped_lock lock(registry.mutex);
+
+		return static_cast<ModuleId>(registry.names.size());
+	}
+
+	ATTR_NODISCARD ModuleLevels ModuleLevels::resolve(const spdlog::level::level_enum fallback, const std::vector<ModuleLevel> &overrides)
+	{
+		Registry &registry{getRegistry()};
+		const std::scoped_lock lock(registry.mutex);
+
+		ModuleLevels levels{};
+
+		for (std::size_t id{0}; id < registry.names.size(); ++id)
+		{
+			const std::string_view name{registry.names[id]};
+			spdlog::level::level_enum level{fallback};
+			std::size_t specificity{0};
+			bool matched{false};
+
+			// The longest covering name is the most specific; among equal names the last override wins
+			for (const ModuleLevel &entry : overrides)
+			{
+				if (covers(entry.module, name) && (!matched || entry.module.size() >= specificity))
+				{
+					level = entry.level;
+					specificity = entry.module.size();
+					matched = true;
+				}
+			}
+
+			levels.mLevels[id] = static_cast<Project::Core::ub>(level); // NOLINT(cppcoreguidelines-pro-bounds-constant-array-index)
+			levels.mLowest = std::min(levels.mLowest, level);
+		}
+
+		return levels;
+	}
+
+	ATTR_NODISCARD ATTR_PURE bool ModuleLevels::covers(const std::string_view ancestor, const std::string_view name) noexcept
+	{
+		if (ancestor.empty() || ancestor == name)
+		{
+			return true;
+		}
+
+		return name.size() > ancestor.size() && name.starts_with(ancestor) && name[ancestor.size()] == '.';
+	}
+} // namespace Project::Utility::Debug::Logging
@@ -0,0 +1,134 @@
+/*! \file perThreadSink.cpp
+	\brief Contains the function definitions for the per-thread buffered file sink
+	\date --/--/----
+	\version x.x.x
+	\since x.x.x
+	\author Matthew Moore
+*/
+
+#include "Utility/Debug/Logging/perThreadSink.h"
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <span>
+#include <string>
+#include <string_view>
+#include <utility>
+
+#include "Core/attributeMacros.h"
+#include "Utility/Debug/Logging/loggerOptions.h"
+#include "Utility/Debug/Logging/threadBufferWriter.h"
+
+#include <spdlog/common.h>
+#include <spdlog/details/log_msg.h>
+#include <spdlog/formatter.h>
+#include <spdlog/pattern_formatter.h>
+
+namespace Project::Utility::Debug::Logging
+{
+	namespace
+	{
+		/*! @struct ThreadFormatter
+			@brief The calling thread's private clone of a PerThreadSink formatter.
+		*/
+		struct ThreadFormatter
+		{
+			ul sinkId{0};									/*!< The sink the clone was taken from; 0 when empty */
+			ul generation{0};								/*!< The sink's formatter generation at clone time */
+			std::unique_ptr<spdlog::formatter> formatter{}; /*!< The cloned formatter */
+		};
+
+		/*! @brief Hands out a process-unique id for each PerThreadSink so stale per-thread clones are detected even if addresses are reused.
+			@return A non-zero id.
+		*/
+		ul nextSinkId() noexcept
+		{
+			static std::atomic<ul> sinkId{0};
+			return sinkId.fetch_add(1, std::memory_order_relaxed) + 1;
+		}
+	} // namespace
+
+	// MARK: Constructors & Destructor
+
+	PerThreadSink::PerThreadSink(const std::string &fileName, const ul threadBufferBytes, const OverflowPolicy policy,
+								 const std::chrono::milliseconds interval, const RotationOptions &rotation)
+		: mId{nextSinkId()}, mFormatter{std::make_unique<spdlog::pattern_formatter>()},
+		  mWriter{fileName,
+				  std::string_view{},
+				  threadBufferBytes,
+				  policy,
+				  [](spdlog::memory_buf_t & /*batch*/) {},
+				  &PerThreadSink::appendRecord,
+				  interval,
+				  rotation}
+	{
+	}
+
+	PerThreadSink::~PerThreadSink() = default;
+
+	// MARK: Getters
+
+	ATTR_NODISCARD ul PerThreadSink::droppedCount() const noexcept
+	{
+		return mWriter.droppedCount();
+	}
+
+	// MARK: spdlog::sinks::sink
+
+	void PerThreadSink::log(const spdlog::details::log_msg &msg)
+	{
+		thread_local spdlog::memory_buf_t line{};
+
+		line.clear();
+		threadFormatter().format(msg, line);
+
+		const sl timestamp{std::chrono::duration_cast<std::chrono::nanoseconds>(msg.time.time_since_epoch()).count()};
+
+		mWriter.push(timestamp, line.size(), [](ThreadBufferWriter::Ring::Writer &writer) { writer.put(line.data(), line.size()); });
+	}
+
+	void PerThreadSink::flush()
+	{
+		mWriter.flush();
+	}
+
+	void PerThreadSink::set_pattern(const std::string &pattern)
+	{
+		set_formatter(std::make_unique<spdlog::pattern_formatter>(pattern));
+	}
+
+	void PerThreadSink::set_formatter(std::unique_ptr<spdlog::formatter> sinkFormatter)
+	{
+		const std::scoped_lock lock(mFormatterMutex);
+
+		mFormatter = std::move(sinkFormatter);
+		mFormatterGeneration.fetch_add(1, std::memory_order_release);
+	}
+
+	// MARK: Private Member Functions
+
+	spdlog::formatter &PerThreadSink::threadFormatter()
+	{
+		thread_local ThreadFormatter cache{};
+
+		if (!cache.formatter || cache.sinkId != mId || cache.generation != mFormatterGeneration.load(std::memory_order_acquire)) ATTR_UNLIKELY
+		{
+			const std::scoped_lock lock(mFormatterMutex);
+
+			cache.formatter = mFormatter->clone();
+			cache.sinkId = mId;
+			cache.generation = mFormatterGeneration.load(std::memory_order_relaxed);
+		}
+
+		return *cache.formatter;
+	}
+
+	void PerThreadSink::appendRecord(spdlog::memory_buf_t &batch, const sl /*timestamp*/, const std::span<const std::byte> body)
+	{
+		const auto *data{reinterpret_cast<const char *>(body.data())}; // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+		batch.append(data, data + body.size());
+	}
+} // namespace Project::Utility::Debug::Logging
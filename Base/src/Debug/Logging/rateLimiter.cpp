@@ -0,0 +1,206 @@
+/*! \file rateLimiter.cpp
+	\brief Contains the function definitions for the per-call-site token bucket and sampler
+	\date --/--/----
+	\version x.x.x
+	\since x.x.x
+	\author Matthew Moore
+*/
+
+#include "Utility/Debug/Logging/rateLimiter.h"
+
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <memory>
+
+#include "Core/attributeMacros.h"
+#include "Core/typedefs.h"
+#include "Utility/Debug/Logging/loggerOptions.h"
+
+namespace Project::Utility::Debug::Logging
+{
+	namespace
+	{
+		/*! @brief Nanoseconds per second, as a double for rate arithmetic. */
+		constexpr double NANOSECONDS_PER_SECOND{1'000'000'000.0};
+
+		/*! @brief 2^64 as a double, for turning a probability into a 64-bit threshold. */
+		constexpr double TWO_TO_THE_64{18'446'744'073'709'551'616.0};
+
+		/*! @brief The largest nanosecond span the bucket works with; keeps arrival-time arithmetic far from overflow. */
+		constexpr double MAX_SPAN{static_cast<double>(std::numeric_limits<sl>::max() / 4)};
+
+		/*! @brief Computes the nanoseconds per token of the bucket described by @p options.
+			@param[in] options The limits.
+			@return The interval, or 0 when the bucket is disabled.
+		*/
+		sl tokenInterval(const RateLimitOptions &options)
+		{
+			if (options.burst == 0 || options.perSecond <= 0.0)
+			{
+				return 0;
+			}
+
+			return static_cast<sl>(std::clamp(NANOSECONDS_PER_SECOND / options.perSecond, 1.0, MAX_SPAN / static_cast<double>(options.burst)));
+		}
+
+		/*! @brief Converts the sampling probability into the threshold a uniformly random 64-bit value is compared against.
+			@param[in] rate The probability of keeping a record.
+			@return The threshold; the maximum value means sampling is disabled.
+		*/
+		ul sampleThreshold(const double rate)
+		{
+			if (rate >= 1.0)
+			{
+				return std::numeric_limits<ul>::max();
+			}
+
+			return rate <= 0.0 ? 0 : static_cast<ul>(rate * TWO_TO_THE_64);
+		}
+
+		/*! @brief Mixes a pointer into a table index; the low bits of an address are mostly alignment.
+			@param[in] site The call site's identity.
+			@return A well-distributed 64-bit hash.
+		*/
+		std::uint64_t hashSite(const void *site)
+		{
+			constexpr std::uint64_t GOLDEN_RATIO{0x9E37'79B9'7F4A'7C15};
+			constexpr unsigned SHIFT{29};
+
+			const auto value{reinterpret_cast<std::uintptr_t>(site)}; // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+			const std::uint64_t mixed{static_cast<std::uint64_t>(value) * GOLDEN_RATIO};
+			return mixed ^ (mixed >> SHIFT);
+		}
+	} // namespace
+
+	// MARK: Constructors & Destructor
+
+	RateLimiter::RateLimiter(const RateLimitOptions &options) : mMask{std::bit_ceil(std::max<std::size_t>(options.sites, 1)) - 1},
+																mInterval{tokenInterval(options)},
+																mTolerance{mInterval * static_cast<sl>(options.burst)},
+																mSampleThreshold{sampleThreshold(options.sampleRate)},
+																mSummaryInterval{std::chrono::duration_cast<std::chrono::nanoseconds>(options.summaryInterval).count()},
+																mSites{std::make_unique<Site[]>(mMask + 1)}
+	{
+	}
+
+	// MARK: Utility
+
+	ATTR_NODISCARD RateLimiter::Admission RateLimiter::admit(const void *site, const sl now) noexcept
+	{
+		Site *slot{find(site)};
+
+		// A full table leaves new sites unlimited rather than sharing another site's bucket
+		if (slot == nullptr) ATTR_UNLIKELY
+		{
+			return Admission{};
+		}
+
+		if (sampled() && (mInterval == 0 || take(*slot, now))) ATTR_LIKELY
+		{
+			// The load keeps the common case, nothing held back, free of a read-modify-write
+			if (slot->suppressed.load(std::memory_order_relaxed) == 0) ATTR_LIKELY
+			{
+				return Admission{};
+			}
+
+			slot->reported.store(now, std::memory_order_relaxed);
+			return Admission{.write = true, .suppressed = slot->suppressed.exchange(0, std::memory_order_relaxed)};
+		}
+
+		slot->suppressed.fetch_add(1, std::memory_order_relaxed);
+
+		sl reported{slot->reported.load(std::memory_order_relaxed)};
+
+		// One held-back call per interval wins the exchange and reports for everyone
+		if (mSummaryInterval != 0 && now - reported >= mSummaryInterval &&
+			slot->reported.compare_exchange_strong(reported, now, std::memory_order_relaxed))
+		{
+			return Admission{.write = false, .suppressed = slot->suppressed.exchange(0, std::memory_order_relaxed)};
+		}
+
+		return Admission{.write = false};
+	}
+
+	// MARK: Static Member Functions
+
+	ATTR_NODISCARD ATTR_PURE bool RateLimiter::enabled(const RateLimitOptions &options) noexcept
+	{
+		return (options.burst != 0 && options.perSecond > 0.0) || options.sampleRate < 1.0;
+	}
+
+	// MARK: Private Member Functions
+
+	ATTR_NODISCARD RateLimiter::Site *RateLimiter::find(const void *site) noexcept
+	{
+		std::size_t index{hashSite(site) & mMask};
+
+		for (std::size_t probe{0}; probe <= mMask; ++probe, index = (index + 1) & mMask)
+		{
+			Site &slot{mSites[index]};
+			const void *key{slot.key.load(std::memory_order_acquire)};
+
+			if (key == site) ATTR_LIKELY
+			{
+				return &slot;
+			}
+
+			if (key == nullptr)
+			{
+				// Losing the race to another thread claiming the same slot for the same site is as good as winning it
+				if (slot.key.compare_exchange_strong(key, site, std::memory_order_acq_rel) || key == site)
+				{
+					return &slot;
+				}
+			}
+		}
+
+		return nullptr;
+	}
+
+	ATTR_NODISCARD bool RateLimiter::take(Site &slot, const sl now) const noexcept
+	{
+		sl arrival{slot.arrival.load(std::memory_order_relaxed)};
+
+		while (true)
+		{
+			const sl next{std::max(arrival, now) + mInterval};
+
+			if (next - now > mTolerance)
+			{
+				return false;
+			}
+
+			if (slot.arrival.compare_exchange_weak(arrival, next, std::memory_order_relaxed))
+			{
+				return true;
+			}
+		}
+	}
+
+	ATTR_NODISCARD bool RateLimiter::sampled() const noexcept
+	{
+		if (mSampleThreshold == std::numeric_limits<ul>::max()) ATTR_LIKELY
+		{
+			return true;
+		}
+
+		// xorshift64*, seeded from the thread's own state address so every thread draws a different stream
+		thread_local std::uint64_t state{reinterpret_cast<std::uintptr_t>(&state) | 1U}; // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+
+		constexpr unsigned SHIFT_A{12};
+		constexpr unsigned SHIFT_B{25};
+		constexpr unsigned SHIFT_C{27};
+		constexpr std::uint64_t MULTIPLIER{0x2545'F491'4F6C'DD1D};
+
+		state ^= state >> SHIFT_A;
+		state ^= state << SHIFT_B;
+		state ^= state >> SHIFT_C;
+
+		return state * MULTIPLIER < mSampleThreshold;
+	}
+} // namespace Project::Utility::Debug::Logging
@@ -0,0 +1,134 @@
+/*! \file repeatFilter.cpp
+	\brief Contains the function definitions for the per-thread filter that collapses consecutive identical log records
+	\date --/--/----
+	\version x.x.x
+	\since x.x.x
+	\author Matthew Moore
+*/
+
+#include "Utility/Debug/Logging/repeatFilter.h"
+
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <new>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include "Core/attributeMacros.h"
+
+#include <spdlog/common.h>
+
+namespace Project::Utility::Debug::Logging
+{
+	// MARK: Constructors & Destructor
+
+	RepeatFilter::RepeatFilter(const std::chrono::nanoseconds interval) : mInterval{interval}
+	{
+		Registry &registry{getRegistry()};
+		const std::scoped_lock lock(registry.mutex);
+		registry.filters.push_back(this);
+	}
+
+	RepeatFilter::~RepeatFilter()
+	{
+		Registry &registry{getRegistry()};
+		const std::scoped_lock lock(registry.mutex);
+
+		std::erase(registry.filters, this);
+
+		if (mRepeats == 0)
+		{
+			return;
+		}
+
+		try
+		{
+			registry.orphans.push_back(Orphan{.run = currentRun(), .payload = std::string{mCurrent.data(), mCurrent.size()}});
+			mOrphaned.store(true, std::memory_order_relaxed);
+		}
+		catch (const std::bad_alloc &error)
+		{
+			// The run is lost, as it would have been without the registry
+		}
+	}
+
+	// MARK: Private Member Functions
+
+	ATTR_NODISCARD RepeatFilter::Verdict RepeatFilter::decide(const ul epoch, const void *id, const spdlog::level::level_enum level,
+															  const std::string_view format, const spdlog::log_clock::time_point now)
+	{
+		const std::string_view candidate{mCandidate.data(), mCandidate.size()};
+		const ul print{fingerprint(id, level, candidate)};
+		Verdict verdict{};
+
+		const std::scoped_lock lock(mMutex);
+
+		if (print == mFingerprint && epoch == mEpoch && id == mId && level == mLevel &&
+			candidate == std::string_view{mCurrent.data(), mCurrent.size()})
+		{
+			if (mRepeats == 0)
+			{
+				mFirst = now;
+			}
+
+			++mRepeats;
+			mLast = now;
+			verdict.write = false;
+
+			if (mLast - mFirst >= mInterval)
+			{
+				verdict.run = currentRun();
+				mRepeats = 0;
+			}
+
+			return verdict;
+		}
+
+		// The ended run's arguments move aside so the caller can still report it after the new record is stored
+		if (mRepeats != 0)
+		{
+			std::swap(mCurrent, mPrevious);
+			verdict.run = Run{.repeats = mRepeats, .level = mLevel, .first = mFirst, .last = mLast, .format = mFormat,
+							  .payload = std::string_view{mPrevious.data(), mPrevious.size()}};
+		}
+
+		mCurrent.clear();
+		mCurrent.append(candidate.data(), candidate.data() + candidate.size());
+		mEpoch = epoch;
+		mFingerprint = print;
+		mId = id;
+		mLevel = level;
+		mFormat = format;
+		mRepeats = 0;
+
+		return verdict;
+	}
+
+	ATTR_NODISCARD ATTR_PURE RepeatFilter::Run RepeatFilter::currentRun() const noexcept
+	{
+		return Run{.repeats = mRepeats, .level = mLevel, .first = mFirst, .last = mLast, .format = mFormat,
+				   .payload = std::string_view{mCurrent.data(), mCurrent.size()}};
+	}
+
+	// MARK: Private Static Member Functions
+
+	ATTR_NODISCARD ul RepeatFilter::fingerprint(const void *id, const spdlog::level::level_enum level, const std::string_view payload) noexcept
+	{
+		// Fibonacci hashing spreads the format's address and level over the whole word before they are mixed with the arguments' hash
+		constexpr ul GOLDEN_RATIO{0x9E37'79B9'7F4A'7C15};
+
+		const ul address{reinterpret_cast<std::uintptr_t>(id)}; // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+		const ul identity{address ^ static_cast<ul>(level)};
+		return std::hash<std::string_view>{}(payload) ^ (identity * GOLDEN_RATIO);
+	}
+
+	ATTR_NODISCARD RepeatFilter::Registry &RepeatFilter::getRegistry() noexcept
+	{
+		static Registry registry{};
+		return registry;
+	}
+} // namespace Project::Utility::Debug::Logging
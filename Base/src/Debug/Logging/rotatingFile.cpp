@@ -0,0 +1,385 @@
+/*! \file rotatingFile.cpp
+	\brief Contains the function definitions for the rotating log file and its background segment archiver
+	\date --/--/----
+	\version x.x.x
+	\since x.x.x
+	\author Matthew Moore
+*/
+
+#include "Utility/Debug/Logging/rotatingFile.h"
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <ctime>
+#include <filesystem>
+#include <fstream>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <utility>
+#include <vector>
+
+#include <sys/resource.h>
+#include <unistd.h>
+#include <zlib.h>
+
+#include "Core/attributeMacros.h"
+#include "Utility/Debug/Logging/loggerOptions.h"
+
+#include <spdlog/common.h>
+#include <spdlog/fmt/chrono.h>
+#include <spdlog/fmt/fmt.h>
+
+namespace Project::Utility::Debug::Logging
+{
+	namespace
+	{
+		/*! @brief The length of the `yyyymmddTHHMMSS.nnn` part of a segment name. */
+		constexpr std::size_t SEGMENT_STAMP_SIZE{19};
+
+		/*! @brief The suffix of a compressed segment. */
+		constexpr std::string_view COMPRESSED_SUFFIX{".gz"};
+
+		/*! @brief The nice value of the archiver thread; the lowest priority Linux offers. */
+		constexpr int ARCHIVER_NICE{19};
+
+		/*! @brief Finds the first multiple of @p interval since the epoch that is later than @p time.
+			@param[in] time The time to start from.
+			@param[in] interval The rotation interval; must not be zero.
+			@return The next rotation boundary.
+		*/
+		std::chrono::system_clock::time_point nextBoundary(const std::chrono::system_clock::time_point time, const std::chrono::seconds interval)
+		{
+			const std::chrono::seconds elapsed{std::chrono::floor<std::chrono::seconds>(time.time_since_epoch())};
+			return std::chrono::system_clock::time_point{((elapsed / interval) + 1) * interval};
+		}
+
+		/*! @brief Gzips @p segment next to itself and removes the original once the compressed copy is complete.
+			@details Writes to a temporary name first, so a crash never leaves a truncated `.gz` that looks finished. On failure the original
+		   segment is kept and the partial output removed.
+			@param[in] segment The rotated segment.
+		*/
+		void compress(const std::filesystem::path &segment)
+		{
+			std::filesystem::path target{segment};
+			target += COMPRESSED_SUFFIX;
+			std::filesystem::path partial{target};
+			partial += ".tmp";
+
+			std::ifstream input{segment, std::ios::binary};
+			gzFile output{::gzopen(partial.c_str(), "wb")};
+
+			if (!input.is_open() || output == nullptr)
+			{
+				if (output != nullptr)
+				{
+					static_cast<void>(::gzclose(output));
+				}
+
+				return;
+			}
+
+			constexpr std::size_t CHUNK_SIZE{65'536};
+			std::array<char, CHUNK_SIZE> chunk{};
+			bool failed{false};
+
+			while (!failed && input.read(chunk.data(), chunk.size()).gcount() > 0)
+			{
+				const auto count{static_cast<unsigned>(input.gcount())};
+				failed = ::gzwrite(output, chunk.data(), count) != static_cast<int>(count);
+			}
+
+			failed = (::gzclose(output) != Z_OK) || failed || input.bad();
+
+			std::error_code error{};
+
+			if (!failed)
+			{
+				std::filesystem::rename(partial, target, error);
+			}
+
+			if (failed || error)
+			{
+				std::filesystem::remove(partial, error);
+				return;
+			}
+
+			std::filesystem::remove(segment, error);
+		}
+	} // namespace
+
+	// MARK: Constructors & Destructor
+
+	RotatingFile::RotatingFile(const std::string &fileName, const RotationOptions &options) : mPath{fileName}, mOptions{options}
+	{
+		mFile.open(fileName, false);
+		mOpen = true;
+		mSize = mFile.size();
+
+		if (mOptions.interval != std::chrono::seconds::zero())
+		{
+			// Resume the boundary the existing records belong to, so a restart after midnight still rotates yesterday's file
+			std::error_code error{};
+			const std::filesystem::file_time_type modified{std::filesystem::last_write_time(mPath, error)};
+			std::chrono::system_clock::time_point written{std::chrono::system_clock::now()};
+
+			if (mSize != 0 && !error)
+			{
+				written = std::chrono::time_point_cast<std::chrono::system_clock::duration>(std::chrono::file_clock::to_sys(modified));
+			}
+
+			mNextRotation = nextBoundary(written, mOptions.interval);
+		}
+
+		if (mOptions.compress || mOptions.maxFiles != 0)
+		{
+			mArchiver = std::thread{&RotatingFile::archiverLoop, this};
+		}
+	}
+
+	RotatingFile::~RotatingFile()
+	{
+		mFile.close();
+
+		{
+			const std::scoped_lock lock(mArchiveMutex);
+			mStopping = true;
+		}
+
+		mArchiveCondition.notify_one();
+
+		if (mArchiver.joinable())
+		{
+			mArchiver.join();
+		}
+	}
+
+	// MARK: Getters
+
+	ATTR_NODISCARD ATTR_PURE ul RotatingFile::size() const noexcept
+	{
+		return mSize;
+	}
+
+	// MARK: Utility
+
+	void RotatingFile::write(const spdlog::memory_buf_t &bytes)
+	{
+		if (rotationDue(bytes.size())) ATTR_UNLIKELY
+		{
+			rotate();
+		}
+		else if (!mOpen) ATTR_UNLIKELY
+		{
+			mFile.open(mPath.string(), false);
+			mOpen = true;
+			mSize = mFile.size();
+		}
+
+		mFile.write(bytes);
+		mSize += bytes.size();
+	}
+
+	void RotatingFile::flush()
+	{
+		if (mOpen)
+		{
+			mFile.flush();
+		}
+	}
+
+	// MARK: Static Member Functions
+
+	ATTR_NODISCARD std::filesystem::path RotatingFile::segmentPath(const std::filesystem::path &active, const std::chrono::sys_seconds time,
+																	const unsigned sequence)
+	{
+		const std::time_t seconds{std::chrono::system_clock::to_time_t(time)};
+
+		std::filesystem::path segment{active};
+		segment.replace_filename(fmt::format("{}.{:%Y%m%dT%H%M%S}.{:03}{}", active.stem().string(), fmt::gmtime(seconds), sequence,
+											 active.extension().string()));
+
+		return segment;
+	}
+
+	ATTR_NODISCARD bool RotatingFile::isSegment(const std::filesystem::path &active, const std::filesystem::path &candidate)
+	{
+		const std::string candidateName{candidate.filename().string()};
+		const std::string stem{active.stem().string() + '.'};
+		const std::string extension{active.extension().string()};
+		std::string_view name{candidateName};
+
+		if (name.ends_with(COMPRESSED_SUFFIX))
+		{
+			name.remove_suffix(COMPRESSED_SUFFIX.size());
+		}
+
+		if (name.size() != stem.size() + SEGMENT_STAMP_SIZE + extension.size() || !name.starts_with(stem) || !name.ends_with(extension))
+		{
+			return false;
+		}
+
+		const std::string_view stamp{name.substr(stem.size(), SEGMENT_STAMP_SIZE)};
+
+		// yyyymmddTHHMMSS.nnn
+		constexpr std::size_t SEPARATOR_T{8};
+		constexpr std::size_t SEPARATOR_DOT{15};
+
+		for (std::size_t index{0}; index < stamp.size(); ++index)
+		{
+			const char expected{index == SEPARATOR_T ? 'T' : (index == SEPARATOR_DOT ? '.' : '\0')};
+			const bool valid{expected != '\0' ? stamp[index] == expected : (stamp[index] >= '0' && stamp[index] <= '9')};
+
+			if (!valid)
+			{
+				return false;
+			}
+		}
+
+		return true;
+	}
+
+	// MARK: Private Member Functions
+
+	bool RotatingFile::rotationDue(const std::size_t incoming)
+	{
+		if (mOptions.maxBytes != 0 && mSize != 0 && mSize + incoming > mOptions.maxBytes)
+		{
+			return true;
+		}
+
+		if (mOptions.interval == std::chrono::seconds::zero())
+		{
+			return false;
+		}
+
+		const std::chrono::system_clock::time_point now{std::chrono::system_clock::now()};
+
+		if (now < mNextRotation) ATTR_LIKELY
+		{
+			return false;
+		}
+
+		// An empty file has nothing to hand over; just move on to the boundary after now
+		if (mSize == 0)
+		{
+			mNextRotation = nextBoundary(now, mOptions.interval);
+			return false;
+		}
+
+		return true;
+	}
+
+	void RotatingFile::rotate()
+	{
+		const std::chrono::system_clock::time_point now{std::chrono::system_clock::now()};
+
+		mFile.close();
+		mOpen = false;
+
+		std::filesystem::path segment{};
+		std::error_code error{};
+		const std::chrono::sys_seconds second{std::chrono::floor<std::chrono::seconds>(now)};
+
+		// Pruning can free an earlier name in this second, and reusing it would sort the new segment before older ones
+		unsigned sequence{second == mSegmentSecond ? mNextSequence : 0};
+
+		do
+		{
+			segment = segmentPath(mPath, second, sequence++);
+		} while (std::filesystem::exists(segment, error) || std::filesystem::exists(std::filesystem::path{segment} += COMPRESSED_SUFFIX, error));
+
+		mSegmentSecond = second;
+		mNextSequence = sequence;
+
+		std::filesystem::rename(mPath, segment, error);
+
+		// On a failed rename the records keep going to the active file; counting from zero delays the retry by another maxBytes
+		mSize = 0;
+
+		if (mOptions.interval != std::chrono::seconds::zero())
+		{
+			mNextRotation = nextBoundary(now, mOptions.interval);
+		}
+
+		mFile.open(mPath.string(), false);
+		mOpen = true;
+
+		if (!error && mArchiver.joinable())
+		{
+			{
+				const std::scoped_lock lock(mArchiveMutex);
+				mArchiveQueue.push_back(std::move(segment));
+			}
+
+			mArchiveCondition.notify_one();
+		}
+	}
+
+	void RotatingFile::archiverLoop()
+	{
+		// Compression competes with the application for CPU; on Linux this lowers only the calling thread
+		static_cast<void>(::setpriority(PRIO_PROCESS, static_cast<id_t>(::gettid()), ARCHIVER_NICE));
+
+		std::unique_lock lock(mArchiveMutex);
+
+		while (true)
+		{
+			mArchiveCondition.wait(lock, [this]() { return mStopping || !mArchiveQueue.empty(); });
+
+			// Segments queued before destruction are still finished, so none is left uncompressed
+			if (mArchiveQueue.empty())
+			{
+				break;
+			}
+
+			const std::filesystem::path segment{std::move(mArchiveQueue.front())};
+			mArchiveQueue.pop_front();
+
+			lock.unlock();
+
+			if (mOptions.compress)
+			{
+				compress(segment);
+			}
+
+			if (mOptions.maxFiles != 0)
+			{
+				prune();
+			}
+
+			lock.lock();
+		}
+	}
+
+	void RotatingFile::prune() const
+	{
+		const std::filesystem::path directory{mPath.has_parent_path() ? mPath.parent_path() : std::filesystem::path{"."}};
+		std::vector<std::filesystem::path> segments{};
+		std::error_code error{};
+
+		for (const std::filesystem::directory_entry &entry : std::filesystem::directory_iterator{directory, error})
+		{
+			if (isSegment(mPath, entry.path()))
+			{
+				segments.push_back(entry.path());
+			}
+		}
+
+		if (segments.size() <= mOptions.maxFiles)
+		{
+			return;
+		}
+
+		// Segment names embed a fixed-width timestamp and sequence, so name order is rotation order
+		std::ranges::sort(segments, {}, [](const std::filesystem::path &segment) { return segment.filename().string(); });
+
+		for (std::size_t index{0}; index < segments.size() - mOptions.maxFiles; ++index)
+		{
+			std::filesystem::remove(segments[index], error);
+		}
+	}
+} // namespace Project::Utility::Debug::Logging
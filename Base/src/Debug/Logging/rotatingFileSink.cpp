@@ -0,0 +1,41 @@
+/*! \file rotatingFileSink.cpp
+	\brief Contains the function definitions for the synchronous rotating file sink
+	\date --/--/----
+	\version x.x.x
+	\since x.x.x
+	\author Matthew Moore
+*/
+
+#include "Utility/Debug/Logging/rotatingFileSink.h"
+
+#include <string>
+
+#include "Utility/Debug/Logging/formatBuffer.h"
+#include "Utility/Debug/Logging/loggerOptions.h"
+
+#include <spdlog/common.h>
+#include <spdlog/details/log_msg.h>
+
+namespace Project::Utility::Debug::Logging
+{
+	// MARK: Constructors & Destructor
+
+	RotatingFileSink::RotatingFileSink(const std::string &fileName, const RotationOptions &options, const FormatBufferOptions &buffers)
+		: mFile{fileName, options}, mBuffers{buffers}
+	{
+	}
+
+	// MARK: spdlog::sinks::base_sink
+
+	void RotatingFileSink::sink_it_(const spdlog::details::log_msg &msg)
+	{
+		FormatBuffer formatted{FormatBuffer::Use::Sink, mBuffers};
+		formatter_->format(msg, formatted.get());
+		mFile.write(formatted.get());
+	}
+
+	void RotatingFileSink::flush_()
+	{
+		mFile.flush();
+	}
+} // namespace Project::Utility::Debug::Logging
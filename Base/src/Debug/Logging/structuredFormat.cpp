@@ -0,0 +1,159 @@
+/*! \file structuredFormat.cpp
+	\brief Contains the function definitions for the string, header and footer encoders of structured log records
+	\date --/--/----
+	\version x.x.x
+	\since x.x.x
+	\author Matthew Moore
+*/
+
+#include "Utility/Debug/Logging/structuredFormat.h"
+
+#include <algorithm>
+#include <array>
+#include <string_view>
+
+#include "Core/attributeMacros.h"
+#include "Utility/Debug/Logging/loggerOptions.h"
+#include "Utility/Debug/Logging/timestampCache.h"
+
+#include <spdlog/common.h>
+
+namespace Project::Utility::Debug::Logging::Structured
+{
+	namespace
+	{
+		/*! @brief The first byte that needs no escaping in a JSON string. */
+		constexpr unsigned char FIRST_PRINTABLE{0x20};
+
+		/*! @brief Appends @p text to @p buffer unchanged.
+			@param[in,out] buffer Receives the bytes.
+			@param[in] text The bytes to append.
+		*/
+		void appendRaw(spdlog::memory_buf_t &buffer, const std::string_view text)
+		{
+			buffer.append(text.data(), text.data() + text.size());
+		}
+
+		/*! @brief Tests whether @p character must be escaped inside a JSON string.
+			@param[in] character The byte to test.
+			@return true for quotes, backslashes and control characters.
+		*/
+		bool needsEscape(const char character)
+		{
+			return character == '"' || character == '\\' || static_cast<unsigned char>(character) < FIRST_PRINTABLE;
+		}
+	} // namespace
+
+	void appendJsonString(spdlog::memory_buf_t &buffer, const std::string_view text)
+	{
+		constexpr std::array<char, 16> HEX_DIGITS{'0', '1', '2', '3', '4', '5', '6', '7', '8', '9', 'a', 'b', 'c', 'd', 'e', 'f'};
+
+		buffer.push_back('"');
+
+		std::string_view::const_iterator runStart{text.begin()};
+
+		// Copy runs of plain bytes in one append; only the bytes that need escaping are handled one at a time
+		for (std::string_view::const_iterator position{text.begin()}; position != text.end(); ++position)
+		{
+			const char character{*position};
+
+			if (!needsEscape(character)) ATTR_LIKELY
+			{
+				continue;
+			}
+
+			buffer.append(runStart, position);
+			runStart = position + 1;
+			buffer.push_back('\\');
+
+			switch (character)
+			{
+				case '"':
+				case '\\':
+					buffer.push_back(character);
+					break;
+				case '\n':
+					buffer.push_back('n');
+					break;
+				case '\r':
+					buffer.push_back('r');
+					break;
+				case '\t':
+					buffer.push_back('t');
+					break;
+				default:
+				{
+					const auto code{static_cast<unsigned char>(character)};
+					const std::array<char, 5> escape{'u', '0', '0', HEX_DIGITS[code >> 4U], HEX_DIGITS[code & 0x0FU]};
+					buffer.append(escape.begin(), escape.end());
+					break;
+				}
+			}
+		}
+
+		buffer.append(runStart, text.end());
+		buffer.push_back('"');
+	}
+
+	void appendLogfmtString(spdlog::memory_buf_t &buffer, const std::string_view text)
+	{
+		const bool quoted{text.empty() ||
+						  std::ranges::any_of(text, [](const char character) { return character == ' ' || character == '=' || needsEscape(character); })};
+
+		if (quoted)
+		{
+			appendJsonString(buffer, text);
+		}
+		else
+		{
+			appendRaw(buffer, text);
+		}
+	}
+
+	void appendHeader(spdlog::memory_buf_t &buffer, const RecordFormat format, const spdlog::log_clock::time_point time,
+					  const spdlog::level::level_enum level, const std::string_view loggerName, const std::string_view message)
+	{
+		if (format == RecordFormat::Text)
+		{
+			appendRaw(buffer, message);
+			return;
+		}
+
+		// Each thread reformats only the microseconds until the second changes
+		thread_local TimestampCache timestamps{};
+
+		const std::string_view timestamp{timestamps.format(time)};
+		const spdlog::string_view_t levelName{spdlog::level::to_string_view(level)};
+
+		if (format == RecordFormat::JsonLines)
+		{
+			appendRaw(buffer, R"({"ts":")");
+			appendRaw(buffer, timestamp);
+			appendRaw(buffer, R"(","level":")");
+			appendRaw(buffer, std::string_view{levelName.data(), levelName.size()});
+			appendRaw(buffer, R"(","logger":)");
+			appendJsonString(buffer, loggerName);
+			appendRaw(buffer, R"(,"msg":)");
+			appendJsonString(buffer, message);
+		}
+		else
+		{
+			appendRaw(buffer, "ts=");
+			appendRaw(buffer, timestamp);
+			appendRaw(buffer, " level=");
+			appendRaw(buffer, std::string_view{levelName.data(), levelName.size()});
+			appendRaw(buffer, " logger=");
+			appendLogfmtString(buffer, loggerName);
+			appendRaw(buffer, " msg=");
+			appendLogfmtString(buffer, message);
+		}
+	}
+
+	void appendFooter(spdlog::memory_buf_t &buffer, const RecordFormat format)
+	{
+		if (format == RecordFormat::JsonLines)
+		{
+			buffer.push_back('}');
+		}
+	}
+} // namespace Project::Utility::Debug::Logging::Structured
@@ -0,0 +1,339 @@
+/*! \file threadBufferWriter.cpp
+	\brief Contains the function definitions for the per-thread record buffers and their timestamp-merging writer thread
+	\date --/--/----
+	\version x.x.x
+	\since x.x.x
+	\author Matthew Moore
+*/
+
+#include "Utility/Debug/Logging/threadBufferWriter.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstring>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <mutex>
+#include <queue>
+#include <span>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "Core/attributeMacros.h"
+#include "Utility/Debug/Logging/loggerOptions.h"
+
+#include <spdlog/common.h>
+
+namespace Project::Utility::Debug::Logging
+{
+	namespace
+	{
+		/*! @brief Hands out a process-unique id for each ThreadBufferWriter so per-thread buffer caches can tell writers apart.
+			@return A non-zero id.
+		*/
+		ul nextWriterId() noexcept
+		{
+			static std::atomic<ul> writerId{0};
+			return writerId.fetch_add(1, std::memory_order_relaxed) + 1;
+		}
+
+		/*! @brief Reads a fixed-size value out of a drained record frame.
+			@tparam T A trivially copyable type.
+			@param[in] bytes The drained bytes.
+			@param[in] offset The offset of the value in @p bytes.
+			@return The value.
+		*/
+		template <typename T>
+		ATTR_NODISCARD T read(const std::vector<std::byte> &bytes, const std::size_t offset) noexcept
+		{
+			T value{};
+			std::memcpy(&value, bytes.data() + offset, sizeof(T));
+			return value;
+		}
+	} // namespace
+
+	// MARK: Constructors & Destructor
+
+	ThreadBufferWriter::ThreadBufferWriter(const std::string &fileName, const std::string_view header, const ul threadBufferBytes,
+										   const OverflowPolicy policy, PrepareBatch prepare, AppendRecord append,
+										   const std::chrono::milliseconds interval, const RotationOptions &rotation)
+		: mId{nextWriterId()}, mThreadBufferBytes{static_cast<std::size_t>(threadBufferBytes)}, mPolicy{policy}, mInterval{interval},
+		  mPrepare{std::move(prepare)}, mAppend{std::move(append)}, mFile{fileName, rotation}
+	{
+		if (!header.empty())
+		{
+			spdlog::memory_buf_t bytes{};
+			bytes.append(header.data(), header.data() + header.size());
+			mFile.write(bytes);
+			mFile.flush();
+		}
+
+		mWriter = std::thread{&ThreadBufferWriter::writerLoop, this};
+	}
+
+	ThreadBufferWriter::~ThreadBufferWriter()
+	{
+		mStopping.store(true, std::memory_order_release);
+		wakeWriter();
+
+		if (mWriter.joinable())
+		{
+			mWriter.join();
+		}
+
+		for (const std::shared_ptr<ThreadBuffer> &buffer : mBuffers)
+		{
+			buffer->closed.store(true, std::memory_order_relaxed);
+		}
+	}
+
+	// MARK: Getters
+
+	ATTR_NODISCARD ul ThreadBufferWriter::droppedCount() const noexcept
+	{
+		return mDropped.load(std::memory_order_relaxed);
+	}
+
+	// MARK: Utility
+
+	void ThreadBufferWriter::flush()
+	{
+		const ul ticket{mFlushRequested.fetch_add(1, std::memory_order_acq_rel) + 1};
+		ul completed{mFlushCompleted.load(std::memory_order_acquire)};
+
+		while (completed < ticket)
+		{
+			wakeWriter();
+			mFlushCompleted.wait(completed, std::memory_order_acquire);
+			completed = mFlushCompleted.load(std::memory_order_acquire);
+		}
+	}
+
+	// MARK: Private Member Functions
+
+	ThreadBufferWriter::ThreadBuffer &ThreadBufferWriter::threadBuffer()
+	{
+		/*! @struct ThreadBuffers
+			@brief The calling thread's buffers, most recently used last; marks them abandoned when the thread exits.
+		*/
+		struct ThreadBuffers
+		{
+			ThreadBuffers() = default;
+			ThreadBuffers(const ThreadBuffers &) = delete;
+			ThreadBuffers(ThreadBuffers &&) = delete;
+			ThreadBuffers &operator=(const ThreadBuffers &) = delete;
+			ThreadBuffers &operator=(ThreadBuffers &&) = delete;
+
+			~ThreadBuffers()
+			{
+				for (const std::shared_ptr<ThreadBuffer> &buffer : buffers)
+				{
+					buffer->abandoned.store(true, std::memory_order_release);
+				}
+			}
+
+			std::vector<std::shared_ptr<ThreadBuffer>> buffers{}; /*!< One entry per live writer this thread has pushed to */
+		};
+
+		thread_local ThreadBuffers local{};
+		std::vector<std::shared_ptr<ThreadBuffer>> &buffers{local.buffers};
+
+		if (!buffers.empty() && buffers.back()->writerId == mId) ATTR_LIKELY
+		{
+			return *buffers.back();
+		}
+
+		const auto found{std::ranges::find(buffers, mId, &ThreadBuffer::writerId)};
+
+		if (found != buffers.end())
+		{
+			std::rotate(found, std::next(found), buffers.end());
+			return *buffers.back();
+		}
+
+		std::erase_if(buffers, [](const std::shared_ptr<ThreadBuffer> &buffer) { return buffer->closed.load(std::memory_order_relaxed); });
+
+		std::shared_ptr<ThreadBuffer> buffer{std::make_shared<ThreadBuffer>(mId, mThreadBufferBytes)};
+
+		{
+			const std::scoped_lock lock(mBuffersMutex);
+
+			mBuffers.push_back(buffer);
+			mBuffersVersion.fetch_add(1, std::memory_order_release);
+		}
+
+		buffers.push_back(std::move(buffer));
+
+		return *buffers.back();
+	}
+
+	void ThreadBufferWriter::wakeWriter()
+	{
+		{
+			const std::scoped_lock lock(mWakeMutex);
+			++mWakeups;
+		}
+
+		mWakeCondition.notify_one();
+	}
+
+	void ThreadBufferWriter::writerLoop()
+	{
+		ul wakeups{0};
+
+		while (true)
+		{
+			const ul requested{mFlushRequested.load(std::memory_order_acquire)};
+			const bool wrote{drain()};
+
+			if (wrote || requested != mFlushCompleted.load(std::memory_order_relaxed))
+			{
+				try
+				{
+					mFile.flush();
+				}
+				catch (const spdlog::spdlog_ex &ex)
+				{
+					// The records are already handed to stdio; a failed flush is retried on the next pass
+				}
+
+				mFlushCompleted.store(requested, std::memory_order_release);
+				mFlushCompleted.notify_all();
+			}
+
+			if (mStopping.load(std::memory_order_acquire))
+			{
+				if (!wrote && buffersEmpty())
+				{
+					break;
+				}
+
+				continue;
+			}
+
+			if (requested != mFlushRequested.load(std::memory_order_acquire))
+			{
+				continue;
+			}
+
+			// Sleep until the next poll unless a producer or flush() has bumped mWakeups since the last sleep
+			std::unique_lock lock(mWakeMutex);
+			mWakeCondition.wait_for(lock, mInterval, [this, wakeups]() { return mWakeups != wakeups; });
+			wakeups = mWakeups;
+		}
+	}
+
+	bool ThreadBufferWriter::drain()
+	{
+		refreshBuffers();
+
+		mPending.resize(mWriterBuffers.size());
+
+		bool drained{false};
+
+		for (std::size_t index{0}; index < mWriterBuffers.size(); ++index)
+		{
+			Pending &pending{mPending[index]};
+			pending.bytes.clear();
+			pending.offset = 0;
+
+			drained |= mWriterBuffers[index]->ring.drain([&pending](const std::span<const std::byte> bytes) {
+				pending.bytes.insert(pending.bytes.end(), bytes.begin(), bytes.end());
+			}) != 0;
+		}
+
+		if (drained)
+		{
+			mBatch.clear();
+			mPrepare(mBatch);
+			merge();
+
+			try
+			{
+				mFile.write(mBatch);
+			}
+			catch (const spdlog::spdlog_ex &ex)
+			{
+				mDropped.fetch_add(1, std::memory_order_relaxed);
+			}
+		}
+
+		// Retire buffers of exited threads; abandoned is read before emptiness so a record pushed just before exit is never lost
+		const auto retired = [](const std::shared_ptr<ThreadBuffer> &buffer) {
+			return buffer->abandoned.load(std::memory_order_acquire) && buffer->ring.empty();
+		};
+
+		if (std::ranges::any_of(mWriterBuffers, retired))
+		{
+			const std::scoped_lock lock(mBuffersMutex);
+
+			std::erase_if(mBuffers, retired);
+			mWriterBuffers = mBuffers;
+			mWriterBuffersVersion = mBuffersVersion.fetch_add(1, std::memory_order_acq_rel) + 1;
+		}
+
+		return drained;
+	}
+
+	void ThreadBufferWriter::merge()
+	{
+		using Head = std::pair<sl, std::size_t>;
+
+		// A min-heap of each non-empty buffer's oldest unmerged record, keyed by timestamp; ties go to the lower buffer index
+		std::priority_queue<Head, std::vector<Head>, std::greater<>> heads{};
+
+		for (std::size_t index{0}; index < mPending.size(); ++index)
+		{
+			if (!mPending[index].bytes.empty())
+			{
+				heads.emplace(read<sl>(mPending[index].bytes, 0), index);
+			}
+		}
+
+		while (!heads.empty())
+		{
+			const auto [timestamp, index]{heads.top()};
+			heads.pop();
+
+			Pending &pending{mPending[index]};
+			const auto bodySize{static_cast<std::size_t>(read<ui>(pending.bytes, pending.offset + sizeof(sl)))};
+			const std::size_t body{pending.offset + FRAME_SIZE};
+
+			mAppend(mBatch, timestamp, std::span<const std::byte>{pending.bytes}.subspan(body, bodySize));
+
+			pending.offset = body + bodySize;
+
+			if (pending.offset < pending.bytes.size())
+			{
+				heads.emplace(read<sl>(pending.bytes, pending.offset), index);
+			}
+		}
+	}
+
+	bool ThreadBufferWriter::buffersEmpty()
+	{
+		refreshBuffers();
+
+		return std::ranges::all_of(mWriterBuffers, [](const std::shared_ptr<ThreadBuffer> &buffer) { return buffer->ring.empty(); });
+	}
+
+	void ThreadBufferWriter::refreshBuffers()
+	{
+		if (mBuffersVersion.load(std::memory_order_acquire) == mWriterBuffersVersion)
+		{
+			return;
+		}
+
+		const std::scoped_lock lock(mBuffersMutex);
+
+		mWriterBuffers = mBuffers;
+		mWriterBuffersVersion = mBuffersVersion.load(std::memory_order_relaxed);
+	}
+} // namespace Project::Utility::Debug::Logging
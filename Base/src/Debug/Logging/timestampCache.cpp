@@ -0,0 +1,64 @@
+/*! \file timestampCache.cpp
+	\brief Contains the function definitions for the formatter that rewrites only the changed part of a record's timestamp text
+	\date --/--/----
+	\version x.x.x
+	\since x.x.x
+	\author Matthew Moore
+*/
+
+#include "Utility/Debug/Logging/timestampCache.h"
+
+#include <chrono>
+#include <cstddef>
+#include <ctime>
+#include <string_view>
+
+#include "Core/attributeMacros.h"
+#include "Core/typedefs.h"
+
+#include <spdlog/common.h>
+#include <spdlog/fmt/chrono.h>
+#include <spdlog/fmt/fmt.h>
+
+namespace Project::Utility::Debug::Logging
+{
+	namespace
+	{
+		/*! @brief The number of characters before the microsecond digits: `YYYY-MM-DDTHH:MM:SS.`. */
+		constexpr std::size_t FRACTION_OFFSET{20};
+
+		/*! @brief The number of microsecond digits. */
+		constexpr std::size_t FRACTION_DIGITS{6};
+
+		/*! @brief The radix the digits are written in. */
+		constexpr Project::Core::sl DECIMAL{10};
+	} // namespace
+
+	// MARK: Utility
+
+	ATTR_NODISCARD std::string_view TimestampCache::format(const spdlog::log_clock::time_point time)
+	{
+		const std::chrono::system_clock::time_point second{std::chrono::floor<std::chrono::seconds>(time)};
+		const Project::Core::sl seconds{std::chrono::duration_cast<std::chrono::seconds>(second.time_since_epoch()).count()};
+
+		if (seconds != mSeconds) ATTR_UNLIKELY
+		{
+			const std::time_t wholeSeconds{std::chrono::system_clock::to_time_t(second)};
+
+			// Bounded by the fraction offset so that years past 9999 cannot run into the digits below
+			static_cast<void>(fmt::format_to_n(mText.begin(), FRACTION_OFFSET, "{:%Y-%m-%dT%H:%M:%S}.", fmt::gmtime(wholeSeconds)));
+			mText.back() = 'Z';
+			mSeconds = seconds;
+		}
+
+		Project::Core::sl microseconds{std::chrono::duration_cast<std::chrono::microseconds>(time - second).count()};
+
+		for (std::size_t digit{FRACTION_OFFSET + FRACTION_DIGITS}; digit > FRACTION_OFFSET; --digit)
+		{
+			mText[digit - 1] = static_cast<char>('0' + (microseconds % DECIMAL));
+			microseconds /= DECIMAL;
+		}
+
+		return std::string_view{mText.data(), mText.size()};
+	}
+} // namespace Project::Utility::Debug::Logging
@@ -0,0 +1,151 @@
+/*! \file tscClock.cpp
+	\brief Contains the function definitions for the clock that stamps log records from the CPU's time-stamp counter
+	\date --/--/----
+	\version x.x.x
+	\since x.x.x
+	\author Matthew Moore
+*/
+
+#include "Utility/Debug/Logging/tscClock.h"
+
+#include <chrono>
+#include <thread>
+
+#include "Core/attributeMacros.h"
+#include "Core/typedefs.h"
+#include "Utility/Debug/Logging/constants.h"
+
+#include <spdlog/common.h>
+
+#if defined(__x86_64__) || defined(__i386__)
+	#include <cpuid.h>
+	#include <x86intrin.h>
+#endif
+
+namespace Project::Utility::Debug::Logging
+{
+	namespace
+	{
+		/*! @brief The extended CPUID leaf that reports advanced power management features. */
+		constexpr unsigned POWER_MANAGEMENT_LEAF{0x8000'0007};
+
+		/*! @brief The bit of that leaf's EDX that reports an invariant time-stamp counter. */
+		constexpr unsigned INVARIANT_TSC_BIT{1U << 8U};
+
+		/*! @brief Tests whether the CPU reports an invariant time-stamp counter.
+			@return false on CPUs without the feature and on every non-x86 build.
+		*/
+		bool invariantCounter() noexcept
+		{
+#if defined(__x86_64__) || defined(__i386__)
+			unsigned eax{0};
+			unsigned ebx{0};
+			unsigned ecx{0};
+			unsigned edx{0};
+
+			return __get_cpuid(POWER_MANAGEMENT_LEAF, &eax, &ebx, &ecx, &edx) != 0 && (edx & INVARIANT_TSC_BIT) != 0;
+#else
+			return false;
+#endif
+		}
+
+		/*! @brief Reads the time-stamp counter.
+			@return The counter, or 0 on non-x86 builds, where it is never called.
+		*/
+		Project::Core::ul readCounter() noexcept
+		{
+#if defined(__x86_64__) || defined(__i386__)
+			return __rdtsc();
+#else
+			return 0;
+#endif
+		}
+
+		/*! @brief Reads the system clock in nanoseconds since its epoch.
+			@return The current system time.
+		*/
+		Project::Core::sl systemNanoseconds() noexcept
+		{
+			return std::chrono::duration_cast<std::chrono::nanoseconds>(spdlog::log_clock::now().time_since_epoch()).count();
+		}
+	} // namespace
+
+	// MARK: Static Member Functions
+
+	ATTR_NODISCARD bool TscClock::available() noexcept
+	{
+		return getCalibration().invariant;
+	}
+
+	ATTR_NODISCARD spdlog::log_clock::time_point TscClock::now() noexcept
+	{
+		const Calibration &calibration{getCalibration()};
+
+		if (!calibration.invariant) ATTR_UNLIKELY
+		{
+			return spdlog::log_clock::now();
+		}
+
+		/*! @brief A counter reading paired with the system time it was taken at. */
+		struct Anchor
+		{
+			Project::Core::ul ticks{0};			/*!< The counter */
+			Project::Core::sl nanoseconds{0};	/*!< The system time */
+		};
+
+		thread_local Anchor anchor{};
+
+		const Project::Core::ul ticks{readCounter()};
+		Project::Core::sl nanoseconds{0};
+
+		// A reading behind the anchor wraps to a huge difference, so it renews the anchor as well
+		if (ticks - anchor.ticks >= calibration.reanchorTicks) ATTR_UNLIKELY
+		{
+			anchor = Anchor{.ticks = ticks, .nanoseconds = systemNanoseconds()};
+			nanoseconds = anchor.nanoseconds;
+		}
+		else
+		{
+			nanoseconds = anchor.nanoseconds + static_cast<Project::Core::sl>(((ticks - anchor.ticks) * calibration.multiplier) >> SHIFT);
+		}
+
+		return spdlog::log_clock::time_point{std::chrono::duration_cast<spdlog::log_clock::duration>(std::chrono::nanoseconds{nanoseconds})};
+	}
+
+	// MARK: Private Static Member Functions
+
+	ATTR_NODISCARD const TscClock::Calibration &TscClock::getCalibration() noexcept
+	{
+		static const Calibration calibration{[]() noexcept {
+			if (!invariantCounter())
+			{
+				return Calibration{};
+			}
+
+			const std::chrono::steady_clock::time_point startTime{std::chrono::steady_clock::now()};
+			const Project::Core::ul startTicks{readCounter()};
+
+			std::this_thread::sleep_for(LOGGING_TSC_CALIBRATION);
+
+			const std::chrono::steady_clock::time_point endTime{std::chrono::steady_clock::now()};
+			const Project::Core::ul endTicks{readCounter()};
+
+			const auto elapsed{std::chrono::duration_cast<std::chrono::duration<double, std::nano>>(endTime - startTime).count()};
+
+			// A counter that did not advance cannot be calibrated; fall back rather than divide by zero
+			if (endTicks <= startTicks || elapsed <= 0.0)
+			{
+				return Calibration{};
+			}
+
+			const double nanosecondsPerTick{elapsed / static_cast<double>(endTicks - startTicks)};
+			const double interval{std::chrono::duration_cast<std::chrono::duration<double, std::nano>>(LOGGING_TSC_REANCHOR_INTERVAL).count()};
+
+			return Calibration{.invariant = true,
+							   .multiplier = static_cast<Project::Core::ul>(nanosecondsPerTick * static_cast<double>(1ULL << SHIFT)),
+							   .reanchorTicks = static_cast<Project::Core::ul>(interval / nanosecondsPerTick)};
+		}()};
+
+		return calibration;
+	}
+} // namespace Project::Utility::Debug::Logging
@@ -0,0 +1,485 @@
+/*! \file uringFile.cpp
+	\brief Contains the function definitions for the io_uring log file
+	\date --/--/----
+	\version x.x.x
+	\since x.x.x
+	\author Matthew Moore
+*/
+
+#include "Utility/Debug/Logging/uringFile.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <fcntl.h>
+#include <linux/io_uring.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/syscall.h>
+#include <sys/types.h>
+#include <sys/uio.h>
+#include <unistd.h>
+
+#include "Core/attributeMacros.h"
+#include "Utility/Debug/Logging/loggerOptions.h"
+
+#include <spdlog/common.h>
+
+namespace Project::Utility::Debug::Logging
+{
+	namespace
+	{
+		/*! @brief The most submission queue entries the kernel accepts for one ring. */
+		constexpr ul MAX_ENTRIES{32'768};
+
+		/*! @brief Points @p offset bytes into a ring mapping.
+			@tparam T The type stored at the offset.
+			@param[in] base The start of the mapping.
+			@param[in] offset The offset the kernel reported for the field.
+			@return The field's address.
+		*/
+		template <typename T>
+		T *at(void *base, const ui offset) noexcept
+		{
+			return reinterpret_cast<T *>(static_cast<std::byte *>(base) + offset); // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+		}
+
+		/*! @brief Maps one of the ring's regions.
+			@param[in] ring The ring's file descriptor.
+			@param[in] size The length of the region.
+			@param[in] offset Which region, one of the IORING_OFF_* values.
+			@return The mapping, or nullptr on failure.
+		*/
+		void *mapRing(const int ring, const std::size_t size, const off_t offset) noexcept
+		{
+			void *mapping{::mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, ring, offset)}; // NOLINT(hicpp-signed-bitwise)
+			return mapping == MAP_FAILED ? nullptr : mapping; // NOLINT(cppcoreguidelines-pro-type-cstyle-cast)
+		}
+
+		/*! @brief Calls io_uring_enter, retrying when interrupted.
+			@param[in] ring The ring's file descriptor.
+			@param[in] submit The number of new submission queue entries.
+			@param[in] wait The number of completions to wait for.
+			@return The number of entries the kernel took, or -1 with errno set.
+		*/
+		long enterRing(const int ring, const ui submit, const ui wait) noexcept
+		{
+			const ui flags{wait != 0 ? IORING_ENTER_GETEVENTS : 0U};
+			long result{0};
+
+			do
+			{
+				result = ::syscall(__NR_io_uring_enter, ring, submit, wait, flags, nullptr, 0); // NOLINT(cppcoreguidelines-pro-type-vararg)
+			} while (result < 0 && errno == EINTR);
+
+			return result;
+		}
+	} // namespace
+
+	// MARK: Constructors & Destructor
+
+	UringFile::UringFile(const std::string &fileName, const UringOptions &options)
+		: mFileName{fileName}, mBatchBytes{static_cast<std::size_t>(options.batchBytes)}
+	{
+		mFile = ::open(mFileName.c_str(), O_WRONLY | O_CREAT | O_CLOEXEC, S_IRUSR | S_IWUSR | S_IRGRP | S_IROTH); // NOLINT(hicpp-signed-bitwise)
+
+		if (mFile < 0)
+		{
+			spdlog::throw_spdlog_ex("Failed opening file " + mFileName + " for writing", errno);
+		}
+
+		struct stat status{};
+
+		if (::fstat(mFile, &status) != 0)
+		{
+			const int error{errno};
+			::close(mFile);
+			spdlog::throw_spdlog_ex("Failed to get the size of " + mFileName, error);
+		}
+
+		mOffset = static_cast<ul>(status.st_size);
+
+		// Without a ring one buffer is enough: it is written out synchronously every time it fills
+		const std::size_t count{static_cast<std::size_t>(std::clamp<ul>(options.queueDepth, 1, MAX_ENTRIES))};
+
+		try
+		{
+			mStorage = std::make_unique<std::byte[]>(count * mBatchBytes);
+			mBuffers.resize(count);
+			mFree.reserve(count);
+			mReady.reserve(count);
+		}
+		catch (...)
+		{
+			::close(mFile);
+			throw;
+		}
+
+		for (std::size_t index{count}; index-- > 0;)
+		{
+			mBuffers[index].data = mStorage.get() + (index * mBatchBytes);
+			mFree.push_back(index);
+		}
+
+		mCurrent = mBuffers.size();
+
+		if (options.queueDepth != 0)
+		{
+			setupRing(static_cast<ui>(count));
+		}
+	}
+
+	UringFile::~UringFile()
+	{
+		flush();
+		teardownRing();
+		::close(mFile);
+	}
+
+	// MARK: Getters
+
+	ATTR_NODISCARD ATTR_PURE bool UringFile::usingUring() const noexcept
+	{
+		return mRing.usable;
+	}
+
+	ATTR_NODISCARD ul UringFile::lostRecords() const noexcept
+	{
+		return mLost.load(std::memory_order_relaxed);
+	}
+
+	// MARK: Utility
+
+	void UringFile::write(const spdlog::memory_buf_t &bytes) noexcept
+	{
+		const std::size_t size{bytes.size()};
+
+		if (size > mBatchBytes) ATTR_UNLIKELY
+		{
+			// Everything buffered so far sits earlier in the file, so it must be on its way before this record takes the next offset
+			seal();
+			submit();
+
+			if (!writeAt(reinterpret_cast<const std::byte *>(bytes.data()), size, mOffset)) // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+			{
+				mLost.fetch_add(1, std::memory_order_relaxed);
+			}
+
+			mOffset += size;
+			return;
+		}
+
+		if (mCurrent == mBuffers.size() || mBuffers[mCurrent].size + size > mBatchBytes)
+		{
+			seal();
+			mCurrent = acquire();
+		}
+
+		Buffer &buffer{mBuffers[mCurrent]};
+		std::memcpy(buffer.data + buffer.size, bytes.data(), size);
+		buffer.size += size;
+		++buffer.records;
+		mOffset += size;
+	}
+
+	void UringFile::flush() noexcept
+	{
+		seal();
+		submit();
+
+		while (mInFlight != 0)
+		{
+			reap(true);
+		}
+	}
+
+	// MARK: Private Member Functions
+
+	void UringFile::setupRing(const ui depth)
+	{
+		io_uring_params params{};
+		const long ring{::syscall(__NR_io_uring_setup, depth, &params)}; // NOLINT(cppcoreguidelines-pro-type-vararg)
+
+		if (ring < 0)
+		{
+			return;
+		}
+
+		mRing.fd = static_cast<int>(ring);
+
+		const std::size_t submissionSize{params.sq_off.array + (params.sq_entries * sizeof(ui))};
+		const std::size_t completionSize{params.cq_off.cqes + (params.cq_entries * sizeof(io_uring_cqe))};
+		const bool shared{(params.features & IORING_FEAT_SINGLE_MMAP) != 0};
+
+		mRing.ringsSize = shared ? std::max(submissionSize, completionSize) : submissionSize;
+		mRing.rings = mapRing(mRing.fd, mRing.ringsSize, IORING_OFF_SQ_RING);
+
+		if (!shared && mRing.rings != nullptr)
+		{
+			mRing.completionsSize = completionSize;
+			mRing.completions = mapRing(mRing.fd, mRing.completionsSize, IORING_OFF_CQ_RING);
+		}
+
+		mRing.entriesSize = params.sq_entries * sizeof(io_uring_sqe);
+		mRing.entries = mRing.rings != nullptr ? mapRing(mRing.fd, mRing.entriesSize, IORING_OFF_SQES) : nullptr;
+
+		if (mRing.rings == nullptr || mRing.entries == nullptr || (!shared && mRing.completions == nullptr))
+		{
+			teardownRing();
+			return;
+		}
+
+		void *completions{shared ? mRing.rings : mRing.completions};
+
+		mRing.sqTail = at<ui>(mRing.rings, params.sq_off.tail);
+		mRing.sqMask = *at<ui>(mRing.rings, params.sq_off.ring_mask);
+		mRing.sqArray = at<ui>(mRing.rings, params.sq_off.array);
+		mRing.cqHead = at<ui>(completions, params.cq_off.head);
+		mRing.cqTail = at<ui>(completions, params.cq_off.tail);
+		mRing.cqMask = *at<ui>(completions, params.cq_off.ring_mask);
+		mRing.cqes = at<io_uring_cqe>(completions, params.cq_off.cqes);
+
+		// Registration pins the buffers once; if it is refused (e.g. by RLIMIT_MEMLOCK) plain writes still go through the ring
+		std::vector<iovec> vectors(mBuffers.size());
+
+		for (std::size_t index{0}; index < mBuffers.size(); ++index)
+		{
+			vectors[index] = iovec{.iov_base = mBuffers[index].data, .iov_len = mBatchBytes};
+		}
+
+		mRing.fixed = ::syscall(__NR_io_uring_register, mRing.fd, IORING_REGISTER_BUFFERS, vectors.data(), // NOLINT(cppcoreguidelines-pro-type-vararg)
+								static_cast<ui>(vectors.size())) == 0;
+		mRing.usable = true;
+	}
+
+	void UringFile::teardownRing() noexcept
+	{
+		if (mRing.fd < 0)
+		{
+			return;
+		}
+
+		if (mRing.entries != nullptr)
+		{
+			::munmap(mRing.entries, mRing.entriesSize);
+		}
+
+		if (mRing.completions != nullptr)
+		{
+			::munmap(mRing.completions, mRing.completionsSize);
+		}
+
+		if (mRing.rings != nullptr)
+		{
+			::munmap(mRing.rings, mRing.ringsSize);
+		}
+
+		::close(mRing.fd);
+		mRing = Ring{};
+	}
+
+	void UringFile::abandonRing(const std::size_t rejected) noexcept
+	{
+		// The kernel only reads the tail inside io_uring_enter, so entries it did not take can simply be withdrawn
+		std::atomic_ref<ui> tail{*mRing.sqTail};
+		tail.store(tail.load(std::memory_order_relaxed) - static_cast<ui>(rejected), std::memory_order_release);
+
+		mInFlight -= rejected;
+		mRing.usable = false;
+
+		for (std::size_t index{mReady.size() - rejected}; index < mReady.size(); ++index)
+		{
+			complete(mReady[index], -ECANCELED);
+		}
+	}
+
+	std::size_t UringFile::acquire() noexcept
+	{
+		reap(false);
+
+		// Submitting as soon as the kernel runs out of work keeps it busy; while it is busy, filled buffers gather into longer chains
+		if (mInFlight == 0 || mFree.empty())
+		{
+			submit();
+		}
+
+		while (mFree.empty())
+		{
+			reap(true);
+		}
+
+		const std::size_t index{mFree.back()};
+		mFree.pop_back();
+		mBuffers[index].offset = mOffset;
+
+		return index;
+	}
+
+	void UringFile::seal() noexcept
+	{
+		if (mCurrent == mBuffers.size())
+		{
+			return;
+		}
+
+		if (mBuffers[mCurrent].size != 0)
+		{
+			mReady.push_back(mCurrent);
+		}
+		else
+		{
+			mFree.push_back(mCurrent);
+		}
+
+		mCurrent = mBuffers.size();
+	}
+
+	void UringFile::submit() noexcept
+	{
+		if (mReady.empty())
+		{
+			return;
+		}
+
+		if (!mRing.usable)
+		{
+			for (const std::size_t index : mReady)
+			{
+				complete(index, 0);
+			}
+
+			mReady.clear();
+			return;
+		}
+
+		std::atomic_ref<ui> tail{*mRing.sqTail};
+		ui position{tail.load(std::memory_order_relaxed)};
+		auto *entries{static_cast<io_uring_sqe *>(mRing.entries)};
+
+		for (std::size_t link{0}; link < mReady.size(); ++link, ++position)
+		{
+			const std::size_t index{mReady[link]};
+			const Buffer &buffer{mBuffers[index]};
+			const ui slot{position & mRing.sqMask};
+			io_uring_sqe &entry{entries[slot]};
+
+			std::memset(&entry, 0, sizeof(entry));
+			entry.opcode = mRing.fixed ? IORING_OP_WRITE_FIXED : IORING_OP_WRITE;
+			entry.fd = mFile;
+			entry.off = buffer.offset;
+			entry.addr = reinterpret_cast<std::uintptr_t>(buffer.data); // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+			entry.len = static_cast<ui>(buffer.size);
+			entry.buf_index = mRing.fixed ? static_cast<std::uint16_t>(index) : 0;
+			entry.user_data = index;
+
+			// Linking the chain lets one system call carry every batch; a short write cancels the rest, which complete() finishes
+			if (link + 1 < mReady.size())
+			{
+				entry.flags = IOSQE_IO_LINK;
+			}
+
+			mRing.sqArray[slot] = slot;
+		}
+
+		tail.store(position, std::memory_order_release);
+		mInFlight += mReady.size();
+
+		std::size_t taken{0};
+
+		while (taken < mReady.size())
+		{
+			const long result{enterRing(mRing.fd, static_cast<ui>(mReady.size() - taken), 0)};
+
+			if (result <= 0) ATTR_UNLIKELY
+			{
+				abandonRing(mReady.size() - taken);
+				break;
+			}
+
+			taken += static_cast<std::size_t>(result);
+		}
+
+		mReady.clear();
+	}
+
+	void UringFile::reap(const bool wait) noexcept
+	{
+		if (mRing.fd < 0 || mInFlight == 0)
+		{
+			return;
+		}
+
+		std::atomic_ref<ui> head{*mRing.cqHead};
+		std::atomic_ref<ui> tail{*mRing.cqTail};
+		ui position{head.load(std::memory_order_relaxed)};
+
+		if (wait && position == tail.load(std::memory_order_acquire))
+		{
+			// A failed wait is retried by the caller's loop; completions still arrive without it
+			static_cast<void>(enterRing(mRing.fd, 0, 1));
+		}
+
+		const ui end{tail.load(std::memory_order_acquire)};
+		const auto *completions{static_cast<const io_uring_cqe *>(mRing.cqes)};
+
+		for (; position != end; ++position)
+		{
+			const io_uring_cqe &completion{completions[position & mRing.cqMask]};
+			complete(static_cast<std::size_t>(completion.user_data), completion.res);
+			--mInFlight;
+		}
+
+		head.store(position, std::memory_order_release);
+	}
+
+	void UringFile::complete(const std::size_t index, const int result) noexcept
+	{
+		Buffer &buffer{mBuffers[index]};
+		const std::size_t written{result > 0 ? std::min(static_cast<std::size_t>(result), buffer.size) : 0};
+
+		if (written < buffer.size && !writeAt(buffer.data + written, buffer.size - written, buffer.offset + written))
+		{
+			mLost.fetch_add(buffer.records, std::memory_order_relaxed);
+		}
+
+		buffer.size = 0;
+		buffer.records = 0;
+		mFree.push_back(index);
+	}
+
+	ATTR_NODISCARD bool UringFile::writeAt(const std::byte *data, std::size_t size, ul offset) const noexcept
+	{
+		while (size != 0)
+		{
+			const ssize_t written{::pwrite(mFile, data, size, static_cast<off_t>(offset))};
+
+			if (written < 0)
+			{
+				if (errno == EINTR)
+				{
+					continue;
+				}
+
+				return false;
+			}
+
+			if (written == 0) ATTR_UNLIKELY
+			{
+				return false;
+			}
+
+			data += written;
+			size -= static_cast<std::size_t>(written);
+			offset += static_cast<ul>(written);
+		}
+
+		return true;
+	}
+} // namespace Project::Utility::Debug::Logging
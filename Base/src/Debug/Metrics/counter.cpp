@@ -0,0 +1,38 @@
+/*! \file counter.cpp
+	\brief Contains the function definitions for the monotonically increasing metric whose increments are spread over per-CPU shards
+	\date --/--/----
+	\version x.x.x
+	\since x.x.x
+	\author Matthew Moore
+*/
+
+#include "Utility/Debug/Metrics/counter.h"
+
+#include <atomic>
+#include <memory>
+
+#include "Core/attributeMacros.h"
+#include "Utility/Debug/Metrics/shards.h"
+
+namespace Project::Utility::Debug::Metrics
+{
+	// MARK: Constructors & Destructor
+
+	Counter::Counter() : mMask{Shards::count() - 1}, mSlots{std::make_unique<Slot[]>(Shards::count())}
+	{
+	}
+
+	// MARK: Getters
+
+	ATTR_NODISCARD ul Counter::value() const noexcept
+	{
+		ul total{0};
+
+		for (ul shard{0}; shard <= mMask; ++shard)
+		{
+			total += mSlots[shard].value.load(std::memory_order_relaxed);
+		}
+
+		return total;
+	}
+} // namespace Project::Utility::Debug::Metrics
@@ -0,0 +1,75 @@
+/*! \file histogram.cpp
+	\brief Contains the function definitions for the log-linear histogram metric whose buckets are spread over per-CPU shards
+	\date --/--/----
+	\version x.x.x
+	\since x.x.x
+	\author Matthew Moore
+*/
+
+#include "Utility/Debug/Metrics/histogram.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <memory>
+
+#include "Core/attributeMacros.h"
+#include "Utility/Debug/Metrics/shards.h"
+
+namespace Project::Utility::Debug::Metrics
+{
+	// MARK: Constructors & Destructor
+
+	Histogram::Histogram() : mMask{Shards::count() - 1}, mShards{std::make_unique<Shard[]>(Shards::count())}
+	{
+	}
+
+	// MARK: Getters
+
+	ATTR_NODISCARD Histogram::Snapshot Histogram::snapshot() const noexcept
+	{
+		Snapshot total{};
+
+		for (ul shard{0}; shard <= mMask; ++shard)
+		{
+			for (ul bucket{0}; bucket < BUCKETS; ++bucket)
+			{
+				total.buckets[bucket] += mShards[shard].buckets[bucket].load(std::memory_order_relaxed);
+			}
+
+			total.sum += mShards[shard].sum.load(std::memory_order_relaxed);
+		}
+
+		for (const ul recorded : total.buckets)
+		{
+			total.count += recorded;
+		}
+
+		return total;
+	}
+
+	ATTR_NODISCARD ATTR_PURE ul Histogram::Snapshot::quantile(const double quantile) const noexcept
+	{
+		if (count == 0)
+		{
+			return 0;
+		}
+
+		// The rank of the value sought, counting from 1, so quantile 0 finds the smallest value and quantile 1 the largest
+		const double clamped{std::clamp(quantile, 0.0, 1.0)};
+		const ul rank{std::max(ul{1}, static_cast<ul>(std::ceil(clamped * static_cast<double>(count))))};
+		ul seen{0};
+
+		for (ul bucket{0}; bucket < BUCKETS; ++bucket)
+		{
+			seen += buckets[bucket];
+
+			if (seen >= rank)
+			{
+				return bucketUpperBound(bucket);
+			}
+		}
+
+		return bucketUpperBound(BUCKETS - 1);
+	}
+} // namespace Project::Utility::Debug::Metrics
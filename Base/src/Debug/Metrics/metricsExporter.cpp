@@ -0,0 +1,287 @@
+/*! \file metricsExporter.cpp
+	\brief Contains the function definitions for the background writer that periodically exports a metrics registry to a file
+	\date --/--/----
+	\version x.x.x
+	\since x.x.x
+	\author Matthew Moore
+*/
+
+#include "Utility/Debug/Metrics/metricsExporter.h"
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <exception>
+#include <filesystem>
+#include <iterator>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <thread>
+#include <utility>
+
+#include "Core/attributeMacros.h"
+#include "Utility/Debug/Logging/formatBuffer.h"
+#include "Utility/Debug/Logging/loggerOptions.h"
+#include "Utility/Debug/Logging/rotatingFile.h"
+#include "Utility/Debug/Logging/timestampCache.h"
+#include "Utility/Debug/Metrics/histogram.h"
+#include "Utility/Debug/Metrics/metricsOptions.h"
+#include "Utility/Debug/Metrics/registry.h"
+
+#include <spdlog/common.h>
+#include <spdlog/details/file_helper.h>
+#include <spdlog/fmt/fmt.h>
+
+namespace Project::Utility::Debug::Metrics
+{
+	namespace
+	{
+		/*! @brief The quantiles each histogram reports in a JSON snapshot, with their keys. */
+		constexpr std::array<std::pair<std::string_view, double>, 4> JSON_QUANTILES{
+			{{"p50", 0.5}, {"p90", 0.9}, {"p99", 0.99}, {"p999", 0.999}}};
+
+		/*! @brief Appends a `# HELP` and a `# TYPE` line for one metric.
+			@param[out] buffer Receives the lines.
+			@param[in] name The metric's name.
+			@param[in] help The metric's description; no HELP line is written when it is empty.
+			@param[in] type The Prometheus metric type.
+		*/
+		void appendPrometheusHeader(spdlog::memory_buf_t &buffer, const std::string_view name, const std::string_view help,
+									const std::string_view type)
+		{
+			if (!help.empty())
+			{
+				fmt::format_to(std::back_inserter(buffer), "# HELP {} ", name);
+
+				// The exposition format escapes only backslashes and line feeds in help text
+				for (const char character : help)
+				{
+					if (character == '\\')
+					{
+						buffer.append(std::string_view{R"(\\)"});
+					}
+					else if (character == '\n')
+					{
+						buffer.append(std::string_view{R"(\n)"});
+					}
+					else
+					{
+						buffer.push_back(character);
+					}
+				}
+
+				buffer.push_back('\n');
+			}
+
+			fmt::format_to(std::back_inserter(buffer), "# TYPE {} {}\n", name, type);
+		}
+	} // namespace
+
+	// MARK: Constructors & Destructor
+
+	MetricsExporter::MetricsExporter(const Registry &registry, std::string fileName, const ExportOptions &options)
+		: mRegistry{registry}, mFileName{std::move(fileName)}, mOptions{options}
+	{
+		if (mOptions.format == ExportFormat::JsonLines)
+		{
+			mFile = std::make_unique<Logging::RotatingFile>(mFileName, mOptions.rotation);
+		}
+
+		if (mOptions.interval != std::chrono::milliseconds::zero())
+		{
+			mExporter = std::thread{&MetricsExporter::exporterLoop, this};
+		}
+	}
+
+	MetricsExporter::~MetricsExporter()
+	{
+		{
+			const std::scoped_lock lock(mStopMutex);
+			mStopping = true;
+		}
+
+		mStopCondition.notify_all();
+
+		if (mExporter.joinable())
+		{
+			mExporter.join();
+		}
+
+		static_cast<void>(exportNow());
+	}
+
+	// MARK: Getters
+
+	ATTR_NODISCARD ul MetricsExporter::getFailedExports() const noexcept
+	{
+		return mFailedExports.load(std::memory_order_relaxed);
+	}
+
+	// MARK: Utility
+
+	bool MetricsExporter::exportNow()
+	{
+		const std::scoped_lock lock(mExportMutex);
+
+		// Runs from the destructor and the exporter thread, so nothing may escape; the snapshot and the buffer can throw std::bad_alloc
+		try
+		{
+			const Registry::Snapshot snapshot{mRegistry.snapshot()};
+			Logging::FormatBuffer rendered{Logging::FormatBuffer::Use::Record, Logging::FormatBufferOptions{}};
+
+			if (mOptions.format == ExportFormat::JsonLines)
+			{
+				renderJson(snapshot, spdlog::log_clock::now(), rendered.get());
+				mFile->write(rendered.get());
+				mFile->flush();
+			}
+			else
+			{
+				renderPrometheus(snapshot, rendered.get());
+				replaceFile(rendered.get());
+			}
+		}
+		catch (const std::exception &)
+		{
+			mFailedExports.fetch_add(1, std::memory_order_relaxed);
+			return false;
+		}
+
+		return true;
+	}
+
+	// MARK: Static Member Functions
+
+	void MetricsExporter::renderPrometheus(const Registry::Snapshot &snapshot, spdlog::memory_buf_t &buffer)
+	{
+		for (const Registry::Value<ul> &counter : snapshot.counters)
+		{
+			appendPrometheusHeader(buffer, counter.name, counter.help, "counter");
+			fmt::format_to(std::back_inserter(buffer), "{} {}\n", counter.name, counter.value);
+		}
+
+		for (const Registry::Value<sl> &gauge : snapshot.gauges)
+		{
+			appendPrometheusHeader(buffer, gauge.name, gauge.help, "gauge");
+			fmt::format_to(std::back_inserter(buffer), "{} {}\n", gauge.name, gauge.value);
+		}
+
+		for (const Registry::Distribution &distribution : snapshot.histograms)
+		{
+			const Histogram::Snapshot &histogram{distribution.histogram};
+			ul cumulative{0};
+
+			appendPrometheusHeader(buffer, distribution.name, distribution.help, "histogram");
+
+			// Prometheus buckets are cumulative, so an empty bucket repeats its predecessor and adds nothing
+			for (ul bucket{0}; bucket < Histogram::BUCKETS; ++bucket)
+			{
+				if (histogram.buckets[bucket] == 0)
+				{
+					continue;
+				}
+
+				cumulative += histogram.buckets[bucket];
+				fmt::format_to(std::back_inserter(buffer), "{}_bucket{{le=\"{}\"}} {}\n", distribution.name, Histogram::bucketUpperBound(bucket),
+							   cumulative);
+			}
+
+			fmt::format_to(std::back_inserter(buffer), "{0}_bucket{{le=\"+Inf\"}} {1}\n{0}_sum {2}\n{0}_count {1}\n", distribution.name,
+						   histogram.count, histogram.sum);
+		}
+	}
+
+	void MetricsExporter::renderJson(const Registry::Snapshot &snapshot, const spdlog::log_clock::time_point time, spdlog::memory_buf_t &buffer)
+	{
+		Logging::TimestampCache timestamps{};
+
+		// Registered names are restricted to characters that need no escaping in JSON
+		fmt::format_to(std::back_inserter(buffer), R"({{"ts":"{}","counters":{{)", timestamps.format(time));
+
+		for (std::size_t i{0}; i < snapshot.counters.size(); ++i)
+		{
+			fmt::format_to(std::back_inserter(buffer), R"({}"{}":{})", i == 0 ? "" : ",", snapshot.counters[i].name, snapshot.counters[i].value);
+		}
+
+		buffer.append(std::string_view{R"(},"gauges":{)"});
+
+		for (std::size_t i{0}; i < snapshot.gauges.size(); ++i)
+		{
+			fmt::format_to(std::back_inserter(buffer), R"({}"{}":{})", i == 0 ? "" : ",", snapshot.gauges[i].name, snapshot.gauges[i].value);
+		}
+
+		buffer.append(std::string_view{R"(},"histograms":{)"});
+
+		for (std::size_t i{0}; i < snapshot.histograms.size(); ++i)
+		{
+			const Histogram::Snapshot &histogram{snapshot.histograms[i].histogram};
+
+			fmt::format_to(std::back_inserter(buffer), R"({}"{}":{{"count":{},"sum":{})", i == 0 ? "" : ",", snapshot.histograms[i].name,
+						   histogram.count, histogram.sum);
+
+			for (const auto &[key, quantile] : JSON_QUANTILES)
+			{
+				fmt::format_to(std::back_inserter(buffer), R"(,"{}":{})", key, histogram.quantile(quantile));
+			}
+
+			// Each bucket is [upper bound, values in it]; unlike Prometheus buckets they are not cumulative
+			buffer.append(std::string_view{R"(,"buckets":[)"});
+			bool first{true};
+
+			for (ul bucket{0}; bucket < Histogram::BUCKETS; ++bucket)
+			{
+				if (histogram.buckets[bucket] == 0)
+				{
+					continue;
+				}
+
+				fmt::format_to(std::back_inserter(buffer), "{}[{},{}]", first ? "" : ",", Histogram::bucketUpperBound(bucket),
+							   histogram.buckets[bucket]);
+				first = false;
+			}
+
+			buffer.append(std::string_view{"]}"});
+		}
+
+		buffer.append(std::string_view{"}}\n"});
+	}
+
+	// MARK: Private Member Functions
+
+	void MetricsExporter::exporterLoop()
+	{
+		std::unique_lock lock(mStopMutex);
+
+		while (!mStopCondition.wait_for(lock, mOptions.interval, [this] { return mStopping; }))
+		{
+			lock.unlock();
+			static_cast<void>(exportNow());
+			lock.lock();
+		}
+	}
+
+	void MetricsExporter::replaceFile(const spdlog::memory_buf_t &bytes) const
+	{
+		const std::string temporary{mFileName + ".tmp"};
+
+		{
+			spdlog::details::file_helper file{};
+			file.open(temporary, true);
+			file.write(bytes);
+			file.flush();
+		}
+
+		std::error_code error{};
+		std::filesystem::rename(temporary, mFileName, error);
+
+		if (error)
+		{
+			spdlog::throw_spdlog_ex("Failed renaming " + temporary + " to " + mFileName, error.value());
+		}
+	}
+} // namespace Project::Utility::Debug::Metrics
@@ -0,0 +1,122 @@
+/*! \file registry.cpp
+	\brief Contains the function definitions for the named collection of counters, gauges and histograms that the metrics exporter snapshots
+	\date --/--/----
+	\version x.x.x
+	\since x.x.x
+	\author Matthew Moore
+*/
+
+#include "Utility/Debug/Metrics/registry.h"
+
+#include <algorithm>
+#include <deque>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+
+#include "Core/attributeMacros.h"
+
+namespace Project::Utility::Debug::Metrics
+{
+	// MARK: Constructors & Destructor
+
+	Registry::Registry() = default;
+
+	Registry::~Registry() = default;
+
+	Registry::Snapshot::~Snapshot() = default;
+
+	// MARK: Getters
+
+	ATTR_NODISCARD Counter &Registry::counter(const std::string_view name, const std::string_view help)
+	{
+		return findOrCreate(mCounters, name, help);
+	}
+
+	ATTR_NODISCARD Gauge &Registry::gauge(const std::string_view name, const std::string_view help)
+	{
+		return findOrCreate(mGauges, name, help);
+	}
+
+	ATTR_NODISCARD Histogram &Registry::histogram(const std::string_view name, const std::string_view help)
+	{
+		return findOrCreate(mHistograms, name, help);
+	}
+
+	ATTR_NODISCARD Registry::Snapshot Registry::snapshot() const
+	{
+		const std::scoped_lock lock(mMutex);
+		Snapshot values{};
+
+		values.counters.reserve(mCounters.size());
+		values.gauges.reserve(mGauges.size());
+		values.histograms.reserve(mHistograms.size());
+
+		for (const Entry<Counter> &entry : mCounters)
+		{
+			values.counters.push_back(Value<ul>{.name = entry.name, .help = entry.help, .value = entry.metric.value()});
+		}
+
+		for (const Entry<Gauge> &entry : mGauges)
+		{
+			values.gauges.push_back(Value<sl>{.name = entry.name, .help = entry.help, .value = entry.metric.value()});
+		}
+
+		for (const Entry<Histogram> &entry : mHistograms)
+		{
+			values.histograms.push_back(Distribution{.name = entry.name, .help = entry.help, .histogram = entry.metric.snapshot()});
+		}
+
+		return values;
+	}
+
+	// MARK: Static Member Functions
+
+	ATTR_NODISCARD Registry &Registry::global()
+	{
+		static Registry registry{};
+		return registry;
+	}
+
+	ATTR_NODISCARD ATTR_PURE bool Registry::validName(const std::string_view name) noexcept
+	{
+		const auto allowed = [](const char character) {
+			return (character >= 'a' && character <= 'z') || (character >= 'A' && character <= 'Z') || (character >= '0' && character <= '9') ||
+				   character == '_' || character == ':';
+		};
+
+		return !name.empty() && (name.front() < '0' || name.front() > '9') && std::ranges::all_of(name, allowed);
+	}
+
+	// MARK: Private Member Functions
+
+	template <typename Metric>
+	ATTR_NODISCARD Metric &Registry::findOrCreate(std::deque<Entry<Metric>> &entries, const std::string_view name, const std::string_view help)
+	{
+		const std::scoped_lock lock(mMutex);
+
+		// Registration is rare and callers keep the reference, so a linear search costs less than keeping an index per type
+		const auto found{std::ranges::find(entries, name, &Entry<Metric>::name)};
+
+		if (found != entries.end())
+		{
+			return found->metric;
+		}
+
+		if (!validName(name))
+		{
+			throw std::invalid_argument{"Invalid metric name \"" + std::string{name} + "\""};
+		}
+
+		if (mNames.contains(name))
+		{
+			throw std::invalid_argument{"The metric " + std::string{name} + " is already registered with another type"};
+		}
+
+		Entry<Metric> &entry{entries.emplace_back(name, help)};
+		mNames.emplace(entry.name);
+
+		return entry.metric;
+	}
+} // namespace Project::Utility::Debug::Metrics
@@ -0,0 +1,38 @@
+/*! \file shards.cpp
+	\brief Contains the function definitions for the mapping from the calling CPU to the shard of a metric it updates
+	\date --/--/----
+	\version x.x.x
+	\since x.x.x
+	\author Matthew Moore
+*/
+
+#include "Utility/Debug/Metrics/shards.h"
+
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <thread>
+
+#include "Core/attributeMacros.h"
+#include "Utility/Debug/Metrics/constants.h"
+
+namespace Project::Utility::Debug::Metrics
+{
+	// MARK: Getters
+
+	ATTR_NODISCARD ul Shards::count() noexcept
+	{
+		static const ul shards{std::min(std::bit_ceil(std::max(ul{std::thread::hardware_concurrency()}, ul{1})), METRICS_MAX_SHARDS)};
+		return shards;
+	}
+
+	// MARK: Private Static Member Functions
+
+	ATTR_NODISCARD ul Shards::threadShard() noexcept
+	{
+		// Threads take consecutive shards in the order they first need one, which spreads them evenly
+		static std::atomic<ul> next{0};
+		thread_local const ul shard{next.fetch_add(1, std::memory_order_relaxed)};
+		return shard;
+	}
+} // namespace Project::Utility::Debug::Metrics
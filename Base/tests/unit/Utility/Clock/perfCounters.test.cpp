@@ -0,0 +1,153 @@
+/*! @file perfCounters.test.cpp
+	@brief Catch2 BDD unit tests for the Linux hardware performance counters, on machines that allow them and machines that do not.
+	@date --/--/----
+	@version x.x.x
+	@since x.x.x
+	@author Matthew Moore
+*/
+
+#include "Utility/Clock/perfCounters.h"
+
+#include <cstddef>
+#include <iostream>
+#include <ratio>
+#include <sstream>
+#include <streambuf>
+#include <string>
+
+#include "Core/typedefs.h"
+#include "Utility/Clock/timer.h"
+
+#include <catch2/catch_test_macros.hpp>
+
+using Project::Core::ul;
+using Project::Utility::Clock::PerfCounters;
+using Project::Utility::Clock::Timer;
+using Project::Utility::Clock::TimingOptions;
+using Project::Utility::Clock::TimingStatistics;
+
+// NOLINTBEGIN(misc-const-correctness,cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers,readability-function-cognitive-complexity)
+
+namespace
+{
+	/*! @brief Does some work the compiler cannot remove.
+		@param iterations How much work.
+		@return A value depending on all of it.
+	*/
+	ul work(const ul iterations) // NOLINT(llvm-prefer-static-over-anonymous-namespace)
+	{
+		volatile ul total{0};
+
+		for (ul i{0}; i < iterations; ++i)
+		{
+			total = total + (i * i);
+		}
+
+		return total;
+	}
+} // namespace
+
+SCENARIO("PerfCounters", "[utility][clock][perfCounters]")
+{
+	GIVEN("counters for the calling thread")
+	{
+		PerfCounters counters{};
+
+		THEN("every event has a name")
+		{
+			CHECK((PerfCounters::name(PerfCounters::Event::Cycles) == "cycles"));
+			CHECK((PerfCounters::name(PerfCounters::Event::BranchMisses) == "branch misses"));
+		}
+
+		THEN("they either count work or explain why they cannot")
+		{
+			const PerfCounters::Reading before{counters.read()};
+			static_cast<void>(work(100'000));
+			const PerfCounters::Reading difference{counters.read() - before};
+
+			if (counters.available())
+			{
+				CHECK(counters.unavailableReason().empty() == (counters.available(PerfCounters::Event::Cycles) &&
+															   counters.available(PerfCounters::Event::Instructions) &&
+															   counters.available(PerfCounters::Event::CacheMisses) &&
+															   counters.available(PerfCounters::Event::BranchMisses)));
+
+				if (counters.available(PerfCounters::Event::Instructions))
+				{
+					CHECK((difference[PerfCounters::Event::Instructions] >= 100'000));
+				}
+			}
+			else
+			{
+				CHECK(!counters.unavailableReason().empty());
+
+				for (std::size_t event{0}; event < PerfCounters::EVENTS; ++event)
+				{
+					CHECK((difference.values[event] == 0));
+					CHECK(!counters.available(static_cast<PerfCounters::Event>(event)));
+				}
+			}
+		}
+
+		THEN("a difference never underflows")
+		{
+			PerfCounters::Reading earlier{};
+			earlier.values[0] = 10;
+
+			CHECK(((PerfCounters::Reading{} - earlier)[PerfCounters::Event::Cycles] == 0));
+		}
+	}
+
+	GIVEN("timeFunction asked for hardware counters")
+	{
+		THEN("the report gives per-call counts or says why there are none")
+		{
+			Timer::closeLogFile();
+
+			std::ostringstream captured;
+			std::streambuf *old{std::cout.rdbuf(captured.rdbuf())};
+
+			TimingStatistics statistics{
+				Timer::timeFunction<std::micro>("counted", TimingOptions{.iterations = 5, .hardwareCounters = true}, [] { return work(10'000); })};
+
+			std::cout.rdbuf(old);
+
+			const std::string out{captured.str()};
+			const PerfCounters probe{};
+
+			if (probe.available())
+			{
+				CHECK(out.contains("\tPer call:"));
+				CHECK((statistics.counters[PerfCounters::Event::Instructions].has_value() ==
+					   probe.available(PerfCounters::Event::Instructions)));
+			}
+			else
+			{
+				CHECK(out.contains("\tHardware counters unavailable: "));
+				CHECK(!statistics.counters.instructionsPerCycle.has_value());
+				CHECK(!statistics.counters[PerfCounters::Event::Cycles].has_value());
+			}
+		}
+
+		THEN("a run with no iterations only calls the counters unavailable when they failed to open")
+		{
+			Timer::closeLogFile();
+
+			std::ostringstream captured;
+			std::streambuf *old{std::cout.rdbuf(captured.rdbuf())};
+
+			static_cast<void>(
+				Timer::timeFunction<std::micro>("uncounted", TimingOptions{.iterations = 0, .hardwareCounters = true}, [] { return work(10); }));
+
+			std::cout.rdbuf(old);
+
+			const std::string out{captured.str()};
+			const PerfCounters probe{};
+
+			CHECK(out.contains("\tHardware counters: no samples\n") == probe.available());
+			CHECK(out.contains("\tHardware counters unavailable: ") == !probe.available());
+		}
+	}
+}
+
+// NOLINTEND(misc-const-correctness,cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers,readability-function-cognitive-complexity)
@@ -0,0 +1,98 @@
+/*! @file scopedTimer.test.cpp
+	@brief Catch2 BDD unit tests for the RAII timer that reports its lifetime to a sink.
+	@date --/--/----
+	@version x.x.x
+	@since x.x.x
+	@author Matthew Moore
+*/
+
+#include "Utility/Clock/scopedTimer.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <ratio>
+#include <thread>
+#include <vector>
+
+#include "Utility/Debug/Metrics/histogram.h"
+
+#include <catch2/catch_test_macros.hpp>
+
+using Project::Utility::Clock::makeScopedTimer;
+
+// NOLINTBEGIN(misc-const-correctness,cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers,readability-function-cognitive-complexity)
+
+SCENARIO("ScopedTimer", "[utility][clock][scopedTimer]")
+{
+	GIVEN("a timer in a scope")
+	{
+		THEN("the sink receives the scope's duration once, when it ends")
+		{
+			double recorded{-1.0};
+			int calls{0};
+
+			{
+				const auto timer{makeScopedTimer<std::milli>([&recorded, &calls](const double elapsed) {
+					recorded = elapsed;
+					++calls;
+				})};
+
+				std::this_thread::sleep_for(std::chrono::milliseconds(5));
+
+				CHECK((timer.elapsed() >= 5.0));
+				CHECK((calls == 0));
+			}
+
+			CHECK((calls == 1));
+			CHECK((recorded >= 5.0));
+		}
+	}
+
+	GIVEN("timers on several threads sharing a histogram")
+	{
+		THEN("every thread's scopes are recorded")
+		{
+			Project::Utility::Debug::Metrics::Histogram latency{};
+			std::atomic<int> longest{0};
+			std::vector<std::thread> threads{};
+
+			for (int thread{0}; thread < 4; ++thread)
+			{
+				threads.emplace_back([&latency, &longest, thread] {
+					for (int i{0}; i < 100; ++i)
+					{
+						const auto timer{makeScopedTimer<std::micro>([&latency, &longest](const double elapsed) {
+							latency.record(static_cast<Project::Core::ul>(elapsed));
+
+							int current{longest.load()};
+
+							while (!longest.compare_exchange_weak(current, std::max(current, static_cast<int>(elapsed))))
+							{
+							}
+						})};
+
+						if (i == 0)
+						{
+							std::this_thread::sleep_for(std::chrono::milliseconds(thread + 1));
+						}
+					}
+				});
+			}
+
+			for (std::thread &thread : threads)
+			{
+				thread.join();
+			}
+
+			const Project::Utility::Debug::Metrics::Histogram::Snapshot snapshot{latency.snapshot()};
+
+			// Each thread sleeps through one scope, for 1 to 4 ms; the 4 ms one must be the longest, and all four must reach the sum
+			CHECK((snapshot.count == 400));
+			CHECK((snapshot.sum >= 10'000));
+			CHECK((longest.load() >= 4'000));
+		}
+	}
+}
+
+// NOLINTEND(misc-const-correctness,cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers,readability-function-cognitive-complexity)
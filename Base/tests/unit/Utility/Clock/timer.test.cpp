@@ -8,7 +8,9 @@
 
 #include "Utility/Clock/timer.h"
 
+#include <array>
 #include <chrono>
+#include <cmath>
 #include <filesystem>
 #include <iostream>
 #include <ratio>
@@ -17,12 +19,27 @@
 #include <string>
 #include <thread>
 
+#include <catch2/catch_approx.hpp>
 #include <catch2/catch_test_macros.hpp>
 
 using Project::Utility::Clock::Timer;
+using Project::Utility::Clock::TimingStatistics;
 
 // NOLINTBEGIN(misc-const-correctness,cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers,readability-function-cognitive-complexity)
 
+namespace
+{
+	/*! @brief Compares two doubles allowing for rounding in the interpolation.
+		@param actual The computed value.
+		@param expected The exact value.
+		@return Whether they agree to within a billionth.
+	*/
+	bool near(const double actual, const double expected) // NOLINT(llvm-prefer-static-over-anonymous-namespace)
+	{
+		return std::abs(actual - expected) < 1e-9;
+	}
+} // namespace
+
 SCENARIO("Timer")
 {
 	GIVEN("getUnit")
@@ -54,6 +71,76 @@ SCENARIO("Timer")
 
 			CHECK((elapsed > 0.0));
 		}
+
+		THEN("each thread keeps its own start")
+		{
+			Timer::start();
+
+			double otherElapsed{0.0};
+			std::thread other{[&otherElapsed] {
+				Timer::start();
+				otherElapsed = Timer::stop<std::milli>();
+			}};
+			other.join();
+
+			std::this_thread::sleep_for(std::chrono::milliseconds(10));
+
+			// The other thread's start must not have reset this one's
+			CHECK((Timer::stop<std::milli>() >= 10.0));
+			CHECK((otherElapsed < 10.0));
+		}
+	}
+
+	GIVEN("summarize")
+	{
+		THEN("no samples give an empty summary")
+		{
+			TimingStatistics statistics{Timer::summarize({}, "s")};
+
+			CHECK((statistics.iterations == 0));
+			CHECK((statistics.max == Catch::Approx(0.0)));
+			CHECK((statistics.outliers == 0));
+		}
+
+		THEN("a known set of samples gives its order statistics, spread and outliers")
+		{
+			std::array<double, 10> samples{100.0, 9.0, 8.0, 7.0, 6.0, 5.0, 4.0, 3.0, 2.0, 1.0};
+			TimingStatistics statistics{Timer::summarize(samples, "ms")};
+
+			CHECK((statistics.iterations == 10));
+			CHECK((statistics.unit == "ms"));
+			CHECK((statistics.min == Catch::Approx(1.0)));
+			CHECK((statistics.max == Catch::Approx(100.0)));
+			CHECK(near(statistics.mean, 14.5));
+			CHECK(near(statistics.median, 5.5));
+			CHECK(near(statistics.p90, 18.1));
+			CHECK(near(statistics.p99, 91.81));
+			CHECK(near(statistics.standardDeviation, std::sqrt(8'182.5 / 9.0)));
+			CHECK(near(statistics.medianAbsoluteDeviation, 2.5));
+			CHECK(near(statistics.lowerFence, -3.5));
+			CHECK(near(statistics.upperFence, 14.5));
+			CHECK((statistics.outliers == 1));
+			CHECK(statistics.isOutlier(100.0));
+			CHECK_FALSE(statistics.isOutlier(9.0));
+		}
+
+		THEN("summarizing in place sorts the samples but keeps their values")
+		{
+			std::array<double, 5> samples{9.0, 1.0, 5.0, 3.0, 7.0};
+			TimingStatistics statistics{Timer::summarize(samples, "s")};
+
+			CHECK(near(statistics.medianAbsoluteDeviation, 2.0));
+			CHECK((samples == std::array<double, 5>{1.0, 3.0, 5.0, 7.0, 9.0}));
+		}
+
+		THEN("preserving the order leaves the samples untouched")
+		{
+			std::array<double, 3> samples{3.0, 1.0, 2.0};
+			TimingStatistics statistics{Timer::summarize(samples, "s", true)};
+
+			CHECK(near(statistics.median, 2.0));
+			CHECK((samples == std::array<double, 3>{3.0, 1.0, 2.0}));
+		}
 	}
 
 	GIVEN("timeFunction")
@@ -108,7 +195,7 @@ SCENARIO("Timer")
 				std::streambuf *old{std::cout.rdbuf(captured.rdbuf())};
 
 				// Run 3 iterations to exercise the per-iteration and average output path
-				Timer::timeFunction<std::ratio<1>>("trivial", 3U, trivial);
+				TimingStatistics statistics{Timer::timeFunction<std::ratio<1>>("trivial", 3U, trivial)};
 
 				// restore
 				std::cout.rdbuf(old);
@@ -117,6 +204,15 @@ SCENARIO("Timer")
 				CHECK(out.contains("Timing function: trivial"));
 				CHECK(out.contains("Iteration 1"));
 				CHECK(out.contains("Average:"));
+				CHECK(out.contains("Median:"));
+				CHECK(out.contains("p99.9:"));
+				CHECK(out.contains("Standard deviation:"));
+				CHECK(out.contains("Outliers:"));
+
+				CHECK((statistics.iterations == 3));
+				CHECK((statistics.unit == "s"));
+				CHECK((statistics.min <= statistics.median));
+				CHECK((statistics.median <= statistics.max));
 			}
 		}
 
@@ -143,6 +239,90 @@ SCENARIO("Timer")
 			}
 		}
 
+		GIVEN("more iterations than fit in a byte")
+		{
+			THEN("every iteration is timed")
+			{
+				Timer::closeLogFile();
+
+				std::ostringstream captured;
+				std::streambuf *old{std::cout.rdbuf(captured.rdbuf())};
+
+				TimingStatistics statistics{Timer::timeFunction<std::nano>("many_iter", 300U, trivial)};
+
+				std::cout.rdbuf(old);
+
+				CHECK((statistics.iterations == 300));
+				CHECK((statistics.batchSize == 1));
+				CHECK(captured.str().contains("Iteration 300:"));
+			}
+		}
+
+		GIVEN("the per-iteration listing turned off")
+		{
+			THEN("only the summary is written")
+			{
+				Timer::closeLogFile();
+
+				std::ostringstream captured;
+				std::streambuf *old{std::cout.rdbuf(captured.rdbuf())};
+
+				TimingStatistics statistics{Timer::timeFunction<std::nano>(
+					"quiet", Project::Utility::Clock::TimingOptions{.iterations = 50, .listIterations = false}, trivial)};
+
+				std::cout.rdbuf(old);
+
+				std::string out{captured.str()};
+				CHECK(out.starts_with("Timing function: quiet\n"));
+				CHECK(!out.contains("Iteration"));
+				CHECK(out.contains("Median:"));
+				CHECK((statistics.iterations == 50));
+			}
+		}
+
+		GIVEN("auto-calibration")
+		{
+			THEN("a trivial function is timed in batches and reported per call")
+			{
+				Timer::closeLogFile();
+
+				std::ostringstream captured;
+				std::streambuf *old{std::cout.rdbuf(captured.rdbuf())};
+
+				int calls{0};
+				TimingStatistics statistics{Timer::timeFunctionCalibrated<std::nano>("calibrated", 3U, std::chrono::milliseconds(1),
+																					 [&calls]() noexcept { ++calls; })};
+
+				std::cout.rdbuf(old);
+
+				std::string out{captured.str()};
+				CHECK(out.contains("Batch size:"));
+				CHECK((statistics.iterations == 3));
+				CHECK((statistics.batchSize > 1));
+				CHECK((static_cast<Project::Core::ul>(calls) >= 3 * statistics.batchSize));
+
+				// A batch lasts at least the minimum, but no single call of a trivial function comes close
+				CHECK((statistics.median < 1'000'000.0));
+			}
+
+			THEN("a slow function needs no batching")
+			{
+				Timer::closeLogFile();
+
+				std::ostringstream captured;
+				std::streambuf *old{std::cout.rdbuf(captured.rdbuf())};
+
+				TimingStatistics statistics{Timer::timeFunctionCalibrated<std::milli>(
+					"slow", 2U, std::chrono::microseconds(100), [] { std::this_thread::sleep_for(std::chrono::milliseconds(1)); })};
+
+				std::cout.rdbuf(old);
+
+				CHECK((statistics.batchSize == 1));
+				CHECK(!captured.str().contains("Batch size:"));
+				CHECK((statistics.min >= 1.0));
+			}
+		}
+
 		GIVEN("a file already open")
 		{
 			namespace fs = std::filesystem;
@@ -0,0 +1,155 @@
+/*! @file boundedQueue.test.cpp
+	@brief Catch2 BDD unit tests for the lock-free BoundedQueue.
+	@date --/--/----
+	@version x.x.x
+	@since x.x.x
+	@author Matthew Moore
+*/
+
+#include "Utility/Containers/BoundedQueue/boundedQueue.h"
+
+#include <atomic>
+#include <cstddef>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include "Core/typedefs.h"
+
+#include <catch2/catch_test_macros.hpp>
+
+using Project::Core::ul;
+using Project::Utility::Containers::BoundedQueue::BoundedQueue;
+
+// NOLINTBEGIN(misc-const-correctness,cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers,readability-function-cognitive-complexity)
+
+SCENARIO("BoundedQueue")
+{
+	GIVEN("a requested capacity")
+	{
+		THEN("the capacity is rounded up to a power of two")
+		{
+			CHECK((BoundedQueue<int>{5}.capacity() == 8));
+			CHECK((BoundedQueue<int>{8}.capacity() == 8));
+			CHECK((BoundedQueue<int>{0}.capacity() == 2));
+		}
+	}
+
+	GIVEN("an empty queue")
+	{
+		BoundedQueue<int> queue{4};
+
+		THEN("popping fails")
+		{
+			CHECK_FALSE(queue.tryPop([](int & /*value*/) {}));
+		}
+
+		WHEN("filled to capacity")
+		{
+			for (int i{0}; i < 4; ++i)
+			{
+				REQUIRE(queue.tryPush([i](int &value) { value = i; }));
+			}
+
+			THEN("another push fails")
+			{
+				CHECK_FALSE(queue.tryPush([](int &value) { value = 99; }));
+				CHECK((queue.enqueuePosition() == 4));
+			}
+
+			THEN("elements come out in insertion order")
+			{
+				for (int i{0}; i < 4; ++i)
+				{
+					int popped{-1};
+					REQUIRE(queue.tryPop([&popped](const int &value) { popped = value; }));
+					CHECK((popped == i));
+				}
+
+				CHECK((queue.dequeuePosition() == 4));
+				CHECK_FALSE(queue.tryPop([](int & /*value*/) {}));
+			}
+
+			THEN("the published elements can be visited without consuming them")
+			{
+				REQUIRE(queue.tryPop([](int & /*value*/) {}));
+				REQUIRE(queue.tryPush([](int &value) { value = 4; }));
+
+				std::vector<int> visited{};
+				queue.forEachPublished([&visited](const int &value) { visited.push_back(value); });
+
+				CHECK((visited == std::vector<int>{1, 2, 3, 4}));
+				CHECK((queue.dequeuePosition() == 1));
+			}
+		}
+	}
+
+	GIVEN("a fill callback that throws")
+	{
+		BoundedQueue<int> queue{2};
+
+		THEN("the claimed cell is still published")
+		{
+			CHECK_THROWS_AS(static_cast<void>(queue.tryPush([](int &value) {
+				value = 7;
+				throw std::runtime_error("fill failed");
+			})),
+							std::runtime_error);
+
+			int popped{0};
+			CHECK(queue.tryPop([&popped](const int &value) { popped = value; }));
+			CHECK((popped == 7));
+		}
+	}
+
+	GIVEN("several producers and consumers")
+	{
+		constexpr ul producerCount{4};
+		constexpr ul consumerCount{2};
+		constexpr ul perProducer{10'000};
+
+		BoundedQueue<ul> queue{64};
+		std::atomic<ul> consumedSum{0};
+		std::atomic<ul> consumedCount{0};
+		std::vector<std::thread> threads{};
+
+		for (ul producer{0}; producer < producerCount; ++producer)
+		{
+			threads.emplace_back([&queue] {
+				for (ul value{1}; value <= perProducer; ++value)
+				{
+					while (!queue.tryPush([value](ul &slot) { slot = value; }))
+					{
+						std::this_thread::yield();
+					}
+				}
+			});
+		}
+
+		for (ul consumer{0}; consumer < consumerCount; ++consumer)
+		{
+			threads.emplace_back([&queue, &consumedSum, &consumedCount] {
+				while (consumedCount.load() < producerCount * perProducer)
+				{
+					if (queue.tryPop([&consumedSum](const ul &slot) { consumedSum.fetch_add(slot); }))
+					{
+						consumedCount.fetch_add(1);
+					}
+				}
+			});
+		}
+
+		for (std::thread &thread : threads)
+		{
+			thread.join();
+		}
+
+		THEN("every element is consumed exactly once")
+		{
+			CHECK((consumedCount.load() == producerCount * perProducer));
+			CHECK((consumedSum.load() == producerCount * (perProducer * (perProducer + 1) / 2)));
+		}
+	}
+}
+
+// NOLINTEND(misc-const-correctness,cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers,readability-function-cognitive-complexity)
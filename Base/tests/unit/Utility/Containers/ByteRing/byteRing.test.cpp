@@ -0,0 +1,172 @@
+/*! @file byteRing.test.cpp
+	@brief Catch2 BDD unit tests for the lock-free single-producer single-consumer ByteRing.
+	@date --/--/----
+	@version x.x.x
+	@since x.x.x
+	@author Matthew Moore
+*/
+
+#include "Utility/Containers/ByteRing/byteRing.h"
+
+#include <cstddef>
+#include <cstring>
+#include <span>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include "Core/typedefs.h"
+
+#include <catch2/catch_test_macros.hpp>
+
+using Project::Core::ul;
+using Project::Utility::Containers::ByteRing::ByteRing;
+
+// NOLINTBEGIN(misc-const-correctness,cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers,readability-function-cognitive-complexity)
+
+namespace
+{
+	/*! @brief Drains @p ring into a vector.
+		@param[in,out] ring The ring to drain.
+		@return Every published byte, in order.
+	*/
+	std::vector<std::byte> drainAll(ByteRing &ring) // NOLINT(llvm-prefer-static-over-anonymous-namespace)
+	{
+		std::vector<std::byte> bytes{};
+		static_cast<void>(ring.drain([&bytes](const std::span<const std::byte> span) { bytes.insert(bytes.end(), span.begin(), span.end()); }));
+		return bytes;
+	}
+} // namespace
+
+SCENARIO("ByteRing")
+{
+	GIVEN("a requested capacity")
+	{
+		THEN("the capacity is rounded up to a power of two of at least 64 bytes")
+		{
+			CHECK((ByteRing{100}.capacity() == 128));
+			CHECK((ByteRing{128}.capacity() == 128));
+			CHECK((ByteRing{1}.capacity() == 64));
+		}
+	}
+
+	GIVEN("an empty ring")
+	{
+		ByteRing ring{64};
+
+		THEN("draining consumes nothing")
+		{
+			CHECK(ring.empty());
+			CHECK((ring.drain([](const std::span<const std::byte> /*bytes*/) {}) == 0));
+		}
+
+		THEN("a record larger than the free space is rejected")
+		{
+			CHECK(ring.tryPush(64, [](ByteRing::Writer & /*writer*/) {}));
+			CHECK_FALSE(ring.tryPush(1, [](ByteRing::Writer & /*writer*/) {}));
+		}
+
+		THEN("a throwing fill publishes nothing")
+		{
+			CHECK_THROWS_AS(ring.tryPush(8, [](ByteRing::Writer & /*writer*/) { throw std::runtime_error("fill failed"); }),
+							std::runtime_error);
+			CHECK(ring.empty());
+		}
+	}
+
+	GIVEN("records that wrap around the end of the storage")
+	{
+		ByteRing ring{64};
+
+		const ul first{0x1111111111111111};
+		REQUIRE(ring.tryPush(48, [&first](ByteRing::Writer &writer) {
+			for (int i{0}; i < 6; ++i)
+			{
+				writer.put(&first, sizeof(first));
+			}
+		}));
+		REQUIRE((drainAll(ring).size() == 48));
+
+		const ul second{0x0123456789ABCDEF};
+		REQUIRE(ring.tryPush(24, [&second](ByteRing::Writer &writer) {
+			for (int i{0}; i < 3; ++i)
+			{
+				writer.put(&second, sizeof(second));
+			}
+		}));
+
+		THEN("the consumer sees the bytes in order across two spans")
+		{
+			int spans{0};
+			std::vector<std::byte> bytes{};
+			const std::size_t consumed{ring.drain([&](const std::span<const std::byte> span) {
+				++spans;
+				bytes.insert(bytes.end(), span.begin(), span.end());
+			})};
+
+			CHECK((consumed == 24));
+			CHECK((spans == 2));
+
+			for (std::size_t offset{0}; offset < bytes.size(); offset += sizeof(ul))
+			{
+				ul value{0};
+				std::memcpy(&value, bytes.data() + offset, sizeof(value));
+				CHECK((value == second));
+			}
+		}
+	}
+
+	GIVEN("a producer and a consumer thread")
+	{
+		ByteRing ring{256};
+		constexpr ul COUNT{100'000};
+
+		THEN("every record arrives exactly once and in order")
+		{
+			std::thread producer{[&ring]() {
+				for (ul i{0}; i < COUNT; ++i)
+				{
+					while (!ring.tryPush(sizeof(ul), [i](ByteRing::Writer &writer) { writer.put(&i, sizeof(i)); }))
+					{
+						std::this_thread::yield();
+					}
+				}
+			}};
+
+			std::vector<std::byte> pending{};
+			ul expected{0};
+			bool ordered{true};
+
+			while (expected < COUNT)
+			{
+				const std::vector<std::byte> bytes{drainAll(ring)};
+				pending.insert(pending.end(), bytes.begin(), bytes.end());
+
+				std::size_t offset{0};
+
+				for (; offset + sizeof(ul) <= pending.size(); offset += sizeof(ul))
+				{
+					ul value{0};
+					std::memcpy(&value, pending.data() + offset, sizeof(value));
+					ordered = ordered && value == expected;
+					++expected;
+				}
+
+				pending.erase(pending.begin(), pending.begin() + static_cast<std::ptrdiff_t>(offset));
+
+				if (bytes.empty())
+				{
+					std::this_thread::yield();
+				}
+			}
+
+			producer.join();
+
+			CHECK(ordered);
+			CHECK(pending.empty());
+			CHECK(ring.empty());
+		}
+	}
+}
+
+// NOLINTEND(misc-const-correctness,cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers,readability-function-cognitive-complexity)
@@ -0,0 +1,246 @@
+/*! @file asyncSink.test.cpp
+	@brief Catch2 BDD unit tests for the asynchronous spdlog sink.
+	@details Drives the sink through a plain spdlog::logger so records take the same path they do inside Logger. Overflow tests rely on the
+   invariant that every record is either written or counted as dropped, which holds regardless of how the writer thread is scheduled.
+	@date --/--/----
+	@version x.x.x
+	@since x.x.x
+	@author Matthew Moore
+*/
+
+#include "Utility/Debug/Logging/asyncSink.h"
+
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "Core/attributeMacros.h"
+#include "Core/typedefs.h"
+#include "Utility/Debug/Logging/constants.h"
+#include "Utility/Debug/Logging/crashHandler.h"
+#include "Utility/Debug/Logging/loggerOptions.h"
+
+#include <catch2/catch_test_macros.hpp>
+#include <spdlog/logger.h>
+
+namespace Logging = Project::Utility::Debug::Logging;
+
+using Logging::AsyncSink;
+using Logging::OverflowPolicy;
+using Project::Core::ul;
+
+// NOLINTBEGIN(misc-const-correctness,cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers,readability-function-cognitive-complexity)
+
+namespace
+{
+	/*! @brief Reads the full contents of a file.
+		@param[in] fileName The file to read.
+		@return The file contents as a string.
+	*/
+	ATTR_NODISCARD std::string readFile(const std::string &fileName) // NOLINT(llvm-prefer-static-over-anonymous-namespace)
+	{
+		std::ifstream file(fileName);
+		std::ostringstream contents;
+		contents << file.rdbuf();
+		return contents.str();
+	}
+
+	/*! @brief Counts the lines in @p text.
+		@param[in] text The text to scan.
+		@return The number of newline characters.
+	*/
+	ATTR_NODISCARD ul countLines(const std::string &text) // NOLINT(llvm-prefer-static-over-anonymous-namespace)
+	{
+		return static_cast<ul>(std::ranges::count(text, '\n'));
+	}
+} // namespace
+
+SCENARIO("AsyncSink")
+{
+	const std::string fileName{"async_sink_test_output.log"};
+
+	bool fileRemoved{std::filesystem::remove(fileName)};
+	REQUIRE(!fileRemoved);
+
+	GIVEN("the blocking overflow policy")
+	{
+		THEN("every record reaches the file in order and nothing is dropped")
+		{
+			const std::shared_ptr<AsyncSink> sink{std::make_shared<AsyncSink>(fileName, 4, OverflowPolicy::Block)};
+			spdlog::logger logger{"async_sink_block", sink};
+
+			for (int i{0}; i < 1'000; ++i)
+			{
+				logger.info("record {}", i);
+			}
+
+			logger.flush();
+
+			const std::string contents{readFile(fileName)};
+			CHECK((countLines(contents) == 1'000));
+			CHECK((contents.find("record 0\n") < contents.find("record 999\n")));
+			CHECK((sink->droppedCount() == 0));
+		}
+
+		THEN("records from several threads are all written")
+		{
+			const std::shared_ptr<AsyncSink> sink{std::make_shared<AsyncSink>(fileName, 16, OverflowPolicy::Block)};
+			spdlog::logger logger{"async_sink_threads", sink};
+			std::vector<std::thread> threads{};
+
+			for (int thread{0}; thread < 4; ++thread)
+			{
+				threads.emplace_back([&logger, thread] {
+					for (int i{0}; i < 500; ++i)
+					{
+						logger.info("thread {} record {}", thread, i);
+					}
+				});
+			}
+
+			for (std::thread &worker : threads)
+			{
+				worker.join();
+			}
+
+			logger.flush();
+
+			CHECK((countLines(readFile(fileName)) == 2'000));
+		}
+	}
+
+	GIVEN("the drop-newest overflow policy")
+	{
+		THEN("every record is either written or counted as dropped")
+		{
+			const std::shared_ptr<AsyncSink> sink{std::make_shared<AsyncSink>(fileName, 2, OverflowPolicy::DropNewest)};
+			spdlog::logger logger{"async_sink_drop_newest", sink};
+
+			for (int i{0}; i < 10'000; ++i)
+			{
+				logger.info("record {}", i);
+			}
+
+			logger.flush();
+
+			CHECK((countLines(readFile(fileName)) + sink->droppedCount() == 10'000));
+		}
+	}
+
+	GIVEN("the drop-oldest overflow policy")
+	{
+		THEN("every record is either written or counted as dropped and the newest record survives")
+		{
+			const std::shared_ptr<AsyncSink> sink{std::make_shared<AsyncSink>(fileName, 2, OverflowPolicy::DropOldest)};
+			spdlog::logger logger{"async_sink_drop_oldest", sink};
+
+			for (int i{0}; i < 10'000; ++i)
+			{
+				logger.info("record {}", i);
+			}
+
+			logger.flush();
+
+			const std::string contents{readFile(fileName)};
+			CHECK((countLines(contents) + sink->droppedCount() == 10'000));
+			CHECK(contents.contains("record 9999"));
+		}
+	}
+
+	GIVEN("a custom pattern")
+	{
+		THEN("records use the pattern")
+		{
+			const std::shared_ptr<AsyncSink> sink{std::make_shared<AsyncSink>(fileName, 8, OverflowPolicy::Block)};
+			spdlog::logger logger{"async_sink_pattern", sink};
+
+			logger.set_pattern("[%l] %v");
+			logger.warn("patterned");
+			logger.flush();
+
+			CHECK(readFile(fileName).contains("[warning] patterned"));
+		}
+	}
+
+	GIVEN("a sink that is destroyed without an explicit flush")
+	{
+		THEN("queued records are still written")
+		{
+			{
+				const std::shared_ptr<AsyncSink> sink{std::make_shared<AsyncSink>(fileName, 64, OverflowPolicy::Block)};
+				spdlog::logger logger{"async_sink_destroy", sink};
+
+				for (int i{0}; i < 50; ++i)
+				{
+					logger.info("record {}", i);
+				}
+			}
+
+			CHECK((countLines(readFile(fileName)) == 50));
+		}
+	}
+
+	GIVEN("a crash handler with every drain slot taken")
+	{
+		THEN("the sink reports that its queue is not drained on a crash and still writes its records")
+		{
+			// Distinct addresses that only serve as drain keys
+			std::vector<char> contexts(Logging::LOGGING_CRASH_DRAINS + 1);
+			std::vector<const void *> taken{};
+
+			for (const char &context : contexts)
+			{
+				if (Logging::CrashHandler::addDrain([](const void * /*context*/, int /*file*/) noexcept {}, &context))
+				{
+					taken.push_back(&context);
+				}
+			}
+
+			{
+				const std::shared_ptr<AsyncSink> sink{std::make_shared<AsyncSink>(fileName, 8, OverflowPolicy::Block)};
+				spdlog::logger logger{"async_sink_no_drain", sink};
+
+				CHECK_FALSE(sink->crashDrainRegistered());
+
+				logger.info("record");
+				logger.flush();
+			}
+
+			for (const void *context : taken)
+			{
+				Logging::CrashHandler::removeDrain(context);
+			}
+
+			CHECK(countLines(readFile(fileName)) == 1);
+
+			const std::shared_ptr<AsyncSink> sink{std::make_shared<AsyncSink>(fileName, 8, OverflowPolicy::Block)};
+			CHECK(sink->crashDrainRegistered());
+		}
+	}
+
+	GIVEN("an unopenable file")
+	{
+		THEN("construction throws spdlog_ex")
+		{
+			// A regular file used as a directory component cannot be created or opened, even with elevated privileges
+			const std::string notADirectory{"async_sink_not_a_directory"};
+			std::ofstream{notADirectory}.close();
+
+			CHECK_THROWS_AS(AsyncSink(notADirectory + "/async.log", 8, OverflowPolicy::Block), spdlog::spdlog_ex);
+
+			REQUIRE(std::filesystem::remove(notADirectory));
+		}
+	}
+
+	// Scenario-level cleanup
+	fileRemoved = std::filesystem::remove(fileName);
+	static_cast<void>(fileRemoved);
+}
+
+// NOLINTEND(misc-const-correctness,cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers,readability-function-cognitive-complexity)
@@ -0,0 +1,147 @@
+/*! @file backtraceRing.test.cpp
+	@brief Catch2 BDD unit tests for the per-thread ring of recent low-level log records.
+	@details Records are pushed with the same argument encoding the Logger uses and formatted back with the binary decoder, so each check
+   reads like the line the record would have produced.
+	@date --/--/----
+	@version x.x.x
+	@since x.x.x
+	@author Matthew Moore
+*/
+
+#include "Utility/Debug/Logging/backtraceRing.h"
+
+#include <chrono>
+#include <cstddef>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "Core/attributeMacros.h"
+#include "Core/typedefs.h"
+#include "Utility/Debug/Logging/binaryDecoder.h"
+#include "Utility/Debug/Logging/binaryFormat.h"
+
+#include <catch2/catch_test_macros.hpp>
+#include <spdlog/common.h>
+
+namespace Logging = Project::Utility::Debug::Logging;
+
+using Logging::BacktraceRing;
+using Project::Core::ul;
+
+// NOLINTBEGIN(misc-const-correctness,cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers,readability-function-cognitive-complexity)
+
+namespace
+{
+	/*! @brief Pushes a `record {}` record with one integer argument.
+		@param[in,out] ring The ring under test.
+		@param[in] index The argument.
+		@return The result of @ref BacktraceRing::push.
+	*/
+	bool pushRecord(BacktraceRing &ring, const int index) // NOLINT(llvm-prefer-static-over-anonymous-namespace)
+	{
+		return ring.push(BacktraceRing::Record{.level = spdlog::level::debug, .time = spdlog::log_clock::now(), .format = "record {}"},
+						 Logging::Binary::encodedSize(index),
+						 [index](BacktraceRing::Writer &writer) { Logging::Binary::encodeArgument(writer, index); });
+	}
+
+	/*! @brief Drains @p ring and formats every record.
+		@param[in,out] ring The ring under test.
+		@return The formatted records, oldest first.
+	*/
+	ATTR_NODISCARD std::vector<std::string> drainAll(BacktraceRing &ring) // NOLINT(llvm-prefer-static-over-anonymous-namespace)
+	{
+		std::vector<std::string> records{};
+		spdlog::memory_buf_t message{};
+
+		ring.drain([&records, &message](const BacktraceRing::Record &record) {
+			records.emplace_back(Logging::Binary::formatPayload(record.format, record.payload, message) ? std::string{message.data(), message.size()}
+																										: std::string{"<malformed>"});
+		});
+
+		return records;
+	}
+} // namespace
+
+SCENARIO("BacktraceRing")
+{
+	GIVEN("a record limit")
+	{
+		THEN("only the newest records are kept and they drain oldest first")
+		{
+			BacktraceRing ring{3, 4'096};
+
+			for (int index{0}; index < 5; ++index)
+			{
+				CHECK(pushRecord(ring, index));
+			}
+
+			CHECK((ring.size() == 3));
+			CHECK((drainAll(ring) == std::vector<std::string>{"record 2", "record 3", "record 4"}));
+			CHECK((ring.size() == 0));
+			CHECK(drainAll(ring).empty());
+		}
+	}
+
+	GIVEN("a byte limit that forces records to wrap around the storage")
+	{
+		THEN("every kept record is intact and the newest ones survive")
+		{
+			BacktraceRing ring{1'000, 200};
+
+			for (int index{0}; index < 100; ++index)
+			{
+				REQUIRE(pushRecord(ring, index));
+			}
+
+			const std::vector<std::string> records{drainAll(ring)};
+			REQUIRE_FALSE(records.empty());
+			CHECK((records.back() == "record 99"));
+
+			for (std::size_t position{0}; position < records.size(); ++position)
+			{
+				CHECK((records[position] == "record " + std::to_string(100 - records.size() + position)));
+			}
+		}
+
+		THEN("a record larger than the whole ring is refused and the kept records are untouched")
+		{
+			BacktraceRing ring{10, 128};
+			const std::string large(256, 'x');
+			const std::string_view text{large};
+
+			REQUIRE(pushRecord(ring, 1));
+			CHECK_FALSE(ring.push(BacktraceRing::Record{.level = spdlog::level::debug, .format = Logging::Binary::PREFORMATTED_FORMAT},
+								  Logging::Binary::encodedSize(text),
+								  [text](BacktraceRing::Writer &writer) { Logging::Binary::encodeArgument(writer, text); }));
+			CHECK((drainAll(ring) == std::vector<std::string>{"record 1"}));
+		}
+	}
+
+	GIVEN("a drained record")
+	{
+		THEN("its level, time and completeness are the ones it was pushed with")
+		{
+			BacktraceRing ring{4, 1'024};
+			const spdlog::log_clock::time_point time{std::chrono::seconds{1'700'000'000} + std::chrono::nanoseconds{7}};
+			const std::string_view text{"done"};
+
+			REQUIRE(ring.push(BacktraceRing::Record{.level = spdlog::level::trace,
+													.time = time,
+													.format = Logging::Binary::PREFORMATTED_FORMAT,
+													.complete = true},
+							  Logging::Binary::encodedSize(text), [text](BacktraceRing::Writer &writer) { Logging::Binary::encodeArgument(writer, text); }));
+
+			ul seen{0};
+			ring.drain([&seen, time](const BacktraceRing::Record &record) {
+				++seen;
+				CHECK((record.level == spdlog::level::trace));
+				CHECK((record.time == time));
+				CHECK(record.complete);
+			});
+			CHECK((seen == 1));
+		}
+	}
+}
+
+// NOLINTEND(misc-const-correctness,cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers,readability-function-cognitive-complexity)
@@ -0,0 +1,282 @@
+/*! @file binaryDecoder.test.cpp
+	@brief Catch2 BDD unit tests for the binary log sink and its offline decoder.
+	@details Records are written through a BinarySink and decoded back, and the text is compared against what fmt produces for the same
+   format and arguments, which is what spdlog's own file sink would have written with the same pattern.
+	@date --/--/----
+	@version x.x.x
+	@since x.x.x
+	@author Matthew Moore
+*/
+
+#include "Utility/Debug/Logging/binaryDecoder.h"
+
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <optional>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+#include "Core/attributeMacros.h"
+#include "Core/typedefs.h"
+#include "Utility/Debug/Logging/binaryFormat.h"
+#include "Utility/Debug/Logging/binarySink.h"
+#include "Utility/Debug/Logging/constants.h"
+#include "Utility/Debug/Logging/loggerOptions.h"
+
+#include <catch2/catch_test_macros.hpp>
+#include <spdlog/common.h>
+#include <spdlog/details/os.h>
+#include <spdlog/fmt/fmt.h>
+#include <spdlog/logger.h>
+
+namespace Logging = Project::Utility::Debug::Logging;
+
+using Logging::BinarySink;
+using Logging::OverflowPolicy;
+using Project::Core::ul;
+
+// NOLINTBEGIN(misc-const-correctness,cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers,readability-function-cognitive-complexity)
+
+namespace
+{
+	/*! @brief Decodes a binary log file with the given pattern.
+		@param[in] fileName The binary log to decode.
+		@param[in] pattern The spdlog pattern.
+		@param[out] text Receives the decoded lines.
+		@return The decoder's result.
+	*/
+	ATTR_NODISCARD std::optional<std::string_view> decodeFile(const std::string &fileName, const std::string &pattern, // NOLINT(llvm-prefer-static-over-anonymous-namespace)
+															  std::string &text)
+	{
+		std::ifstream input(fileName, std::ios::binary);
+		std::ostringstream output;
+		const std::optional<std::string_view> result{Logging::Binary::decode(input, output, pattern)};
+		text = output.str();
+		return result;
+	}
+
+	/*! @brief Decodes an in-memory binary log.
+		@param[in] bytes The binary log contents.
+		@return The decoder's result.
+	*/
+	ATTR_NODISCARD std::optional<std::string_view> decodeBytes(const std::string &bytes) // NOLINT(llvm-prefer-static-over-anonymous-namespace)
+	{
+		std::istringstream input(bytes);
+		std::ostringstream output;
+		return Logging::Binary::decode(input, output);
+	}
+} // namespace
+
+SCENARIO("Binary log decoding")
+{
+	const std::string fileName{"binary_decoder_test.bin"};
+	const std::string pattern{"%n [%l] %v"};
+
+	std::filesystem::remove(fileName);
+
+	GIVEN("records with every supported argument type")
+	{
+		const std::string text{"text"};
+		const int value{42};
+		const void *pointer{&value};
+
+		{
+			BinarySink sink{fileName, "binary", 4'096, OverflowPolicy::Block};
+
+			sink.logDeferred(spdlog::level::info, "ints {} {} {}", -7, 8U, -9'000'000'000L);
+			sink.logDeferred(spdlog::level::warn, "floats {} {} {:.3f}", 0.1F, 0.1, 2.0 / 3.0);
+			sink.logDeferred(spdlog::level::err, "misc {} {} {:>6}|", true, 'c', std::string_view{"sv"});
+			sink.logDeferred(spdlog::level::debug, "strings {} {}", "literal", text);
+			sink.logDeferred(spdlog::level::critical, "hex {:#x} {}", 255, pointer);
+			sink.logDeferred(spdlog::level::trace, "no arguments");
+			sink.logFormatted(spdlog::level::info, "already formatted");
+		}
+
+		THEN("the decoded text matches what fmt and the pattern produce")
+		{
+			std::string decoded{};
+			const std::optional<std::string_view> result{decodeFile(fileName, pattern, decoded)};
+			REQUIRE_FALSE(result.has_value());
+
+			std::string expected{};
+			expected += fmt::format("binary [info] ints {} {} {}\n", -7, 8U, -9'000'000'000L);
+			expected += fmt::format("binary [warning] floats {} {} {:.3f}\n", 0.1F, 0.1, 2.0 / 3.0);
+			expected += fmt::format("binary [error] misc {} {} {:>6}|\n", true, 'c', std::string_view{"sv"});
+			expected += fmt::format("binary [debug] strings {} {}\n", "literal", text);
+			expected += fmt::format("binary [critical] hex {:#x} {}\n", 255, pointer);
+			expected += "binary [trace] no arguments\n";
+			expected += "binary [info] already formatted\n";
+
+			CHECK((decoded == expected));
+		}
+
+		THEN("the thread id is preserved")
+		{
+			std::string decoded{};
+			const std::optional<std::string_view> result{decodeFile(fileName, "%t", decoded)};
+			REQUIRE_FALSE(result.has_value());
+
+			CHECK(decoded.starts_with(std::to_string(spdlog::details::os::thread_id()) + "\n"));
+		}
+	}
+
+	GIVEN("records routed through spdlog::logger")
+	{
+		{
+			const std::shared_ptr<BinarySink> sink{std::make_shared<BinarySink>(fileName, "spdlog_binary", 4'096, OverflowPolicy::Block)};
+			spdlog::logger logger{"spdlog_binary", sink};
+
+			logger.info("through spdlog {}", 1);
+			logger.flush();
+		}
+
+		THEN("they are stored as preformatted text")
+		{
+			std::string decoded{};
+			const std::optional<std::string_view> result{decodeFile(fileName, pattern, decoded)};
+			REQUIRE_FALSE(result.has_value());
+
+			CHECK((decoded == "spdlog_binary [info] through spdlog 1\n"));
+		}
+	}
+
+	GIVEN("several threads logging concurrently")
+	{
+		constexpr int THREADS{4};
+		constexpr int RECORDS{2'000};
+
+		ul dropped{0};
+
+		{
+			BinarySink sink{fileName, "threads", 1'024, OverflowPolicy::Block};
+			std::vector<std::thread> threads{};
+
+			for (int t{0}; t < THREADS; ++t)
+			{
+				threads.emplace_back([&sink, t]() {
+					for (int i{0}; i < RECORDS; ++i)
+					{
+						sink.logDeferred(spdlog::level::info, "thread {} record {}", t, i);
+					}
+				});
+			}
+
+			for (std::thread &thread : threads)
+			{
+				thread.join();
+			}
+
+			sink.flush();
+			dropped = sink.droppedCount();
+		}
+
+		THEN("every record is decoded and each thread's records stay in order")
+		{
+			CHECK((dropped == 0));
+
+			std::string decoded{};
+			const std::optional<std::string_view> result{decodeFile(fileName, "%v", decoded)};
+			REQUIRE_FALSE(result.has_value());
+
+			std::vector<int> next(THREADS, 0);
+			std::istringstream lines(decoded);
+			bool ordered{true};
+			int total{0};
+
+			for (std::string line{}; std::getline(lines, line); ++total)
+			{
+				int thread{-1};
+				int record{-1};
+				REQUIRE((std::sscanf(line.c_str(), "thread %d record %d", &thread, &record) == 2)); // NOLINT(cert-err34-c)
+				ordered = ordered && record == next[static_cast<std::size_t>(thread)]++;
+			}
+
+			CHECK(ordered);
+			CHECK((total == THREADS * RECORDS));
+		}
+	}
+
+	GIVEN("a file appended to by two sinks")
+	{
+		{
+			BinarySink sink{fileName, "first", 4'096, OverflowPolicy::Block};
+			sink.logDeferred(spdlog::level::info, "session {}", 1);
+		}
+
+		{
+			BinarySink sink{fileName, "second", 4'096, OverflowPolicy::Block};
+			sink.logDeferred(spdlog::level::info, "session {}", 2);
+		}
+
+		THEN("each session is decoded with its own header")
+		{
+			std::string decoded{};
+			const std::optional<std::string_view> result{decodeFile(fileName, pattern, decoded)};
+			REQUIRE_FALSE(result.has_value());
+
+			CHECK((decoded == "first [info] session 1\nsecond [info] session 2\n"));
+		}
+	}
+
+	GIVEN("a record larger than a thread buffer")
+	{
+		ul dropped{0};
+
+		{
+			BinarySink sink{fileName, "small", 64, OverflowPolicy::Block};
+			sink.logDeferred(spdlog::level::info, "{}", std::string(256, 'x'));
+			dropped = sink.droppedCount();
+		}
+
+		THEN("it is dropped instead of blocking forever")
+		{
+			CHECK((dropped == 1));
+		}
+	}
+
+	GIVEN("damaged input")
+	{
+		{
+			BinarySink sink{fileName, "damaged", 4'096, OverflowPolicy::Block};
+			sink.logDeferred(spdlog::level::info, "intact {}", 1);
+		}
+
+		std::ifstream input(fileName, std::ios::binary);
+		std::ostringstream contents;
+		contents << input.rdbuf();
+		const std::string bytes{contents.str()};
+
+		THEN("empty input is rejected")
+		{
+			CHECK((decodeBytes("") == Logging::BINARY_DECODE_HEADER_FAILURE));
+		}
+
+		THEN("a wrong magic number is rejected")
+		{
+			CHECK((decodeBytes("PRJXLOG" + bytes.substr(7)) == Logging::BINARY_DECODE_HEADER_FAILURE));
+		}
+
+		THEN("records without a header are rejected")
+		{
+			CHECK((decodeBytes(std::string(1, '\x02') + bytes) == Logging::BINARY_DECODE_HEADER_FAILURE));
+		}
+
+		THEN("a cut-off record is reported")
+		{
+			CHECK((decodeBytes(bytes.substr(0, bytes.size() - 1)) == Logging::BINARY_DECODE_TRUNCATED_FAILURE));
+		}
+
+		THEN("an unknown entry kind is reported")
+		{
+			CHECK((decodeBytes(bytes + '\x7F') == Logging::BINARY_DECODE_CORRUPT_FAILURE));
+		}
+	}
+
+	std::filesystem::remove(fileName);
+}
+
+// NOLINTEND(misc-const-correctness,cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers,readability-function-cognitive-complexity)
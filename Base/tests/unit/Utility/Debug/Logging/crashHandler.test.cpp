@@ -0,0 +1,232 @@
+/*! @file crashHandler.test.cpp
+	@brief Catch2 BDD unit tests for the fatal-signal handler that drains pending log records.
+	@details Each crash runs in a forked child, so the test process keeps its own signal handlers and the parent inspects what the child
+   left in its log file.
+	@date --/--/----
+	@version x.x.x
+	@since x.x.x
+	@author Matthew Moore
+*/
+
+#include "Utility/Debug/Logging/crashHandler.h"
+
+#include <array>
+#include <csignal>
+#include <cstddef>
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <memory>
+#include <sstream>
+#include <string>
+
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include "Core/attributeMacros.h"
+#include "Utility/Debug/Logging/constants.h"
+#include "Utility/Debug/Logging/logger.h"
+#include "Utility/Debug/Logging/loggerOptions.h"
+
+#include <catch2/catch_test_macros.hpp>
+#include <spdlog/logger.h>
+#include <spdlog/sinks/basic_file_sink.h>
+
+namespace Logging = Project::Utility::Debug::Logging;
+
+using Logging::CrashHandler;
+using Logging::Logger;
+
+// NOLINTBEGIN(misc-const-correctness,cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers,readability-function-cognitive-complexity)
+
+namespace
+{
+	/*! @brief Reads the full contents of a file.
+		@param[in] fileName The file to read.
+		@return The file contents as a string.
+	*/
+	ATTR_NODISCARD std::string readFile(const std::string &fileName) // NOLINT(llvm-prefer-static-over-anonymous-namespace)
+	{
+		std::ifstream file(fileName, std::ios::binary);
+		std::ostringstream contents;
+		contents << file.rdbuf();
+		return contents.str();
+	}
+
+	/*! @brief Runs @p body in a forked child that then raises SIGSEGV, and waits for the child to end.
+		@details The child restores the default disposition first, so the crash handler under test falls back to it rather than to Catch2's.
+		@param[in] body Sets up logging in the child; the child exits with status 2 if it throws.
+		@return The child's wait status.
+	*/
+	ATTR_NODISCARD int crashChild(const std::function<void()> &body) // NOLINT(llvm-prefer-static-over-anonymous-namespace)
+	{
+		const pid_t child{::fork()};
+
+		if (child == 0)
+		{
+			static_cast<void>(std::signal(SIGSEGV, SIG_DFL));
+
+			try
+			{
+				body();
+			}
+			catch (...)
+			{
+				::_exit(2);
+			}
+
+			static_cast<void>(std::raise(SIGSEGV));
+			::_exit(1);
+		}
+
+		int status{0};
+		static_cast<void>(::waitpid(child, &status, 0));
+		return status;
+	}
+} // namespace
+
+SCENARIO("CrashHandler")
+{
+	const std::string fileName{"crash_handler_test_output.log"};
+
+	bool fileRemoved{std::filesystem::remove(fileName)};
+	REQUIRE(!fileRemoved);
+
+	GIVEN("a file logger whose last record is still in its stdio buffer")
+	{
+		const int status{crashChild([&fileName] {
+			const auto logger{std::make_shared<spdlog::logger>("crash_handler", std::make_shared<spdlog::sinks::basic_file_sink_mt>(
+																				   fileName, false, CrashHandler::streamEvents()))};
+			logger->set_pattern("%v");
+
+			if (!CrashHandler::install(fileName))
+			{
+				::_exit(3);
+			}
+
+			logger->info("before crash");
+		})};
+
+		THEN("the child dies of the signal")
+		{
+			REQUIRE(WIFSIGNALED(status));
+			CHECK((WTERMSIG(status) == SIGSEGV));
+		}
+
+		THEN("the record is written, followed by the report and a stack trace")
+		{
+			const std::string contents{readFile(fileName)};
+
+			CHECK(contents.starts_with("before crash\n[crash] fatal signal SIGSEGV (11) at address 0x"));
+			CHECK(contents.contains("\n[crash] stack trace:\n"));
+		}
+	}
+
+	GIVEN("the asynchronous logger with the crash handler enabled")
+	{
+		const int status{crashChild([&fileName] {
+			if (!Logger::initialize("crash_handler_async", fileName,
+									Logging::LoggerOptions{.mode = Logging::LoggerMode::Asynchronous, .crashHandler = true}))
+			{
+				::_exit(3);
+			}
+
+			for (int i{0}; i < 1'000; ++i)
+			{
+				static_cast<void>(Logger::info("crash record {}", i));
+			}
+		})};
+
+		THEN("every record still queued or buffered is written exactly once before the report")
+		{
+			REQUIRE(WIFSIGNALED(status));
+			CHECK((WTERMSIG(status) == SIGSEGV));
+
+			const std::string contents{readFile(fileName)};
+			const auto report{contents.find("[crash] fatal signal SIGSEGV")};
+			REQUIRE((report != std::string::npos));
+
+			const std::string records{contents.substr(0, report)};
+			std::istringstream lines{records};
+			int count{0};
+
+			for (std::string line; std::getline(lines, line);)
+			{
+				CHECK(line.ends_with("crash record " + std::to_string(count)));
+				++count;
+			}
+
+			CHECK((count == 1'000));
+		}
+	}
+
+	GIVEN("a handler that was uninstalled")
+	{
+		const int status{crashChild([&fileName] {
+			if (!CrashHandler::install(fileName))
+			{
+				::_exit(3);
+			}
+
+			CrashHandler::uninstall();
+		})};
+
+		THEN("the signal takes its default course without a report")
+		{
+			REQUIRE(WIFSIGNALED(status));
+			CHECK((WTERMSIG(status) == SIGSEGV));
+			CHECK_FALSE(readFile(fileName).contains("[crash]"));
+		}
+	}
+
+	GIVEN("the test process")
+	{
+		THEN("installing and uninstalling are reported")
+		{
+			CHECK_FALSE(CrashHandler::installed());
+			REQUIRE(CrashHandler::install(fileName));
+			CHECK(CrashHandler::installed());
+
+			CrashHandler::uninstall();
+			CHECK_FALSE(CrashHandler::installed());
+		}
+
+		THEN("a file that cannot be opened is refused")
+		{
+			CHECK_FALSE(CrashHandler::install("crash_handler_missing_directory/missing.log"));
+			CHECK_FALSE(CrashHandler::installed());
+		}
+
+		THEN("drains are added until the table is full and can be removed again")
+		{
+			const auto drain = [](const void * /*context*/, int /*file*/) noexcept {};
+			std::array<int, Logging::LOGGING_CRASH_DRAINS + 1> contexts{};
+			std::size_t added{0};
+
+			for (const int &context : contexts)
+			{
+				if (CrashHandler::addDrain(drain, &context))
+				{
+					++added;
+				}
+			}
+
+			CHECK((added <= Logging::LOGGING_CRASH_DRAINS));
+			CHECK_FALSE(CrashHandler::addDrain(drain, &contexts.back()));
+
+			for (const int &context : contexts)
+			{
+				CrashHandler::removeDrain(&context);
+			}
+
+			CHECK(CrashHandler::addDrain(drain, &contexts.front()));
+			CrashHandler::removeDrain(&contexts.front());
+		}
+	}
+
+	// Scenario-level cleanup
+	fileRemoved = std::filesystem::remove(fileName);
+	static_cast<void>(fileRemoved);
+}
+
+// NOLINTEND(misc-const-correctness,cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers,readability-function-cognitive-complexity)
@@ -0,0 +1,240 @@
+/*! @file formatBuffer.test.cpp
+	@brief Catch2 BDD unit tests for the per-thread formatting buffers and the allocation-free Logger path they provide.
+	@details Replaces the global allocation functions with ones that count the allocations made by a thread that asks for it, so a test
+   can require that steady-state logging never reaches the allocator.
+	@date --/--/----
+	@version x.x.x
+	@since x.x.x
+	@author Matthew Moore
+*/
+
+#include "Utility/Debug/Logging/formatBuffer.h"
+
+#include <cstddef>
+#include <cstdlib>
+#include <filesystem>
+#include <iterator>
+#include <memory>
+#include <new>
+#include <optional>
+#include <string>
+#include <string_view>
+
+#include "Core/attributeMacros.h"
+#include "Core/typedefs.h"
+#include "Utility/Debug/Logging/logger.h"
+#include "Utility/Debug/Logging/loggerOptions.h"
+
+#include <catch2/catch_test_macros.hpp>
+#include <spdlog/common.h>
+#include <spdlog/fmt/fmt.h>
+#include <spdlog/logger.h>
+#include <spdlog/spdlog.h>
+
+namespace Logging = Project::Utility::Debug::Logging;
+
+using Logging::FormatBuffer;
+using Logging::Logger;
+using Project::Core::ul;
+
+// NOLINTBEGIN(misc-const-correctness,cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers,readability-function-cognitive-complexity)
+
+namespace
+{
+	thread_local bool counting{false}; // NOLINT(llvm-prefer-static-over-anonymous-namespace)
+	thread_local ul allocations{0};	   // NOLINT(llvm-prefer-static-over-anonymous-namespace)
+
+	/*! @brief Allocates @p size bytes, counting the allocation if the calling thread asked for it.
+		@param size The number of bytes.
+		@return The memory.
+		@throws std::bad_alloc If malloc fails.
+	*/
+	void *countedAllocate(const std::size_t size) // NOLINT(llvm-prefer-static-over-anonymous-namespace)
+	{
+		if (counting)
+		{
+			++allocations;
+		}
+
+		void *memory{std::malloc(size == 0 ? 1 : size)}; // NOLINT(cppcoreguidelines-no-malloc,hicpp-no-malloc)
+
+		if (memory == nullptr)
+		{
+			throw std::bad_alloc{};
+		}
+
+		return memory;
+	}
+
+	/*! @brief Logs a short and a long message @p times times.
+		@param times How many of each to log.
+		@param longMessage A message longer than spdlog's inline buffer.
+		@return true if every call succeeded.
+	*/
+	ATTR_NODISCARD bool logRecords(const int times, const std::string &longMessage) // NOLINT(llvm-prefer-static-over-anonymous-namespace)
+	{
+		bool succeeded{true};
+
+		for (int i{0}; i < times; ++i)
+		{
+			succeeded = !Logger::info("short record {}", i).has_value() && succeeded;
+			succeeded = !Logger::warn("long record {} {}", i, longMessage).has_value() && succeeded;
+		}
+
+		return succeeded;
+	}
+} // namespace
+
+// The replacements forward to malloc and free, so only the count differs from the library's own
+void *operator new(const std::size_t size)
+{
+	return countedAllocate(size);
+}
+
+void *operator new[](const std::size_t size)
+{
+	return countedAllocate(size);
+}
+
+void operator delete(void *memory) noexcept
+{
+	std::free(memory); // NOLINT(cppcoreguidelines-no-malloc,hicpp-no-malloc)
+}
+
+void operator delete[](void *memory) noexcept
+{
+	std::free(memory); // NOLINT(cppcoreguidelines-no-malloc,hicpp-no-malloc)
+}
+
+void operator delete(void *memory, const std::size_t /*size*/) noexcept
+{
+	std::free(memory); // NOLINT(cppcoreguidelines-no-malloc,hicpp-no-malloc)
+}
+
+void operator delete[](void *memory, const std::size_t /*size*/) noexcept
+{
+	std::free(memory); // NOLINT(cppcoreguidelines-no-malloc,hicpp-no-malloc)
+}
+
+SCENARIO("FormatBuffer")
+{
+	const Logging::FormatBufferOptions options{.initialBytes = 512, .maxBytes = 2'048};
+
+	GIVEN("a lease")
+	{
+		THEN("the buffer starts empty with the initial capacity")
+		{
+			{
+				FormatBuffer buffer{FormatBuffer::Use::Message, options};
+				fmt::format_to(std::back_inserter(buffer.get()), "left {}", "behind");
+				CHECK((buffer.view() == "left behind"));
+			}
+
+			FormatBuffer buffer{FormatBuffer::Use::Message, options};
+
+			CHECK(buffer.view().empty());
+			CHECK((buffer.get().capacity() >= 512));
+		}
+
+		THEN("each use has its own buffer")
+		{
+			FormatBuffer message{FormatBuffer::Use::Message, options};
+			FormatBuffer record{FormatBuffer::Use::Record, options};
+
+			fmt::format_to(std::back_inserter(message.get()), "message");
+			fmt::format_to(std::back_inserter(record.get()), "record");
+
+			CHECK((message.view() == "message"));
+			CHECK((record.view() == "record"));
+		}
+
+		THEN("a buffer that grew past the high-water mark is given back")
+		{
+			{
+				FormatBuffer buffer{FormatBuffer::Use::Summary, options};
+				buffer.get().resize(10'000);
+			}
+
+			FormatBuffer buffer{FormatBuffer::Use::Summary, Logging::FormatBufferOptions{.initialBytes = 0, .maxBytes = 2'048}};
+			CHECK((buffer.get().capacity() < 10'000));
+		}
+
+		THEN("a buffer within the high-water mark keeps its capacity")
+		{
+			std::size_t grown{0};
+
+			{
+				FormatBuffer buffer{FormatBuffer::Use::Sink, options};
+				buffer.get().resize(1'500);
+				grown = buffer.get().capacity();
+			}
+
+			FormatBuffer buffer{FormatBuffer::Use::Sink, options};
+			CHECK((buffer.get().capacity() == grown));
+		}
+	}
+}
+
+SCENARIO("Logger formatting without allocation")
+{
+	const std::string loggerName{"format_buffer_logger"};
+	const std::string logFileName{"format_buffer_test.log"};
+	const std::string longMessage(600, 'x');
+
+	spdlog::drop_all();
+	std::filesystem::remove(logFileName);
+
+	GIVEN("synchronous mode")
+	{
+		REQUIRE(Logger::initialize(loggerName, logFileName));
+
+		THEN("the counter sees an allocation made by the counting thread")
+		{
+			counting = true;
+			allocations = 0;
+			const std::string copy{longMessage};
+			counting = false;
+
+			CHECK((copy.size() == longMessage.size()));
+			CHECK((allocations == 1));
+		}
+
+		THEN("steady-state records, long ones included, never allocate")
+		{
+			REQUIRE(logRecords(8, longMessage));
+
+			counting = true;
+			allocations = 0;
+			const bool succeeded{logRecords(100, longMessage)};
+			counting = false;
+
+			CHECK(succeeded);
+			CHECK((allocations == 0));
+		}
+	}
+
+	GIVEN("asynchronous mode")
+	{
+		REQUIRE(Logger::initialize(loggerName, logFileName,
+								   Logging::LoggerOptions{.mode = Logging::LoggerMode::Asynchronous, .queueCapacity = 16}));
+
+		THEN("steady-state records never allocate on the calling thread once every queue slot has held a long record")
+		{
+			REQUIRE(logRecords(32, longMessage));
+			spdlog::apply_all([](const std::shared_ptr<spdlog::logger> &logger) { logger->flush(); });
+
+			counting = true;
+			allocations = 0;
+			const bool succeeded{logRecords(100, longMessage)};
+			counting = false;
+
+			CHECK(succeeded);
+			CHECK((allocations == 0));
+		}
+	}
+
+	spdlog::drop_all();
+	std::filesystem::remove(logFileName);
+}
+
+// NOLINTEND(misc-const-correctness,cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers,readability-function-cognitive-complexity)
@@ -0,0 +1,194 @@
+/*! @file groupCommit.test.cpp
+	@brief Catch2 BDD unit tests for the group commit of durable log records.
+	@date --/--/----
+	@version x.x.x
+	@since x.x.x
+	@author Matthew Moore
+*/
+
+#include "Utility/Debug/Logging/groupCommit.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "Core/attributeMacros.h"
+
+#include <catch2/catch_test_macros.hpp>
+#include <spdlog/common.h>
+#include <spdlog/logger.h>
+#include <spdlog/sinks/base_sink.h>
+#include <spdlog/sinks/basic_file_sink.h>
+
+namespace Logging = Project::Utility::Debug::Logging;
+
+using Logging::GroupCommit;
+
+// NOLINTBEGIN(misc-const-correctness,cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers,readability-function-cognitive-complexity)
+
+namespace
+{
+	/*! @brief Reads the full contents of a file without flushing any logger first.
+		@param[in] fileName The file to read.
+		@return The file contents as a string.
+	*/
+	ATTR_NODISCARD std::string readFile(const std::string &fileName) // NOLINT(llvm-prefer-static-over-anonymous-namespace)
+	{
+		std::ifstream file(fileName, std::ios::binary);
+		std::ostringstream contents;
+		contents << file.rdbuf();
+		return contents.str();
+	}
+
+	/*! @class FailingFlushSink
+		@brief Discards records and fails every flush, as a full or broken disk would.
+	*/
+	class FailingFlushSink final : public spdlog::sinks::base_sink<std::mutex>
+	{
+		protected:
+			/*! @brief Discards @p message.
+				@param[in] message The record.
+			*/
+			void sink_it_(const spdlog::details::log_msg &message) override
+			{
+				static_cast<void>(message);
+			}
+
+			/*! @brief Fails the flush.
+				@throws spdlog::spdlog_ex Always.
+			*/
+			ATTR_NORETURN void flush_() override
+			{
+				spdlog::throw_spdlog_ex("flush failed");
+			}
+	};
+} // namespace
+
+SCENARIO("GroupCommit")
+{
+	const std::string fileName{"group_commit_test_output.log"};
+
+	bool fileRemoved{std::filesystem::remove(fileName)};
+	REQUIRE(!fileRemoved);
+
+	GIVEN("a logger writing through a buffered file sink")
+	{
+		spdlog::logger logger{"group_commit", std::make_shared<spdlog::sinks::basic_file_sink_mt>(fileName)};
+		logger.set_pattern("%v");
+
+		THEN("a commit flushes the records written before it")
+		{
+			GroupCommit commit{fileName, std::chrono::microseconds{0}};
+
+			logger.info("first");
+			logger.info("second");
+
+			CHECK(commit.commit(logger));
+			CHECK((readFile(fileName) == "first\nsecond\n"));
+			CHECK((commit.syncCount() == 1));
+		}
+
+		THEN("threads committing at once share syncs")
+		{
+			GroupCommit commit{fileName, std::chrono::microseconds{1'000}};
+			std::atomic<int> failures{0};
+			std::vector<std::thread> threads{};
+
+			for (int thread{0}; thread < 8; ++thread)
+			{
+				threads.emplace_back([&commit, &logger, &failures, thread] {
+					for (int i{0}; i < 20; ++i)
+					{
+						logger.info("thread {} record {}", thread, i);
+
+						if (!commit.commit(logger))
+						{
+							failures.fetch_add(1);
+						}
+					}
+				});
+			}
+
+			for (std::thread &worker : threads)
+			{
+				worker.join();
+			}
+
+			CHECK((failures.load() == 0));
+			CHECK((std::ranges::count(readFile(fileName), '\n') == 160));
+			CHECK((commit.syncCount() < 160));
+		}
+
+		THEN("a commit follows the path to a replacement file")
+		{
+			GroupCommit commit{fileName, std::chrono::microseconds{0}};
+			const std::string rotatedName{"group_commit_test_output.1.log"};
+
+			logger.info("before rotation");
+			std::filesystem::rename(fileName, rotatedName);
+			std::ofstream{fileName} << "replacement\n";
+
+			CHECK(commit.commit(logger));
+			CHECK((readFile(rotatedName) == "before rotation\n"));
+			CHECK(commit.commit(logger));
+
+			REQUIRE(std::filesystem::remove(rotatedName));
+		}
+	}
+
+	GIVEN("a logger whose flush fails and whose error handler throws")
+	{
+		spdlog::logger logger{"group_commit_throwing", std::make_shared<FailingFlushSink>()};
+		logger.set_error_handler([] ATTR_NORETURN(const std::string &message) { throw std::runtime_error(message); });
+		std::ofstream{fileName} << "";
+
+		THEN("the commit fails without leaving later commits blocked")
+		{
+			GroupCommit commit{fileName, std::chrono::microseconds{0}};
+
+			CHECK_FALSE(commit.commit(logger));
+
+			bool followerDurable{true};
+			std::thread{[&commit, &logger, &followerDurable] { followerDurable = commit.commit(logger); }}.join();
+
+			CHECK_FALSE(followerDurable);
+			CHECK((commit.syncCount() == 0));
+		}
+	}
+
+	GIVEN("a file that cannot be synced")
+	{
+		THEN("commits still succeed")
+		{
+			spdlog::logger logger{"group_commit_null", std::make_shared<spdlog::sinks::basic_file_sink_mt>("/dev/null")};
+			GroupCommit commit{"/dev/null", std::chrono::microseconds{0}};
+
+			logger.info("discarded");
+
+			CHECK(commit.commit(logger));
+		}
+	}
+
+	GIVEN("a missing file")
+	{
+		THEN("construction throws spdlog_ex")
+		{
+			CHECK_THROWS_AS((GroupCommit{"group_commit_missing_directory/missing.log", std::chrono::microseconds{0}}), spdlog::spdlog_ex);
+		}
+	}
+
+	// Scenario-level cleanup
+	fileRemoved = std::filesystem::remove(fileName);
+	static_cast<void>(fileRemoved);
+}
+
+// NOLINTEND(misc-const-correctness,cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers,readability-function-cognitive-complexity)
@@ -10,6 +10,9 @@
 
 #include "Utility/Debug/Logging/logger.h"
 
+#include <algorithm>
+#include <atomic>
+#include <chrono>
 #include <filesystem>
 #include <fstream>
 #include <memory>
@@ -18,10 +21,14 @@
 #include <stdexcept>
 #include <string>
 #include <string_view>
+#include <thread>
+#include <vector>
 
 #include "Core/attributeMacros.h"
 #include "Core/typedefs.h"
+#include "Utility/Debug/Logging/binaryDecoder.h"
 #include "Utility/Debug/Logging/constants.h"
+#include "Utility/Debug/Logging/loggerOptions.h"
 
 #include <catch2/catch_test_macros.hpp>
 #include <spdlog/common.h>
@@ -284,6 +291,29 @@ SCENARIO("Logger")
 		}
 	}
 
+	GIVEN("Runtime format strings")
+	{
+		THEN("a std::string format built at runtime writes message to log")
+		{
+			const std::string format{std::string{"runtime "} + "format {}"};
+			std::optional<std::string_view> result{Logger::info(format, 321)};
+			CHECK_FALSE(result.has_value());
+
+			const std::string contents{readLogFile()};
+			CHECK(contents.contains("runtime format 321"));
+		}
+
+		THEN("a const char pointer format writes message to log")
+		{
+			const char *format{"pointer format {}"};
+			std::optional<std::string_view> result{Logger::log(spdlog::level::warn, format, 654)};
+			CHECK_FALSE(result.has_value());
+
+			const std::string contents{readLogFile()};
+			CHECK(contents.contains("pointer format 654"));
+		}
+	}
+
 	GIVEN("Level filtering")
 	{
 		THEN("info level messages are suppressed when level is set to error")
@@ -298,6 +328,36 @@ SCENARIO("Logger")
 			Logger::setLevel(spdlog::level::info);
 		}
 
+		THEN("isEnabled follows setLevel")
+		{
+			Logger::setLevel(spdlog::level::warn);
+			CHECK_FALSE(Logger::isEnabled(spdlog::level::info));
+			CHECK(Logger::isEnabled(spdlog::level::warn));
+			CHECK(Logger::isEnabled(spdlog::level::critical));
+
+			Logger::setLevel(spdlog::level::info);
+			CHECK(Logger::isEnabled(spdlog::level::info));
+			CHECK_FALSE(Logger::isEnabled(spdlog::level::debug));
+		}
+
+		THEN("disabled records return before reaching spdlog")
+		{
+			// Lower only spdlog's own level; the cached level still says info, so debug records must never reach spdlog
+			spdlog::get(loggerName)->set_level(spdlog::level::trace);
+			spdlog::set_error_handler([] ATTR_NORETURN(const std::string &msg) { throw spdlog::spdlog_ex(msg); });
+
+			std::optional<std::string_view> result{Logger::debug(std::string_view{"{} {}"}, "never formatted")};
+			CHECK_FALSE(result.has_value());
+
+			std::optional<std::string_view> logResult{Logger::log(spdlog::level::debug, "gated debug {}", 1)};
+			CHECK_FALSE(logResult.has_value());
+
+			spdlog::set_error_handler([](const std::string & /*msg*/) {});
+			Logger::setLevel(spdlog::level::info);
+
+			CHECK_FALSE(readLogFile().contains("gated debug"));
+		}
+
 		THEN("warn level messages are suppressed when level is set to critical")
 		{
 			Logger::setLevel(spdlog::level::critical);
@@ -426,7 +486,7 @@ SCENARIO("Logger")
 			spdlog::set_error_handler([] ATTR_NORETURN(const std::string &msg) { throw spdlog::spdlog_ex(msg); });
 			const std::string_view arg{"x"};
 
-			std::optional<std::string_view> result{Logger::info("{} {}", arg)};
+			std::optional<std::string_view> result{Logger::info(std::string_view{"{} {}"}, arg)};
 			REQUIRE(result.has_value());
 
 			spdlog::set_error_handler([](const std::string & /*msg*/) {});
@@ -438,7 +498,7 @@ SCENARIO("Logger")
 			const std::string_view arg1{"a"};
 			const std::string_view arg2{"b"};
 
-			std::optional<std::string_view> result{Logger::info("{} {} {}", arg1, arg2)};
+			std::optional<std::string_view> result{Logger::info(std::string_view{"{} {} {}"}, arg1, arg2)};
 			REQUIRE(result.has_value());
 
 			spdlog::set_error_handler([](const std::string & /*msg*/) {});
@@ -449,7 +509,7 @@ SCENARIO("Logger")
 			spdlog::set_error_handler([] ATTR_NORETURN(const std::string &msg) { throw spdlog::spdlog_ex(msg); });
 			const ub arg{1};
 
-			std::optional<std::string_view> result{Logger::info("{} {}", arg)};
+			std::optional<std::string_view> result{Logger::info(std::string_view{"{} {}"}, arg)};
 			REQUIRE(result.has_value());
 
 			spdlog::set_error_handler([](const std::string & /*msg*/) {});
@@ -460,7 +520,7 @@ SCENARIO("Logger")
 			spdlog::set_error_handler([] ATTR_NORETURN(const std::string &msg) { throw spdlog::spdlog_ex(msg); });
 			const std::string_view arg{"x"};
 
-			std::optional<std::string_view> result{Logger::warn("{} {}", arg)};
+			std::optional<std::string_view> result{Logger::warn(std::string_view{"{} {}"}, arg)};
 			REQUIRE(result.has_value());
 
 			spdlog::set_error_handler([](const std::string & /*msg*/) {});
@@ -472,7 +532,7 @@ SCENARIO("Logger")
 			const std::string_view arg1{"a"};
 			const std::string_view arg2{"b"};
 
-			std::optional<std::string_view> result{Logger::warn("{} {} {}", arg1, arg2)};
+			std::optional<std::string_view> result{Logger::warn(std::string_view{"{} {} {}"}, arg1, arg2)};
 			REQUIRE(result.has_value());
 
 			spdlog::set_error_handler([](const std::string & /*msg*/) {});
@@ -484,7 +544,7 @@ SCENARIO("Logger")
 			const ub userID{1};
 			const std::string_view name{"x"};
 
-			std::optional<std::string_view> result{Logger::warn("{} {} {}", userID, name)};
+			std::optional<std::string_view> result{Logger::warn(std::string_view{"{} {} {}"}, userID, name)};
 			REQUIRE(result.has_value());
 
 			spdlog::set_error_handler([](const std::string & /*msg*/) {});
@@ -496,7 +556,7 @@ SCENARIO("Logger")
 			const ub id1{1};
 			const ub id2{2};
 
-			std::optional<std::string_view> result{Logger::warn("{} {} {}", id1, id2)};
+			std::optional<std::string_view> result{Logger::warn(std::string_view{"{} {} {}"}, id1, id2)};
 			REQUIRE(result.has_value());
 
 			spdlog::set_error_handler([](const std::string & /*msg*/) {});
@@ -507,7 +567,7 @@ SCENARIO("Logger")
 			spdlog::set_error_handler([] ATTR_NORETURN(const std::string &msg) { throw spdlog::spdlog_ex(msg); });
 			const ub userID{1};
 
-			std::optional<std::string_view> result{Logger::warn("{} {} {}", 20UL, userID)};
+			std::optional<std::string_view> result{Logger::warn(std::string_view{"{} {} {}"}, 20UL, userID)};
 			REQUIRE(result.has_value());
 
 			spdlog::set_error_handler([](const std::string & /*msg*/) {});
@@ -521,7 +581,7 @@ SCENARIO("Logger")
 			spdlog::set_error_handler([] ATTR_NORETURN(const std::string &msg) { throw std::runtime_error(msg); });
 			const std::string_view arg{"x"};
 
-			CHECK_THROWS_AS(static_cast<void>(Logger::info("{} {}", arg)), std::runtime_error);
+			CHECK_THROWS_AS(static_cast<void>(Logger::info(std::string_view{"{} {}"}, arg)), std::runtime_error);
 
 			spdlog::set_error_handler([](const std::string & /*msg*/) {});
 		}
@@ -532,7 +592,7 @@ SCENARIO("Logger")
 			const std::string_view arg1{"a"};
 			const std::string_view arg2{"b"};
 
-			CHECK_THROWS_AS(static_cast<void>(Logger::info("{} {} {}", arg1, arg2)), std::runtime_error);
+			CHECK_THROWS_AS(static_cast<void>(Logger::info(std::string_view{"{} {} {}"}, arg1, arg2)), std::runtime_error);
 
 			spdlog::set_error_handler([](const std::string & /*msg*/) {});
 		}
@@ -542,7 +602,7 @@ SCENARIO("Logger")
 			spdlog::set_error_handler([] ATTR_NORETURN(const std::string &msg) { throw std::runtime_error(msg); });
 			const ub arg{1};
 
-			CHECK_THROWS_AS(static_cast<void>(Logger::info("{} {}", arg)), std::runtime_error);
+			CHECK_THROWS_AS(static_cast<void>(Logger::info(std::string_view{"{} {}"}, arg)), std::runtime_error);
 
 			spdlog::set_error_handler([](const std::string & /*msg*/) {});
 		}
@@ -552,7 +612,7 @@ SCENARIO("Logger")
 			spdlog::set_error_handler([] ATTR_NORETURN(const std::string &msg) { throw std::runtime_error(msg); });
 			const std::string_view arg{"x"};
 
-			CHECK_THROWS_AS(static_cast<void>(Logger::warn("{} {}", arg)), std::runtime_error);
+			CHECK_THROWS_AS(static_cast<void>(Logger::warn(std::string_view{"{} {}"}, arg)), std::runtime_error);
 
 			spdlog::set_error_handler([](const std::string & /*msg*/) {});
 		}
@@ -563,7 +623,7 @@ SCENARIO("Logger")
 			const std::string_view arg1{"a"};
 			const std::string_view arg2{"b"};
 
-			CHECK_THROWS_AS(static_cast<void>(Logger::warn("{} {} {}", arg1, arg2)), std::runtime_error);
+			CHECK_THROWS_AS(static_cast<void>(Logger::warn(std::string_view{"{} {} {}"}, arg1, arg2)), std::runtime_error);
 
 			spdlog::set_error_handler([](const std::string & /*msg*/) {});
 		}
@@ -574,7 +634,7 @@ SCENARIO("Logger")
 			const ub userID{1};
 			const std::string_view name{"x"};
 
-			CHECK_THROWS_AS(static_cast<void>(Logger::warn("{} {} {}", userID, name)), std::runtime_error);
+			CHECK_THROWS_AS(static_cast<void>(Logger::warn(std::string_view{"{} {} {}"}, userID, name)), std::runtime_error);
 
 			spdlog::set_error_handler([](const std::string & /*msg*/) {});
 		}
@@ -585,7 +645,7 @@ SCENARIO("Logger")
 			const ub id1{1};
 			const ub id2{2};
 
-			CHECK_THROWS_AS(static_cast<void>(Logger::warn("{} {} {}", id1, id2)), std::runtime_error);
+			CHECK_THROWS_AS(static_cast<void>(Logger::warn(std::string_view{"{} {} {}"}, id1, id2)), std::runtime_error);
 
 			spdlog::set_error_handler([](const std::string & /*msg*/) {});
 		}
@@ -595,7 +655,7 @@ SCENARIO("Logger")
 			spdlog::set_error_handler([] ATTR_NORETURN(const std::string &msg) { throw std::runtime_error(msg); });
 			const ub userID{1};
 
-			CHECK_THROWS_AS(static_cast<void>(Logger::warn("{} {} {}", 20UL, userID)), std::runtime_error);
+			CHECK_THROWS_AS(static_cast<void>(Logger::warn(std::string_view{"{} {} {}"}, 20UL, userID)), std::runtime_error);
 
 			spdlog::set_error_handler([](const std::string & /*msg*/) {});
 		}
@@ -658,6 +718,893 @@ SCENARIO("Logger")
 		}
 	}
 
+	GIVEN("hot reconfiguration while other threads log")
+	{
+		THEN("every record lands in one of the files and no call fails")
+		{
+			const std::string firstFile{"logger_test_swap_a.log"};
+			const std::string secondFile{"logger_test_swap_b.log"};
+			std::filesystem::remove(firstFile);
+			std::filesystem::remove(secondFile);
+
+			loggerInitialized = Logger::initialize(loggerName, firstFile);
+			REQUIRE(loggerInitialized);
+			Logger::setLevel(spdlog::level::info);
+
+			std::atomic<bool> failed{false};
+			std::vector<std::thread> threads{};
+
+			for (int thread{0}; thread < 4; ++thread)
+			{
+				threads.emplace_back([&failed] {
+					for (int i{0}; i < 2'000; ++i)
+					{
+						if (Logger::info("swap record {}", i).has_value())
+						{
+							failed.store(true);
+						}
+					}
+				});
+			}
+
+			for (int swap{0}; swap < 50; ++swap)
+			{
+				const bool swapped{Logger::setFileName(swap % 2 == 0 ? secondFile : firstFile)};
+				CHECK(swapped);
+			}
+
+			for (std::thread &worker : threads)
+			{
+				worker.join();
+			}
+
+			CHECK_FALSE(failed.load());
+
+			// The logging threads have exited, so the retirer destroys (and thereby closes) every replaced logger shortly
+			spdlog::drop_all();
+			loggerInitialized = Logger::initialize(loggerName, logFileName);
+			REQUIRE(loggerInitialized);
+
+			const auto lines = [&]() {
+				return std::ranges::count(readLogFile(&firstFile), '\n') + std::ranges::count(readLogFile(&secondFile), '\n');
+			};
+
+			for (int attempt{0}; attempt < 500 && lines() != 8'000; ++attempt)
+			{
+				std::this_thread::sleep_for(std::chrono::milliseconds{10});
+			}
+
+			CHECK((lines() == 8'000));
+
+			std::filesystem::remove(firstFile);
+			std::filesystem::remove(secondFile);
+		}
+
+		THEN("level changes racing logging threads never leave a call on a retired state")
+		{
+			// Each setLevel publishes a new state and retires the old one; run under AddressSanitizer or ThreadSanitizer to catch a call
+			// that caches a state the retirer has already freed
+			const std::string raceFile{"logger_test_level_race.log"};
+			std::filesystem::remove(raceFile);
+
+			loggerInitialized = Logger::initialize(loggerName, raceFile);
+			REQUIRE(loggerInitialized);
+
+			std::atomic<bool> failed{false};
+			std::atomic<bool> stop{false};
+			std::vector<std::thread> threads{};
+
+			for (int thread{0}; thread < 4; ++thread)
+			{
+				threads.emplace_back([&failed, &stop] {
+					for (int i{0}; !stop.load(std::memory_order_relaxed); ++i)
+					{
+						if (Logger::warn("race record {}", i).has_value() || Logger::info("race record {}", i).has_value())
+						{
+							failed.store(true);
+						}
+					}
+				});
+			}
+
+			for (int change{0}; change < 2'000; ++change)
+			{
+				Logger::setLevel(change % 2 == 0 ? spdlog::level::warn : spdlog::level::info);
+			}
+
+			stop.store(true);
+
+			for (std::thread &worker : threads)
+			{
+				worker.join();
+			}
+
+			CHECK_FALSE(failed.load());
+
+			spdlog::drop_all();
+			loggerInitialized = Logger::initialize(loggerName, logFileName);
+			REQUIRE(loggerInitialized);
+
+			std::filesystem::remove(raceFile);
+		}
+
+		THEN("a thread that has stopped logging does not keep the replaced logger alive")
+		{
+			const std::string firstFile{"logger_test_idle_a.log"};
+			const std::string secondFile{"logger_test_idle_b.log"};
+			std::filesystem::remove(firstFile);
+			std::filesystem::remove(secondFile);
+
+			loggerInitialized = Logger::initialize(loggerName, firstFile);
+			REQUIRE(loggerInitialized);
+
+			std::atomic<bool> logged{false};
+			std::atomic<bool> release{false};
+
+			std::thread idle{[&logged, &release] {
+				static_cast<void>(Logger::info("logged once"));
+				logged.store(true);
+
+				while (!release.load())
+				{
+					std::this_thread::sleep_for(std::chrono::milliseconds{1});
+				}
+			}};
+
+			while (!logged.load())
+			{
+				std::this_thread::yield();
+			}
+
+			const std::weak_ptr<spdlog::logger> replaced{spdlog::get(loggerName)};
+			const bool swapped{Logger::setFileName(secondFile)};
+			CHECK(swapped);
+
+			for (int attempt{0}; attempt < 500 && !replaced.expired(); ++attempt)
+			{
+				std::this_thread::sleep_for(std::chrono::milliseconds{10});
+			}
+
+			CHECK(replaced.expired());
+
+			release.store(true);
+			idle.join();
+
+			spdlog::drop_all();
+			loggerInitialized = Logger::initialize(loggerName, logFileName);
+			REQUIRE(loggerInitialized);
+
+			std::filesystem::remove(firstFile);
+			std::filesystem::remove(secondFile);
+		}
+
+		THEN("a failed reconfiguration keeps the current logger")
+		{
+			// A regular file used as a directory component cannot be created or opened, even with elevated privileges
+			const std::string notADirectory{"logger_test_not_a_directory"};
+			std::ofstream{notADirectory}.close();
+
+			const bool swapped{Logger::setFileName(notADirectory + "/fail.log")};
+			CHECK_FALSE(swapped);
+			std::filesystem::remove(notADirectory);
+
+			std::optional<std::string_view> result{Logger::info("still logging")};
+			CHECK_FALSE(result.has_value());
+
+			CHECK(readLogFile().contains("still logging"));
+			CHECK((spdlog::get(loggerName) != nullptr));
+		}
+	}
+
+	GIVEN("asynchronous mode")
+	{
+		THEN("messages reach the file after a flush")
+		{
+			loggerInitialized = Logger::initialize(loggerName, logFileName, Logging::LoggerOptions{.mode = Logging::LoggerMode::Asynchronous});
+			REQUIRE(loggerInitialized);
+
+			std::optional<std::string_view> result{Logger::info("async message {}", 42)};
+			CHECK_FALSE(result.has_value());
+
+			const std::string contents{readLogFile()};
+			CHECK(contents.contains("async message 42"));
+			CHECK((Logger::getDroppedCount() == 0));
+		}
+
+		THEN("renaming keeps the asynchronous mode")
+		{
+			loggerInitialized = Logger::initialize(
+				loggerName, logFileName,
+				Logging::LoggerOptions{.mode = Logging::LoggerMode::Asynchronous, .overflowPolicy = Logging::OverflowPolicy::DropNewest,
+									   .queueCapacity = 2});
+			REQUIRE(loggerInitialized);
+
+			bool result{Logger::setLoggerName("async_renamed_logger")};
+			REQUIRE(result);
+
+			for (int i{0}; i < 1'000; ++i)
+			{
+				std::optional<std::string_view> logResult{Logger::info("burst {}", i)};
+				CHECK_FALSE(logResult.has_value());
+			}
+
+			const std::string contents{readLogFile()};
+			CHECK((static_cast<Project::Core::ul>(std::ranges::count(contents, '\n')) + Logger::getDroppedCount() == 1'000));
+
+			result = Logger::setLoggerName(loggerName);
+			CHECK(result);
+		}
+
+		THEN("level filtering still applies before records are queued")
+		{
+			loggerInitialized = Logger::initialize(loggerName, logFileName, Logging::LoggerOptions{.mode = Logging::LoggerMode::Asynchronous});
+			REQUIRE(loggerInitialized);
+
+			Logger::setLevel(spdlog::level::err);
+			std::optional<std::string_view> result{Logger::info("async suppressed")};
+			CHECK_FALSE(result.has_value());
+
+			CHECK_FALSE(readLogFile().contains("async suppressed"));
+
+			Logger::setLevel(spdlog::level::info);
+		}
+
+		THEN("io_uring mode batches messages that reach the file after a flush")
+		{
+			loggerInitialized = Logger::initialize(
+				loggerName, logFileName,
+				Logging::LoggerOptions{.mode = Logging::LoggerMode::Uring, .uring = Logging::UringOptions{.queueDepth = 4, .batchBytes = 256}});
+			REQUIRE(loggerInitialized);
+
+			for (int i{0}; i < 100; ++i)
+			{
+				std::optional<std::string_view> result{Logger::info("uring message {}", i)};
+				CHECK_FALSE(result.has_value());
+			}
+
+			const std::string contents{readLogFile()};
+			CHECK(contents.contains("uring message 0"));
+			CHECK(contents.contains("uring message 99"));
+			CHECK((contents.find("uring message 0") < contents.find("uring message 99")));
+			CHECK((Logger::getDroppedCount() == 0));
+		}
+
+		THEN("the dropped count is zero for a synchronous logger")
+		{
+			CHECK((Logger::getDroppedCount() == 0));
+		}
+
+		// Return to the synchronous logger the rest of the scenario expects
+		spdlog::drop_all();
+		loggerInitialized = Logger::initialize(loggerName, logFileName);
+		REQUIRE(loggerInitialized);
+	}
+
+	GIVEN("per-thread mode")
+	{
+		THEN("records from several threads reach the file after a flush")
+		{
+			loggerInitialized = Logger::initialize(loggerName, logFileName, Logging::LoggerOptions{.mode = Logging::LoggerMode::PerThread});
+			REQUIRE(loggerInitialized);
+
+			std::vector<std::thread> threads{};
+			std::atomic<bool> failed{false};
+
+			// Catch2 assertions are not thread-safe, so workers only record failures
+			for (int thread{0}; thread < 3; ++thread)
+			{
+				threads.emplace_back([&failed, thread] {
+					if (Logger::info("per-thread message {}", thread).has_value())
+					{
+						failed.store(true, std::memory_order_relaxed);
+					}
+				});
+			}
+
+			for (std::thread &worker : threads)
+			{
+				worker.join();
+			}
+
+			CHECK_FALSE(failed.load());
+			const std::string contents{readLogFile()};
+			CHECK(contents.contains("per-thread message 0"));
+			CHECK(contents.contains("per-thread message 1"));
+			CHECK(contents.contains("per-thread message 2"));
+			CHECK((Logger::getDroppedCount() == 0));
+		}
+
+		// Return to the synchronous logger the rest of the scenario expects
+		spdlog::drop_all();
+		loggerInitialized = Logger::initialize(loggerName, logFileName);
+		REQUIRE(loggerInitialized);
+	}
+
+	GIVEN("mapped mode")
+	{
+		const std::string mappedFileName{"logger_test_output_mapped.log"};
+		std::filesystem::remove(mappedFileName);
+
+		THEN("records are readable from the file as soon as the call returns")
+		{
+			loggerInitialized = Logger::initialize(
+				loggerName, mappedFileName,
+				Logging::LoggerOptions{.mode = Logging::LoggerMode::Mapped, .extentBytes = 4'096, .syncPolicy = Logging::SyncPolicy::Asynchronous});
+			REQUIRE(loggerInitialized);
+
+			std::optional<std::string_view> result{Logger::info("mapped message {}", 1)};
+			CHECK_FALSE(result.has_value());
+			CHECK(readLogFile(&mappedFileName).contains("mapped message 1"));
+			CHECK((Logger::getDroppedCount() == 0));
+		}
+
+		// Return to the synchronous logger the rest of the scenario expects; the mapped file is released in the background
+		spdlog::drop_all();
+		loggerInitialized = Logger::initialize(loggerName, logFileName);
+		REQUIRE(loggerInitialized);
+		std::filesystem::remove(mappedFileName);
+	}
+
+	GIVEN("size-based rotation")
+	{
+		const std::filesystem::path rotationDirectory{"logger_test_rotation"};
+		const std::filesystem::path rotatingFileName{rotationDirectory / "rotating.log"};
+		std::filesystem::remove_all(rotationDirectory);
+		std::filesystem::create_directory(rotationDirectory);
+
+		THEN("the synchronous logger rotates and compresses finished segments")
+		{
+			loggerInitialized = Logger::initialize(loggerName, rotatingFileName.string(),
+												   Logging::LoggerOptions{.rotation = {.maxBytes = 256, .compress = true}});
+			REQUIRE(loggerInitialized);
+
+			for (int i{0}; i < 20; ++i)
+			{
+				std::optional<std::string_view> result{Logger::info("rotating message {}", i)};
+				CHECK_FALSE(result.has_value());
+			}
+
+			CHECK((std::filesystem::file_size(rotatingFileName) <= 256));
+		}
+
+		// Return to the synchronous logger the rest of the scenario expects; the rotating file is released in the background
+		spdlog::drop_all();
+		loggerInitialized = Logger::initialize(loggerName, logFileName);
+		REQUIRE(loggerInitialized);
+
+		// Segments are compressed on the rotating file's archiver thread, which the background retirer stops
+		bool compressed{false};
+
+		for (int attempt{0}; attempt < 500 && !compressed; ++attempt)
+		{
+			std::this_thread::sleep_for(std::chrono::milliseconds{10});
+			compressed = std::ranges::any_of(std::filesystem::directory_iterator{rotationDirectory}, [](const auto &entry) {
+				return entry.path().extension() == ".gz";
+			});
+		}
+
+		CHECK(compressed);
+		std::filesystem::remove_all(rotationDirectory);
+	}
+
+	GIVEN("structured records")
+	{
+		const std::string structuredFileName{"logger_test_output_structured.log"};
+		std::filesystem::remove(structuredFileName);
+
+		THEN("text records keep the pattern and append the fields as logfmt pairs")
+		{
+			std::optional<std::string_view> result{Logger::info("request done", Logging::kv("latency_us", 42), Logging::kv("path", "/a b"))};
+			CHECK_FALSE(result.has_value());
+			CHECK(readLogFile().contains("[info] request done latency_us=42 path=\"/a b\"\n"));
+		}
+
+		THEN("JSON Lines records hold every call, structured or not, as one object per line")
+		{
+			loggerInitialized = Logger::initialize(loggerName, structuredFileName,
+												   Logging::LoggerOptions{.recordFormat = Logging::RecordFormat::JsonLines});
+			REQUIRE(loggerInitialized);
+
+			const std::string_view path{"/api/v1/items"};
+			std::optional<std::string_view> result{Logger::warn("request done", Logging::kv("latency_us", 1'250U), Logging::kv("path", path),
+																 Logging::kv("cached", false))};
+			CHECK_FALSE(result.has_value());
+			result = Logger::log(spdlog::level::err, "plain {}", "\"quoted\"");
+			CHECK_FALSE(result.has_value());
+			result = Logger::debug("filtered", Logging::kv("count", 1));
+			CHECK_FALSE(result.has_value());
+
+			const std::string contents{readLogFile(&structuredFileName)};
+			const std::size_t firstEnd{contents.find('\n')};
+			REQUIRE((firstEnd != std::string::npos));
+			const std::string first{contents.substr(0, firstEnd)};
+			const std::string second{contents.substr(firstEnd + 1)};
+
+			CHECK(first.starts_with(R"({"ts":")"));
+			CHECK(first.ends_with(R"(Z","level":"warning","logger":"test_logger","msg":"request done","latency_us":1250,)"
+								  R"("path":"/api/v1/items","cached":false})"));
+			CHECK(second.ends_with(R"(","level":"error","logger":"test_logger","msg":"plain \"quoted\""})"
+								   "\n"));
+			CHECK_FALSE(contents.contains("filtered"));
+		}
+
+		THEN("logfmt records quote only the values that need it")
+		{
+			loggerInitialized =
+				Logger::initialize(loggerName, structuredFileName, Logging::LoggerOptions{.recordFormat = Logging::RecordFormat::Logfmt});
+			REQUIRE(loggerInitialized);
+
+			std::optional<std::string_view> result{Logger::critical("disk full", Logging::kv("free", 0.5), Logging::kv("mount", "/var"))};
+			CHECK_FALSE(result.has_value());
+
+			const std::string contents{readLogFile(&structuredFileName)};
+			CHECK(contents.starts_with("ts="));
+			CHECK(contents.ends_with(R"(Z level=critical logger=test_logger msg="disk full" free=0.5 mount=/var)"
+									 "\n"));
+		}
+
+		// Return to the synchronous text logger the rest of the scenario expects
+		spdlog::drop_all();
+		loggerInitialized = Logger::initialize(loggerName, logFileName);
+		REQUIRE(loggerInitialized);
+		std::filesystem::remove(structuredFileName);
+	}
+
+	GIVEN("a backtrace")
+	{
+		const std::string backtraceFileName{"logger_test_output_backtrace.log"};
+		std::filesystem::remove(backtraceFileName);
+
+		THEN("records below the level stay in memory until an error writes the newest of them ahead of itself")
+		{
+			loggerInitialized = Logger::initialize(
+				loggerName, backtraceFileName,
+				Logging::LoggerOptions{.backtrace = {.records = 3, .level = spdlog::level::debug}});
+			REQUIRE(loggerInitialized);
+			Logger::setLevel(spdlog::level::info);
+
+			CHECK(Logger::isEnabled(spdlog::level::debug));
+			CHECK_FALSE(Logger::isEnabled(spdlog::level::trace));
+
+			for (int i{0}; i < 5; ++i)
+			{
+				std::optional<std::string_view> result{Logger::debug("context {}", i)};
+				CHECK_FALSE(result.has_value());
+			}
+
+			const std::string runtimeFormat{"runtime context {}"};
+			std::optional<std::string_view> result{Logger::debug(runtimeFormat, 5)};
+			CHECK_FALSE(result.has_value());
+			result = Logger::info("written");
+			CHECK_FALSE(result.has_value());
+
+			CHECK_FALSE(readLogFile(&backtraceFileName).contains("context"));
+
+			result = Logger::error("failed {}", 1);
+			CHECK_FALSE(result.has_value());
+			result = Logger::critical("failed again");
+			CHECK_FALSE(result.has_value());
+
+			const std::string contents{readLogFile(&backtraceFileName)};
+			const std::size_t written{contents.find("[info] written")};
+			const std::size_t context3{contents.find("[debug] context 3")};
+			const std::size_t context4{contents.find("[debug] context 4")};
+			const std::size_t runtime{contents.find("[debug] runtime context 5")};
+			const std::size_t failed{contents.find("[error] failed 1")};
+
+			CHECK_FALSE(contents.contains("context 2"));
+			REQUIRE((written != std::string::npos));
+			REQUIRE((failed != std::string::npos));
+			CHECK((written < context3));
+			CHECK((context3 < context4));
+			CHECK((context4 < runtime));
+			CHECK((runtime < failed));
+			CHECK((contents.find("context 4") == contents.rfind("context 4")));
+		}
+
+		// Return to the synchronous logger the rest of the scenario expects
+		spdlog::drop_all();
+		loggerInitialized = Logger::initialize(loggerName, logFileName);
+		REQUIRE(loggerInitialized);
+		std::filesystem::remove(backtraceFileName);
+	}
+
+	GIVEN("a rate limit")
+	{
+		const std::string limitedFileName{"logger_test_output_rate_limit.log"};
+		std::filesystem::remove(limitedFileName);
+
+		THEN("a flooding call site writes its burst and one summary, while runtime formats are left alone")
+		{
+			loggerInitialized = Logger::initialize(loggerName, limitedFileName,
+												   Logging::LoggerOptions{.rateLimit = {.burst = 3, .perSecond = 0.001}});
+			REQUIRE(loggerInitialized);
+
+			const std::string runtimeFormat{"runtime flood {}"};
+
+			for (int i{0}; i < 10; ++i)
+			{
+				std::optional<std::string_view> result{Logger::info("flood {}", i)};
+				CHECK_FALSE(result.has_value());
+				result = Logger::info(runtimeFormat, i);
+				CHECK_FALSE(result.has_value());
+			}
+
+			const std::string contents{readLogFile(&limitedFileName)};
+
+			CHECK(contents.contains("[info] flood 2"));
+			CHECK_FALSE(contents.contains("[info] flood 3"));
+			CHECK_FALSE(contents.contains("[info] flood 9"));
+			CHECK(contents.contains("runtime flood 9"));
+			CHECK(contents.contains("[info] suppressed 1 similar messages: flood {}"));
+			CHECK((contents.find("suppressed") == contents.rfind("suppressed")));
+		}
+
+		THEN("a sampling rate of 0 holds back every record from a checked format")
+		{
+			loggerInitialized = Logger::initialize(loggerName, limitedFileName,
+												   Logging::LoggerOptions{.rateLimit = {.sampleRate = 0.0, .summaryInterval = std::chrono::milliseconds::zero()}});
+			REQUIRE(loggerInitialized);
+
+			for (int i{0}; i < 10; ++i)
+			{
+				std::optional<std::string_view> result{Logger::warn("sampled {}", i)};
+				CHECK_FALSE(result.has_value());
+			}
+
+			CHECK_FALSE(readLogFile(&limitedFileName).contains("sampled"));
+		}
+
+		// Return to the synchronous logger the rest of the scenario expects
+		spdlog::drop_all();
+		loggerInitialized = Logger::initialize(loggerName, logFileName);
+		REQUIRE(loggerInitialized);
+		std::filesystem::remove(limitedFileName);
+	}
+
+	GIVEN("module loggers")
+	{
+		const Logging::ModuleLogger http{Logger::module("logger.test.net.http")};
+		const Logging::ModuleLogger tcp{Logger::module("logger.test.net.tcp")};
+		const Logging::ModuleLogger disk{Logger::module("logger.test.disk")};
+
+		THEN("the same name always gives the same module")
+		{
+			CHECK((Logger::module("logger.test.net.http").id() == http.id()));
+			CHECK((http.id() != tcp.id()));
+		}
+
+		THEN("a module follows the global level until it or an ancestor is overridden")
+		{
+			Logger::setLevel(spdlog::level::info);
+			CHECK((http.getLevel() == spdlog::level::info));
+			CHECK_FALSE(http.isEnabled(spdlog::level::debug));
+
+			Logger::setModuleLevel("logger.test.net", spdlog::level::debug);
+			CHECK((http.getLevel() == spdlog::level::debug));
+			CHECK((tcp.getLevel() == spdlog::level::debug));
+			CHECK((disk.getLevel() == spdlog::level::info));
+			CHECK((Logger::getLevel() == spdlog::level::info));
+			CHECK_FALSE(Logger::isEnabled(spdlog::level::debug));
+
+			Logger::setModuleLevel("logger.test.net.tcp", spdlog::level::err);
+			CHECK((tcp.getLevel() == spdlog::level::err));
+
+			std::optional<std::string_view> result{http.debug("module http {}", 1)};
+			CHECK_FALSE(result.has_value());
+			result = tcp.warn("module tcp {}", 2);
+			CHECK_FALSE(result.has_value());
+			result = disk.debug("module disk {}", 3);
+			CHECK_FALSE(result.has_value());
+			result = Logger::debug("global debug {}", 4);
+			CHECK_FALSE(result.has_value());
+			result = disk.info(std::string{"module disk runtime {}"}, 5);
+			CHECK_FALSE(result.has_value());
+
+			const std::string contents{readLogFile()};
+			CHECK(contents.contains("[debug] module http 1"));
+			CHECK_FALSE(contents.contains("module tcp 2"));
+			CHECK_FALSE(contents.contains("module disk 3"));
+			CHECK_FALSE(contents.contains("global debug 4"));
+			CHECK(contents.contains("[info] module disk runtime 5"));
+
+			Logger::resetModuleLevel("logger.test.net.tcp");
+			CHECK((tcp.getLevel() == spdlog::level::debug));
+			Logger::resetModuleLevel("logger.test.net");
+			CHECK((http.getLevel() == spdlog::level::info));
+		}
+
+		THEN("overrides given at initialize survive reinitialization, and setLevel moves modules without one")
+		{
+			loggerInitialized = Logger::initialize(
+				loggerName, logFileName,
+				Logging::LoggerOptions{.moduleLevels = {{.module = "logger.test.disk", .level = spdlog::level::trace}}});
+			REQUIRE(loggerInitialized);
+
+			CHECK((disk.getLevel() == spdlog::level::trace));
+			CHECK(disk.isEnabled(spdlog::level::trace));
+
+			Logger::setLevel(spdlog::level::warn);
+			CHECK((disk.getLevel() == spdlog::level::trace));
+			CHECK((http.getLevel() == spdlog::level::warn));
+
+			loggerInitialized = Logger::setLoggerName(loggerName);
+			REQUIRE(loggerInitialized);
+			CHECK((disk.getLevel() == spdlog::level::trace));
+			Logger::setLevel(spdlog::level::info);
+		}
+
+		// Return to the synchronous logger the rest of the scenario expects
+		spdlog::drop_all();
+		loggerInitialized = Logger::initialize(loggerName, logFileName);
+		REQUIRE(loggerInitialized);
+	}
+
+	GIVEN("durable error records")
+	{
+		const std::string durableFileName{"logger_test_output_durable.log"};
+		std::filesystem::remove(durableFileName);
+
+		// Read without Logger's flush, so only what the group commit pushed out is seen
+		const auto readUnflushed = [&durableFileName] {
+			std::ifstream file(durableFileName);
+			std::ostringstream contents;
+			contents << file.rdbuf();
+			return contents.str();
+		};
+
+		THEN("an error is in the file when the call returns, along with the records before it")
+		{
+			loggerInitialized = Logger::initialize(loggerName, durableFileName,
+												   Logging::LoggerOptions{.durability = Logging::DurabilityOptions{.level = spdlog::level::err}});
+			REQUIRE(loggerInitialized);
+
+			std::optional<std::string_view> result{Logger::info("durable before")};
+			CHECK_FALSE(result.has_value());
+			result = Logger::error("durable error {}", 1);
+			CHECK_FALSE(result.has_value());
+
+			const std::string contents{readUnflushed()};
+			CHECK(contents.contains("[info] durable before\n"));
+			CHECK(contents.contains("[error] durable error 1\n"));
+		}
+
+		THEN("errors from several asynchronous threads are all in the file when their calls return")
+		{
+			loggerInitialized = Logger::initialize(
+				loggerName, durableFileName,
+				Logging::LoggerOptions{.mode = Logging::LoggerMode::Asynchronous,
+									   .durability = Logging::DurabilityOptions{.level = spdlog::level::err, .maxWait = std::chrono::microseconds{500}}});
+			REQUIRE(loggerInitialized);
+
+			std::atomic<int> failures{0};
+			std::vector<std::thread> threads{};
+
+			for (int thread{0}; thread < 4; ++thread)
+			{
+				threads.emplace_back([&failures, thread] {
+					for (int i{0}; i < 25; ++i)
+					{
+						if (Logger::error("durable thread {} record {}", thread, i).has_value())
+						{
+							failures.fetch_add(1);
+						}
+					}
+				});
+			}
+
+			for (std::thread &worker : threads)
+			{
+				worker.join();
+			}
+
+			CHECK((failures.load() == 0));
+			CHECK((std::ranges::count(readUnflushed(), '\n') == 100));
+		}
+
+		// Return to the synchronous logger the rest of the scenario expects
+		spdlog::drop_all();
+		loggerInitialized = Logger::initialize(loggerName, logFileName);
+		REQUIRE(loggerInitialized);
+		std::filesystem::remove(durableFileName);
+	}
+
+	GIVEN("deduplication switched on")
+	{
+		const std::string repeatFileName{"logger_test_output_repeat.log"};
+		std::filesystem::remove(repeatFileName);
+
+		loggerInitialized = Logger::initialize(loggerName, repeatFileName);
+		REQUIRE(loggerInitialized);
+
+		CHECK_FALSE(Logger::isDeduplicating());
+		Logger::setDeduplication(true);
+		CHECK(Logger::isDeduplicating());
+
+		THEN("consecutive repeats are collapsed into one line that counts them")
+		{
+			for (int i{0}; i < 5; ++i)
+			{
+				std::optional<std::string_view> result{Logger::warn("repeat {}", 1)};
+				CHECK_FALSE(result.has_value());
+			}
+
+			std::optional<std::string_view> result{Logger::warn("repeat {}", 2)};
+			CHECK_FALSE(result.has_value());
+
+			const std::string contents{readLogFile(&repeatFileName)};
+
+			CHECK((contents.find("[warning] repeat 1\n") == contents.rfind("[warning] repeat 1\n")));
+			CHECK(contents.contains("[warning] previous message repeated 4 times between "));
+			CHECK(contents.contains(": repeat 1\n"));
+			CHECK((contents.find("previous message repeated") < contents.find("[warning] repeat 2\n")));
+		}
+
+		THEN("switching it off writes every record again")
+		{
+			Logger::setDeduplication(false);
+			CHECK_FALSE(Logger::isDeduplicating());
+
+			for (int i{0}; i < 3; ++i)
+			{
+				std::optional<std::string_view> result{Logger::info("plain repeat")};
+				CHECK_FALSE(result.has_value());
+			}
+
+			const std::string contents{readLogFile(&repeatFileName)};
+
+			CHECK((std::ranges::count(contents, '\n') == 3));
+		}
+
+		THEN("switching it off reports a run that is still open")
+		{
+			for (int i{0}; i < 3; ++i)
+			{
+				std::optional<std::string_view> result{Logger::warn("repeat {}", 1)};
+				CHECK_FALSE(result.has_value());
+			}
+
+			Logger::setDeduplication(false);
+
+			const std::string contents{readLogFile(&repeatFileName)};
+
+			CHECK(contents.contains("[warning] previous message repeated 2 times between "));
+			CHECK(contents.contains(": repeat 1\n"));
+		}
+
+		THEN("initializing another logger reports a run that is still open to the outgoing file")
+		{
+			const std::string nextFileName{"logger_test_output_repeat_next.log"};
+
+			for (int i{0}; i < 3; ++i)
+			{
+				std::optional<std::string_view> result{Logger::warn("repeat {}", 1)};
+				CHECK_FALSE(result.has_value());
+			}
+
+			spdlog::drop_all();
+			loggerInitialized = Logger::initialize(loggerName, nextFileName);
+			REQUIRE(loggerInitialized);
+
+			CHECK(readLogFile(&repeatFileName).contains("[warning] previous message repeated 2 times between "));
+			CHECK_FALSE(readLogFile(&nextFileName).contains("previous message repeated"));
+			std::filesystem::remove(nextFileName);
+		}
+
+		THEN("a run left open by a thread that exits is reported by the next record")
+		{
+			std::thread{[] {
+				for (int i{0}; i < 3; ++i)
+				{
+					static_cast<void>(Logger::warn("repeat {}", 1));
+				}
+			}}.join();
+
+			std::optional<std::string_view> result{Logger::warn("repeat {}", 2)};
+			CHECK_FALSE(result.has_value());
+
+			const std::string contents{readLogFile(&repeatFileName)};
+
+			CHECK(contents.contains("[warning] previous message repeated 2 times between "));
+			CHECK((contents.find("previous message repeated") < contents.find("[warning] repeat 2\n")));
+		}
+
+		Logger::setDeduplication(false);
+
+		// Return to the logger the rest of the scenario expects
+		spdlog::drop_all();
+		loggerInitialized = Logger::initialize(loggerName, logFileName);
+		REQUIRE(loggerInitialized);
+		std::filesystem::remove(repeatFileName);
+	}
+
+	GIVEN("a TSC clock")
+	{
+		const std::string tscFileName{"logger_test_output_tsc.log"};
+		std::filesystem::remove(tscFileName);
+
+		THEN("text and JSON records are stamped with the current time")
+		{
+			loggerInitialized = Logger::initialize(loggerName, tscFileName, Logging::LoggerOptions{.clock = Logging::ClockSource::Tsc});
+			REQUIRE(loggerInitialized);
+
+			std::optional<std::string_view> result{Logger::info("tsc text {}", 1)};
+			CHECK_FALSE(result.has_value());
+			CHECK(readLogFile(&tscFileName).contains("[info] tsc text 1\n"));
+
+			std::filesystem::remove(tscFileName);
+			loggerInitialized = Logger::initialize(
+				loggerName, tscFileName,
+				Logging::LoggerOptions{.recordFormat = Logging::RecordFormat::JsonLines, .clock = Logging::ClockSource::Tsc});
+			REQUIRE(loggerInitialized);
+
+			const std::chrono::year_month_day today{std::chrono::floor<std::chrono::days>(std::chrono::system_clock::now())};
+			result = Logger::info("tsc json", Logging::kv("n", 2));
+			CHECK_FALSE(result.has_value());
+
+			const std::string contents{readLogFile(&tscFileName)};
+			CHECK(contents.starts_with(fmt::format(R"({{"ts":"{:04}-)", static_cast<int>(today.year()))));
+			CHECK(contents.contains(R"("msg":"tsc json","n":2})"));
+		}
+
+		// Return to the synchronous logger the rest of the scenario expects
+		spdlog::drop_all();
+		loggerInitialized = Logger::initialize(loggerName, logFileName);
+		REQUIRE(loggerInitialized);
+		std::filesystem::remove(tscFileName);
+	}
+
+	GIVEN("binary mode")
+	{
+		const std::string binaryFileName{"logger_test_output.bin"};
+		std::filesystem::remove(binaryFileName);
+
+		loggerInitialized = Logger::initialize(loggerName, binaryFileName, Logging::LoggerOptions{.mode = Logging::LoggerMode::Binary});
+		REQUIRE(loggerInitialized);
+
+		THEN("deferred, runtime and fallback calls all decode to the text spdlog would write")
+		{
+			const std::string runtimeFormat{"runtime {}"};
+			std::optional<std::string_view> result{Logger::info("binary {} {}", 42, std::string_view{"deferred"})};
+			CHECK_FALSE(result.has_value());
+			result = Logger::warn(runtimeFormat, 7);
+			CHECK_FALSE(result.has_value());
+			result = Logger::error("long double {}", 1.5L);
+			CHECK_FALSE(result.has_value());
+			result = Logger::debug("filtered {}", 1);
+			CHECK_FALSE(result.has_value());
+			result = Logger::info("structured", Logging::kv("id", 3));
+			CHECK_FALSE(result.has_value());
+
+			spdlog::get(loggerName)->flush();
+
+			std::ifstream input(binaryFileName, std::ios::binary);
+			std::ostringstream output;
+			const std::optional<std::string_view> decodeResult{Logging::Binary::decode(input, output, "[%n] [%l] %v")};
+			REQUIRE_FALSE(decodeResult.has_value());
+
+			CHECK((output.str() == "[test_logger] [info] binary 42 deferred\n"
+								   "[test_logger] [warning] runtime 7\n"
+								   "[test_logger] [error] long double 1.5\n"
+								   "[test_logger] [info] structured id=3\n"));
+			CHECK((Logger::getDroppedCount() == 0));
+		}
+
+		THEN("a malformed runtime format returns the failure message")
+		{
+			std::optional<std::string_view> result{Logger::critical(std::string_view{"{} {}"}, 1)};
+			REQUIRE(result.has_value());
+			CHECK((result.value() == Logging::CRITICAL_LOG_FAILURE));
+		}
+
+		// Return to the synchronous logger the rest of the scenario expects
+		spdlog::drop_all();
+		loggerInitialized = Logger::initialize(loggerName, logFileName);
+		REQUIRE(loggerInitialized);
+
+		std::filesystem::remove(binaryFileName);
+	}
+
 	GIVEN("spdlog initialization with duplicate registry name")
 	{
 		THEN("initialization fails when duplicate name exists")
@@ -667,8 +1614,8 @@ SCENARIO("Logger")
 			std::string tempFile{"logger_test_dup.log"};
 			const std::shared_ptr<spdlog::logger> manualLogger{spdlog::basic_logger_mt(duplicateName, tempFile)};
 
-			// initialize will reset its own internal state but cannot drop the manually registered logger,
-			// causing spdlog to throw spdlog_ex which is caught internally and returns false.
+			// initialize keeps its current logger and cannot drop the manually registered one, so registering the new logger
+			// throws spdlog_ex, which is caught internally and returns false.
 			loggerInitialized = Logger::initialize(duplicateName, logFileName);
 			CHECK_FALSE(loggerInitialized);
 
@@ -685,7 +1632,7 @@ SCENARIO("Logger")
 		{
 			spdlog::set_error_handler([] ATTR_NORETURN(const std::string &msg) { throw spdlog::spdlog_ex(msg); });
 
-			std::optional<std::string_view> result{Logger::log(spdlog::level::info, "{} {}", 77)};
+			std::optional<std::string_view> result{Logger::log(spdlog::level::info, std::string_view{"{} {}"}, 77)};
 
 			REQUIRE(result.has_value());
 			CHECK((result.value() == Logging::LOG_LOG_FAILURE));
@@ -698,7 +1645,7 @@ SCENARIO("Logger")
 			Logger::setLevel(spdlog::level::trace);
 			spdlog::set_error_handler([] ATTR_NORETURN(const std::string &msg) { throw spdlog::spdlog_ex(msg); });
 
-			std::optional<std::string_view> result{Logger::trace("{} {}", 42)};
+			std::optional<std::string_view> result{Logger::trace(std::string_view{"{} {}"}, 42)};
 
 			REQUIRE(result.has_value());
 			CHECK((result.value() == Logging::TRACE_LOG_FAILURE));
@@ -712,7 +1659,7 @@ SCENARIO("Logger")
 			Logger::setLevel(spdlog::level::debug);
 			spdlog::set_error_handler([] ATTR_NORETURN(const std::string &msg) { throw spdlog::spdlog_ex(msg); });
 
-			std::optional<std::string_view> result{Logger::debug("{} {}", "hello")};
+			std::optional<std::string_view> result{Logger::debug(std::string_view{"{} {}"}, "hello")};
 
 			REQUIRE(result.has_value());
 			CHECK((result.value() == Logging::DEBUG_LOG_FAILURE));
@@ -725,7 +1672,7 @@ SCENARIO("Logger")
 		{
 			spdlog::set_error_handler([] ATTR_NORETURN(const std::string &msg) { throw spdlog::spdlog_ex(msg); });
 
-			std::optional<std::string_view> result{Logger::info("{} {}", 100)};
+			std::optional<std::string_view> result{Logger::info(std::string_view{"{} {}"}, 100)};
 
 			REQUIRE(result.has_value());
 			CHECK((result.value() == Logging::INFO_LOG_FAILURE));
@@ -737,7 +1684,7 @@ SCENARIO("Logger")
 		{
 			spdlog::set_error_handler([] ATTR_NORETURN(const std::string &msg) { throw spdlog::spdlog_ex(msg); });
 
-			std::optional<std::string_view> result{Logger::warn("{} {}", 3.14)};
+			std::optional<std::string_view> result{Logger::warn(std::string_view{"{} {}"}, 3.14)};
 
 			REQUIRE(result.has_value());
 			CHECK((result.value() == Logging::WARN_LOG_FAILURE));
@@ -749,7 +1696,7 @@ SCENARIO("Logger")
 		{
 			spdlog::set_error_handler([] ATTR_NORETURN(const std::string &msg) { throw spdlog::spdlog_ex(msg); });
 
-			std::optional<std::string_view> result{Logger::error("{} {}", "failure")};
+			std::optional<std::string_view> result{Logger::error(std::string_view{"{} {}"}, "failure")};
 
 			REQUIRE(result.has_value());
 			CHECK((result.value() == Logging::ERROR_LOG_FAILURE));
@@ -761,7 +1708,7 @@ SCENARIO("Logger")
 		{
 			spdlog::set_error_handler([] ATTR_NORETURN(const std::string &msg) { throw spdlog::spdlog_ex(msg); });
 
-			std::optional<std::string_view> result{Logger::critical("{} {}", 999)};
+			std::optional<std::string_view> result{Logger::critical(std::string_view{"{} {}"}, 999)};
 
 			REQUIRE(result.has_value());
 			CHECK((result.value() == Logging::CRITICAL_LOG_FAILURE));
@@ -776,7 +1723,7 @@ SCENARIO("Logger")
 		{
 			spdlog::set_error_handler([] ATTR_NORETURN(const std::string &msg) { throw std::runtime_error(msg); });
 
-			CHECK_THROWS_AS(static_cast<void>(Logger::log(spdlog::level::info, "{} {}", 77)), std::runtime_error);
+			CHECK_THROWS_AS(static_cast<void>(Logger::log(spdlog::level::info, std::string_view{"{} {}"}, 77)), std::runtime_error);
 
 			spdlog::set_error_handler([](const std::string & /*msg*/) {});
 		}
@@ -786,7 +1733,7 @@ SCENARIO("Logger")
 			Logger::setLevel(spdlog::level::trace);
 			spdlog::set_error_handler([] ATTR_NORETURN(const std::string &msg) { throw std::runtime_error(msg); });
 
-			CHECK_THROWS_AS(static_cast<void>(Logger::trace("{} {}", 42)), std::runtime_error);
+			CHECK_THROWS_AS(static_cast<void>(Logger::trace(std::string_view{"{} {}"}, 42)), std::runtime_error);
 
 			spdlog::set_error_handler([](const std::string & /*msg*/) {});
 			Logger::setLevel(spdlog::level::info);
@@ -797,7 +1744,7 @@ SCENARIO("Logger")
 			Logger::setLevel(spdlog::level::debug);
 			spdlog::set_error_handler([] ATTR_NORETURN(const std::string &msg) { throw std::runtime_error(msg); });
 
-			CHECK_THROWS_AS(static_cast<void>(Logger::debug("{} {}", "hello")), std::runtime_error);
+			CHECK_THROWS_AS(static_cast<void>(Logger::debug(std::string_view{"{} {}"}, "hello")), std::runtime_error);
 
 			spdlog::set_error_handler([](const std::string & /*msg*/) {});
 			Logger::setLevel(spdlog::level::info);
@@ -807,7 +1754,7 @@ SCENARIO("Logger")
 		{
 			spdlog::set_error_handler([] ATTR_NORETURN(const std::string &msg) { throw std::runtime_error(msg); });
 
-			CHECK_THROWS_AS(static_cast<void>(Logger::info("{} {}", 100)), std::runtime_error);
+			CHECK_THROWS_AS(static_cast<void>(Logger::info(std::string_view{"{} {}"}, 100)), std::runtime_error);
 
 			spdlog::set_error_handler([](const std::string & /*msg*/) {});
 		}
@@ -816,7 +1763,7 @@ SCENARIO("Logger")
 		{
 			spdlog::set_error_handler([] ATTR_NORETURN(const std::string &msg) { throw std::runtime_error(msg); });
 
-			CHECK_THROWS_AS(static_cast<void>(Logger::warn("{} {}", 3.14)), std::runtime_error);
+			CHECK_THROWS_AS(static_cast<void>(Logger::warn(std::string_view{"{} {}"}, 3.14)), std::runtime_error);
 
 			spdlog::set_error_handler([](const std::string & /*msg*/) {});
 		}
@@ -825,7 +1772,7 @@ SCENARIO("Logger")
 		{
 			spdlog::set_error_handler([] ATTR_NORETURN(const std::string &msg) { throw std::runtime_error(msg); });
 
-			CHECK_THROWS_AS(static_cast<void>(Logger::error("{} {}", "failure")), std::runtime_error);
+			CHECK_THROWS_AS(static_cast<void>(Logger::error(std::string_view{"{} {}"}, "failure")), std::runtime_error);
 
 			spdlog::set_error_handler([](const std::string & /*msg*/) {});
 		}
@@ -834,7 +1781,7 @@ SCENARIO("Logger")
 		{
 			spdlog::set_error_handler([] ATTR_NORETURN(const std::string &msg) { throw std::runtime_error(msg); });
 
-			CHECK_THROWS_AS(static_cast<void>(Logger::critical("{} {}", 999)), std::runtime_error);
+			CHECK_THROWS_AS(static_cast<void>(Logger::critical(std::string_view{"{} {}"}, 999)), std::runtime_error);
 
 			spdlog::set_error_handler([](const std::string & /*msg*/) {});
 		}
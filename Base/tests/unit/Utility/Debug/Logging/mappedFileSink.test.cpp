@@ -0,0 +1,236 @@
+/*! @file mappedFileSink.test.cpp
+	@brief Catch2 BDD unit tests for the memory-mapped spdlog file sink.
+	@details Extents in these tests are a single page so that a few hundred records already cross many extent boundaries.
+	@date --/--/----
+	@version x.x.x
+	@since x.x.x
+	@author Matthew Moore
+*/
+
+#include "Utility/Debug/Logging/mappedFileSink.h"
+
+#include <algorithm>
+#include <atomic>
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "Core/attributeMacros.h"
+#include "Core/typedefs.h"
+#include "Utility/Debug/Logging/loggerOptions.h"
+
+#include <catch2/catch_test_macros.hpp>
+#include <spdlog/common.h>
+#include <spdlog/logger.h>
+
+namespace Logging = Project::Utility::Debug::Logging;
+
+using Logging::MappedFileSink;
+using Logging::SyncPolicy;
+using Project::Core::ul;
+
+// NOLINTBEGIN(misc-const-correctness,cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers,readability-function-cognitive-complexity)
+
+namespace
+{
+	/*! @brief Reads the full contents of a file.
+		@param[in] fileName The file to read.
+		@return The file contents as a string.
+	*/
+	ATTR_NODISCARD std::string readFile(const std::string &fileName) // NOLINT(llvm-prefer-static-over-anonymous-namespace)
+	{
+		std::ifstream file(fileName, std::ios::binary);
+		std::ostringstream contents;
+		contents << file.rdbuf();
+		return contents.str();
+	}
+
+	/*! @brief Counts the lines in @p text.
+		@param[in] text The text to scan.
+		@return The number of newline characters.
+	*/
+	ATTR_NODISCARD ul countLines(const std::string &text) // NOLINT(llvm-prefer-static-over-anonymous-namespace)
+	{
+		return static_cast<ul>(std::ranges::count(text, '\n'));
+	}
+
+	/*! @brief A one-page extent, so tests cross extent boundaries quickly. */
+	constexpr ul SMALL_EXTENT{4'096};
+
+	/*! @brief A size limit far beyond what any test writes. */
+	constexpr ul LARGE_LIMIT{16'777'216};
+} // namespace
+
+SCENARIO("MappedFileSink")
+{
+	const std::string fileName{"mapped_file_sink_test_output.log"};
+
+	bool fileRemoved{std::filesystem::remove(fileName)};
+	REQUIRE(!fileRemoved);
+
+	GIVEN("a new file")
+	{
+		THEN("records cross extent boundaries intact and the file is truncated to them on destruction")
+		{
+			std::string expected{};
+
+			{
+				const std::shared_ptr<MappedFileSink> sink{std::make_shared<MappedFileSink>(fileName, SMALL_EXTENT, LARGE_LIMIT, SyncPolicy::Never)};
+				spdlog::logger logger{"mapped_file_sink_extents", sink};
+				logger.set_pattern("%v");
+
+				for (int i{0}; i < 1'000; ++i)
+				{
+					logger.info("record {:04}", i);
+					expected += "record " + std::string(4 - std::to_string(i).size(), '0') + std::to_string(i) + '\n';
+				}
+
+				CHECK((sink->size() == expected.size()));
+				CHECK((std::filesystem::file_size(fileName) > expected.size()));
+			}
+
+			CHECK((readFile(fileName) == expected));
+		}
+
+		THEN("records from several threads are all written and each thread keeps its order")
+		{
+			{
+				const std::shared_ptr<MappedFileSink> sink{std::make_shared<MappedFileSink>(fileName, SMALL_EXTENT, LARGE_LIMIT, SyncPolicy::Never)};
+				spdlog::logger logger{"mapped_file_sink_threads", sink};
+				logger.set_pattern("%v");
+				std::vector<std::thread> threads{};
+
+				for (int thread{0}; thread < 4; ++thread)
+				{
+					threads.emplace_back([&logger, thread] {
+						for (int i{0}; i < 1'000; ++i)
+						{
+							logger.info("thread {} record {:04}", thread, i);
+						}
+					});
+				}
+
+				for (std::thread &worker : threads)
+				{
+					worker.join();
+				}
+			}
+
+			const std::string contents{readFile(fileName)};
+			CHECK((countLines(contents) == 4'000));
+			CHECK_FALSE(contents.contains('\0'));
+
+			for (int thread{0}; thread < 4; ++thread)
+			{
+				const std::string prefix{"thread " + std::to_string(thread) + " record "};
+				CHECK((contents.find(prefix + "0000\n") < contents.find(prefix + "0500\n")));
+				CHECK((contents.find(prefix + "0500\n") < contents.find(prefix + "0999\n")));
+			}
+		}
+
+		THEN("records are readable through the file while the sink is still open")
+		{
+			const std::shared_ptr<MappedFileSink> sink{std::make_shared<MappedFileSink>(fileName, SMALL_EXTENT, LARGE_LIMIT, SyncPolicy::Synchronous)};
+			spdlog::logger logger{"mapped_file_sink_live", sink};
+			logger.set_pattern("%v");
+
+			logger.info("visible before close");
+			logger.flush();
+
+			CHECK(readFile(fileName).starts_with("visible before close\n"));
+		}
+	}
+
+	GIVEN("a file that already holds records")
+	{
+		THEN("new records are appended after them")
+		{
+			std::ofstream{fileName} << "existing\n";
+
+			{
+				const std::shared_ptr<MappedFileSink> sink{std::make_shared<MappedFileSink>(fileName, SMALL_EXTENT, LARGE_LIMIT, SyncPolicy::Asynchronous)};
+				spdlog::logger logger{"mapped_file_sink_append", sink};
+				logger.set_pattern("%v");
+				logger.info("appended");
+				logger.flush();
+			}
+
+			CHECK((readFile(fileName) == "existing\nappended\n"));
+		}
+
+		THEN("zero padding left by a process that never closed the sink is trimmed")
+		{
+			{
+				std::ofstream file{fileName, std::ios::binary};
+				file << "before crash\n" << std::string(SMALL_EXTENT, '\0');
+			}
+
+			{
+				const std::shared_ptr<MappedFileSink> sink{std::make_shared<MappedFileSink>(fileName, SMALL_EXTENT, LARGE_LIMIT, SyncPolicy::Never)};
+				spdlog::logger logger{"mapped_file_sink_trim", sink};
+				logger.set_pattern("%v");
+				logger.info("after restart");
+			}
+
+			CHECK((readFile(fileName) == "before crash\nafter restart\n"));
+		}
+	}
+
+	GIVEN("a size limit")
+	{
+		THEN("records that would exceed it are counted as dropped and the file never grows past it")
+		{
+			std::shared_ptr<MappedFileSink> sink{std::make_shared<MappedFileSink>(fileName, SMALL_EXTENT, SMALL_EXTENT * 2, SyncPolicy::Never)};
+
+			{
+				spdlog::logger logger{"mapped_file_sink_limit", sink};
+				logger.set_pattern("%v");
+
+				for (int i{0}; i < 1'000; ++i)
+				{
+					logger.info("record {:04}", i);
+				}
+			}
+
+			const ul dropped{sink->droppedCount()};
+			sink.reset();
+
+			const std::string contents{readFile(fileName)};
+			CHECK((dropped > 0));
+			CHECK((countLines(contents) + dropped == 1'000));
+			CHECK((contents.size() <= SMALL_EXTENT * 2));
+		}
+
+		THEN("a file already larger than the limit is rejected")
+		{
+			std::ofstream{fileName} << std::string(SMALL_EXTENT + 1, 'x');
+
+			CHECK_THROWS_AS(MappedFileSink(fileName, SMALL_EXTENT, SMALL_EXTENT, SyncPolicy::Never), spdlog::spdlog_ex);
+			CHECK((std::filesystem::file_size(fileName) == SMALL_EXTENT + 1));
+		}
+	}
+
+	GIVEN("an unopenable file")
+	{
+		THEN("construction throws spdlog_ex")
+		{
+			// A regular file used as a directory component cannot be created or opened, even with elevated privileges
+			const std::string notADirectory{"mapped_file_sink_not_a_directory"};
+			std::ofstream{notADirectory}.close();
+
+			CHECK_THROWS_AS(MappedFileSink(notADirectory + "/mapped.log", SMALL_EXTENT, LARGE_LIMIT, SyncPolicy::Never), spdlog::spdlog_ex);
+
+			REQUIRE(std::filesystem::remove(notADirectory));
+		}
+	}
+
+	// Scenario-level cleanup
+	fileRemoved = std::filesystem::remove(fileName);
+	static_cast<void>(fileRemoved);
+}
+
+// NOLINTEND(misc-const-correctness,cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers,readability-function-cognitive-complexity)
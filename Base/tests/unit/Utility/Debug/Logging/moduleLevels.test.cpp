@@ -0,0 +1,103 @@
+/*! @file moduleLevels.test.cpp
+	@brief Catch2 BDD unit tests for the module registry and the resolution of per-module log levels.
+	@details The registry is process-wide, so every module name used here is unique to this file.
+	@date --/--/----
+	@version x.x.x
+	@since x.x.x
+	@author Matthew Moore
+*/
+
+#include "Utility/Debug/Logging/moduleLevels.h"
+
+#include <string>
+#include <vector>
+
+#include "Utility/Debug/Logging/loggerOptions.h"
+
+#include <catch2/catch_test_macros.hpp>
+#include <spdlog/common.h>
+
+namespace Logging = Project::Utility::Debug::Logging;
+
+using Logging::ModuleId;
+using Logging::ModuleLevel;
+using Logging::ModuleLevels;
+
+// NOLINTBEGIN(misc-const-correctness,cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers,readability-function-cognitive-complexity)
+
+SCENARIO("ModuleLevels resolves a dotted hierarchy into a flat table", "[utility][debug][logging][moduleLevels]")
+{
+	GIVEN("module names")
+	{
+		THEN("a name covers itself and its dotted descendants only")
+		{
+			CHECK(ModuleLevels::covers("", "anything"));
+			CHECK(ModuleLevels::covers("net", "net"));
+			CHECK(ModuleLevels::covers("net", "net.http"));
+			CHECK(ModuleLevels::covers("net", "net.http.client"));
+			CHECK(ModuleLevels::covers("net.http", "net.http.client"));
+			CHECK_FALSE(ModuleLevels::covers("net", "network"));
+			CHECK_FALSE(ModuleLevels::covers("net.http", "net"));
+			CHECK_FALSE(ModuleLevels::covers("http", "net.http"));
+		}
+
+		THEN("registering is idempotent and ids are stable")
+		{
+			const ModuleId count{ModuleLevels::moduleCount()};
+			const ModuleId first{ModuleLevels::registerModule("moduleLevels.test.first")};
+			const ModuleId second{ModuleLevels::registerModule("moduleLevels.test.second")};
+
+			CHECK((first != Logging::ROOT_MODULE));
+			CHECK((first != second));
+			CHECK((ModuleLevels::registerModule("moduleLevels.test.first") == first));
+			CHECK((ModuleLevels::moduleCount() == count + 2));
+			CHECK((ModuleLevels::registerModule("") == Logging::ROOT_MODULE));
+		}
+	}
+
+	GIVEN("a small hierarchy")
+	{
+		const ModuleId storage{ModuleLevels::registerModule("mlt.storage")};
+		const ModuleId disk{ModuleLevels::registerModule("mlt.storage.disk")};
+		const ModuleId cache{ModuleLevels::registerModule("mlt.storage.cache")};
+		const ModuleId ui{ModuleLevels::registerModule("mlt.ui")};
+
+		THEN("modules without an override use the fallback")
+		{
+			const ModuleLevels levels{ModuleLevels::resolve(spdlog::level::warn, {})};
+
+			CHECK((levels.level(Logging::ROOT_MODULE) == spdlog::level::warn));
+			CHECK((levels.level(disk) == spdlog::level::warn));
+			CHECK((levels.lowest() == spdlog::level::warn));
+		}
+
+		THEN("the most specific override wins, whatever the order")
+		{
+			const std::vector<ModuleLevel> overrides{{.module = "mlt.storage.disk", .level = spdlog::level::trace},
+													 {.module = "mlt.storage", .level = spdlog::level::debug},
+													 {.module = "mlt", .level = spdlog::level::err}};
+			const ModuleLevels levels{ModuleLevels::resolve(spdlog::level::info, overrides)};
+
+			CHECK((levels.level(storage) == spdlog::level::debug));
+			CHECK((levels.level(disk) == spdlog::level::trace));
+			CHECK((levels.level(cache) == spdlog::level::debug));
+			CHECK((levels.level(ui) == spdlog::level::err));
+			CHECK((levels.level(Logging::ROOT_MODULE) == spdlog::level::info));
+			CHECK((levels.lowest() == spdlog::level::trace));
+		}
+
+		THEN("the root override applies where nothing closer does, and the last of equal names wins")
+		{
+			const std::vector<ModuleLevel> overrides{{.module = "", .level = spdlog::level::critical},
+													 {.module = "mlt.ui", .level = spdlog::level::debug},
+													 {.module = "mlt.ui", .level = spdlog::level::warn}};
+			const ModuleLevels levels{ModuleLevels::resolve(spdlog::level::info, overrides)};
+
+			CHECK((levels.level(Logging::ROOT_MODULE) == spdlog::level::critical));
+			CHECK((levels.level(storage) == spdlog::level::critical));
+			CHECK((levels.level(ui) == spdlog::level::warn));
+		}
+	}
+}
+
+// NOLINTEND(misc-const-correctness,cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers,readability-function-cognitive-complexity)
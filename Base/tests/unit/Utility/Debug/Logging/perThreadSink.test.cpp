@@ -0,0 +1,254 @@
+/*! @file perThreadSink.test.cpp
+	@brief Catch2 BDD unit tests for the per-thread buffered spdlog sink.
+	@details Records go through a plain spdlog::logger where the path through spdlog matters, and straight into the sink where a test needs
+   to control record timestamps. Merge-order tests use a writer poll interval far longer than the test, so the only pass that drains the
+   buffers is the one triggered by the explicit flush.
+	@date --/--/----
+	@version x.x.x
+	@since x.x.x
+	@author Matthew Moore
+*/
+
+#include "Utility/Debug/Logging/perThreadSink.h"
+
+#include <algorithm>
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "Core/attributeMacros.h"
+#include "Core/typedefs.h"
+#include "Utility/Debug/Logging/loggerOptions.h"
+
+#include <catch2/catch_test_macros.hpp>
+#include <spdlog/common.h>
+#include <spdlog/details/log_msg.h>
+#include <spdlog/logger.h>
+
+namespace Logging = Project::Utility::Debug::Logging;
+
+using Logging::OverflowPolicy;
+using Logging::PerThreadSink;
+using Project::Core::sl;
+using Project::Core::ul;
+
+// NOLINTBEGIN(misc-const-correctness,cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers,readability-function-cognitive-complexity)
+
+namespace
+{
+	/*! @brief Reads the full contents of a file.
+		@param[in] fileName The file to read.
+		@return The file contents as a string.
+	*/
+	ATTR_NODISCARD std::string readFile(const std::string &fileName) // NOLINT(llvm-prefer-static-over-anonymous-namespace)
+	{
+		std::ifstream file(fileName);
+		std::ostringstream contents;
+		contents << file.rdbuf();
+		return contents.str();
+	}
+
+	/*! @brief Counts the lines in @p text.
+		@param[in] text The text to scan.
+		@return The number of newline characters.
+	*/
+	ATTR_NODISCARD ul countLines(const std::string &text) // NOLINT(llvm-prefer-static-over-anonymous-namespace)
+	{
+		return static_cast<ul>(std::ranges::count(text, '\n'));
+	}
+
+	/*! @brief Logs @p text straight into @p sink with a synthetic timestamp.
+		@param[in,out] sink The sink under test.
+		@param[in] nanoseconds The record's timestamp since the epoch.
+		@param[in] text The message.
+	*/
+	void logAt(PerThreadSink &sink, const sl nanoseconds, const std::string &text) // NOLINT(llvm-prefer-static-over-anonymous-namespace)
+	{
+		const spdlog::log_clock::time_point time{std::chrono::duration_cast<spdlog::log_clock::duration>(std::chrono::nanoseconds{nanoseconds})};
+		sink.log(spdlog::details::log_msg{time, spdlog::source_loc{}, "per_thread", spdlog::level::info, text});
+	}
+
+	/*! @brief A poll interval no test outlives, so the writer only drains when flushed. */
+	constexpr std::chrono::hours NEVER{24};
+} // namespace
+
+SCENARIO("PerThreadSink")
+{
+	const std::string fileName{"per_thread_sink_test_output.log"};
+
+	bool fileRemoved{std::filesystem::remove(fileName)};
+	REQUIRE(!fileRemoved);
+
+	GIVEN("the blocking overflow policy")
+	{
+		THEN("records from several threads are all written and each thread keeps its order")
+		{
+			const std::shared_ptr<PerThreadSink> sink{std::make_shared<PerThreadSink>(fileName, 256, OverflowPolicy::Block)};
+			spdlog::logger logger{"per_thread_sink_threads", sink};
+			logger.set_pattern("%v");
+			std::vector<std::thread> threads{};
+
+			for (int thread{0}; thread < 4; ++thread)
+			{
+				threads.emplace_back([&logger, thread] {
+					for (int i{0}; i < 1'000; ++i)
+					{
+						logger.info("thread {} record {:04}", thread, i);
+					}
+				});
+			}
+
+			for (std::thread &worker : threads)
+			{
+				worker.join();
+			}
+
+			logger.flush();
+
+			const std::string contents{readFile(fileName)};
+			CHECK((countLines(contents) == 4'000));
+			CHECK((sink->droppedCount() == 0));
+
+			for (int thread{0}; thread < 4; ++thread)
+			{
+				const std::string prefix{"thread " + std::to_string(thread) + " record "};
+				CHECK((contents.find(prefix + "0000\n") < contents.find(prefix + "0500\n")));
+				CHECK((contents.find(prefix + "0500\n") < contents.find(prefix + "0999\n")));
+			}
+		}
+	}
+
+	GIVEN("records from several threads drained in one pass")
+	{
+		THEN("the file is ordered by timestamp rather than by thread")
+		{
+			const std::shared_ptr<PerThreadSink> sink{std::make_shared<PerThreadSink>(fileName, 65'536, OverflowPolicy::Block, NEVER)};
+			sink->set_pattern("%v");
+			std::vector<std::thread> threads{};
+
+			// Thread t logs timestamps t, t + 3, t + 6, ... so the merged file must interleave the three threads record by record
+			for (int thread{0}; thread < 3; ++thread)
+			{
+				threads.emplace_back([&sink, thread] {
+					for (int i{0}; i < 100; ++i)
+					{
+						const int order{(i * 3) + thread};
+						logAt(*sink, 1'000 + order, std::to_string(order));
+					}
+				});
+			}
+
+			for (std::thread &worker : threads)
+			{
+				worker.join();
+			}
+
+			sink->flush();
+
+			std::string expected{};
+
+			for (int order{0}; order < 300; ++order)
+			{
+				expected += std::to_string(order) + '\n';
+			}
+
+			CHECK((readFile(fileName) == expected));
+		}
+	}
+
+	GIVEN("the drop-newest overflow policy")
+	{
+		THEN("every record is either written or counted as dropped")
+		{
+			const std::shared_ptr<PerThreadSink> sink{std::make_shared<PerThreadSink>(fileName, 64, OverflowPolicy::DropNewest, NEVER)};
+			spdlog::logger logger{"per_thread_sink_drop_newest", sink};
+			logger.set_pattern("%v");
+
+			for (int i{0}; i < 1'000; ++i)
+			{
+				logger.info("record {}", i);
+			}
+
+			logger.flush();
+
+			CHECK((sink->droppedCount() > 0));
+			CHECK((countLines(readFile(fileName)) + sink->droppedCount() == 1'000));
+		}
+
+		THEN("a record larger than the buffer is counted as dropped")
+		{
+			const std::shared_ptr<PerThreadSink> sink{std::make_shared<PerThreadSink>(fileName, 64, OverflowPolicy::Block)};
+			spdlog::logger logger{"per_thread_sink_oversized", sink};
+			logger.set_pattern("%v");
+
+			logger.info("{}", std::string(128, 'x'));
+			logger.info("small");
+			logger.flush();
+
+			const std::string contents{readFile(fileName)};
+			CHECK((countLines(contents) == 1));
+			CHECK(contents.contains("small"));
+			CHECK((sink->droppedCount() == 1));
+		}
+	}
+
+	GIVEN("a pattern changed after a thread has logged")
+	{
+		THEN("the thread's next record uses the new pattern")
+		{
+			const std::shared_ptr<PerThreadSink> sink{std::make_shared<PerThreadSink>(fileName, 1'024, OverflowPolicy::Block)};
+			spdlog::logger logger{"per_thread_sink_pattern", sink};
+
+			logger.set_pattern("%v");
+			logger.warn("plain");
+			logger.set_pattern("[%l] %v");
+			logger.warn("patterned");
+			logger.flush();
+
+			CHECK((readFile(fileName) == "plain\n[warning] patterned\n"));
+		}
+	}
+
+	GIVEN("a sink that is destroyed without an explicit flush")
+	{
+		THEN("buffered records are still written")
+		{
+			{
+				const std::shared_ptr<PerThreadSink> sink{std::make_shared<PerThreadSink>(fileName, 4'096, OverflowPolicy::Block, NEVER)};
+				spdlog::logger logger{"per_thread_sink_destroy", sink};
+
+				for (int i{0}; i < 50; ++i)
+				{
+					logger.info("record {}", i);
+				}
+			}
+
+			CHECK((countLines(readFile(fileName)) == 50));
+		}
+	}
+
+	GIVEN("an unopenable file")
+	{
+		THEN("construction throws spdlog_ex")
+		{
+			// A regular file used as a directory component cannot be created or opened, even with elevated privileges
+			const std::string notADirectory{"per_thread_sink_not_a_directory"};
+			std::ofstream{notADirectory}.close();
+
+			CHECK_THROWS_AS(PerThreadSink(notADirectory + "/per_thread.log", 64, OverflowPolicy::Block), spdlog::spdlog_ex);
+
+			REQUIRE(std::filesystem::remove(notADirectory));
+		}
+	}
+
+	// Scenario-level cleanup
+	fileRemoved = std::filesystem::remove(fileName);
+	static_cast<void>(fileRemoved);
+}
+
+// NOLINTEND(misc-const-correctness,cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers,readability-function-cognitive-complexity)
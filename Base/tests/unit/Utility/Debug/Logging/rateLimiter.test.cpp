@@ -0,0 +1,201 @@
+/*! @file rateLimiter.test.cpp
+	@brief Catch2 BDD unit tests for the per-call-site token bucket and sampler.
+	@details Time is passed in explicitly, so every bucket is checked against exact nanosecond values rather than the wall clock.
+	@date --/--/----
+	@version x.x.x
+	@since x.x.x
+	@author Matthew Moore
+*/
+
+#include "Utility/Debug/Logging/rateLimiter.h"
+
+#include <array>
+#include <chrono>
+
+#include "Core/typedefs.h"
+#include "Utility/Debug/Logging/loggerOptions.h"
+
+#include <catch2/catch_test_macros.hpp>
+
+namespace Logging = Project::Utility::Debug::Logging;
+
+using Logging::RateLimiter;
+using Logging::RateLimitOptions;
+using Project::Core::sl;
+using Project::Core::ul;
+
+// NOLINTBEGIN(misc-const-correctness,cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers,readability-function-cognitive-complexity)
+
+namespace
+{
+	/*! @brief One second in nanoseconds. */
+	constexpr sl SECOND{1'000'000'000};
+
+	/*! @brief Stand-ins for two call sites' format strings. */
+	constexpr std::array<char, 2> SITES{'a', 'b'};
+} // namespace
+
+SCENARIO("RateLimiter limits each call site on its own", "[utility][debug][logging][rateLimiter]")
+{
+	GIVEN("options")
+	{
+		THEN("only a token bucket or sampling counts as limiting")
+		{
+			CHECK_FALSE(RateLimiter::enabled(RateLimitOptions{}));
+			CHECK_FALSE(RateLimiter::enabled(RateLimitOptions{.burst = 5}));
+			CHECK_FALSE(RateLimiter::enabled(RateLimitOptions{.perSecond = 5.0}));
+			CHECK(RateLimiter::enabled(RateLimitOptions{.burst = 5, .perSecond = 5.0}));
+			CHECK(RateLimiter::enabled(RateLimitOptions{.sampleRate = 0.5}));
+		}
+	}
+
+	GIVEN("a bucket of two tokens refilled once a second and no periodic reports")
+	{
+		RateLimiter limiter{RateLimitOptions{.burst = 2, .perSecond = 1.0, .summaryInterval = std::chrono::milliseconds::zero()}};
+
+		THEN("a burst is admitted, the rest is counted, and the count rides on the next admitted record")
+		{
+			RateLimiter::Admission admission{limiter.admit(&SITES[0], 0)};
+			CHECK(admission.write);
+			CHECK(admission.suppressed == 0);
+
+			CHECK(limiter.admit(&SITES[0], 0).write);
+
+			for (int i{0}; i < 3; ++i)
+			{
+				admission = limiter.admit(&SITES[0], 0);
+				CHECK_FALSE(admission.write);
+				CHECK(admission.suppressed == 0);
+			}
+
+			admission = limiter.admit(&SITES[0], SECOND / 2);
+			CHECK_FALSE(admission.write);
+
+			admission = limiter.admit(&SITES[0], SECOND);
+			CHECK(admission.write);
+			CHECK(admission.suppressed == 4);
+
+			admission = limiter.admit(&SITES[0], SECOND);
+			CHECK_FALSE(admission.write);
+			CHECK(admission.suppressed == 0);
+		}
+
+		THEN("an idle site refills to the burst and no further")
+		{
+			CHECK(limiter.admit(&SITES[0], 0).write);
+			CHECK(limiter.admit(&SITES[0], 0).write);
+
+			CHECK(limiter.admit(&SITES[0], 100 * SECOND).write);
+			CHECK(limiter.admit(&SITES[0], 100 * SECOND).write);
+			CHECK_FALSE(limiter.admit(&SITES[0], 100 * SECOND).write);
+		}
+
+		THEN("sites do not share a bucket")
+		{
+			CHECK(limiter.admit(&SITES[0], 0).write);
+			CHECK(limiter.admit(&SITES[0], 0).write);
+			CHECK_FALSE(limiter.admit(&SITES[0], 0).write);
+
+			CHECK(limiter.admit(&SITES[1], 0).write);
+			CHECK(limiter.admit(&SITES[1], 0).write);
+			CHECK_FALSE(limiter.admit(&SITES[1], 0).write);
+		}
+	}
+
+	GIVEN("a bucket of one token a second reporting every second")
+	{
+		RateLimiter limiter{RateLimitOptions{.burst = 1, .perSecond = 1.0, .summaryInterval = std::chrono::seconds{1}}};
+
+		THEN("the first held-back record reports at once and later ones wait for the interval")
+		{
+			CHECK(limiter.admit(&SITES[0], 5 * SECOND).write);
+
+			RateLimiter::Admission admission{limiter.admit(&SITES[0], 5 * SECOND)};
+			CHECK_FALSE(admission.write);
+			CHECK(admission.suppressed == 1);
+
+			admission = limiter.admit(&SITES[0], 5 * SECOND);
+			CHECK_FALSE(admission.write);
+			CHECK(admission.suppressed == 0);
+
+			admission = limiter.admit(&SITES[0], 5 * SECOND + SECOND / 2);
+			CHECK_FALSE(admission.write);
+			CHECK(admission.suppressed == 0);
+
+			admission = limiter.admit(&SITES[0], 6 * SECOND);
+			CHECK(admission.write);
+			CHECK(admission.suppressed == 2);
+		}
+
+		THEN("a flood that never lets up is still reported once per interval")
+		{
+			RateLimiter starved{RateLimitOptions{.burst = 1, .perSecond = 0.001, .summaryInterval = std::chrono::seconds{1}}};
+			CHECK(starved.admit(&SITES[0], 5 * SECOND).write);
+
+			ul reports{0};
+			ul suppressed{0};
+
+			for (sl now{5 * SECOND}; now < 8 * SECOND; now += SECOND / 10)
+			{
+				const RateLimiter::Admission admission{starved.admit(&SITES[0], now)};
+				CHECK_FALSE(admission.write);
+
+				if (admission.suppressed != 0)
+				{
+					++reports;
+					suppressed += admission.suppressed;
+				}
+			}
+
+			CHECK(reports == 3);
+			CHECK(suppressed == 21);
+		}
+	}
+
+	GIVEN("sampling only")
+	{
+		THEN("a rate of 0 keeps nothing")
+		{
+			RateLimiter limiter{RateLimitOptions{.sampleRate = 0.0, .summaryInterval = std::chrono::milliseconds::zero()}};
+
+			for (int i{0}; i < 100; ++i)
+			{
+				CHECK_FALSE(limiter.admit(&SITES[0], 0).write);
+			}
+		}
+
+		THEN("a rate of one half keeps about half")
+		{
+			RateLimiter limiter{RateLimitOptions{.sampleRate = 0.5, .summaryInterval = std::chrono::milliseconds::zero()}};
+			int kept{0};
+
+			for (int i{0}; i < 10'000; ++i)
+			{
+				kept += limiter.admit(&SITES[0], 0).write ? 1 : 0;
+			}
+
+			CHECK(kept > 4'000);
+			CHECK(kept < 6'000);
+		}
+	}
+
+	GIVEN("a table with room for one site")
+	{
+		RateLimiter limiter{RateLimitOptions{.burst = 1, .perSecond = 1.0, .sites = 1}};
+
+		THEN("the first site is limited and the rest are not")
+		{
+			CHECK(limiter.admit(&SITES[0], 0).write);
+			CHECK_FALSE(limiter.admit(&SITES[0], 0).write);
+
+			for (int i{0}; i < 10; ++i)
+			{
+				const RateLimiter::Admission admission{limiter.admit(&SITES[1], 0)};
+				CHECK(admission.write);
+				CHECK(admission.suppressed == 0);
+			}
+		}
+	}
+}
+
+// NOLINTEND(misc-const-correctness,cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers,readability-function-cognitive-complexity)
@@ -0,0 +1,185 @@
+/*! @file repeatFilter.test.cpp
+	@brief Catch2 BDD unit tests for the per-thread filter that collapses consecutive identical log records.
+	@date --/--/----
+	@version x.x.x
+	@since x.x.x
+	@author Matthew Moore
+*/
+
+#include "Utility/Debug/Logging/repeatFilter.h"
+
+#include <chrono>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+#include "Utility/Debug/Logging/binaryDecoder.h"
+
+#include <catch2/catch_test_macros.hpp>
+#include <spdlog/common.h>
+
+namespace Logging = Project::Utility::Debug::Logging;
+
+using Logging::RepeatFilter;
+
+namespace
+{
+	/*! @brief Formats a reported run's message from its format and encoded arguments.
+		@param run The run.
+		@return The message, or an empty string if it cannot be decoded.
+	*/
+	std::string message(const RepeatFilter::Run &run) // NOLINT(llvm-prefer-static-over-anonymous-namespace)
+	{
+		spdlog::memory_buf_t buffer{};
+		return Logging::Binary::formatPayload(run.format, run.payload, buffer) ? std::string{buffer.data(), buffer.size()} : std::string{};
+	}
+} // namespace
+
+// NOLINTBEGIN(misc-const-correctness,cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers,readability-function-cognitive-complexity)
+
+SCENARIO("RepeatFilter")
+{
+	constexpr std::string_view FORMAT{"disk {} full"};
+	const spdlog::log_clock::time_point start{std::chrono::seconds{1'000}};
+
+	GIVEN("a filter with a one-second interval")
+	{
+		RepeatFilter filter{std::chrono::seconds{1}};
+
+		THEN("the first record is written")
+		{
+			const RepeatFilter::Verdict verdict{filter.observe(1, FORMAT.data(), spdlog::level::info, FORMAT, start, 1)};
+
+			CHECK(verdict.write);
+			CHECK((verdict.run.repeats == 0));
+		}
+
+		WHEN("a record repeats three times")
+		{
+			REQUIRE(filter.observe(1, FORMAT.data(), spdlog::level::info, FORMAT, start, 1).write);
+
+			for (int i{1}; i <= 3; ++i)
+			{
+				const RepeatFilter::Verdict verdict{
+					filter.observe(1, FORMAT.data(), spdlog::level::info, FORMAT, start + std::chrono::milliseconds{i}, 1)};
+				CHECK_FALSE(verdict.write);
+				CHECK((verdict.run.repeats == 0));
+			}
+
+			THEN("the next different record is written and reports the run")
+			{
+				const RepeatFilter::Verdict verdict{
+					filter.observe(1, FORMAT.data(), spdlog::level::info, FORMAT, start + std::chrono::milliseconds{10}, 2)};
+
+				CHECK(verdict.write);
+				CHECK((verdict.run.repeats == 3));
+				CHECK((verdict.run.level == spdlog::level::info));
+				CHECK((verdict.run.first == start + std::chrono::milliseconds{1}));
+				CHECK((verdict.run.last == start + std::chrono::milliseconds{3}));
+				CHECK((message(verdict.run) == "disk 1 full"));
+			}
+
+			THEN("the same arguments at another level, from another format or with another type are written")
+			{
+				CHECK(filter.observe(1, FORMAT.data(), spdlog::level::warn, FORMAT, start, 1).write);
+
+				constexpr std::string_view OTHER{"disk {} is full"};
+				CHECK(filter.observe(1, OTHER.data(), spdlog::level::warn, OTHER, start, 1).write);
+				CHECK(filter.observe(1, OTHER.data(), spdlog::level::warn, OTHER, start, 1U).write);
+			}
+
+			THEN("a record from a new epoch is written")
+			{
+				const RepeatFilter::Verdict verdict{filter.observe(2, FORMAT.data(), spdlog::level::info, FORMAT, start, 1)};
+
+				CHECK(verdict.write);
+				CHECK((verdict.run.repeats == 3));
+			}
+		}
+
+		WHEN("a record keeps repeating past the interval")
+		{
+			REQUIRE(filter.observe(1, FORMAT.data(), spdlog::level::info, FORMAT, start, 1).write);
+			REQUIRE_FALSE(filter.observe(1, FORMAT.data(), spdlog::level::info, FORMAT, start + std::chrono::milliseconds{1}, 1).write);
+
+			const RepeatFilter::Verdict verdict{
+				filter.observe(1, FORMAT.data(), spdlog::level::info, FORMAT, start + std::chrono::milliseconds{1'001}, 1)};
+
+			THEN("the run is reported without writing the record")
+			{
+				CHECK_FALSE(verdict.write);
+				CHECK((verdict.run.repeats == 2));
+				CHECK((message(verdict.run) == "disk 1 full"));
+			}
+
+			THEN("counting starts again")
+			{
+				const RepeatFilter::Verdict next{
+					filter.observe(1, FORMAT.data(), spdlog::level::info, FORMAT, start + std::chrono::milliseconds{1'002}, 2)};
+
+				CHECK(next.write);
+				CHECK((next.run.repeats == 0));
+			}
+		}
+
+		WHEN("arguments longer than the inline buffer repeat")
+		{
+			constexpr std::string_view NAMED{"disk {} full"};
+			const std::string longName(1'000, 'x');
+
+			REQUIRE(filter.observe(1, NAMED.data(), spdlog::level::info, NAMED, start, std::string_view{longName}).write);
+			REQUIRE_FALSE(filter.observe(1, NAMED.data(), spdlog::level::info, NAMED, start, std::string_view{longName}).write);
+
+			THEN("the reported arguments survive the next record being stored")
+			{
+				const std::string otherName(1'000, 'y');
+				const RepeatFilter::Verdict verdict{
+					filter.observe(1, NAMED.data(), spdlog::level::info, NAMED, start, std::string_view{otherName})};
+
+				CHECK((verdict.run.repeats == 1));
+				CHECK((message(verdict.run) == "disk " + longName + " full"));
+			}
+		}
+
+		WHEN("a run is still open")
+		{
+			REQUIRE(filter.observe(1, FORMAT.data(), spdlog::level::info, FORMAT, start, 1).write);
+			REQUIRE_FALSE(filter.observe(1, FORMAT.data(), spdlog::level::info, FORMAT, start + std::chrono::milliseconds{1}, 1).write);
+
+			THEN("reportOpen hands it over and the next record is written")
+			{
+				std::vector<std::string> reported{};
+				RepeatFilter::reportOpen([&reported](const RepeatFilter::Run &run) { reported.push_back(message(run)); });
+
+				CHECK((reported == std::vector<std::string>{"disk 1 full"}));
+				CHECK(filter.observe(1, FORMAT.data(), spdlog::level::info, FORMAT, start + std::chrono::milliseconds{2}, 1).write);
+			}
+		}
+	}
+
+	GIVEN("a thread that exits with a run still open")
+	{
+		// Filters destroyed by the sections above may have left runs of their own
+		RepeatFilter::reportOrphaned([](const RepeatFilter::Run &) {});
+
+		std::thread{[&FORMAT, &start] {
+			RepeatFilter filter{std::chrono::seconds{1}};
+			static_cast<void>(filter.observe(1, FORMAT.data(), spdlog::level::warn, FORMAT, start, 7));
+			static_cast<void>(filter.observe(1, FORMAT.data(), spdlog::level::warn, FORMAT, start, 7));
+		}}.join();
+
+		THEN("the run is kept until it is reported")
+		{
+			REQUIRE(RepeatFilter::hasOrphaned());
+
+			std::vector<std::string> reported{};
+			RepeatFilter::reportOrphaned([&reported](const RepeatFilter::Run &run) { reported.push_back(message(run)); });
+
+			CHECK((reported == std::vector<std::string>{"disk 7 full"}));
+			CHECK_FALSE(RepeatFilter::hasOrphaned());
+		}
+	}
+}
+
+// NOLINTEND(misc-const-correctness,cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers,readability-function-cognitive-complexity)
@@ -0,0 +1,261 @@
+/*! @file rotatingFile.test.cpp
+	@brief Catch2 BDD unit tests for the rotating log file and its background segment archiver.
+	@details Every test works in its own scratch directory so segments can be counted by listing it. The archiver finishes every queued
+   segment before the file's destructor returns, so the checks run after the file is destroyed.
+	@date --/--/----
+	@version x.x.x
+	@since x.x.x
+	@author Matthew Moore
+*/
+
+#include "Utility/Debug/Logging/rotatingFile.h"
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <zlib.h>
+
+#include "Core/attributeMacros.h"
+#include "Utility/Debug/Logging/loggerOptions.h"
+
+#include <catch2/catch_test_macros.hpp>
+#include <spdlog/common.h>
+
+namespace Logging = Project::Utility::Debug::Logging;
+
+using Logging::RotatingFile;
+using Logging::RotationOptions;
+
+// NOLINTBEGIN(misc-const-correctness,cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers,readability-function-cognitive-complexity)
+
+namespace
+{
+	/*! @brief Reads the full contents of a file, decompressing it first if it is gzipped.
+		@param[in] path The file to read.
+		@return The file contents as a string.
+	*/
+	ATTR_NODISCARD std::string readFile(const std::filesystem::path &path) // NOLINT(llvm-prefer-static-over-anonymous-namespace)
+	{
+		if (path.extension() != ".gz")
+		{
+			std::ifstream file(path, std::ios::binary);
+			std::ostringstream contents;
+			contents << file.rdbuf();
+			return contents.str();
+		}
+
+		std::string contents{};
+		gzFile file{::gzopen(path.c_str(), "rb")};
+		std::array<char, 4'096> chunk{};
+		int count{0};
+
+		while ((count = ::gzread(file, chunk.data(), static_cast<unsigned>(chunk.size()))) > 0)
+		{
+			contents.append(chunk.data(), static_cast<std::size_t>(count));
+		}
+
+		static_cast<void>(::gzclose(file));
+		return contents;
+	}
+
+	/*! @brief Lists the rotated segments of @p active in name order, which is rotation order.
+		@param[in] active The active log file.
+		@return The segment paths.
+	*/
+	ATTR_NODISCARD std::vector<std::filesystem::path> segmentsOf(const std::filesystem::path &active) // NOLINT(llvm-prefer-static-over-anonymous-namespace)
+	{
+		std::vector<std::filesystem::path> segments{};
+
+		for (const std::filesystem::directory_entry &entry : std::filesystem::directory_iterator{active.parent_path()})
+		{
+			if (RotatingFile::isSegment(active, entry.path()))
+			{
+				segments.push_back(entry.path());
+			}
+		}
+
+		std::ranges::sort(segments);
+		return segments;
+	}
+
+	/*! @brief Writes @p text through @p file.
+		@param[in,out] file The file under test.
+		@param[in] text The bytes to write.
+	*/
+	void write(RotatingFile &file, const std::string &text) // NOLINT(llvm-prefer-static-over-anonymous-namespace)
+	{
+		spdlog::memory_buf_t bytes{};
+		bytes.append(text.data(), text.data() + text.size());
+		file.write(bytes);
+	}
+
+	/*! @brief Builds the 30-byte record number @p index.
+		@param[in] index The record number.
+		@return The record, newline included.
+	*/
+	ATTR_NODISCARD std::string record(const int index) // NOLINT(llvm-prefer-static-over-anonymous-namespace)
+	{
+		std::string text{"record " + std::to_string(index)};
+		text.resize(29, '.');
+		return text + '\n';
+	}
+} // namespace
+
+SCENARIO("RotatingFile")
+{
+	const std::filesystem::path directory{"rotating_file_test"};
+	const std::filesystem::path active{directory / "rotating.log"};
+
+	std::filesystem::remove_all(directory);
+	REQUIRE(std::filesystem::create_directory(directory));
+
+	GIVEN("segment names")
+	{
+		THEN("they embed the UTC rotation time and a fixed-width sequence, and are recognised compressed or not")
+		{
+			const std::chrono::sys_seconds time{std::chrono::seconds{1'700'000'000}};
+			const std::filesystem::path segment{RotatingFile::segmentPath(active, time, 7)};
+
+			CHECK((segment == directory / "rotating.20231114T221320.007.log"));
+			CHECK(RotatingFile::isSegment(active, segment));
+			CHECK(RotatingFile::isSegment(active, directory / "rotating.20231114T221320.007.log.gz"));
+			CHECK_FALSE(RotatingFile::isSegment(active, active));
+			CHECK_FALSE(RotatingFile::isSegment(active, directory / "rotating.2023.log"));
+			CHECK_FALSE(RotatingFile::isSegment(active, directory / "other.20231114T221320.007.log"));
+			CHECK_FALSE(RotatingFile::isSegment(active, directory / "rotating.20231114T221320.007.log.gz.tmp"));
+		}
+	}
+
+	GIVEN("a size limit")
+	{
+		THEN("the file rotates before a write would cross it and no record is lost or reordered")
+		{
+			std::string expected{};
+
+			{
+				RotatingFile file{active.string(), RotationOptions{.maxBytes = 100}};
+
+				for (int index{0}; index < 10; ++index)
+				{
+					write(file, record(index));
+					expected += record(index);
+				}
+			}
+
+			const std::vector<std::filesystem::path> segments{segmentsOf(active)};
+			REQUIRE((segments.size() == 3));
+
+			std::string contents{};
+
+			for (const std::filesystem::path &segment : segments)
+			{
+				CHECK((std::filesystem::file_size(segment) <= 100));
+				contents += readFile(segment);
+			}
+
+			contents += readFile(active);
+			CHECK((contents == expected));
+		}
+
+		THEN("compressed segments replace the originals and decompress to the same records")
+		{
+			std::string expected{};
+
+			{
+				RotatingFile file{active.string(), RotationOptions{.maxBytes = 100, .compress = true}};
+
+				for (int index{0}; index < 10; ++index)
+				{
+					write(file, record(index));
+					expected += record(index);
+				}
+			}
+
+			const std::vector<std::filesystem::path> segments{segmentsOf(active)};
+			REQUIRE((segments.size() == 3));
+
+			std::string contents{};
+
+			for (const std::filesystem::path &segment : segments)
+			{
+				CHECK((segment.extension() == ".gz"));
+				contents += readFile(segment);
+			}
+
+			contents += readFile(active);
+			CHECK((contents == expected));
+		}
+
+		THEN("only the newest segments are kept")
+		{
+			{
+				RotatingFile file{active.string(), RotationOptions{.maxBytes = 30, .maxFiles = 2}};
+
+				for (int index{0}; index < 10; ++index)
+				{
+					write(file, record(index));
+				}
+			}
+
+			const std::vector<std::filesystem::path> segments{segmentsOf(active)};
+			REQUIRE((segments.size() == 2));
+			CHECK((readFile(segments[0]) == record(7)));
+			CHECK((readFile(segments[1]) == record(8)));
+			CHECK((readFile(active) == record(9)));
+		}
+	}
+
+	GIVEN("a time interval")
+	{
+		THEN("a file last written before the current boundary is rotated by the first write")
+		{
+			std::ofstream{active} << "yesterday\n";
+			std::filesystem::last_write_time(active, std::filesystem::file_time_type::clock::now() - std::chrono::hours{2});
+
+			{
+				RotatingFile file{active.string(), RotationOptions{.interval = std::chrono::hours{1}}};
+				write(file, "today\n");
+			}
+
+			const std::vector<std::filesystem::path> segments{segmentsOf(active)};
+			REQUIRE((segments.size() == 1));
+			CHECK((readFile(segments[0]) == "yesterday\n"));
+			CHECK((readFile(active) == "today\n"));
+		}
+
+		THEN("a file written within the current boundary keeps growing")
+		{
+			{
+				RotatingFile file{active.string(), RotationOptions{.interval = std::chrono::hours{24}}};
+				write(file, "first\n");
+				write(file, "second\n");
+			}
+
+			CHECK(segmentsOf(active).empty());
+			CHECK((readFile(active) == "first\nsecond\n"));
+		}
+	}
+
+	GIVEN("an unopenable file")
+	{
+		THEN("construction throws spdlog_ex")
+		{
+			// A regular file used as a directory component cannot be created or opened, even with elevated privileges
+			const std::filesystem::path notADirectory{directory / "not_a_directory"};
+			std::ofstream{notADirectory}.close();
+
+			CHECK_THROWS_AS(RotatingFile((notADirectory / "rotating.log").string(), RotationOptions{.maxBytes = 100}), spdlog::spdlog_ex);
+		}
+	}
+
+	// Scenario-level cleanup
+	std::filesystem::remove_all(directory);
+}
+
+// NOLINTEND(misc-const-correctness,cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers,readability-function-cognitive-complexity)
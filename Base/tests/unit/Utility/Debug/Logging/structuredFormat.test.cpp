@@ -0,0 +1,119 @@
+/*! @file structuredFormat.test.cpp
+	@brief Catch2 BDD unit tests for the structured record encoders.
+	@details Records are encoded with a fixed timestamp so whole lines can be compared.
+	@date --/--/----
+	@version x.x.x
+	@since x.x.x
+	@author Matthew Moore
+*/
+
+#include "Utility/Debug/Logging/structuredFormat.h"
+
+#include <chrono>
+#include <cstdint>
+#include <limits>
+#include <string>
+#include <string_view>
+
+#include "Core/attributeMacros.h"
+#include "Utility/Debug/Logging/loggerOptions.h"
+
+#include <catch2/catch_test_macros.hpp>
+#include <spdlog/common.h>
+
+namespace Structured = Project::Utility::Debug::Logging::Structured;
+
+using Project::Utility::Debug::Logging::RecordFormat;
+using Structured::kv;
+
+// NOLINTBEGIN(misc-const-correctness,cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers,readability-function-cognitive-complexity)
+
+namespace
+{
+	/*! @brief 2023-11-14T22:13:20.000042Z. */
+	const spdlog::log_clock::time_point FIXED_TIME{std::chrono::seconds{1'700'000'000} + std::chrono::microseconds{42}};
+
+	/*! @brief Encodes a record at the info level from logger `app` with the fixed timestamp.
+		@tparam T The stored value types of the fields.
+		@param[in] format The record layout.
+		@param[in] message The record's message.
+		@param[in] fields The record's fields.
+		@return The encoded record.
+	*/
+	template <typename... T>
+	ATTR_NODISCARD std::string encode(const RecordFormat format, const std::string_view message, const Structured::Field<T> &...fields)
+	{
+		spdlog::memory_buf_t buffer{};
+		Structured::encode(buffer, format, FIXED_TIME, spdlog::level::info, "app", message, fields...);
+		return {buffer.data(), buffer.size()};
+	}
+} // namespace
+
+SCENARIO("Structured record encoding")
+{
+	GIVEN("fields of every supported type")
+	{
+		THEN("JSON Lines writes numbers and booleans bare and strings quoted")
+		{
+			const std::string record{encode(RecordFormat::JsonLines, "done", kv("count", static_cast<std::uint8_t>(7)), kv("delta", -3L),
+											kv("ratio", 0.25), kv("ok", true), kv("grade", 'A'), kv("path", std::string{"/x"}))};
+
+			CHECK((record == R"({"ts":"2023-11-14T22:13:20.000042Z","level":"info","logger":"app","msg":"done",)"
+							 R"("count":7,"delta":-3,"ratio":0.25,"ok":true,"grade":"A","path":"/x"})"));
+		}
+
+		THEN("logfmt writes the same fields as key=value pairs")
+		{
+			const std::string record{encode(RecordFormat::Logfmt, "done", kv("count", 7U), kv("ok", false), kv("path", "/x"))};
+
+			CHECK((record == "ts=2023-11-14T22:13:20.000042Z level=info logger=app msg=done count=7 ok=false path=/x"));
+		}
+
+		THEN("text writes the message followed by logfmt pairs")
+		{
+			CHECK((encode(RecordFormat::Text, "done", kv("count", 7), kv("path", "/x")) == "done count=7 path=/x"));
+			CHECK((encode(RecordFormat::Text, "no fields") == "no fields"));
+		}
+	}
+
+	GIVEN("strings that need escaping")
+	{
+		THEN("JSON escapes quotes, backslashes and control characters and passes UTF-8 through")
+		{
+			spdlog::memory_buf_t buffer{};
+			Structured::appendJsonString(buffer, "a\"b\\c\nd\te\x01 \xC3\xA9");
+
+			CHECK((std::string_view{buffer.data(), buffer.size()} == R"("a\"b\\c\nd\te\u0001 )"
+																	  "\xC3\xA9\""));
+		}
+
+		THEN("logfmt quotes only empty values and values with spaces, equals signs, quotes or control characters")
+		{
+			const auto logfmt = [](const std::string_view text) {
+				spdlog::memory_buf_t buffer{};
+				Structured::appendLogfmtString(buffer, text);
+				return std::string{buffer.data(), buffer.size()};
+			};
+
+			CHECK((logfmt("plain/value") == "plain/value"));
+			CHECK((logfmt("") == R"("")"));
+			CHECK((logfmt("a b") == R"("a b")"));
+			CHECK((logfmt("a=b") == R"("a=b")"));
+			CHECK((logfmt("say \"hi\"") == R"("say \"hi\"")"));
+			CHECK((logfmt("line\n") == R"("line\n")"));
+		}
+	}
+
+	GIVEN("non-finite floating-point values")
+	{
+		THEN("JSON writes null and logfmt writes fmt's spelling")
+		{
+			const double infinity{std::numeric_limits<double>::infinity()};
+
+			CHECK(encode(RecordFormat::JsonLines, "m", kv("x", infinity)).ends_with(R"("x":null})"));
+			CHECK(encode(RecordFormat::Logfmt, "m", kv("x", infinity)).ends_with(" x=inf"));
+		}
+	}
+}
+
+// NOLINTEND(misc-const-correctness,cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers,readability-function-cognitive-complexity)
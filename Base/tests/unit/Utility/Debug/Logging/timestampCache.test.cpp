@@ -0,0 +1,75 @@
+/*! @file timestampCache.test.cpp
+	@brief Catch2 BDD unit tests for the formatter that rewrites only the changed part of a record's timestamp text.
+	@date --/--/----
+	@version x.x.x
+	@since x.x.x
+	@author Matthew Moore
+*/
+
+#include "Utility/Debug/Logging/timestampCache.h"
+
+#include <chrono>
+#include <string>
+
+#include <catch2/catch_test_macros.hpp>
+#include <spdlog/common.h>
+
+namespace Logging = Project::Utility::Debug::Logging;
+
+using Logging::TimestampCache;
+
+// NOLINTBEGIN(misc-const-correctness,cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers,readability-function-cognitive-complexity)
+
+namespace
+{
+	/*! @brief Builds a UTC time point.
+		@param[in] date The calendar date.
+		@param[in] time The time of day.
+		@return The time point.
+	*/
+	spdlog::log_clock::time_point at(const std::chrono::year_month_day date, // NOLINT(llvm-prefer-static-over-anonymous-namespace)
+									 const std::chrono::microseconds time)
+	{
+		return spdlog::log_clock::time_point{std::chrono::duration_cast<spdlog::log_clock::duration>(std::chrono::sys_days{date}.time_since_epoch() + time)};
+	}
+} // namespace
+
+SCENARIO("TimestampCache formats RFC 3339 UTC timestamps", "[utility][debug][logging][timestampCache]")
+{
+	GIVEN("a cache")
+	{
+		using namespace std::chrono_literals;
+
+		TimestampCache cache{};
+		const std::chrono::year_month_day date{std::chrono::year{2024} / std::chrono::May / 1};
+
+		THEN("the first call formats the whole timestamp")
+		{
+			CHECK((std::string{cache.format(at(date, 12h + 34min + 56s + 789'012us))} == "2024-05-01T12:34:56.789012Z"));
+			CHECK((cache.format(at(date, 0us)).size() == TimestampCache::LENGTH));
+		}
+
+		THEN("later calls in the same second change only the fraction, and a new second changes the rest")
+		{
+			CHECK((std::string{cache.format(at(date, 12h + 34min + 56s + 5us))} == "2024-05-01T12:34:56.000005Z"));
+			CHECK((std::string{cache.format(at(date, 12h + 34min + 56s + 999'999us))} == "2024-05-01T12:34:56.999999Z"));
+			CHECK((std::string{cache.format(at(date, 12h + 34min + 57s))} == "2024-05-01T12:34:57.000000Z"));
+			CHECK((std::string{cache.format(at(date, 23h + 59min + 59s + 1us))} == "2024-05-01T23:59:59.000001Z"));
+			CHECK((std::string{cache.format(at(date, 24h))} == "2024-05-02T00:00:00.000000Z"));
+		}
+
+		THEN("time going backwards is formatted correctly too")
+		{
+			CHECK((std::string{cache.format(at(date, 10s + 1us))} == "2024-05-01T00:00:10.000001Z"));
+			CHECK((std::string{cache.format(at(date, 9s + 2us))} == "2024-05-01T00:00:09.000002Z"));
+		}
+
+		THEN("times before the epoch round down to the earlier second")
+		{
+			const spdlog::log_clock::time_point beforeEpoch{std::chrono::duration_cast<spdlog::log_clock::duration>(-500'000us)};
+			CHECK((std::string{cache.format(beforeEpoch)} == "1969-12-31T23:59:59.500000Z"));
+		}
+	}
+}
+
+// NOLINTEND(misc-const-correctness,cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers,readability-function-cognitive-complexity)
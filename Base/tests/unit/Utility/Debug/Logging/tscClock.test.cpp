@@ -0,0 +1,81 @@
+/*! @file tscClock.test.cpp
+	@brief Catch2 BDD unit tests for the clock that stamps log records from the CPU's time-stamp counter.
+	@details Whether the counter is used depends on the machine, so every check holds for both the counter and the system-clock fallback.
+	@date --/--/----
+	@version x.x.x
+	@since x.x.x
+	@author Matthew Moore
+*/
+
+#include "Utility/Debug/Logging/tscClock.h"
+
+#include <chrono>
+#include <thread>
+
+#include "Utility/Debug/Logging/loggerOptions.h"
+
+#include <catch2/catch_test_macros.hpp>
+#include <spdlog/common.h>
+
+namespace Logging = Project::Utility::Debug::Logging;
+
+using Logging::TscClock;
+
+// NOLINTBEGIN(misc-const-correctness,cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers,readability-function-cognitive-complexity)
+
+namespace
+{
+	/*! @brief How far the clock may stray from the system clock: a calibration error over one anchor interval, plus scheduling noise. */
+	constexpr std::chrono::milliseconds TOLERANCE{20};
+
+	/*! @brief Tests whether @p time is within @ref TOLERANCE of the system clock now.
+		@param[in] time The time to test.
+		@return true if the two are close.
+	*/
+	bool closeToSystemClock(const spdlog::log_clock::time_point time) // NOLINT(llvm-prefer-static-over-anonymous-namespace)
+	{
+		const spdlog::log_clock::time_point now{spdlog::log_clock::now()};
+
+		return time > now - TOLERANCE && time < now + TOLERANCE;
+	}
+} // namespace
+
+SCENARIO("TscClock tracks the system clock", "[utility][debug][logging][tscClock]")
+{
+	GIVEN("the process-wide calibration")
+	{
+		THEN("availability never changes once decided")
+		{
+			const bool available{TscClock::available()};
+			CHECK((TscClock::available() == available));
+		}
+
+		THEN("readings agree with the system clock")
+		{
+			CHECK(closeToSystemClock(TscClock::now()));
+			CHECK(closeToSystemClock(TscClock::now(Logging::ClockSource::Tsc)));
+			CHECK(closeToSystemClock(TscClock::now(Logging::ClockSource::System)));
+		}
+
+		THEN("readings advance with real time")
+		{
+			const spdlog::log_clock::time_point before{TscClock::now()};
+			std::this_thread::sleep_for(std::chrono::milliseconds{5});
+			const spdlog::log_clock::time_point after{TscClock::now()};
+
+			CHECK((after - before >= std::chrono::milliseconds{4}));
+			CHECK(closeToSystemClock(after));
+		}
+
+		THEN("every thread keeps its own anchor")
+		{
+			spdlog::log_clock::time_point other{};
+			std::thread thread{[&other]() { other = TscClock::now(); }};
+			thread.join();
+
+			CHECK(closeToSystemClock(other));
+		}
+	}
+}
+
+// NOLINTEND(misc-const-correctness,cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers,readability-function-cognitive-complexity)
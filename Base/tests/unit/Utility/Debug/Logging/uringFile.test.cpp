@@ -0,0 +1,182 @@
+/*! @file uringFile.test.cpp
+	@brief Catch2 BDD unit tests for the io_uring log file.
+	@details Batch buffers in these tests are tiny so that a few hundred records already fill, chain and recycle every buffer many times.
+	@date --/--/----
+	@version x.x.x
+	@since x.x.x
+	@author Matthew Moore
+*/
+
+#include "Utility/Debug/Logging/uringFile.h"
+
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <sstream>
+#include <string>
+#include <string_view>
+
+#include "Core/attributeMacros.h"
+#include "Utility/Debug/Logging/loggerOptions.h"
+
+#include <catch2/catch_test_macros.hpp>
+#include <spdlog/common.h>
+
+namespace Logging = Project::Utility::Debug::Logging;
+
+using Logging::UringFile;
+using Logging::UringOptions;
+
+// NOLINTBEGIN(misc-const-correctness,cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers,readability-function-cognitive-complexity)
+
+namespace
+{
+	/*! @brief Reads the full contents of a file.
+		@param[in] fileName The file to read.
+		@return The file contents as a string.
+	*/
+	ATTR_NODISCARD std::string readFile(const std::string &fileName) // NOLINT(llvm-prefer-static-over-anonymous-namespace)
+	{
+		std::ifstream file(fileName, std::ios::binary);
+		std::ostringstream contents;
+		contents << file.rdbuf();
+		return contents.str();
+	}
+
+	/*! @brief Writes @p text to @p file as one record.
+		@param[in,out] file The file to write to.
+		@param[in] text The record's bytes.
+	*/
+	void writeText(UringFile &file, const std::string_view text) // NOLINT(llvm-prefer-static-over-anonymous-namespace)
+	{
+		spdlog::memory_buf_t record{};
+		record.append(text.data(), std::next(text.data(), static_cast<std::ptrdiff_t>(text.size())));
+		file.write(record);
+	}
+
+	/*! @brief Writes @p count numbered records to @p file.
+		@param[in,out] file The file to write to.
+		@param[in] count The number of records.
+		@return The text the records add up to.
+	*/
+	std::string writeRecords(UringFile &file, const int count) // NOLINT(llvm-prefer-static-over-anonymous-namespace)
+	{
+		std::string expected{};
+
+		for (int i{0}; i < count; ++i)
+		{
+			const std::string record{"record " + std::string(4 - std::to_string(i).size(), '0') + std::to_string(i) + '\n'};
+			writeText(file, record);
+			expected += record;
+		}
+
+		return expected;
+	}
+
+	/*! @brief Four buffers of 64 bytes: five records fill a buffer, so batches chain and recycle constantly. */
+	constexpr UringOptions SMALL_BATCHES{.queueDepth = 4, .batchBytes = 64};
+
+	/*! @brief The pwrite fallback with the same buffer size. */
+	constexpr UringOptions FALLBACK{.queueDepth = 0, .batchBytes = 64};
+} // namespace
+
+SCENARIO("UringFile")
+{
+	const std::string fileName{"uring_file_test_output.log"};
+
+	bool fileRemoved{std::filesystem::remove(fileName)};
+	REQUIRE(!fileRemoved);
+
+	GIVEN("a ring of small batch buffers")
+	{
+		THEN("every record reaches the file in order by the time flush returns")
+		{
+			UringFile file{fileName, SMALL_BATCHES};
+			const std::string expected{writeRecords(file, 1'000)};
+			file.flush();
+
+			CHECK((readFile(fileName) == expected));
+			CHECK((file.lostRecords() == 0));
+		}
+
+		THEN("records larger than a buffer are written in place between the batched ones")
+		{
+			std::string expected{};
+
+			{
+				UringFile file{fileName, SMALL_BATCHES};
+				expected += writeRecords(file, 7);
+
+				const std::string large(200, 'x');
+				writeText(file, large);
+				expected += large;
+
+				expected += writeRecords(file, 3);
+			}
+
+			CHECK((readFile(fileName) == expected));
+		}
+
+		THEN("destruction writes the records still buffered")
+		{
+			std::string expected{};
+
+			{
+				UringFile file{fileName, SMALL_BATCHES};
+				expected = writeRecords(file, 3);
+			}
+
+			CHECK((readFile(fileName) == expected));
+		}
+	}
+
+	GIVEN("a queue depth of 0")
+	{
+		THEN("the file writes with pwrite and every record still arrives in order")
+		{
+			UringFile file{fileName, FALLBACK};
+			CHECK_FALSE(file.usingUring());
+
+			const std::string expected{writeRecords(file, 1'000)};
+			file.flush();
+
+			CHECK((readFile(fileName) == expected));
+			CHECK((file.lostRecords() == 0));
+		}
+	}
+
+	GIVEN("a file that already holds records")
+	{
+		THEN("new records are appended after them")
+		{
+			std::ofstream{fileName} << "existing\n";
+
+			{
+				UringFile file{fileName, SMALL_BATCHES};
+				writeText(file, "appended\n");
+			}
+
+			CHECK((readFile(fileName) == "existing\nappended\n"));
+		}
+	}
+
+	GIVEN("an unopenable file")
+	{
+		THEN("construction throws spdlog_ex")
+		{
+			// A regular file used as a directory component cannot be created or opened, even with elevated privileges
+			const std::string notADirectory{"uring_file_not_a_directory"};
+			std::ofstream{notADirectory}.close();
+
+			CHECK_THROWS_AS((UringFile{notADirectory + "/uring.log", SMALL_BATCHES}), spdlog::spdlog_ex);
+
+			REQUIRE(std::filesystem::remove(notADirectory));
+		}
+	}
+
+	// Scenario-level cleanup
+	fileRemoved = std::filesystem::remove(fileName);
+	static_cast<void>(fileRemoved);
+}
+
+// NOLINTEND(misc-const-correctness,cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers,readability-function-cognitive-complexity)
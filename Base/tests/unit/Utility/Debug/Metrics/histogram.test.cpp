@@ -0,0 +1,136 @@
+/*! @file histogram.test.cpp
+	@brief Catch2 BDD unit tests for the log-linear histogram metric.
+	@date --/--/----
+	@version x.x.x
+	@since x.x.x
+	@author Matthew Moore
+*/
+
+#include "Utility/Debug/Metrics/histogram.h"
+
+#include <limits>
+#include <thread>
+#include <vector>
+
+#include "Core/typedefs.h"
+
+#include <catch2/catch_test_macros.hpp>
+
+namespace Metrics = Project::Utility::Debug::Metrics;
+
+using Metrics::Histogram;
+using Project::Core::ul;
+
+// NOLINTBEGIN(misc-const-correctness,cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers,readability-function-cognitive-complexity)
+
+SCENARIO("Histogram buckets values log-linearly", "[utility][debug][metrics][histogram]")
+{
+	GIVEN("the bucket layout")
+	{
+		THEN("values below eight get a bucket each")
+		{
+			for (ul value{0}; value < Histogram::SUB_BUCKETS; ++value)
+			{
+				CHECK((Histogram::bucketIndex(value) == value));
+				CHECK((Histogram::bucketUpperBound(value) == value));
+			}
+		}
+
+		THEN("each power of two is split into eight buckets")
+		{
+			CHECK((Histogram::bucketIndex(8) == 8));
+			CHECK((Histogram::bucketIndex(15) == 15));
+			CHECK((Histogram::bucketIndex(16) == 16));
+			CHECK((Histogram::bucketIndex(17) == 16));
+			CHECK((Histogram::bucketIndex(18) == 17));
+			CHECK((Histogram::bucketUpperBound(16) == 17));
+			CHECK((Histogram::bucketUpperBound(Histogram::bucketIndex(1'000)) >= 1'000));
+		}
+
+		THEN("every value falls in a bucket whose bounds contain it, at most an eighth wide")
+		{
+			for (ul value{1}; value < 100'000; value = value * 3 / 2 + 1)
+			{
+				const ul bucket{Histogram::bucketIndex(value)};
+				const ul lower{bucket == 0 ? 0 : Histogram::bucketUpperBound(bucket - 1) + 1};
+
+				CHECK((lower <= value));
+				CHECK((value <= Histogram::bucketUpperBound(bucket)));
+				CHECK((Histogram::bucketUpperBound(bucket) - lower <= lower / 8));
+			}
+		}
+
+		THEN("the largest value lands in the last bucket")
+		{
+			CHECK((Histogram::bucketIndex(std::numeric_limits<ul>::max()) == Histogram::BUCKETS - 1));
+			CHECK((Histogram::bucketUpperBound(Histogram::BUCKETS - 1) == std::numeric_limits<ul>::max()));
+		}
+	}
+
+	GIVEN("a histogram")
+	{
+		Histogram histogram{};
+
+		THEN("an empty snapshot has no values")
+		{
+			const Histogram::Snapshot snapshot{histogram.snapshot()};
+
+			CHECK((snapshot.count == 0));
+			CHECK((snapshot.sum == 0));
+			CHECK((snapshot.quantile(0.5) == 0));
+		}
+
+		WHEN("values from 1 to 100 are recorded")
+		{
+			for (ul value{1}; value <= 100; ++value)
+			{
+				histogram.record(value);
+			}
+
+			const Histogram::Snapshot snapshot{histogram.snapshot()};
+
+			THEN("the count and sum are exact")
+			{
+				CHECK((snapshot.count == 100));
+				CHECK((snapshot.sum == 5'050));
+			}
+
+			THEN("quantiles are the upper bound of the bucket holding them")
+			{
+				CHECK((snapshot.quantile(0.0) == 1));
+				CHECK((snapshot.quantile(0.5) == Histogram::bucketUpperBound(Histogram::bucketIndex(50))));
+				CHECK((snapshot.quantile(1.0) == Histogram::bucketUpperBound(Histogram::bucketIndex(100))));
+			}
+		}
+
+		WHEN("several threads record at once")
+		{
+			std::vector<std::thread> threads{};
+
+			for (int thread{0}; thread < 4; ++thread)
+			{
+				threads.emplace_back([&histogram] {
+					for (ul i{0}; i < 10'000; ++i)
+					{
+						histogram.record(i % 64);
+					}
+				});
+			}
+
+			for (std::thread &thread : threads)
+			{
+				thread.join();
+			}
+
+			THEN("no value is lost")
+			{
+				const Histogram::Snapshot snapshot{histogram.snapshot()};
+
+				CHECK((snapshot.count == 40'000));
+				CHECK((snapshot.buckets[Histogram::bucketIndex(63)] != 0));
+			}
+		}
+	}
+}
+
+// NOLINTEND(misc-const-correctness,cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers,readability-function-cognitive-complexity)
@@ -0,0 +1,142 @@
+/*! @file metricsExporter.test.cpp
+	@brief Catch2 BDD unit tests for the exporter that writes metrics snapshots in the Prometheus text format or as JSON lines.
+	@date --/--/----
+	@version x.x.x
+	@since x.x.x
+	@author Matthew Moore
+*/
+
+#include "Utility/Debug/Metrics/metricsExporter.h"
+
+#include <algorithm>
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <thread>
+
+#include "Utility/Debug/Metrics/metricsOptions.h"
+#include "Utility/Debug/Metrics/registry.h"
+
+#include <catch2/catch_test_macros.hpp>
+#include <spdlog/common.h>
+
+namespace Metrics = Project::Utility::Debug::Metrics;
+
+using Metrics::MetricsExporter;
+using Metrics::Registry;
+
+// NOLINTBEGIN(misc-const-correctness,cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers,readability-function-cognitive-complexity)
+
+namespace
+{
+	/*! @brief Reads a whole file.
+		@param fileName The file.
+		@return The contents.
+	*/
+	std::string readFile(const std::string &fileName) // NOLINT(llvm-prefer-static-over-anonymous-namespace)
+	{
+		std::ifstream file(fileName);
+		std::ostringstream contents;
+		contents << file.rdbuf();
+		return contents.str();
+	}
+} // namespace
+
+SCENARIO("MetricsExporter", "[utility][debug][metrics][metricsExporter]")
+{
+	const std::string fileName{"metrics_exporter_test.out"};
+	std::filesystem::remove(fileName);
+
+	Registry registry{};
+	registry.counter("requests_total", "Requests served\nby \\ everyone").add(3);
+	registry.gauge("queue_depth").set(-4);
+
+	Metrics::Histogram &latency{registry.histogram("latency_ns", "Request latency")};
+	latency.record(5);
+	latency.record(100);
+	latency.record(100);
+
+	GIVEN("the Prometheus format")
+	{
+		THEN("the snapshot follows the text exposition format")
+		{
+			spdlog::memory_buf_t buffer{};
+			MetricsExporter::renderPrometheus(registry.snapshot(), buffer);
+			const std::string text{buffer.data(), buffer.size()};
+
+			CHECK(text.contains("# HELP requests_total Requests served\\nby \\\\ everyone\n# TYPE requests_total counter\nrequests_total 3\n"));
+			CHECK(text.contains("# TYPE queue_depth gauge\nqueue_depth -4\n"));
+			CHECK(text.contains("# TYPE latency_ns histogram\nlatency_ns_bucket{le=\"5\"} 1\nlatency_ns_bucket{le=\"103\"} 3\n"));
+			CHECK(text.contains("latency_ns_bucket{le=\"+Inf\"} 3\nlatency_ns_sum 205\nlatency_ns_count 3\n"));
+		}
+
+		THEN("each export replaces the file with the latest snapshot")
+		{
+			{
+				MetricsExporter exporter{registry, fileName, Metrics::ExportOptions{.interval = std::chrono::milliseconds::zero()}};
+
+				REQUIRE(exporter.exportNow());
+				registry.counter("requests_total").add(1);
+				REQUIRE(exporter.exportNow());
+				CHECK((exporter.getFailedExports() == 0));
+			}
+
+			const std::string contents{readFile(fileName)};
+
+			CHECK((std::ranges::count(contents, '#') == 5));
+			CHECK(contents.contains("requests_total 4\n"));
+			CHECK_FALSE(std::filesystem::exists(fileName + ".tmp"));
+		}
+
+		THEN("a file that cannot be written counts as a failed export")
+		{
+			// A regular file where the directory should be makes the write fail whatever the permissions
+			std::ofstream{fileName} << "not a directory";
+
+			{
+				MetricsExporter exporter{registry, fileName + "/metrics.prom", Metrics::ExportOptions{.interval = std::chrono::milliseconds::zero()}};
+
+				CHECK_FALSE(exporter.exportNow());
+				CHECK((exporter.getFailedExports() == 1));
+			}
+
+			CHECK((readFile(fileName) == "not a directory"));
+		}
+	}
+
+	GIVEN("the JSON lines format")
+	{
+		THEN("the snapshot is one line of JSON")
+		{
+			spdlog::memory_buf_t buffer{};
+			MetricsExporter::renderJson(registry.snapshot(), spdlog::log_clock::time_point{}, buffer);
+			const std::string text{buffer.data(), buffer.size()};
+
+			CHECK((text == R"({"ts":"1970-01-01T00:00:00.000000Z","counters":{"requests_total":3},"gauges":{"queue_depth":-4},)"
+						   R"("histograms":{"latency_ns":{"count":3,"sum":205,"p50":103,"p90":103,"p99":103,"p999":103,)"
+						   R"("buckets":[[5,1],[103,2]]}}})"
+						   "\n"));
+		}
+
+		THEN("the exporter thread appends a snapshot every interval and a last one when it stops")
+		{
+			{
+				MetricsExporter exporter{registry, fileName,
+										 Metrics::ExportOptions{.format = Metrics::ExportFormat::JsonLines, .interval = std::chrono::milliseconds{5}}};
+
+				std::this_thread::sleep_for(std::chrono::milliseconds{50});
+			}
+
+			const std::string contents{readFile(fileName)};
+
+			CHECK((std::ranges::count(contents, '\n') >= 2));
+			CHECK(contents.ends_with("}}}\n"));
+		}
+	}
+
+	std::filesystem::remove(fileName);
+}
+
+// NOLINTEND(misc-const-correctness,cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers,readability-function-cognitive-complexity)
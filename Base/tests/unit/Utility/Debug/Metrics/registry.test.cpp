@@ -0,0 +1,130 @@
+/*! @file registry.test.cpp
+	@brief Catch2 BDD unit tests for the metrics registry and the counters and gauges it hands out.
+	@date --/--/----
+	@version x.x.x
+	@since x.x.x
+	@author Matthew Moore
+*/
+
+#include "Utility/Debug/Metrics/registry.h"
+
+#include <bit>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include "Core/typedefs.h"
+#include "Utility/Debug/Metrics/constants.h"
+#include "Utility/Debug/Metrics/shards.h"
+
+#include <catch2/catch_test_macros.hpp>
+
+namespace Metrics = Project::Utility::Debug::Metrics;
+
+using Metrics::Registry;
+using Metrics::Shards;
+using Project::Core::ul;
+
+// NOLINTBEGIN(misc-const-correctness,cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers,readability-function-cognitive-complexity)
+
+SCENARIO("Metrics registry", "[utility][debug][metrics][registry]")
+{
+	GIVEN("the shard layout")
+	{
+		THEN("the shard count is a power of two within the limit")
+		{
+			CHECK(std::has_single_bit(Shards::count()));
+			CHECK((Shards::count() <= Metrics::METRICS_MAX_SHARDS));
+			CHECK((Shards::current(Shards::count() - 1) < Shards::count()));
+		}
+	}
+
+	GIVEN("a registry")
+	{
+		Registry registry{};
+
+		THEN("looking a metric up twice returns the same one")
+		{
+			Metrics::Counter &first{registry.counter("requests_total", "Requests served")};
+			Metrics::Counter &second{registry.counter("requests_total")};
+
+			CHECK((&first == &second));
+		}
+
+		THEN("a name taken by another type or breaking the naming rules is rejected")
+		{
+			static_cast<void>(registry.counter("queue_total"));
+
+			CHECK_THROWS_AS(static_cast<void>(registry.gauge("queue_total")), std::invalid_argument);
+			CHECK_THROWS_AS(static_cast<void>(registry.histogram("9lives")), std::invalid_argument);
+			CHECK_THROWS_AS(static_cast<void>(registry.counter("has space")), std::invalid_argument);
+			CHECK_THROWS_AS(static_cast<void>(registry.counter("")), std::invalid_argument);
+			CHECK(Registry::validName("http:requests_total"));
+		}
+
+		THEN("counters sum the increments of every thread")
+		{
+			Metrics::Counter &counter{registry.counter("work_total")};
+			std::vector<std::thread> threads{};
+
+			for (int thread{0}; thread < 4; ++thread)
+			{
+				threads.emplace_back([&counter] {
+					for (int i{0}; i < 10'000; ++i)
+					{
+						counter.add();
+					}
+				});
+			}
+
+			for (std::thread &thread : threads)
+			{
+				thread.join();
+			}
+
+			counter.add(5);
+			CHECK((counter.value() == 40'005));
+		}
+
+		THEN("gauges go up, down and can be replaced")
+		{
+			Metrics::Gauge &gauge{registry.gauge("queue_depth")};
+
+			gauge.add(10);
+			gauge.subtract(3);
+			CHECK((gauge.value() == 7));
+
+			gauge.set(-2);
+			CHECK((gauge.value() == -2));
+		}
+
+		THEN("a snapshot lists every metric in registration order")
+		{
+			registry.counter("b_total").add(2);
+			registry.counter("a_total", "First").add(1);
+			registry.gauge("level").set(4);
+			registry.histogram("latency_ns").record(100);
+
+			const Registry::Snapshot snapshot{registry.snapshot()};
+
+			REQUIRE((snapshot.counters.size() == 2));
+			CHECK((snapshot.counters[0].name == "b_total"));
+			CHECK((snapshot.counters[1].help == "First"));
+			CHECK((snapshot.counters[1].value == 1));
+			REQUIRE((snapshot.gauges.size() == 1));
+			CHECK((snapshot.gauges[0].value == 4));
+			REQUIRE((snapshot.histograms.size() == 1));
+			CHECK((snapshot.histograms[0].histogram.count == 1));
+		}
+	}
+
+	GIVEN("the global registry")
+	{
+		THEN("it is the same object every time")
+		{
+			CHECK((&Registry::global() == &Registry::global()));
+		}
+	}
+}
+
+// NOLINTEND(misc-const-correctness,cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers,readability-function-cognitive-complexity)
@@ -0,0 +1,55 @@
+/*! @file logDecoder.cpp
+	@brief Contains the entry point of the tool that converts binary log files into text
+	@date --/--/----
+	@version x.x.x
+	@since x.x.x
+	@author Matthew Moore
+*/
+
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <optional>
+#include <span>
+#include <string>
+#include <string_view>
+
+#include "Utility/Debug/Logging/binaryDecoder.h"
+
+/*! @brief Decodes the binary log named on the command line to standard output.
+	@details Usage: `logDecoder <binary log file> [spdlog pattern]`. Without a pattern the output matches spdlog's default pattern.
+	@date --/--/----
+	@version x.x.x
+	@since x.x.x
+	@author Matthew Moore
+	@return int EXIT_SUCCESS if the whole file was decoded, otherwise EXIT_FAILURE
+*/
+int main(int argc, char **argv)
+{
+	const std::span<char *> arguments{argv, static_cast<std::size_t>(argc)};
+
+	if (arguments.size() < 2 || arguments.size() > 3)
+	{
+		std::cerr << "Usage: " << (arguments.empty() ? "logDecoder" : arguments[0]) << " <binary log file> [spdlog pattern]\n";
+		return EXIT_FAILURE;
+	}
+
+	std::ifstream input(arguments[1], std::ios::binary);
+
+	if (!input.is_open())
+	{
+		std::cerr << "Could not open " << arguments[1] << '\n';
+		return EXIT_FAILURE;
+	}
+
+	const std::string pattern{arguments.size() == 3 ? arguments[2] : ""};
+	const std::optional<std::string_view> failure{Project::Utility::Debug::Logging::Binary::decode(input, std::cout, pattern)};
+
+	if (failure)
+	{
+		std::cerr << *failure << '\n';
+		return EXIT_FAILURE;
+	}
+
+	return EXIT_SUCCESS;
+}